@@ -920,3 +920,59 @@ TEST_F( DataDictionaryTest, DictionaryEnumTypeDefEncodeWithFragmentation ) {
     EXPECT_FALSE( true ) <<  "unexpected exception: DataDictionary::encodeEnumTypeDictionary(fragmentationSize) failed to encode enumerated type dictionary";
   }
 }
+
+TEST_F( DataDictionaryTest, DictionarySharedDictionary ) {
+  DataDictionary publisher, sharedDictionary;
+  char errTxt[256];
+  RsslBuffer errorText = { 255, (char*)errTxt };
+
+  rsslRemoveSharedDataDictionary("emaTest", &globalRsslDataDictionary.infoField_Version, &globalRsslDataDictionary.infoEnum_DT_Version, &errorText);
+
+  try {
+    publisher.publishSharedDictionary("emaTest");
+    EXPECT_FALSE( true ) << "expected exception when publishing a dictionary that is not loaded";
+  }
+  catch (const OmmException& excp)
+  {
+    EXPECT_EQ( excp.getExceptionType(), OmmException::OmmInvalidUsageExceptionEnum )
+      << "unexpected exception type when publishing a dictionary that is not loaded";
+  }
+
+  try {
+    publisher.loadFieldDictionary(fieldDictionaryFileName);
+    publisher.loadEnumTypeDictionary(enumTableFileName);
+    publisher.publishSharedDictionary("emaTest");
+
+    sharedDictionary.loadSharedDictionary("emaTest", publisher.getFieldVersion(), publisher.getEnumDisplayTemplateVersion());
+    EXPECT_TRUE( comparingDataDictionary(&globalRsslDataDictionary, sharedDictionary) ) << "shared dictionary should equal the loaded dictionary";
+    EXPECT_EQ( sharedDictionary.getEntry("PROD_PERM").getFid(), 1 ) << "DataDictionary::getEntry(name) on a shared dictionary";
+  }
+  catch (const OmmException&)
+  {
+    EXPECT_FALSE( true ) << "unexpected exception when publishing and loading a shared dictionary";
+  }
+
+  try {
+    sharedDictionary.loadFieldDictionary(fieldDictionaryFileName);
+    EXPECT_FALSE( true ) << "expected exception when loading into a shared dictionary";
+  }
+  catch (const OmmException& excp)
+  {
+    EXPECT_EQ( excp.getExceptionType(), OmmException::OmmInvalidUsageExceptionEnum )
+      << "unexpected exception type when loading into a shared dictionary";
+  }
+
+  try {
+    sharedDictionary.clear();
+    EXPECT_EQ( sharedDictionary.getEntries().size(), 0 ) << "number of dictionary entries should be 0 after calling clear()";
+    sharedDictionary.loadSharedDictionary("emaTest", "0.0.0", publisher.getEnumDisplayTemplateVersion());
+    EXPECT_FALSE( true ) << "expected exception when loading a shared dictionary with a different version";
+  }
+  catch (const OmmException& excp)
+  {
+    EXPECT_EQ( excp.getExceptionType(), OmmException::OmmInvalidUsageExceptionEnum )
+      << "unexpected exception type when loading a shared dictionary with a different version";
+  }
+
+  rsslRemoveSharedDataDictionary("emaTest", &globalRsslDataDictionary.infoField_Version, &globalRsslDataDictionary.infoEnum_DT_Version, &errorText);
+}
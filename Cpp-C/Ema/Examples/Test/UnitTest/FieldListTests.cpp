@@ -4288,6 +4288,132 @@ TEST(FieldListTests, testFieldListEncodeEMADecodeEMARippleToRippleToName)
     rsslDeleteDataDictionary(&dictionary);
 }
 
+TEST(FieldListTests, testFieldListFind)
+{
+    RsslDataDictionary dictionary;
+
+    ASSERT_TRUE(loadDictionaryFromFile( &dictionary )) << "Failed to load dictionary";
+
+    try
+    {
+        FieldList flEnc;
+        flEnc.addReal(6, 5236, OmmReal::ExponentNeg2Enum); // TRDPRC_1
+        flEnc.addUInt(1, 64); // PROD_PERM
+        flEnc.addEnum(270, 5); // ACT_TP_1
+        flEnc.addReal(22, 5230, OmmReal::ExponentNeg2Enum); // BID
+        flEnc.addReal(25, 5240, OmmReal::ExponentNeg2Enum); // ASK
+        flEnc.complete();
+
+        StaticDecoder::setData(&flEnc, &dictionary);
+
+        EXPECT_TRUE( flEnc.find(25) ) << "FieldList::find(25)";
+        EXPECT_EQ( flEnc.getEntry().getFieldId(), 25 ) << "FieldEntry::getFieldId()";
+        EXPECT_STREQ( flEnc.getEntry().getName(), "ASK" ) << "FieldEntry::getName()";
+        EXPECT_EQ( flEnc.getEntry().getReal().getMantissa(), 5240 ) << "FieldEntry::getReal().getMantissa()";
+
+        EXPECT_TRUE( flEnc.find(1) ) << "FieldList::find(1)";
+        EXPECT_EQ( flEnc.getEntry().getUInt(), 64 ) << "FieldEntry::getUInt()";
+
+        EXPECT_FALSE( flEnc.find(3) ) << "FieldList::find(3) for a field not in the list";
+
+        // find() does not move forth() iteration
+        EXPECT_TRUE( flEnc.forth() ) << "FieldList::forth() after find()";
+        EXPECT_EQ( flEnc.getEntry().getFieldId(), 6 ) << "FieldEntry::getFieldId()";
+
+        while ( flEnc.forth() );
+
+        // entries can still be found after iteration has ended
+        EXPECT_TRUE( flEnc.find(270) ) << "FieldList::find(270) after the end of iteration";
+        EXPECT_EQ( flEnc.getEntry().getEnum(), 5 ) << "FieldEntry::getEnum()";
+        EXPECT_TRUE( flEnc.find(22) ) << "FieldList::find(22) after the end of iteration";
+        EXPECT_EQ( flEnc.getEntry().getReal().getMantissa(), 5230 ) << "FieldEntry::getReal().getMantissa()";
+
+        // find() does not restart an iteration that has ended
+        EXPECT_FALSE( flEnc.forth() ) << "FieldList::forth() after find() at the end of iteration";
+
+        flEnc.reset();
+        EXPECT_TRUE( flEnc.forth() ) << "FieldList::forth() after reset()";
+        EXPECT_EQ( flEnc.getEntry().getFieldId(), 6 ) << "FieldEntry::getFieldId()";
+
+        FieldList flEmpty;
+        flEmpty.complete();
+        StaticDecoder::setData(&flEmpty, &dictionary);
+        EXPECT_FALSE( flEmpty.find(1) ) << "FieldList::find() on an empty FieldList";
+    }
+    catch (const OmmException& excp)
+    {
+        EXPECT_FALSE( true ) << "FieldList::find() - exception not expected" << excp << endl;
+    }
+
+    rsslDeleteDataDictionary(&dictionary);
+}
+
+TEST(FieldListTests, testFieldListDecodeOnAccess)
+{
+    RsslDataDictionary dictionary;
+
+    ASSERT_TRUE(loadDictionaryFromFile( &dictionary )) << "Failed to load dictionary";
+
+    try
+    {
+        FieldList flNested;
+        flNested.addUInt(1, 128); // PROD_PERM
+        flNested.complete();
+
+        FieldList flEnc;
+        flEnc.addReal(6, 5236, OmmReal::ExponentNeg2Enum); // TRDPRC_1
+        flEnc.addUInt(1, 64); // PROD_PERM
+        flEnc.addAscii(235, EmaString("ABCDEF")); // PNAC
+        flEnc.addCodeReal(22); // BID
+        flEnc.addFieldList(-13, flNested); // MY_FIELDLIST
+        flEnc.addReal(25, 5240, OmmReal::ExponentNeg2Enum); // ASK
+        flEnc.complete();
+
+        StaticDecoder::setData(&flEnc, &dictionary);
+
+        // entries whose load is never requested are skipped without being decoded
+        int count = 0;
+        while ( flEnc.forth() )
+        {
+            ++count;
+            if ( flEnc.getEntry().getFieldId() == 235 )
+            {
+                EXPECT_STREQ( flEnc.getEntry().getName(), "PNAC" ) << "FieldEntry::getName()";
+                EXPECT_STREQ( flEnc.getEntry().getAscii(), "ABCDEF" ) << "FieldEntry::getAscii()";
+            }
+            else if ( flEnc.getEntry().getFieldId() == 22 )
+            {
+                EXPECT_EQ( flEnc.getEntry().getCode(), Data::BlankEnum ) << "FieldEntry::getCode() of blank";
+                EXPECT_EQ( flEnc.getEntry().getLoadType(), DataType::RealEnum ) << "FieldEntry::getLoadType() of blank";
+            }
+            else if ( flEnc.getEntry().getFieldId() == -13 )
+            {
+                const FieldList& fl = flEnc.getEntry().getFieldList();
+                EXPECT_TRUE( fl.forth() ) << "FieldList::forth() on nested FieldList";
+                EXPECT_EQ( fl.getEntry().getUInt(), 128 ) << "FieldEntry::getUInt() of nested FieldList";
+            }
+        }
+        EXPECT_EQ( count, 6 ) << "number of entries";
+
+        // a load is decoded once and stays valid until the next entry is reached
+        flEnc.reset();
+        EXPECT_TRUE( flEnc.forth( 25 ) ) << "FieldList::forth(25)";
+        const OmmReal& ask = flEnc.getEntry().getReal();
+        EXPECT_EQ( &flEnc.getEntry().getReal(), &ask ) << "FieldEntry::getReal() returns the same load";
+        EXPECT_EQ( ask.getMantissa(), 5240 ) << "FieldEntry::getReal().getMantissa()";
+
+        EXPECT_TRUE( flEnc.find(6) ) << "FieldList::find(6)";
+        EXPECT_EQ( flEnc.getEntry().getReal().getMantissa(), 5236 ) << "FieldEntry::getReal().getMantissa() after find()";
+        EXPECT_THROW( flEnc.getEntry().getUInt(), OmmInvalidUsageException ) << "FieldEntry::getUInt() on a Real";
+    }
+    catch (const OmmException& excp)
+    {
+        EXPECT_FALSE( true ) << "FieldList decode on access - exception not expected" << excp << endl;
+    }
+
+    rsslDeleteDataDictionary(&dictionary);
+}
+
 TEST(FieldListTests, testFieldListAddInfoAfterInitialized)
 {
 	try
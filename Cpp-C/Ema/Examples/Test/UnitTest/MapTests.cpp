@@ -7557,3 +7557,50 @@ TEST(MapTests, testMapEntryKeyUtf8WithNoPayload_Encode_Decode)
 	}
 }
 
+
+TEST(MapTests, testMapEncodeStopsAllocatingAfterWarmUp)
+{
+	try
+	{
+		// large and small Maps, the field lists they carry and refresh messages carrying them
+		// alternate; once every shape has been encoded the pooled encode buffers cover all of them
+		for ( int pass = 0; pass < 4; ++pass )
+		{
+			UInt64 allocations = EncoderStatistics::getAllocationCount();
+			UInt64 reallocations = EncoderStatistics::getReallocationCount();
+
+			for ( int shape = 0; shape < 4; ++shape )
+			{
+				UInt64 entries = shape % 2 ? 10 : 2000;
+
+				Map map;
+				FieldList fl;
+
+				for ( UInt64 key = 0; key < entries; ++key )
+				{
+					fl.clear();
+					fl.addUInt( 1, key ).addReal( 6, 5236 + key, OmmReal::ExponentNeg2Enum ).complete();
+					map.addKeyUInt( key, MapEntry::AddEnum, fl );
+				}
+
+				map.complete();
+
+				RefreshMsg refresh;
+				refresh.streamId( 5 ).name( "IBM.N" ).state( OmmState::OpenEnum, OmmState::OkEnum ).payload( map );
+
+				Map msgs;
+				msgs.addKeyUInt( shape, MapEntry::AddEnum, refresh ).complete();
+			}
+
+			if ( pass > 0 )
+			{
+				EXPECT_EQ( EncoderStatistics::getAllocationCount() - allocations, 0u ) << "Encoding allocates after warm-up";
+				EXPECT_EQ( EncoderStatistics::getReallocationCount() - reallocations, 0u ) << "Encoding reallocates after warm-up";
+			}
+		}
+	}
+	catch ( const OmmException& excp )
+	{
+		EXPECT_FALSE( true ) << "Map encoding - exception not expected" << excp;
+	}
+}
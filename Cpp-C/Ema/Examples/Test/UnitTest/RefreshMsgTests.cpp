@@ -1064,3 +1064,120 @@ TEST(RefreshMsgTests, testRefreshMsgEncodeDecodeQos)
 	EXPECT_STREQ( refreshMsg.getQos().toString(), "Timeliness: 29300/TickByTick" ) << "RefreshMsg::getQos().toString()" ;
 }
 
+
+TEST(RefreshMsgTests, testRefreshMsgCopy)
+{
+	RsslDataDictionary dictionary;
+
+	ASSERT_TRUE(loadDictionaryFromFile( &dictionary )) << "Failed to load dictionary";
+
+	try
+	{
+		RsslRefreshMsg refresh;
+		rsslClearRefreshMsg( &refresh );
+
+		refresh.msgBase.streamId = 5;
+		refresh.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+
+		char* nameData = ( char* )malloc( 6 );
+		memcpy( nameData, "ABCDEF", 6 );
+		refresh.msgBase.msgKey.name.data = nameData;
+		refresh.msgBase.msgKey.name.length = 6;
+		rsslMsgKeyApplyHasName( &refresh.msgBase.msgKey );
+		rsslRefreshMsgApplyHasMsgKey( &refresh );
+
+		RsslBuffer rsslBuf;
+		rsslBuf.length = 1000;
+		rsslBuf.data = ( char* )malloc( sizeof( char ) * 1000 );
+
+		EmaString inText;
+		encodeFieldList( rsslBuf, inText );
+
+		refresh.msgBase.encDataBody = rsslBuf;
+		refresh.msgBase.containerType = RSSL_DT_FIELD_LIST;
+
+		refresh.state.streamState = RSSL_STREAM_OPEN;
+		refresh.state.dataState = RSSL_DATA_OK;
+		refresh.state.code = RSSL_SC_NONE;
+		rsslRefreshMsgApplyRefreshComplete( &refresh );
+
+		RefreshMsg received;
+		StaticDecoder::setRsslData( &received, ( RsslMsg* )&refresh, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION, &dictionary );
+
+		RefreshMsg copy( received );
+
+		RefreshMsg assigned;
+		assigned = received;
+
+		// the copies must not refer to the memory the message was received in
+		memset( rsslBuf.data, 0, 1000 );
+		memset( nameData, 0, 6 );
+		free( rsslBuf.data );
+		free( nameData );
+
+		const RefreshMsg* msgs[2] = { &copy, &assigned };
+		for ( int i = 0; i < 2; ++i )
+		{
+			const RefreshMsg& msg = *msgs[i];
+
+			EXPECT_EQ( msg.getStreamId(), 5 ) << "RefreshMsg::getStreamId() of copy";
+			EXPECT_EQ( msg.getDomainType(), MMT_MARKET_PRICE ) << "RefreshMsg::getDomainType() of copy";
+			EXPECT_STREQ( msg.getName(), "ABCDEF" ) << "RefreshMsg::getName() of copy";
+			EXPECT_TRUE( msg.getComplete() ) << "RefreshMsg::getComplete() of copy";
+			EXPECT_EQ( msg.getState().getStreamState(), OmmState::OpenEnum ) << "RefreshMsg::getState()::getStreamState() of copy";
+			EXPECT_EQ( msg.getPayload().getDataType(), DataType::FieldListEnum ) << "RefreshMsg::getPayload()::getDataType() of copy";
+
+			const FieldList& fl = msg.getPayload().getFieldList();
+			EXPECT_TRUE( fl.forth() ) << "FieldList::forth() of copy";
+			EXPECT_EQ( fl.getEntry().getFieldId(), 1 ) << "FieldEntry::getFieldId() of copy";
+			EXPECT_EQ( fl.getEntry().getUInt(), 64 ) << "FieldEntry::getUInt() of copy";
+			EXPECT_TRUE( fl.forth() ) << "FieldList::forth() of copy";
+			EXPECT_EQ( fl.getEntry().getReal().getMantissa(), 11 ) << "FieldEntry::getReal() of copy";
+		}
+
+		// assigning a larger message over a copy replaces its buffer
+		char longName[255];
+		memset( longName, 'X', sizeof( longName ) );
+
+		char largeBody[4096];
+		memset( largeBody, 'Y', sizeof( largeBody ) );
+
+		RsslRefreshMsg largeRefresh;
+		rsslClearRefreshMsg( &largeRefresh );
+		largeRefresh.msgBase.streamId = 6;
+		largeRefresh.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+		largeRefresh.msgBase.containerType = RSSL_DT_OPAQUE;
+		largeRefresh.msgBase.encDataBody.data = largeBody;
+		largeRefresh.msgBase.encDataBody.length = sizeof( largeBody );
+		largeRefresh.msgBase.msgKey.name.data = longName;
+		largeRefresh.msgBase.msgKey.name.length = sizeof( longName );
+		rsslMsgKeyApplyHasName( &largeRefresh.msgBase.msgKey );
+		rsslRefreshMsgApplyHasMsgKey( &largeRefresh );
+		largeRefresh.state.streamState = RSSL_STREAM_OPEN;
+		largeRefresh.state.dataState = RSSL_DATA_OK;
+
+		RefreshMsg largeReceived;
+		StaticDecoder::setRsslData( &largeReceived, ( RsslMsg* )&largeRefresh, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION, &dictionary );
+
+		assigned = largeReceived;
+
+		memset( largeBody, 0, sizeof( largeBody ) );
+
+		EXPECT_EQ( assigned.getStreamId(), 6 ) << "RefreshMsg::getStreamId() of reassigned copy";
+		EXPECT_EQ( assigned.getName(), EmaString( longName, sizeof( longName ) ) ) << "RefreshMsg::getName() of reassigned copy";
+		EXPECT_EQ( assigned.getPayload().getDataType(), DataType::OpaqueEnum ) << "RefreshMsg::getPayload()::getDataType() of reassigned copy";
+		EXPECT_EQ( assigned.getPayload().getOpaque().getBuffer().length(), sizeof( largeBody ) ) << "RefreshMsg::getPayload()::getOpaque() length of reassigned copy";
+		EXPECT_EQ( assigned.getPayload().getOpaque().getBuffer().c_buf()[0], 'Y' ) << "RefreshMsg::getPayload()::getOpaque() of reassigned copy";
+		EXPECT_EQ( copy.getStreamId(), 5 ) << "RefreshMsg::getStreamId() of copy after reassignment";
+
+		RefreshMsg encoded;
+		encoded.streamId( 1 );
+		EXPECT_THROW( RefreshMsg copyOfEncoded( encoded ), OmmInvalidUsageException ) << "RefreshMsg copy of a message being encoded";
+	}
+	catch ( const OmmException& excp )
+	{
+		EXPECT_FALSE( true ) << "RefreshMsg copy - exception not expected" << excp;
+	}
+
+	rsslDeleteDataDictionary( &dictionary );
+}
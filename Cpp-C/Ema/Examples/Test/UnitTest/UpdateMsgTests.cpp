@@ -890,3 +890,61 @@ TEST(UpdateMsgTests, testUpdateMsgHybrid)
 	}
 }
 
+
+TEST(UpdateMsgTests, testUpdateMsgCopy)
+{
+	RsslDataDictionary dictionary;
+
+	ASSERT_TRUE(loadDictionaryFromFile( &dictionary )) << "Failed to load dictionary";
+
+	try
+	{
+		RsslUpdateMsg update;
+		rsslClearUpdateMsg( &update );
+
+		update.msgBase.streamId = 7;
+		update.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+		update.updateType = RDM_UPD_EVENT_TYPE_QUOTE;
+
+		RsslBuffer rsslBuf;
+		rsslBuf.length = 1000;
+		rsslBuf.data = ( char* )malloc( sizeof( char ) * 1000 );
+
+		EmaString inText;
+		encodeFieldList( rsslBuf, inText );
+
+		update.msgBase.encDataBody = rsslBuf;
+		update.msgBase.containerType = RSSL_DT_FIELD_LIST;
+
+		UpdateMsg received;
+		StaticDecoder::setRsslData( &received, ( RsslMsg* )&update, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION, &dictionary );
+
+		UpdateMsg copy( received );
+
+		// the copy must not refer to the memory the message was received in
+		memset( rsslBuf.data, 0, 1000 );
+		free( rsslBuf.data );
+
+		EXPECT_EQ( copy.getStreamId(), 7 ) << "UpdateMsg::getStreamId() of copy";
+		EXPECT_EQ( copy.getUpdateTypeNum(), RDM_UPD_EVENT_TYPE_QUOTE ) << "UpdateMsg::getUpdateTypeNum() of copy";
+		EXPECT_EQ( copy.getPayload().getDataType(), DataType::FieldListEnum ) << "UpdateMsg::getPayload()::getDataType() of copy";
+
+		const FieldList& fl = copy.getPayload().getFieldList();
+		EXPECT_TRUE( fl.forth() ) << "FieldList::forth() of copy";
+		EXPECT_EQ( fl.getEntry().getUInt(), 64 ) << "FieldEntry::getUInt() of copy";
+
+		// a copy can be copied again and assigned over an earlier copy
+		UpdateMsg copyOfCopy( copy );
+		copy = copyOfCopy;
+		EXPECT_EQ( copy.getStreamId(), 7 ) << "UpdateMsg::getStreamId() after assignment";
+
+		UpdateMsg empty;
+		EXPECT_THROW( UpdateMsg copyOfEmpty( empty ), OmmInvalidUsageException ) << "UpdateMsg copy of an empty message";
+	}
+	catch ( const OmmException& excp )
+	{
+		EXPECT_FALSE( true ) << "UpdateMsg copy - exception not expected" << excp;
+	}
+
+	rsslDeleteDataDictionary( &dictionary );
+}
@@ -13,7 +13,7 @@
 using namespace thomsonreuters::ema::access;
 
 AckMsgEncoder::AckMsgEncoder() :
-	MsgEncoder()
+	MsgEncoder( DataType::AckMsgEnum )
 #ifdef __EMA_COPY_ON_SET__
 	, _text()
 #endif
@@ -35,6 +35,7 @@ using namespace thomsonreuters::ema::access;
 extern const EmaString& getMTypeAsString( OmmReal::MagnitudeType mType );
 
 ElementListEncoder::ElementListEncoder() :
+ Encoder( DataType::ElementListEnum ),
  _rsslElementList(),
  _rsslElementEntry(),
  _containerInitialized( false )
@@ -13,6 +13,12 @@
 
 using namespace thomsonreuters::ema::access;
 
+Mutex EncodeIterator::_countLock;
+
+UInt64 EncodeIterator::_allocationCount = 0;
+
+UInt64 EncodeIterator::_reallocationCount = 0;
+
 EncodeIterator::EncodeIterator() :
  _rsslEncIter(),
  _rsslEncBuffer1(),
@@ -35,91 +41,56 @@ EncodeIterator::~EncodeIterator()
 
 void EncodeIterator::clear(UInt32 allocatedSize)
 {
-	if ( !_allocatedSize )
+	RsslBuffer* temp = _rsslEncBuffer1.data ? &_rsslEncBuffer1 : &_rsslEncBuffer2;
+
+	if ( _allocatedSize < allocatedSize )
 	{
-		_allocatedSize = allocatedSize;
+		// pooled iterators only ever grow, and at least geometrically, so that
+		// encoders of different sizes sharing the pool stop allocating once warmed up;
+		// nothing encoded so far has to be kept, so the old buffer is not copied
+		RsslUInt32 newSize = _allocatedSize << 1;
+		if ( newSize < allocatedSize )
+			newSize = allocatedSize;
+
+		char* tempBuffer = 0;
 
 		try {
-			_rsslEncBuffer1.data = new char[ _allocatedSize ];
+			tempBuffer = new char[ newSize ];
 		}
 		catch ( std::bad_alloc )
 		{
-			rsslClearBuffer( &_rsslEncBuffer1 );
-
-			_allocatedSize = 0;
-
 			const char* temp = "Failed to allocate memory for encode iterator buffer in EncodeIterator::clear().";
 			throwMeeException( temp );
 			return;
 		}
 
-		*_rsslEncBuffer1.data = 0;
-		_rsslEncBuffer1.length = _allocatedSize;
+		if ( temp->data )
+			delete [] temp->data;
 
-		rsslClearEncodeIterator( &_rsslEncIter );
+		temp->data = tempBuffer;
 
-		RsslRet retCode = rsslSetEncodeIteratorRWFVersion( &_rsslEncIter, _rsslMajVer, _rsslMinVer );
-		if ( retCode != RSSL_RET_SUCCESS )
-		{
-			const char* temp = "Failed to set RsslEncodeIterator version in EncodeIterator::clear().";
-			throwIueException( temp );
-		}
+		_allocatedSize = newSize;
 
-		retCode = rsslSetEncodeIteratorBuffer( &_rsslEncIter, &_rsslEncBuffer1 );
-		if ( retCode != RSSL_RET_SUCCESS )
-		{
-			const char* temp = "Failed to set RsslEncodeIterator buffer in EncodeIterator::clear().";
-			throwIueException( temp );
-		}
+		countAllocation( false );
 	}
-	else if (_allocatedSize < allocatedSize)
+
+	*temp->data = 0;
+	temp->length = _allocatedSize;
+
+	rsslClearEncodeIterator( &_rsslEncIter );
+
+	RsslRet retCode = rsslSetEncodeIteratorRWFVersion( &_rsslEncIter, _rsslMajVer, _rsslMinVer );
+	if ( retCode != RSSL_RET_SUCCESS )
 	{
-		reallocate( allocatedSize );
+		const char* temp = "Failed to set RsslEncodeIterator version in EncodeIterator::clear().";
+		throwIueException( temp );
 	}
-	else
+
+	retCode = rsslSetEncodeIteratorBuffer( &_rsslEncIter, temp );
+	if ( retCode != RSSL_RET_SUCCESS )
 	{
-		if ( _rsslEncBuffer1.data )
-		{
-			*_rsslEncBuffer1.data = 0;
-			_rsslEncBuffer1.length = _allocatedSize;
-
-			rsslClearEncodeIterator( &_rsslEncIter );
-
-			RsslRet retCode = rsslSetEncodeIteratorRWFVersion( &_rsslEncIter, _rsslMajVer, _rsslMinVer );
-			if ( retCode != RSSL_RET_SUCCESS )
-			{
-				const char* temp = "Failed to set RsslEncodeIterator version in EncodeIterator::clear().";
-				throwIueException( temp );
-			}
-
-			retCode = rsslSetEncodeIteratorBuffer( &_rsslEncIter, &_rsslEncBuffer1 );
-			if ( retCode != RSSL_RET_SUCCESS )
-			{
-				const char* temp = "Failed to set RsslEncodeIterator buffer in EncodeIterator::clear().";
-				throwIueException( temp );
-			}
-		}
-		else
-		{
-			*_rsslEncBuffer2.data = 0;
-			_rsslEncBuffer2.length = _allocatedSize;
-
-			rsslClearEncodeIterator( &_rsslEncIter );
-
-			RsslRet retCode = rsslSetEncodeIteratorRWFVersion( &_rsslEncIter, _rsslMajVer, _rsslMinVer );
-			if ( retCode != RSSL_RET_SUCCESS )
-			{
-				const char* temp = "Failed to set RsslEncodeIterator version in EncodeIterator::clear().";
-				throwIueException( temp );
-			}
-
-			retCode = rsslSetEncodeIteratorBuffer( &_rsslEncIter, &_rsslEncBuffer2 );
-			if ( retCode != RSSL_RET_SUCCESS )
-			{
-				const char* temp = "Failed to set RsslEncodeIterator buffer in EncodeIterator::clear().";
-				throwIueException( temp );
-			}
-		}
+		const char* temp = "Failed to set RsslEncodeIterator buffer in EncodeIterator::clear().";
+		throwIueException( temp );
 	}
 }
 
@@ -148,6 +119,8 @@ void EncodeIterator::reallocate()
 		}
 
 		_allocatedSize = newSize;
+
+		countAllocation( true );
 	}
 	catch ( std::bad_alloc )
 	{
@@ -175,6 +148,8 @@ void EncodeIterator::reallocate( UInt32 size )
 
 		_allocatedSize = size;
 
+		countAllocation( false );
+
 		rsslClearEncodeIterator( &_rsslEncIter );
 
 		RsslRet retCode = rsslSetEncodeIteratorRWFVersion( &_rsslEncIter, _rsslMajVer, _rsslMinVer );
@@ -204,3 +179,33 @@ void EncodeIterator::setEncodedLength( UInt32 length )
 
 	temp->length = length;
 }
+
+void EncodeIterator::countAllocation( bool reallocation )
+{
+	_countLock.lock();
+
+	if ( reallocation )
+		++_reallocationCount;
+	else
+		++_allocationCount;
+
+	_countLock.unlock();
+}
+
+UInt64 EncodeIterator::getAllocationCount()
+{
+	_countLock.lock();
+	UInt64 count = _allocationCount;
+	_countLock.unlock();
+
+	return count;
+}
+
+UInt64 EncodeIterator::getReallocationCount()
+{
+	_countLock.lock();
+	UInt64 count = _reallocationCount;
+	_countLock.unlock();
+
+	return count;
+}
@@ -34,6 +34,12 @@ public :
 
 	void setEncodedLength( UInt32 );
 
+	// number of encode buffers allocated, and of buffers grown by reallocate() after an encode
+	// call returned RSSL_RET_BUFFER_TOO_SMALL, summed over all iterators since start up
+	static UInt64 getAllocationCount();
+
+	static UInt64 getReallocationCount();
+
 	RsslEncodeIterator		_rsslEncIter;
 
 	RsslBuffer				_rsslEncBuffer1;
@@ -45,6 +51,16 @@ public :
 	RsslUInt8				_rsslMajVer;
 
 	RsslUInt8				_rsslMinVer;
+
+private :
+
+	static void countAllocation( bool reallocation );
+
+	static Mutex			_countLock;
+
+	static UInt64			_allocationCount;
+
+	static UInt64			_reallocationCount;
 };
 
 class EncodeIteratorPool : public Pool< EncodeIterator >
@@ -11,10 +11,15 @@
 
 using namespace thomsonreuters::ema::access;
 
-Encoder::Encoder() :
+UInt32 Encoder::_sizeHints[ DataType::GenericMsgEnum + 1 ];
+
+Mutex Encoder::_sizeHintLock;
+
+Encoder::Encoder( DataType::DataTypeEnum dataType ) :
  _pEncodeIter( 0 ),
  _iteratorOwner( 0 ),
- _containerComplete( false )
+ _containerComplete( false ),
+ _dataType( dataType )
 {
 }
 
@@ -31,7 +36,9 @@ void Encoder::acquireEncIterator( UInt32 allocatedSize )
 	
 		_iteratorOwner = this;
 
-		_pEncodeIter->clear( allocatedSize );
+		UInt32 sizeHint = getSizeHint();
+
+		_pEncodeIter->clear( allocatedSize < sizeHint ? sizeHint : allocatedSize );
 	}
 }
 
@@ -40,7 +47,13 @@ void Encoder::releaseEncIterator()
 	if ( _pEncodeIter )
 	{
 		if ( _iteratorOwner == this )
+		{
+			// remember what this type of data needed so that the next iterator is sized up front
+			// instead of growing through reallocate() again
+			updateSizeHint( rsslGetEncodedBufferLength( &_pEncodeIter->_rsslEncIter ) );
+
 			g_pool._encodeIteratorPool.returnItem( _pEncodeIter );
+		}
 	
 		_pEncodeIter = 0;
 		_iteratorOwner = 0;
@@ -48,6 +61,33 @@ void Encoder::releaseEncIterator()
 	}
 }
 
+UInt32 Encoder::getSizeHint() const
+{
+	if ( _dataType > DataType::GenericMsgEnum )
+		return 0;
+
+	_sizeHintLock.lock();
+	UInt32 sizeHint = _sizeHints[ _dataType ];
+	_sizeHintLock.unlock();
+
+	return sizeHint;
+}
+
+void Encoder::updateSizeHint( UInt32 encodedLength )
+{
+	if ( _dataType > DataType::GenericMsgEnum )
+		return;
+
+	// the hint only grows, so sizes that alternate between messages of the same type
+	// are all covered and a small message never shrinks it for the next large one
+	UInt32 sizeHint = encodedLength + ( encodedLength >> 3 );
+
+	_sizeHintLock.lock();
+	if ( _sizeHints[ _dataType ] < sizeHint )
+		_sizeHints[ _dataType ] = sizeHint;
+	_sizeHintLock.unlock();
+}
+
 bool Encoder::ownsIterator() const
 {
 	return _iteratorOwner == this ? true : false;
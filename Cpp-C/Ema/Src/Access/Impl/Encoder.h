@@ -52,7 +52,7 @@ protected :
 
 	friend class thomsonreuters::ema::rdm::DataDictionaryImpl;
 
-	Encoder();
+	Encoder( DataType::DataTypeEnum );
 
 	virtual ~Encoder();
 
@@ -67,6 +67,19 @@ protected :
 	const Encoder*		_iteratorOwner;
 
 	bool				_containerComplete;
+
+private :
+
+	UInt32 getSizeHint() const;
+
+	void updateSizeHint( UInt32 );
+
+	DataType::DataTypeEnum	_dataType;
+
+	// encoded size needed so far by each data and message type, shared by all encoders
+	static UInt32			_sizeHints[ DataType::GenericMsgEnum + 1 ];
+
+	static Mutex			_sizeHintLock;
 };
 
 }
@@ -0,0 +1,22 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright Thomson Reuters 2018. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "EncoderStatistics.h"
+#include "EncodeIterator.h"
+
+using namespace thomsonreuters::ema::access;
+
+UInt64 EncoderStatistics::getAllocationCount()
+{
+	return EncodeIterator::getAllocationCount();
+}
+
+UInt64 EncoderStatistics::getReallocationCount()
+{
+	return EncodeIterator::getReallocationCount();
+}
@@ -62,17 +62,17 @@ FieldEntry::~FieldEntry()
 
 DataType::DataTypeEnum FieldEntry::getLoadType() const
 {
-	return (*_pLoad)->getDataType();
+	return _pDecoder->getLoad().getDataType();
 }
 
 Data::DataCode FieldEntry::getCode() const
 {
-	return (*_pLoad)->getCode();
+	return _pDecoder->getLoad().getCode();
 }
 
 const Data& FieldEntry::getLoad() const
 {
-	return **_pLoad;
+	return _pDecoder->getLoad();
 }
 
 const EmaString& FieldEntry::getName() const
@@ -97,266 +97,266 @@ const EmaString& FieldEntry::getRippleToName(Int16 fieldId) const
 
 Int64 FieldEntry::getInt() const
 {
-	if ( (*_pLoad)->getDataType() != DataType::IntEnum )
+	if ( _pDecoder->getLoad().getDataType() != DataType::IntEnum )
 	{
 		EmaString temp( "Attempt to getInt() while actual Entry data type is " );
-		temp += getDTypeAsString( (*_pLoad)->getDataType() );
+		temp += getDTypeAsString( _pDecoder->getLoad().getDataType() );
 		throwIueException( temp );
 	}
-	else if ( (*_pLoad)->getCode() == Data::BlankEnum )
+	else if ( _pDecoder->getLoad().getCode() == Data::BlankEnum )
 	{
 		EmaString temp( "Attempt to getInt() while entry data is blank." );
 		throwIueException( temp );
 	}
 
-	return static_cast<const OmmInt&>( **_pLoad ).getInt();
+	return static_cast<const OmmInt&>( _pDecoder->getLoad() ).getInt();
 }
 
 UInt64 FieldEntry::getUInt() const
 {
-	if ( (*_pLoad)->getDataType() != DataType::UIntEnum )
+	if ( _pDecoder->getLoad().getDataType() != DataType::UIntEnum )
 	{
 		EmaString temp( "Attempt to getUInt() while actual entry data type is " );
-		temp += getDTypeAsString( (*_pLoad)->getDataType() );
+		temp += getDTypeAsString( _pDecoder->getLoad().getDataType() );
 		throwIueException( temp );
 	}
-	else if ( (*_pLoad)->getCode() == Data::BlankEnum )
+	else if ( _pDecoder->getLoad().getCode() == Data::BlankEnum )
 	{
 		EmaString temp( "Attempt to getUInt() while entry data is blank." );
 		throwIueException( temp );
 	}
 
-	return static_cast<const OmmUInt&>( **_pLoad ).getUInt();
+	return static_cast<const OmmUInt&>( _pDecoder->getLoad() ).getUInt();
 }
 
 const OmmReal& FieldEntry::getReal() const
 {
-	if ( (*_pLoad)->getDataType() != DataType::RealEnum )
+	if ( _pDecoder->getLoad().getDataType() != DataType::RealEnum )
 	{
 		EmaString temp( "Attempt to getReal() while actual entry data type is " );
-		temp += getDTypeAsString( (*_pLoad)->getDataType() );
+		temp += getDTypeAsString( _pDecoder->getLoad().getDataType() );
 		throwIueException( temp );
 	}
-	else if ( (*_pLoad)->getCode() == Data::BlankEnum )
+	else if ( _pDecoder->getLoad().getCode() == Data::BlankEnum )
 	{
 		EmaString temp( "Attempt to getReal() while entry data is blank." );
 		throwIueException( temp );
 	}
 
-	return static_cast<const OmmReal&>( **_pLoad );
+	return static_cast<const OmmReal&>( _pDecoder->getLoad() );
 }
 
 const OmmDate& FieldEntry::getDate() const
 {
-	if ( (*_pLoad)->getDataType() != DataType::DateEnum )
+	if ( _pDecoder->getLoad().getDataType() != DataType::DateEnum )
 	{
 		EmaString temp( "Attempt to getDate() while actual entry data type is " );
-		temp += getDTypeAsString( (*_pLoad)->getDataType() );
+		temp += getDTypeAsString( _pDecoder->getLoad().getDataType() );
 		throwIueException( temp );
 	}
-	else if ( (*_pLoad)->getCode() == Data::BlankEnum )
+	else if ( _pDecoder->getLoad().getCode() == Data::BlankEnum )
 	{
 		EmaString temp( "Attempt to getDate() while entry data is blank." );
 		throwIueException( temp );
 	}
 
-	return static_cast<const OmmDate&>( **_pLoad );
+	return static_cast<const OmmDate&>( _pDecoder->getLoad() );
 }
 
 const OmmDateTime& FieldEntry::getDateTime() const
 {
-	if ( (*_pLoad)->getDataType() != DataType::DateTimeEnum )
+	if ( _pDecoder->getLoad().getDataType() != DataType::DateTimeEnum )
 	{
 		EmaString temp( "Attempt to getDateTime() while actual entry data type is " );
-		temp += getDTypeAsString( (*_pLoad)->getDataType() );
+		temp += getDTypeAsString( _pDecoder->getLoad().getDataType() );
 		throwIueException( temp );
 	}
-	else if ( (*_pLoad)->getCode() == Data::BlankEnum )
+	else if ( _pDecoder->getLoad().getCode() == Data::BlankEnum )
 	{
 		EmaString temp( "Attempt to getDateTime() while entry data is blank." );
 		throwIueException( temp );
 	}
 
-	return static_cast<const OmmDateTime&>( **_pLoad );
+	return static_cast<const OmmDateTime&>( _pDecoder->getLoad() );
 }
 
 const OmmTime& FieldEntry::getTime() const
 {
-	if ( (*_pLoad)->getDataType() != DataType::TimeEnum )
+	if ( _pDecoder->getLoad().getDataType() != DataType::TimeEnum )
 	{
 		EmaString temp( "Attempt to getTime() while actual entry data type is " );
-		temp += getDTypeAsString( (*_pLoad)->getDataType() );
+		temp += getDTypeAsString( _pDecoder->getLoad().getDataType() );
 		throwIueException( temp );
 	}
-	else if ( (*_pLoad)->getCode() == Data::BlankEnum )
+	else if ( _pDecoder->getLoad().getCode() == Data::BlankEnum )
 	{
 		EmaString temp( "Attempt to getTime() while entry data is blank." );
 		throwIueException( temp );
 	}
 
-	return static_cast<const OmmTime&>( **_pLoad );
+	return static_cast<const OmmTime&>( _pDecoder->getLoad() );
 }
 
 const EmaString& FieldEntry::getAscii() const
 {
-	if ( (*_pLoad)->getDataType() != DataType::AsciiEnum )
+	if ( _pDecoder->getLoad().getDataType() != DataType::AsciiEnum )
 	{
 		EmaString temp( "Attempt to getAscii() while actual entry data type is " );
-		temp += getDTypeAsString( (*_pLoad)->getDataType() );
+		temp += getDTypeAsString( _pDecoder->getLoad().getDataType() );
 		throwIueException( temp );
 	}
-	else if ( (*_pLoad)->getCode() == Data::BlankEnum )
+	else if ( _pDecoder->getLoad().getCode() == Data::BlankEnum )
 	{
 		EmaString temp( "Attempt to getAscii() while entry data is blank." );
 		throwIueException( temp );
 	}
 
-	return static_cast<const OmmAscii&>( **_pLoad ).getAscii();
+	return static_cast<const OmmAscii&>( _pDecoder->getLoad() ).getAscii();
 }
 
 const EmaBuffer& FieldEntry::getBuffer() const
 {
-	if ( (*_pLoad)->getDataType() != DataType::BufferEnum )
+	if ( _pDecoder->getLoad().getDataType() != DataType::BufferEnum )
 	{
 		EmaString temp( "Attempt to getBuffer() while actual entry data type is " );
-		temp += getDTypeAsString( (*_pLoad)->getDataType() );
+		temp += getDTypeAsString( _pDecoder->getLoad().getDataType() );
 		throwIueException( temp );
 	}
-	else if ( (*_pLoad)->getCode() == Data::BlankEnum )
+	else if ( _pDecoder->getLoad().getCode() == Data::BlankEnum )
 	{
 		EmaString temp( "Attempt to getBuffer() while entry data is blank." );
 		throwIueException( temp );
 	}
 
-	return static_cast<const OmmBuffer&>( **_pLoad ).getBuffer();
+	return static_cast<const OmmBuffer&>( _pDecoder->getLoad() ).getBuffer();
 }
 
 float FieldEntry::getFloat() const
 {
-	if ( (*_pLoad)->getDataType() != DataType::FloatEnum )
+	if ( _pDecoder->getLoad().getDataType() != DataType::FloatEnum )
 	{
 		EmaString temp( "Attempt to getFloat() while actual entry data type is " );
-		temp += getDTypeAsString( (*_pLoad)->getDataType() );
+		temp += getDTypeAsString( _pDecoder->getLoad().getDataType() );
 		throwIueException( temp );
 	}
-	else if ( (*_pLoad)->getCode() == Data::BlankEnum )
+	else if ( _pDecoder->getLoad().getCode() == Data::BlankEnum )
 	{
 		EmaString temp( "Attempt to getFloat() while entry data is blank." );
 		throwIueException( temp );
 	}
 
-	return static_cast<const OmmFloat&>( **_pLoad ).getFloat();
+	return static_cast<const OmmFloat&>( _pDecoder->getLoad() ).getFloat();
 }
 
 double FieldEntry::getDouble() const
 {
-	if ( (*_pLoad)->getDataType() != DataType::DoubleEnum )
+	if ( _pDecoder->getLoad().getDataType() != DataType::DoubleEnum )
 	{
 		EmaString temp( "Attempt to getDouble() while actual entry data type is " );
-		temp += getDTypeAsString( (*_pLoad)->getDataType() );
+		temp += getDTypeAsString( _pDecoder->getLoad().getDataType() );
 		throwIueException( temp );
 	}
-	else if ( (*_pLoad)->getCode() == Data::BlankEnum )
+	else if ( _pDecoder->getLoad().getCode() == Data::BlankEnum )
 	{
 		EmaString temp( "Attempt to getDouble() while entry data is blank." );
 		throwIueException( temp );
 	}
 
-	return static_cast<const OmmDouble&>( **_pLoad ).getDouble();
+	return static_cast<const OmmDouble&>( _pDecoder->getLoad() ).getDouble();
 }
 
 const RmtesBuffer& FieldEntry::getRmtes() const
 {
-	if ( (*_pLoad)->getDataType() != DataType::RmtesEnum )
+	if ( _pDecoder->getLoad().getDataType() != DataType::RmtesEnum )
 	{
 		EmaString temp( "Attempt to getRmtes() while actual entry data type is " );
-		temp += getDTypeAsString( (*_pLoad)->getDataType() );
+		temp += getDTypeAsString( _pDecoder->getLoad().getDataType() );
 		throwIueException( temp );
 	}
-	else if ( (*_pLoad)->getCode() == Data::BlankEnum )
+	else if ( _pDecoder->getLoad().getCode() == Data::BlankEnum )
 	{
 		EmaString temp( "Attempt to getRmtes() while entry data is blank." );
 		throwIueException( temp );
 	}
 
-	return static_cast<const OmmRmtes&>( **_pLoad ).getRmtes();
+	return static_cast<const OmmRmtes&>( _pDecoder->getLoad() ).getRmtes();
 }
 
 const EmaBuffer& FieldEntry::getUtf8() const
 {
-	if ( (*_pLoad)->getDataType() != DataType::Utf8Enum )
+	if ( _pDecoder->getLoad().getDataType() != DataType::Utf8Enum )
 	{
 		EmaString temp( "Attempt to getUtf8() while actual entry data type is " );
-		temp += getDTypeAsString( (*_pLoad)->getDataType() );
+		temp += getDTypeAsString( _pDecoder->getLoad().getDataType() );
 		throwIueException( temp );
 	}
-	else if ( (*_pLoad)->getCode() == Data::BlankEnum )
+	else if ( _pDecoder->getLoad().getCode() == Data::BlankEnum )
 	{
 		EmaString temp( "Attempt to getUtf8() while entry data is blank." );
 		throwIueException( temp );
 	}
 
-	return static_cast<const OmmUtf8&>( **_pLoad ).getUtf8();
+	return static_cast<const OmmUtf8&>( _pDecoder->getLoad() ).getUtf8();
 }
 
 const OmmState& FieldEntry::getState() const
 {
-	if ( (*_pLoad)->getDataType() != DataType::StateEnum )
+	if ( _pDecoder->getLoad().getDataType() != DataType::StateEnum )
 	{
 		EmaString temp( "Attempt to getState() while actual entry data type is " );
-		temp += getDTypeAsString( (*_pLoad)->getDataType() );
+		temp += getDTypeAsString( _pDecoder->getLoad().getDataType() );
 		throwIueException( temp );
 	}
-	else if ( (*_pLoad)->getCode() == Data::BlankEnum )
+	else if ( _pDecoder->getLoad().getCode() == Data::BlankEnum )
 	{
 		EmaString temp( "Attempt to getState() while entry data is blank." );
 		throwIueException( temp );
 	}
 
-	return static_cast<const OmmState&>( **_pLoad );
+	return static_cast<const OmmState&>( _pDecoder->getLoad() );
 }
 
 const OmmQos& FieldEntry::getQos() const
 {
-	if ( (*_pLoad)->getDataType() != DataType::QosEnum )
+	if ( _pDecoder->getLoad().getDataType() != DataType::QosEnum )
 	{
 		EmaString temp( "Attempt to getQos() while actual entry data type is " );
-		temp += getDTypeAsString( (*_pLoad)->getDataType() );
+		temp += getDTypeAsString( _pDecoder->getLoad().getDataType() );
 		throwIueException( temp );
 	}
-	else if ( (*_pLoad)->getCode() == Data::BlankEnum )
+	else if ( _pDecoder->getLoad().getCode() == Data::BlankEnum )
 	{
 		EmaString temp( "Attempt to getQos() while entry data is blank." );
 		throwIueException( temp );
 	}
 
-	return static_cast<const OmmQos&>( **_pLoad );
+	return static_cast<const OmmQos&>( _pDecoder->getLoad() );
 }
 
 UInt16 FieldEntry::getEnum() const
 {
-	if ( (*_pLoad)->getDataType() != DataType::EnumEnum )
+	if ( _pDecoder->getLoad().getDataType() != DataType::EnumEnum )
 	{
 		EmaString temp( "Attempt to getEnum() while actual entry data type is " );
-		temp += getDTypeAsString( (*_pLoad)->getDataType() );
+		temp += getDTypeAsString( _pDecoder->getLoad().getDataType() );
 		throwIueException( temp );
 	}
-	else if ( (*_pLoad)->getCode() == Data::BlankEnum )
+	else if ( _pDecoder->getLoad().getCode() == Data::BlankEnum )
 	{
 		EmaString temp( "Attempt to getEnum() while entry data is blank." );
 		throwIueException( temp );
 	}
 
-	return static_cast<const OmmEnum&>( **_pLoad ).getEnum();
+	return static_cast<const OmmEnum&>( _pDecoder->getLoad() ).getEnum();
 }
 
 
 bool FieldEntry::hasEnumDisplay() const
 {
-	if  ( ( (*_pLoad)->getDataType() == DataType::EnumEnum ) &&
-		( (*_pLoad)->getCode() != Data::BlankEnum ) )
+	if  ( ( _pDecoder->getLoad().getDataType() == DataType::EnumEnum ) &&
+		( _pDecoder->getLoad().getCode() != Data::BlankEnum ) )
 	{
-		return _pDecoder->hasEnumDisplay( static_cast<const OmmEnum&>( **_pLoad ).getEnum() );
+		return _pDecoder->hasEnumDisplay( static_cast<const OmmEnum&>( _pDecoder->getLoad() ).getEnum() );
 	}
 
 	return false;
@@ -364,235 +364,235 @@ bool FieldEntry::hasEnumDisplay() const
 
 const EmaString& FieldEntry::getEnumDisplay() const
 {
-	if ( (*_pLoad)->getDataType() != DataType::EnumEnum )
+	if ( _pDecoder->getLoad().getDataType() != DataType::EnumEnum )
 	{
 		EmaString temp( "Attempt to getEnumDisplay() while actual entry data type is " );
-		temp += getDTypeAsString( (*_pLoad)->getDataType() );
+		temp += getDTypeAsString( _pDecoder->getLoad().getDataType() );
 		throwIueException( temp );
 	}
-	else if ( (*_pLoad)->getCode() == Data::BlankEnum )
+	else if ( _pDecoder->getLoad().getCode() == Data::BlankEnum )
 	{
 		EmaString temp( "Attempt to getEnumDisplay() while entry data is blank." );
 		throwIueException( temp );
 	}
 
-	return _pDecoder->getEnumDisplay( static_cast<const OmmEnum&>( **_pLoad ).getEnum() );
+	return _pDecoder->getEnumDisplay( static_cast<const OmmEnum&>( _pDecoder->getLoad() ).getEnum() );
 }
 
 const FieldList& FieldEntry::getFieldList() const
 {
-	if ( (*_pLoad)->getDataType() != DataType::FieldListEnum )
+	if ( _pDecoder->getLoad().getDataType() != DataType::FieldListEnum )
 	{
 		EmaString temp( "Attempt to getFieldList() while actual entry data type is " );
-		temp += getDTypeAsString( (*_pLoad)->getDataType() );
+		temp += getDTypeAsString( _pDecoder->getLoad().getDataType() );
 		throwIueException( temp );
 	}
 
-	return static_cast<const FieldList&>( **_pLoad );
+	return static_cast<const FieldList&>( _pDecoder->getLoad() );
 }
 
 const ElementList& FieldEntry::getElementList() const
 {
-	if ( (*_pLoad)->getDataType() != DataType::ElementListEnum )
+	if ( _pDecoder->getLoad().getDataType() != DataType::ElementListEnum )
 	{
 		EmaString temp( "Attempt to getElementList() while actual entry data type is " );
-		temp += getDTypeAsString( (*_pLoad)->getDataType() );
+		temp += getDTypeAsString( _pDecoder->getLoad().getDataType() );
 		throwIueException( temp );
 	}
 
-	return static_cast<const ElementList&>( **_pLoad );
+	return static_cast<const ElementList&>( _pDecoder->getLoad() );
 }
 
 const Map& FieldEntry::getMap() const
 {
-	if ( (*_pLoad)->getDataType() != DataType::MapEnum )
+	if ( _pDecoder->getLoad().getDataType() != DataType::MapEnum )
 	{
 		EmaString temp( "Attempt to getMap() while actual entry data type is " );
-		temp += getDTypeAsString( (*_pLoad)->getDataType() );
+		temp += getDTypeAsString( _pDecoder->getLoad().getDataType() );
 		throwIueException( temp );
 	}
 
-	return static_cast<const Map&>( **_pLoad );
+	return static_cast<const Map&>( _pDecoder->getLoad() );
 }
 
 const Vector& FieldEntry::getVector() const
 {
-	if ( (*_pLoad)->getDataType() != DataType::VectorEnum )
+	if ( _pDecoder->getLoad().getDataType() != DataType::VectorEnum )
 	{
 		EmaString temp( "Attempt to getVector() while actual entry data type is " );
-		temp += getDTypeAsString( (*_pLoad)->getDataType() );
+		temp += getDTypeAsString( _pDecoder->getLoad().getDataType() );
 		throwIueException( temp );
 	}
 
-	return static_cast<const Vector&>( **_pLoad );
+	return static_cast<const Vector&>( _pDecoder->getLoad() );
 }
 
 const Series& FieldEntry::getSeries() const
 {
-	if ( (*_pLoad)->getDataType() != DataType::SeriesEnum )
+	if ( _pDecoder->getLoad().getDataType() != DataType::SeriesEnum )
 	{
 		EmaString temp( "Attempt to getSeries() while actual entry data type is " );
-		temp += getDTypeAsString( (*_pLoad)->getDataType() );
+		temp += getDTypeAsString( _pDecoder->getLoad().getDataType() );
 		throwIueException( temp );
 	}
 
-	return static_cast<const Series&>( **_pLoad );
+	return static_cast<const Series&>( _pDecoder->getLoad() );
 }
 
 const FilterList& FieldEntry::getFilterList() const
 {
-	if ( (*_pLoad)->getDataType() != DataType::FilterListEnum )
+	if ( _pDecoder->getLoad().getDataType() != DataType::FilterListEnum )
 	{
 		EmaString temp( "Attempt to getFilterList() while actual entry data type is " );
-		temp += getDTypeAsString( (*_pLoad)->getDataType() );
+		temp += getDTypeAsString( _pDecoder->getLoad().getDataType() );
 		throwIueException( temp );
 	}
 
-	return static_cast<const FilterList&>( **_pLoad );
+	return static_cast<const FilterList&>( _pDecoder->getLoad() );
 }
 
 const OmmOpaque& FieldEntry::getOpaque() const
 {
-	if ( (*_pLoad)->getDataType() != DataType::OpaqueEnum )
+	if ( _pDecoder->getLoad().getDataType() != DataType::OpaqueEnum )
 	{
 		EmaString temp( "Attempt to getOpaque() while actual entry data type is " );
-		temp += getDTypeAsString( (*_pLoad)->getDataType() );
+		temp += getDTypeAsString( _pDecoder->getLoad().getDataType() );
 		throwIueException( temp );
 	}
 
-	return static_cast<const OmmOpaque&>( **_pLoad );
+	return static_cast<const OmmOpaque&>( _pDecoder->getLoad() );
 }
 
 const OmmXml& FieldEntry::getXml() const
 {
-	if ( (*_pLoad)->getDataType() != DataType::XmlEnum )
+	if ( _pDecoder->getLoad().getDataType() != DataType::XmlEnum )
 	{
 		EmaString temp( "Attempt to getXml() while actual entry data type is " );
-		temp += getDTypeAsString( (*_pLoad)->getDataType() );
+		temp += getDTypeAsString( _pDecoder->getLoad().getDataType() );
 		throwIueException( temp );
 	}
 
-	return static_cast<const OmmXml&>( **_pLoad );
+	return static_cast<const OmmXml&>( _pDecoder->getLoad() );
 }
 
 const OmmAnsiPage& FieldEntry::getAnsiPage() const
 {
-	if ( (*_pLoad)->getDataType() != DataType::AnsiPageEnum )
+	if ( _pDecoder->getLoad().getDataType() != DataType::AnsiPageEnum )
 	{
 		EmaString temp( "Attempt to getAnsiPage() while actual entry data type is " );
-		temp += getDTypeAsString( (*_pLoad)->getDataType() );
+		temp += getDTypeAsString( _pDecoder->getLoad().getDataType() );
 		throwIueException( temp );
 	}
 
-	return static_cast<const OmmAnsiPage&>( **_pLoad );
+	return static_cast<const OmmAnsiPage&>( _pDecoder->getLoad() );
 }
 
 const ReqMsg& FieldEntry::getReqMsg() const
 {
-	if ( (*_pLoad)->getDataType() != DataType::ReqMsgEnum )
+	if ( _pDecoder->getLoad().getDataType() != DataType::ReqMsgEnum )
 	{
 		EmaString temp( "Attempt to getReqMsg() while actual entry data type is " );
-		temp += getDTypeAsString( (*_pLoad)->getDataType() );
+		temp += getDTypeAsString( _pDecoder->getLoad().getDataType() );
 		throwIueException( temp );
 	}
 
-	return static_cast<const ReqMsg&>( **_pLoad );
+	return static_cast<const ReqMsg&>( _pDecoder->getLoad() );
 }
 
 const RefreshMsg& FieldEntry::getRefreshMsg() const
 {
-	if ( (*_pLoad)->getDataType() != DataType::RefreshMsgEnum )
+	if ( _pDecoder->getLoad().getDataType() != DataType::RefreshMsgEnum )
 	{
 		EmaString temp( "Attempt to getRefreshMsg() while actual data type is " );
-		temp += getDTypeAsString( (*_pLoad)->getDataType() );
+		temp += getDTypeAsString( _pDecoder->getLoad().getDataType() );
 		throwIueException( temp );
 	}
 
-	return static_cast<const RefreshMsg&>( **_pLoad );
+	return static_cast<const RefreshMsg&>( _pDecoder->getLoad() );
 }
 
 const UpdateMsg& FieldEntry::getUpdateMsg() const
 {
-	if ( (*_pLoad)->getDataType() != DataType::UpdateMsgEnum )
+	if ( _pDecoder->getLoad().getDataType() != DataType::UpdateMsgEnum )
 	{
 		EmaString temp( "Attempt to getUpdateMsg() while actual data type is " );
-		temp += getDTypeAsString( (*_pLoad)->getDataType() );
+		temp += getDTypeAsString( _pDecoder->getLoad().getDataType() );
 		throwIueException( temp );
 	}
 
-	return static_cast<const UpdateMsg&>( **_pLoad );
+	return static_cast<const UpdateMsg&>( _pDecoder->getLoad() );
 }
 
 const StatusMsg& FieldEntry::getStatusMsg() const
 {
-	if ( (*_pLoad)->getDataType() != DataType::StatusMsgEnum )
+	if ( _pDecoder->getLoad().getDataType() != DataType::StatusMsgEnum )
 	{
 		EmaString temp( "Attempt to getStatusMsg() while actual data type is " );
-		temp += getDTypeAsString( (*_pLoad)->getDataType() );
+		temp += getDTypeAsString( _pDecoder->getLoad().getDataType() );
 		throwIueException( temp );
 	}
 
-	return static_cast<const StatusMsg&>( **_pLoad );
+	return static_cast<const StatusMsg&>( _pDecoder->getLoad() );
 }
 
 const PostMsg& FieldEntry::getPostMsg() const
 {
-	if ( (*_pLoad)->getDataType() != DataType::PostMsgEnum )
+	if ( _pDecoder->getLoad().getDataType() != DataType::PostMsgEnum )
 	{
 		EmaString temp( "Attempt to getRespMsg() while actual entry data type is " );
-		temp += getDTypeAsString( (*_pLoad)->getDataType() );
+		temp += getDTypeAsString( _pDecoder->getLoad().getDataType() );
 		throwIueException( temp );
 	}
 
-	return static_cast<const PostMsg&>( **_pLoad );
+	return static_cast<const PostMsg&>( _pDecoder->getLoad() );
 }
 
 const AckMsg& FieldEntry::getAckMsg() const
 {
-	if ( (*_pLoad)->getDataType() != DataType::AckMsgEnum )
+	if ( _pDecoder->getLoad().getDataType() != DataType::AckMsgEnum )
 	{
 		EmaString temp( "Attempt to getAckMsg() while actual entry data type is " );
-		temp += getDTypeAsString( (*_pLoad)->getDataType() );
+		temp += getDTypeAsString( _pDecoder->getLoad().getDataType() );
 		throwIueException( temp );
 	}
 
-	return static_cast<const AckMsg&>( **_pLoad );
+	return static_cast<const AckMsg&>( _pDecoder->getLoad() );
 }
 
 const GenericMsg& FieldEntry::getGenericMsg() const
 {
-	if ( (*_pLoad)->getDataType() != DataType::GenericMsgEnum )
+	if ( _pDecoder->getLoad().getDataType() != DataType::GenericMsgEnum )
 	{
 		EmaString temp( "Attempt to getGenericMsg() while actual entry data type is " );
-		temp += getDTypeAsString( (*_pLoad)->getDataType() );
+		temp += getDTypeAsString( _pDecoder->getLoad().getDataType() );
 		throwIueException( temp );
 	}
 
-	return static_cast<const GenericMsg&>( **_pLoad );
+	return static_cast<const GenericMsg&>( _pDecoder->getLoad() );
 }
 
 const OmmArray& FieldEntry::getArray() const
 {
-	if ( (*_pLoad)->getDataType() != DataType::ArrayEnum )
+	if ( _pDecoder->getLoad().getDataType() != DataType::ArrayEnum )
 	{
 		EmaString temp( "Attempt to getArray() while actual entry data type is " );
-		temp += getDTypeAsString( (*_pLoad)->getDataType() );
+		temp += getDTypeAsString( _pDecoder->getLoad().getDataType() );
 		throwIueException( temp );
 	}
 
-	return static_cast<const OmmArray&>( **_pLoad );
+	return static_cast<const OmmArray&>( _pDecoder->getLoad() );
 }
 
 const OmmError& FieldEntry::getError() const
 {
-	if ( (*_pLoad)->getDataType() != DataType::ErrorEnum )
+	if ( _pDecoder->getLoad().getDataType() != DataType::ErrorEnum )
 	{
 		EmaString temp( "Attempt to getError() while actual entry data type is " );
-		temp += getDTypeAsString( (*_pLoad)->getDataType() );
+		temp += getDTypeAsString( _pDecoder->getLoad().getDataType() );
 		throwIueException( temp );
 	}
 
-	return static_cast<const OmmError&>( **_pLoad );
+	return static_cast<const OmmError&>( _pDecoder->getLoad() );
 }
 
 const EmaString& FieldEntry::toString() const
@@ -601,15 +601,15 @@ const EmaString& FieldEntry::toString() const
 		.append( "FieldEntry " )
 		.append( " fid=\"" ).append( _pDecoder->getFieldId() ).append( "\"" )
 		.append( " name=\"" ).append( _pDecoder->getName() ).append( "\"" )
-		.append( " dataType=\"" ).append( getDTypeAsString( (*_pLoad)->getDataType() ) );
+		.append( " dataType=\"" ).append( getDTypeAsString( _pDecoder->getLoad().getDataType() ) );
 
-	if ( (*_pLoad)->getDataType() >= DataType::FieldListEnum || (*_pLoad)->getDataType() == DataType::ArrayEnum )
+	if ( _pDecoder->getLoad().getDataType() >= DataType::FieldListEnum || _pDecoder->getLoad().getDataType() == DataType::ArrayEnum )
 	{
-		_toString.append( "\"\n" ).append( (*_pLoad)->toString( 1 ) );
+		_toString.append( "\"\n" ).append( _pDecoder->getLoad().toString( 1 ) );
 		addIndent( _toString, 0 ).append( "FieldEntryEnd\n" );
 	}
 	else
-		_toString.append( "\" value=\"" ).append( (*_pLoad)->toString() ).append( "\"\n" );
+		_toString.append( "\" value=\"" ).append( _pDecoder->getLoad().toString() ).append( "\"\n" );
 
 	return _toString;
 }
@@ -87,6 +87,11 @@ bool FieldList::forth( const Data& data ) const
 	return !_pDecoder->getNextData( data );
 }
 
+bool FieldList::find( Int16 fieldId ) const
+{
+	return !_pDecoder->findData( fieldId );
+}
+
 void FieldList::reset() const
 {
 	_pDecoder->reset();
@@ -162,7 +167,6 @@ Decoder& FieldList::getDecoder()
 	if ( !_pDecoder )
 	{
 		_entry._pDecoder = _pDecoder = g_pool._fieldListDecoderPool.getItem();
-		_entry._pLoad = _pDecoder->getLoadPtr();
 	}
 
 	return *_pDecoder;
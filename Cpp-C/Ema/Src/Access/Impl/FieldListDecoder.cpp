@@ -24,16 +24,19 @@ FieldListDecoder::FieldListDecoder() :
  _decodeIter(),
  _pLoadPool( 0 ),
  _pLoad( 0 ),
+ _loadPending( false ),
  _pRsslDictionary( 0 ),
  _rsslDictionaryEntry( 0 ),
  _rsslLocalFLSetDefDb( 0 ),
+ _pRsslFieldListIndex( 0 ),
  _name(),
  _hexBuffer(),
  _rsslMajVer( RSSL_RWF_MAJOR_VERSION ),
  _rsslMinVer( RSSL_RWF_MINOR_VERSION ),
  _errorCode( OmmError::NoErrorEnum ),
  _decodingStarted( false ),
- _atEnd( false )
+ _atEnd( false ),
+ _indexBuilt( false )
 {
 	createLoadPool( _pLoadPool );
 
@@ -51,6 +54,12 @@ FieldListDecoder::~FieldListDecoder()
 {
 	destroyLoadPool( _pLoadPool );
 
+	if ( _pRsslFieldListIndex )
+	{
+		delete [] _pRsslFieldListIndex->entries;
+		delete _pRsslFieldListIndex;
+	}
+
 	if (_pDataDictionary)
 	{
 		delete _pDataDictionary;
@@ -96,6 +105,10 @@ void FieldListDecoder::clone( const FieldListDecoder& other )
 {
 	_decodingStarted = false;
 
+	_loadPending = false;
+
+	_indexBuilt = false;
+
 	_rsslMajVer = other._rsslMajVer;
 
 	_rsslMinVer = other._rsslMinVer;
@@ -172,6 +185,8 @@ void FieldListDecoder::reset()
 {
 	_decodingStarted = false;
 
+	_loadPending = false;
+
 	if ( !_pRsslDictionary )
 	{
 		_atEnd = false;
@@ -240,6 +255,10 @@ bool FieldListDecoder::setRsslData( UInt8 majVer, UInt8 minVer, RsslBuffer* rssl
 {
 	_decodingStarted = false;
 
+	_loadPending = false;
+
+	_indexBuilt = false;
+
 	_rsslMajVer = majVer;
 
 	_rsslMinVer = minVer;
@@ -310,6 +329,8 @@ bool FieldListDecoder::setRsslData( UInt8 majVer, UInt8 minVer, RsslBuffer* rssl
 
 bool FieldListDecoder::getNextData()
 {
+	_loadPending = false;
+
 	if ( _atEnd ) return true;
 
 	_decodingStarted = true;
@@ -328,7 +349,7 @@ bool FieldListDecoder::getNextData()
 			return false;
 		}
 
-		_pLoad = Decoder::setRsslData( _pLoadPool, _rsslDictionaryEntry->rwfType, &_decodeIter, &_rsslFieldEntry.encData, _pRsslDictionary, 0 ); 
+		_loadPending = true;
 		return false;
 	}
 	case RSSL_RET_END_OF_CONTAINER :
@@ -348,6 +369,8 @@ bool FieldListDecoder::getNextData()
 
 bool FieldListDecoder::getNextData( Int16 fieldId )
 {
+	_loadPending = false;
+
 	RsslRet retCode = RSSL_RET_SUCCESS;
 
 	do {
@@ -377,7 +400,7 @@ bool FieldListDecoder::getNextData( Int16 fieldId )
 			return false;
 		}
 
-		_pLoad = Decoder::setRsslData( _pLoadPool, _rsslDictionaryEntry->rwfType, &_decodeIter, &_rsslFieldEntry.encData, _pRsslDictionary, 0 ); 
+		_loadPending = true;
 		return false;
 	}
 	case RSSL_RET_END_OF_CONTAINER :
@@ -397,6 +420,8 @@ bool FieldListDecoder::getNextData( Int16 fieldId )
 
 bool FieldListDecoder::getNextData( const EmaString& name )
 {
+	_loadPending = false;
+
 	RsslRet retCode = RSSL_RET_SUCCESS;
 	bool matchName = false;
 	EmaStringInt tempName;
@@ -435,7 +460,7 @@ bool FieldListDecoder::getNextData( const EmaString& name )
 			return false;
 		}
 
-		_pLoad = Decoder::setRsslData( _pLoadPool, _rsslDictionaryEntry->rwfType, &_decodeIter, &_rsslFieldEntry.encData, _pRsslDictionary, 0 ); 
+		_loadPending = true;
 		return false;
 	}
 	case RSSL_RET_END_OF_CONTAINER :
@@ -453,8 +478,118 @@ bool FieldListDecoder::getNextData( const EmaString& name )
 	}
 }
 
+bool FieldListDecoder::findData( Int16 fieldId )
+{
+	_loadPending = false;
+
+	if ( _atEnd )
+	{
+		// the iterator has left the field list, so decode its header again; the index stays valid
+		reset();
+
+		if ( _atEnd ) return true;
+
+		// forth() still returns false, as it did before the lookup
+		_atEnd = true;
+	}
+
+	if ( _errorCode != OmmError::NoErrorEnum && _errorCode != OmmError::NoSetDefinitionEnum )
+	{
+		_decodingStarted = true;
+		_pLoad = Decoder::setRsslData( _pLoadPool[DataType::ErrorEnum], _errorCode, &_decodeIter, &_rsslFieldListBuffer );
+		return false;
+	}
+
+	_decodingStarted = true;
+
+	RsslRet retCode = RSSL_RET_SUCCESS;
+
+	if ( !_pRsslFieldListIndex )
+	{
+		try
+		{
+			_pRsslFieldListIndex = new RsslFieldListIndex;
+		}
+		catch ( std::bad_alloc )
+		{
+			throwMeeException( "Failed to allocate memory in FieldListDecoder::findData()." );
+			return true;
+		}
+
+		rsslClearFieldListIndex( _pRsslFieldListIndex );
+	}
+
+	if ( !_indexBuilt )
+	{
+		retCode = rsslDecodeFieldListIndex( &_decodeIter, _pRsslFieldListIndex );
+
+		if ( retCode == RSSL_RET_BUFFER_TOO_SMALL )
+		{
+			delete [] _pRsslFieldListIndex->entries;
+			_pRsslFieldListIndex->entries = 0;
+			_pRsslFieldListIndex->maxEntries = 0;
+
+			try
+			{
+				_pRsslFieldListIndex->entries = new RsslFieldListIndexEntry[ _pRsslFieldListIndex->entryCount ];
+			}
+			catch ( std::bad_alloc )
+			{
+				throwMeeException( "Failed to allocate memory in FieldListDecoder::findData()." );
+				return true;
+			}
+
+			_pRsslFieldListIndex->maxEntries = _pRsslFieldListIndex->entryCount;
+
+			retCode = rsslDecodeFieldListIndex( &_decodeIter, _pRsslFieldListIndex );
+		}
+
+		switch ( retCode )
+		{
+		case RSSL_RET_SUCCESS :
+			_indexBuilt = true;
+			break;
+		case RSSL_RET_INCOMPLETE_DATA :
+			_pLoad = Decoder::setRsslData( _pLoadPool[DataType::ErrorEnum], OmmError::IncompleteDataEnum, &_decodeIter, &_rsslFieldListBuffer );
+			return false;
+		case RSSL_RET_UNSUPPORTED_DATA_TYPE :
+			_pLoad = Decoder::setRsslData( _pLoadPool[DataType::ErrorEnum], OmmError::UnsupportedDataTypeEnum, &_decodeIter, &_rsslFieldListBuffer );
+			return false;
+		default :
+			_pLoad = Decoder::setRsslData( _pLoadPool[DataType::ErrorEnum], OmmError::UnknownErrorEnum, &_decodeIter, &_rsslFieldListBuffer );
+			return false;
+		}
+	}
+
+	retCode = rsslDecodeFieldEntryById( &_decodeIter, _pRsslFieldListIndex, fieldId, &_rsslFieldEntry );
+
+	switch ( retCode )
+	{
+	case RSSL_RET_SUCCESS :
+	{
+		_rsslDictionaryEntry = _pRsslDictionary->entriesArray[_rsslFieldEntry.fieldId];
+
+		if ( !_rsslDictionaryEntry )
+		{
+			_pLoad = Decoder::setRsslData( _pLoadPool[DataType::ErrorEnum], OmmError::FieldIdNotFoundEnum, &_decodeIter, &_rsslFieldEntry.encData ); 
+			return false;
+		}
+
+		_loadPending = true;
+		return false;
+	}
+	case RSSL_RET_END_OF_CONTAINER :
+		return true;
+	default :
+		_pLoad = Decoder::setRsslData( _pLoadPool[DataType::ErrorEnum], OmmError::UnknownErrorEnum, &_decodeIter, &_rsslFieldEntry.encData );
+		return false;
+	}
+}
+
 bool FieldListDecoder::getNextData( const EmaVector< Int16 >& intList )
 {
+	_loadPending = false;
+
 	RsslRet retCode = RSSL_RET_SUCCESS;
 	bool match = false;
 
@@ -503,7 +638,7 @@ bool FieldListDecoder::getNextData( const EmaVector< Int16 >& intList )
 			return false;
 		}
 
-		_pLoad = Decoder::setRsslData( _pLoadPool, _rsslDictionaryEntry->rwfType, &_decodeIter, &_rsslFieldEntry.encData, _pRsslDictionary, 0 ); 
+		_loadPending = true;
 		return false;
 	}
 	case RSSL_RET_END_OF_CONTAINER :
@@ -523,6 +658,8 @@ bool FieldListDecoder::getNextData( const EmaVector< Int16 >& intList )
 
 bool FieldListDecoder::getNextData( const EmaVector< EmaString >& stringList )
 {
+	_loadPending = false;
+
 	RsslRet retCode = RSSL_RET_SUCCESS;
 	bool matchName = false;
 	EmaStringInt tempName;
@@ -577,7 +714,7 @@ bool FieldListDecoder::getNextData( const EmaVector< EmaString >& stringList )
 			return false;
 		}
 
-		_pLoad = Decoder::setRsslData( _pLoadPool, _rsslDictionaryEntry->rwfType, &_decodeIter, &_rsslFieldEntry.encData, _pRsslDictionary, 0 ); 
+		_loadPending = true;
 		return false;
 	}
 	case RSSL_RET_END_OF_CONTAINER :
@@ -731,12 +868,18 @@ void FieldListDecoder::decodeViewList( RsslBuffer* rsslBuffer, RsslDataType& rss
 
 const Data& FieldListDecoder::getLoad() const
 {
+	if ( _loadPending )
+		const_cast< FieldListDecoder* >( this )->decodeLoad();
+
 	return *_pLoad;
 }
 
-Data** FieldListDecoder::getLoadPtr()
+void FieldListDecoder::decodeLoad()
 {
-	return &_pLoad;
+	// the iterator still points at the current entry until the next getNextData() or findData()
+	_loadPending = false;
+
+	_pLoad = Decoder::setRsslData( _pLoadPool, _rsslDictionaryEntry->rwfType, &_decodeIter, &_rsslFieldEntry.encData, _pRsslDictionary, 0 );
 }
 
 void FieldListDecoder::setAtExit()
@@ -46,6 +46,8 @@ public :
 
 	bool getNextData( const Data& );
 
+	bool findData( Int16 );
+
 	void reset();
 
 	const EmaString& getName();
@@ -58,8 +60,6 @@ public :
 
 	const Data& getLoad() const;
 
-	Data** getLoadPtr();
-
 	const EmaBuffer& getHexBuffer();
 	
 	void clone( const FieldListDecoder& );
@@ -92,6 +92,8 @@ private :
 
 	void decodeViewList( RsslBuffer* , RsslDataType& , EmaVector< Int16 >& , EmaVector< EmaString >& );
 
+	void decodeLoad();
+
 	RsslFieldList				_rsslFieldList;
 
 	mutable RsslBuffer			_rsslFieldListBuffer;
@@ -104,12 +106,16 @@ private :
 
 	Data*						_pLoad;
 
+	bool						_loadPending;
+
 	const RsslDataDictionary*	_pRsslDictionary;
 
 	const RsslDictionaryEntry*	_rsslDictionaryEntry;
 
 	RsslLocalFieldSetDefDb*		_rsslLocalFLSetDefDb;
 
+	RsslFieldListIndex*			_pRsslFieldListIndex;
+
 	EmaStringInt				_name;
 
 	mutable EmaStringInt		_rippleToName;
@@ -128,6 +134,8 @@ private :
 
 	bool						_atEnd;
 
+	bool						_indexBuilt;
+
 	thomsonreuters::ema::rdm::DataDictionary*				_pDataDictionary;
 };
 
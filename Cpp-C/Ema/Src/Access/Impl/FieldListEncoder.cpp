@@ -35,6 +35,7 @@ using namespace thomsonreuters::ema::access;
 extern const EmaString& getMTypeAsString( OmmReal::MagnitudeType mType );
 
 FieldListEncoder::FieldListEncoder() :
+ Encoder( DataType::FieldListEnum ),
  _rsslFieldList(),
  _rsslFieldEntry(),
  _containerInitialized( false )
@@ -15,6 +15,7 @@
 using namespace thomsonreuters::ema::access;
 
 FilterListEncoder::FilterListEncoder() :
+ Encoder( DataType::FilterListEnum ),
  _rsslFilterList(),
  _rsslFilterEntry(),
  _containerInitialized( false )
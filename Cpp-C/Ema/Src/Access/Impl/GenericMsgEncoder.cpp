@@ -13,7 +13,7 @@
 using namespace thomsonreuters::ema::access;
 
 GenericMsgEncoder::GenericMsgEncoder() :
- MsgEncoder()
+ MsgEncoder( DataType::GenericMsgEnum )
 #ifdef __EMA_COPY_ON_SET__
  ,_permissionData()
 #endif
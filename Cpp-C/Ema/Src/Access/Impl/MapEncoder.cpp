@@ -17,6 +17,7 @@ using namespace thomsonreuters::ema::access;
 extern const EmaString& getMTypeAsString( OmmReal::MagnitudeType mType );
 
 MapEncoder::MapEncoder() :
+ Encoder( DataType::MapEnum ),
  _rsslMap(),
  _rsslMapEntry(),
  _emaLoadType( DataType::NoDataEnum ),
@@ -8,17 +8,93 @@
 
 #include "MsgDecoder.h"
 #include "StaticDecoder.h"
+#include "ExceptionTranslator.h"
+#include "rtr/rsslMsgEncoders.h"
+
+#include <stdlib.h>
 
 using namespace thomsonreuters::ema::access;
 
 MsgDecoder::MsgDecoder() :
  _pRsslDictionary( 0 ),
  _attrib(),
- _payload()
+ _payload(),
+ _copyBuffer(),
+ _copyCapacity( 0 )
 {
 }
 
 MsgDecoder::~MsgDecoder()
+{
+	StaticDecoder::morph( &_payload, DataType::NoDataEnum );
+	StaticDecoder::morph( &_attrib, DataType::NoDataEnum );
+
+	if ( _copyBuffer.data )
+		free( _copyBuffer.data );
+}
+
+RsslBuffer* MsgDecoder::copyRsslMsg( RsslMsg* pRsslMsg, UInt8 majVer, UInt8 minVer, UInt32 extraLength )
+{
+	UInt32 size = pRsslMsg->msgBase.encDataBody.length + pRsslMsg->msgBase.msgKey.encAttrib.length + 256;
+
+	if ( size < _copyCapacity )
+		size = _copyCapacity;
+
+	while ( true )
+	{
+		RsslBuffer target;
+		UInt32 targetCapacity = _copyCapacity;
+
+		if ( size + extraLength > _copyCapacity )
+		{
+			targetCapacity = size + extraLength;
+			target.data = (char*)malloc( targetCapacity );
+
+			if ( !target.data )
+			{
+				const char* temp = "Failed to allocate memory in MsgDecoder::copyRsslMsg().";
+				throwMeeException( temp );
+				return 0;
+			}
+		}
+		else
+			target.data = _copyBuffer.data;
+
+		target.length = targetCapacity - extraLength;
+
+		RsslEncodeIterator encodeIter;
+		rsslClearEncodeIterator( &encodeIter );
+		rsslSetEncodeIteratorRWFVersion( &encodeIter, majVer, minVer );
+		rsslSetEncodeIteratorBuffer( &encodeIter, &target );
+
+		RsslRet retCode = rsslEncodeMsg( &encodeIter, pRsslMsg );
+
+		if ( retCode == RSSL_RET_SUCCESS )
+		{
+			if ( target.data != _copyBuffer.data )
+			{
+				if ( _copyBuffer.data )
+					free( _copyBuffer.data );
+
+				_copyBuffer.data = target.data;
+				_copyCapacity = targetCapacity;
+			}
+
+			_copyBuffer.length = rsslGetEncodedBufferLength( &encodeIter );
+			return &_copyBuffer;
+		}
+
+		if ( target.data != _copyBuffer.data )
+			free( target.data );
+
+		if ( retCode != RSSL_RET_BUFFER_TOO_SMALL )
+			return 0;
+
+		size = targetCapacity * 2;
+	}
+}
+
+void MsgDecoder::clearAttribAndPayload()
 {
 	StaticDecoder::morph( &_payload, DataType::NoDataEnum );
 	StaticDecoder::morph( &_attrib, DataType::NoDataEnum );
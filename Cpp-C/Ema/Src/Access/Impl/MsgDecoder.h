@@ -68,11 +68,23 @@ protected :
 
 	virtual ~MsgDecoder();
 
+	// encodes RsslMsg into memory owned by this decoder, reserving extraLength bytes after it;
+	// used to retain a received message past the lifetime of the buffer it was read from;
+	// a larger buffer replaces the current one only once the message was encoded into it
+	RsslBuffer* copyRsslMsg( RsslMsg* , UInt8 majVer, UInt8 minVer, UInt32 extraLength );
+
+	// drops the attrib and payload of the last message set on this decoder
+	void clearAttribAndPayload();
+
 	const RsslDataDictionary*		_pRsslDictionary;
 
 	NoDataImpl						_attrib;
 
 	NoDataImpl						_payload;
+
+	RsslBuffer						_copyBuffer;
+
+	UInt32							_copyCapacity;
 };
 
 }
@@ -11,7 +11,8 @@
 
 using namespace thomsonreuters::ema::access;
 
-MsgEncoder::MsgEncoder() :
+MsgEncoder::MsgEncoder( DataType::DataTypeEnum dataType ) :
+ Encoder( dataType ),
 #ifdef __EMA_COPY_ON_SET__
  _name(),
  _serviceName(),
@@ -26,7 +26,7 @@ class MsgEncoder : public Encoder
 {
 public :
 
-	MsgEncoder();
+	MsgEncoder( DataType::DataTypeEnum );
 
 	virtual ~MsgEncoder();
 
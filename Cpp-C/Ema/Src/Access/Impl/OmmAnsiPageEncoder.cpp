@@ -10,7 +10,8 @@
 
 using namespace thomsonreuters::ema::access;
 
-OmmAnsiPageEncoder::OmmAnsiPageEncoder(void)
+OmmAnsiPageEncoder::OmmAnsiPageEncoder(void) :
+ OmmNonRwfEncoder( DataType::AnsiPageEnum )
 {
 }
 
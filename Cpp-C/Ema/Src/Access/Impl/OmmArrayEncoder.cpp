@@ -20,6 +20,7 @@ extern const EmaString& getDTypeAsString( DataType::DataTypeEnum dType );
 extern const EmaString& getMTypeAsString( OmmReal::MagnitudeType mType );
 
 OmmArrayEncoder::OmmArrayEncoder() :
+ Encoder( DataType::ArrayEnum ),
  _rsslArray()
 {
 }
@@ -11,7 +11,8 @@
 
 using namespace thomsonreuters::ema::access;
 
-OmmNonRwfEncoder::OmmNonRwfEncoder()
+OmmNonRwfEncoder::OmmNonRwfEncoder( DataType::DataTypeEnum dataType ) :
+ Encoder( dataType )
 {
 }
 
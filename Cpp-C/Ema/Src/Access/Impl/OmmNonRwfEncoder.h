@@ -21,7 +21,7 @@ class OmmNonRwfEncoder : public Encoder
 {
 public :
 
-	OmmNonRwfEncoder();
+	OmmNonRwfEncoder( DataType::DataTypeEnum );
 
 	virtual ~OmmNonRwfEncoder();
 
@@ -11,7 +11,8 @@
 
 using namespace thomsonreuters::ema::access;
 
-OmmOpaqueEncoder::OmmOpaqueEncoder()
+OmmOpaqueEncoder::OmmOpaqueEncoder() :
+ OmmNonRwfEncoder( DataType::OpaqueEnum )
 {
 }
 
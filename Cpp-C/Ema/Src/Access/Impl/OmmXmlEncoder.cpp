@@ -10,7 +10,8 @@
 
 using namespace thomsonreuters::ema::access;
 
-OmmXmlEncoder::OmmXmlEncoder()
+OmmXmlEncoder::OmmXmlEncoder() :
+ OmmNonRwfEncoder( DataType::XmlEnum )
 {
 }
 
@@ -13,7 +13,7 @@
 using namespace thomsonreuters::ema::access;
 
 PostMsgEncoder::PostMsgEncoder() :
- MsgEncoder()
+ MsgEncoder( DataType::PostMsgEnum )
 #ifdef __EMA_COPY_ON_SET__
  ,_permissionData()
  ,_permissionDataSet( false )
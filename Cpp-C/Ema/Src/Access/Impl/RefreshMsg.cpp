@@ -12,6 +12,7 @@
 #include "OmmState.h"
 #include "EmaBufferInt.h"
 #include "Utilities.h"
+#include "ExceptionTranslator.h"
 #include "GlobalPool.h"
 #include "RdmUtilities.h"
 
@@ -26,6 +27,13 @@ RefreshMsg::RefreshMsg() :
 {
 }
 
+RefreshMsg::RefreshMsg( const RefreshMsg& other ) :
+ Msg(),
+ _toString()
+{
+	*this = other;
+}
+
 RefreshMsg::~RefreshMsg()
 {
 	if ( _pEncoder )
@@ -35,6 +43,29 @@ RefreshMsg::~RefreshMsg()
 		g_pool._refreshMsgDecoderPool.returnItem( static_cast<RefreshMsgDecoder*>( _pDecoder ) );
 }
 
+RefreshMsg& RefreshMsg::operator=( const RefreshMsg& other )
+{
+	if ( this == &other )
+		return *this;
+
+	if ( !other._pDecoder )
+	{
+		EmaString temp( "Attempt to copy RefreshMsg that does not hold a received message." );
+		throwIueException( temp );
+		return *this;
+	}
+
+	if ( _pEncoder )
+	{
+		g_pool._refreshMsgEncoderPool.returnItem( static_cast<RefreshMsgEncoder*>( _pEncoder ) );
+		_pEncoder = 0;
+	}
+
+	static_cast<RefreshMsgDecoder&>( getDecoder() ).clone( *static_cast<const RefreshMsgDecoder*>( other._pDecoder ) );
+
+	return *this;
+}
+
 RefreshMsg& RefreshMsg::clear()
 {
 	if ( _pEncoder )
@@ -130,6 +130,65 @@ bool RefreshMsgDecoder::setRsslData( RsslDecodeIterator* , RsslBuffer* )
 	return false;
 }
 
+void RefreshMsgDecoder::clone( const RefreshMsgDecoder& other )
+{
+	if ( &other == this )
+		return;
+
+	if ( !other._pRsslMsg )
+	{
+		clearClone( other, other._errorCode );
+		return;
+	}
+
+	// the service name is kept right after the copied message
+	UInt32 serviceNameLength = other._serviceNameSet ? other._serviceName.length() : 0;
+
+	RsslBuffer* pCopy = 0;
+
+	try
+	{
+		pCopy = copyRsslMsg( other._pRsslMsg, other._rsslMajVer, other._rsslMinVer, serviceNameLength + 1 );
+	}
+	catch ( ... )
+	{
+		clearClone( other, OmmError::UnknownErrorEnum );
+		throw;
+	}
+
+	if ( !pCopy )
+	{
+		clearClone( other, OmmError::UnknownErrorEnum );
+		return;
+	}
+
+	setRsslData( other._rsslMajVer, other._rsslMinVer, pCopy, other._pRsslDictionary, 0 );
+
+	if ( serviceNameLength )
+	{
+		char* pServiceName = pCopy->data + pCopy->length;
+		memcpy( pServiceName, other._serviceName.c_str(), serviceNameLength );
+		pServiceName[serviceNameLength] = 0;
+
+		setServiceName( pServiceName, serviceNameLength );
+	}
+}
+
+void RefreshMsgDecoder::clearClone( const RefreshMsgDecoder& other, OmmError::ErrorCode errorCode )
+{
+	// nothing from a previously held message may remain visible
+	_pRsslMsg = 0;
+	_serviceNameSet = false;
+	_stateSet = false;
+	_qosSet = false;
+	_pRsslDictionary = other._pRsslDictionary;
+	_rsslMajVer = other._rsslMajVer;
+	_rsslMinVer = other._rsslMinVer;
+	_errorCode = errorCode;
+
+	clearAttribAndPayload();
+}
+
 bool RefreshMsgDecoder::hasMsgKey() const
 {
 	return ( _pRsslMsg->refreshMsg.flags & RSSL_RFMF_HAS_MSG_KEY ) ? true : false;
@@ -35,6 +35,8 @@ public :
 
 	bool setRsslData( RsslDecodeIterator* , RsslBuffer* );
 
+	void clone( const RefreshMsgDecoder& );
+
 	bool hasMsgKey() const;
 
 	bool hasName() const;
@@ -119,6 +121,8 @@ public :
 
 private :
 
+	void clearClone( const RefreshMsgDecoder& , OmmError::ErrorCode );
+
 	void setStateInt() const;
 
 	void setQosInt() const;
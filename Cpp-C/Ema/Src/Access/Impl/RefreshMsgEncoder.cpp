@@ -14,7 +14,7 @@
 using namespace thomsonreuters::ema::access;
 
 RefreshMsgEncoder::RefreshMsgEncoder() :
- MsgEncoder(),
+ MsgEncoder( DataType::RefreshMsgEnum ),
  _rsslRefreshMsg(),
 #ifdef __EMA_COPY_ON_SET__
  _permissionData(),
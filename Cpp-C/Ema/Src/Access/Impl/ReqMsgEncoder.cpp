@@ -18,7 +18,7 @@
 using namespace thomsonreuters::ema::access;
 
 ReqMsgEncoder::ReqMsgEncoder() :
- MsgEncoder(),
+ MsgEncoder( DataType::ReqMsgEnum ),
  _domainTypeSet(false)
 {
 	rsslClearRequestMsg( &_rsslRequestMsg );
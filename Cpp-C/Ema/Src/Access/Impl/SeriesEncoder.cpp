@@ -15,6 +15,7 @@
 using namespace thomsonreuters::ema::access;
 
 SeriesEncoder::SeriesEncoder() :
+ Encoder( DataType::SeriesEnum ),
  _rsslSeries(),
  _rsslSeriesEntry(),
  _emaDataType( DataType::NoDataEnum ),
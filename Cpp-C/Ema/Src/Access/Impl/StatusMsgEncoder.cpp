@@ -13,7 +13,7 @@
 using namespace thomsonreuters::ema::access;
 
 StatusMsgEncoder::StatusMsgEncoder() :
- MsgEncoder(),
+ MsgEncoder( DataType::StatusMsgEnum ),
  _rsslStatusMsg(),
 #ifdef __EMA_COPY_ON_SET__
  _permissionData(),
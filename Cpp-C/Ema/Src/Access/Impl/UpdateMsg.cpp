@@ -11,6 +11,7 @@
 #include "UpdateMsgEncoder.h"
 #include "EmaBufferInt.h"
 #include "Utilities.h"
+#include "ExceptionTranslator.h"
 #include "GlobalPool.h"
 #include "RdmUtilities.h"
 
@@ -25,6 +26,13 @@ UpdateMsg::UpdateMsg() :
 {
 }
 
+UpdateMsg::UpdateMsg( const UpdateMsg& other ) :
+ Msg(),
+ _toString()
+{
+	*this = other;
+}
+
 UpdateMsg::~UpdateMsg()
 {
 	if ( _pEncoder )
@@ -34,6 +42,29 @@ UpdateMsg::~UpdateMsg()
 		g_pool._updateMsgDecoderPool.returnItem( static_cast<UpdateMsgDecoder*>( _pDecoder ) );
 }
 
+UpdateMsg& UpdateMsg::operator=( const UpdateMsg& other )
+{
+	if ( this == &other )
+		return *this;
+
+	if ( !other._pDecoder )
+	{
+		EmaString temp( "Attempt to copy UpdateMsg that does not hold a received message." );
+		throwIueException( temp );
+		return *this;
+	}
+
+	if ( _pEncoder )
+	{
+		g_pool._updateMsgEncoderPool.returnItem( static_cast<UpdateMsgEncoder*>( _pEncoder ) );
+		_pEncoder = 0;
+	}
+
+	static_cast<UpdateMsgDecoder&>( getDecoder() ).clone( *static_cast<const UpdateMsgDecoder*>( other._pDecoder ) );
+
+	return *this;
+}
+
 UpdateMsg& UpdateMsg::clear()
 {
 	if ( _pEncoder )
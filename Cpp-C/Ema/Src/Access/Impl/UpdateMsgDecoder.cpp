@@ -115,6 +115,63 @@ bool UpdateMsgDecoder::setRsslData( RsslDecodeIterator* , RsslBuffer* )
 	return false;
 }
 
+void UpdateMsgDecoder::clone( const UpdateMsgDecoder& other )
+{
+	if ( &other == this )
+		return;
+
+	if ( !other._pRsslMsg )
+	{
+		clearClone( other, other._errorCode );
+		return;
+	}
+
+	// the service name is kept right after the copied message
+	UInt32 serviceNameLength = other._serviceNameSet ? other._serviceName.length() : 0;
+
+	RsslBuffer* pCopy = 0;
+
+	try
+	{
+		pCopy = copyRsslMsg( other._pRsslMsg, other._rsslMajVer, other._rsslMinVer, serviceNameLength + 1 );
+	}
+	catch ( ... )
+	{
+		clearClone( other, OmmError::UnknownErrorEnum );
+		throw;
+	}
+
+	if ( !pCopy )
+	{
+		clearClone( other, OmmError::UnknownErrorEnum );
+		return;
+	}
+
+	setRsslData( other._rsslMajVer, other._rsslMinVer, pCopy, other._pRsslDictionary, 0 );
+
+	if ( serviceNameLength )
+	{
+		char* pServiceName = pCopy->data + pCopy->length;
+		memcpy( pServiceName, other._serviceName.c_str(), serviceNameLength );
+		pServiceName[serviceNameLength] = 0;
+
+		setServiceName( pServiceName, serviceNameLength );
+	}
+}
+
+void UpdateMsgDecoder::clearClone( const UpdateMsgDecoder& other, OmmError::ErrorCode errorCode )
+{
+	// nothing from a previously held message may remain visible
+	_pRsslMsg = 0;
+	_serviceNameSet = false;
+	_pRsslDictionary = other._pRsslDictionary;
+	_rsslMajVer = other._rsslMajVer;
+	_rsslMinVer = other._rsslMinVer;
+	_errorCode = errorCode;
+
+	clearAttribAndPayload();
+}
+
 bool UpdateMsgDecoder::hasMsgKey() const
 {
 	return ( _pRsslMsg->updateMsg.flags & RSSL_UPMF_HAS_MSG_KEY ) ? true : false;
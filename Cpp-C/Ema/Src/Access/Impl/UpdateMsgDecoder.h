@@ -35,6 +35,8 @@ public :
 
 	bool setRsslData( RsslDecodeIterator* , RsslBuffer* );
 
+	void clone( const UpdateMsgDecoder& );
+
 	bool hasMsgKey() const;
 
 	bool hasName() const;
@@ -111,6 +113,8 @@ public :
 
 private :
 
+	void clearClone( const UpdateMsgDecoder& , OmmError::ErrorCode );
+
 	RsslMsg						_rsslMsg;
 
 	RsslMsg*					_pRsslMsg;
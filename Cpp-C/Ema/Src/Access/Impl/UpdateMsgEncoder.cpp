@@ -13,7 +13,7 @@
 using namespace thomsonreuters::ema::access;
 
 UpdateMsgEncoder::UpdateMsgEncoder() :
- MsgEncoder(),
+ MsgEncoder( DataType::UpdateMsgEnum ),
  _rsslUpdateMsg(),
 #ifdef __EMA_COPY_ON_SET__
  _permissionData(),
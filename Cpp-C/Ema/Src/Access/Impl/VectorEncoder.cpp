@@ -15,6 +15,7 @@
 using namespace thomsonreuters::ema::access;
 
 VectorEncoder::VectorEncoder() :
+ Encoder( DataType::VectorEnum ),
  _rsslVector(),
  _rsslVectorEntry(),
  _emaDataType( DataType::NoDataEnum ),
@@ -0,0 +1,64 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright Thomson Reuters 2018. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#ifndef __thomsonreuters_ema_access_EncoderStatistics_h
+#define __thomsonreuters_ema_access_EncoderStatistics_h
+
+/**
+	@class thomsonreuters::ema::access::EncoderStatistics EncoderStatistics.h "Access/Include/EncoderStatistics.h"
+	@brief EncoderStatistics reports how often EMA allocated memory for encoding containers and messages.
+
+	EMA encodes into buffers that are pooled and reused across containers and messages.
+	Once an application has encoded each of its message shapes a few times, both counts
+	are expected to stay constant.
+
+	\remark All methods in this class are \ref ClassLevelSafe.
+	\remark The counts are collected across all threads.
+*/
+
+#include "Access/Include/Common.h"
+
+namespace thomsonreuters {
+
+namespace ema {
+
+namespace access {
+
+class EMA_ACCESS_API EncoderStatistics
+{
+public :
+
+	/** Returns the number of encode buffers allocated or grown up front since start up.
+		@return number of encode buffer allocations
+	*/
+	static UInt64 getAllocationCount();
+
+	/** Returns the number of encode buffers grown part way through encoding, after
+		their current size was found to be too small, since start up.
+		@return number of encode buffer reallocations
+	*/
+	static UInt64 getReallocationCount();
+
+private :
+
+	EncoderStatistics();
+
+	EncoderStatistics( const EncoderStatistics& );
+
+	EncoderStatistics& operator=( const EncoderStatistics& );
+
+	virtual ~EncoderStatistics();
+};
+
+}
+
+}
+
+}
+
+#endif // __thomsonreuters_ema_access_EncoderStatistics_h
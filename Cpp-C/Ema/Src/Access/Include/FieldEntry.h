@@ -388,7 +388,7 @@ private :
 	friend class FieldList;
 
 	FieldListDecoder*		_pDecoder;
-	const Data* const*		_pLoad;
+	const Data* const*		_pLoad;		// unused; kept so that the class layout does not change
 
 	mutable EmaString		_toString;
 
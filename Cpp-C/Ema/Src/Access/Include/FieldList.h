@@ -259,6 +259,14 @@ public :
 	*/
 	bool forth( const Data& data ) const;
 
+	/** Finds the first FieldEntry having the specified FieldId, independently of the iteration done by forth().
+		The first call scans the FieldList once to index its entries, so that each lookup afterwards takes constant time.
+		Typical usage is to extract the found entry via getEntry().
+		@param[in] fieldId looked up FieldEntry's FieldId
+		@return true if an entry with the FieldId was found; false otherwise
+	*/
+	bool find( Int16 fieldId ) const;
+
 	/** Returns Entry.
 		@throw OmmInvalidUsageException if forth() was not called first
 		@return FieldEntry
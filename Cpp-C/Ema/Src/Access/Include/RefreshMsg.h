@@ -55,7 +55,8 @@
 			call to respective has***() method.
 	\remark Objects of this class are intended to be short lived or rather transitional.
 	\remark This class is designed to efficiently perform setting and getting of information from RefreshMsg.
-	\remark Objects of this class are not cache-able.
+	\remark Objects of this class are not cache-able; a received RefreshMsg is valid only within the callback.
+			Use the copy constructor to retain it beyond the callback.
 	\remark	Decoding of just encoded RefreshMsg in the same application is not supported.
 	\remark All methods in this class are \ref SingleThreaded.
 
@@ -86,6 +87,18 @@ public :
 	RefreshMsg();
 	//@}
 
+	///@name Constructor
+	//@{
+	/** Copy constructor.
+		\remark retains a received RefreshMsg by copying its encoded form once into storage owned by
+				this object; attrib and payload are decoded from that copy, so the result stays valid
+				after the callback returns and may be passed to another thread.
+		@throw OmmInvalidUsageException if other does not hold a received message
+		@param[in] other RefreshMsg to copy
+	*/
+	RefreshMsg( const RefreshMsg& other );
+	//@}
+
 	///@name Constructor
 	//@{
 	/** Destructor.
@@ -231,6 +244,14 @@ public :
 
 	///@name Operations
 	//@{
+	/** Assignment operator.
+		\remark retains a received RefreshMsg the same way the copy constructor does
+		@throw OmmInvalidUsageException if other does not hold a received message
+		@param[in] other RefreshMsg to copy
+		@return reference to this object
+	*/
+	RefreshMsg& operator=( const RefreshMsg& other );
+
 	/** Clears the RefreshMsg.
 		\remark Invoking clear() method clears all the values and resets all the defaults
 		@return reference to this object
@@ -396,9 +417,6 @@ private :
 
 	Decoder& getDecoder();
 
-	RefreshMsg( const RefreshMsg& );
-	RefreshMsg& operator=( const RefreshMsg& );
-
 	mutable EmaString		_toString;
 };
 
@@ -50,7 +50,8 @@
 			call to respective has***() method.
 	\remark Objects of this class are intended to be short lived or rather transitional.
 	\remark This class is designed to efficiently perform setting and getting of information from UpdateMsg.
-	\remark Objects of this class are not cache-able.
+	\remark Objects of this class are not cache-able; a received UpdateMsg is valid only within the callback.
+			Use the copy constructor to retain it beyond the callback.
 	\remark	Decoding of just encoded UpdateMsg in the same application is not supported.
 	\remark All methods in this class are \ref SingleThreaded.
 
@@ -79,6 +80,18 @@ public :
 	UpdateMsg();
 	//@}
 
+	///@name Constructor
+	//@{
+	/** Copy constructor.
+		\remark retains a received UpdateMsg by copying its encoded form once into storage owned by
+				this object; attrib and payload are decoded from that copy, so the result stays valid
+				after the callback returns and may be passed to another thread.
+		@throw OmmInvalidUsageException if other does not hold a received message
+		@param[in] other UpdateMsg to copy
+	*/
+	UpdateMsg( const UpdateMsg& other );
+	//@}
+
 	///@name Constructor
 	//@{
 	/** Destructor.
@@ -202,6 +215,14 @@ public :
 
 	///@name Operations
 	//@{
+	/** Assignment operator.
+		\remark retains a received UpdateMsg the same way the copy constructor does
+		@throw OmmInvalidUsageException if other does not hold a received message
+		@param[in] other UpdateMsg to copy
+		@return reference to this object
+	*/
+	UpdateMsg& operator=( const UpdateMsg& other );
+
 	/** Clears the UpdateMsg.
 		\remark Invoking clear() method clears all the values and resets all the defaults
 		@return reference to this object
@@ -335,9 +356,6 @@ private :
 
 	Decoder& getDecoder();
 
-	UpdateMsg( const UpdateMsg& );
-	UpdateMsg& operator=( const UpdateMsg& );
-
 	mutable EmaString		_toString;
 };
 
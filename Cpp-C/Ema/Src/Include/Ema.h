@@ -109,6 +109,7 @@
 
 #include "Access/Include/TunnelStreamRequest.h"
 #include "Access/Include/ChannelInformation.h"
+#include "Access/Include/EncoderStatistics.h"
 
 #include "Domain/Login/Include/Login.h"
 
@@ -183,6 +183,16 @@ void DataDictionary::loadEnumTypeDictionary(const EmaString& filename)
 	_pImpl->loadEnumTypeDictionary(filename);
 }
 
+void DataDictionary::loadSharedDictionary(const EmaString& name, const EmaString& fieldVersion, const EmaString& enumVersion)
+{
+	_pImpl->loadSharedDictionary(name, fieldVersion, enumVersion);
+}
+
+void DataDictionary::publishSharedDictionary(const EmaString& name)
+{
+	_pImpl->publishSharedDictionary(name);
+}
+
 void DataDictionary::encodeFieldDictionary(Series& series, UInt32 verbosity)
 {
 	_pImpl->encodeFieldDictionary(series, verbosity);
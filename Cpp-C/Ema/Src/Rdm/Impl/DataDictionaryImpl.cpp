@@ -186,6 +186,11 @@ void DataDictionaryImpl::clear()
 		_loadedFieldDictionary = false;
 		_loadedEnumTypeDef = false;
 
+		if (_pRsslDataDictionary->isInitialized)
+		{
+			rsslDeleteDataDictionary(_pRsslDataDictionary);
+		}
+
 		rsslClearDataDictionary(_pRsslDataDictionary);
 
 		if (_pDictionaryEntryList)
@@ -277,7 +282,7 @@ const thomsonreuters::ema::access::EmaVector<EnumTypeTable>& DataDictionaryImpl:
 		RsslEnumTypeTable* rsslEnumTypeTable = 0;
 		EnumTypeTable enumTypeTable;
 
-		for (UInt16 index = 0; index <= _pRsslDataDictionary->enumTableCount; index++)
+		for (UInt16 index = 0; index < _pRsslDataDictionary->enumTableCount; index++)
 		{
 			rsslEnumTypeTable = *(_pRsslDataDictionary->enumTables + index);
 
@@ -539,6 +544,57 @@ void DataDictionaryImpl::loadEnumTypeDictionary(const thomsonreuters::ema::acces
 	}
 }
 
+void DataDictionaryImpl::loadSharedDictionary(const thomsonreuters::ema::access::EmaString& name,
+	const thomsonreuters::ema::access::EmaString& fieldVersion, const thomsonreuters::ema::access::EmaString& enumVersion)
+{
+	if ( _ownRsslDataDictionary )
+	{
+		RsslBuffer rsslFieldVersion, rsslEnumVersion;
+		rsslFieldVersion.data = (char*)fieldVersion.c_str();
+		rsslFieldVersion.length = fieldVersion.length();
+		rsslEnumVersion.data = (char*)enumVersion.c_str();
+		rsslEnumVersion.length = enumVersion.length();
+
+		if ( _loadedFieldDictionary || _loadedEnumTypeDef )
+		{
+			thomsonreuters::ema::access::EmaString errorText("Unable to load shared dictionary named ");
+			errorText.append(name).append(CR).append("Reason='DataDictionary is already loaded'");
+			throwIueException(errorText);
+		}
+		else if (rsslAttachSharedDataDictionary(name.c_str(), &rsslFieldVersion, &rsslEnumVersion, _pRsslDataDictionary, &_errorText) < RSSL_RET_SUCCESS)
+		{
+			thomsonreuters::ema::access::EmaString errorText("Unable to load shared dictionary named ");
+			errorText.append(name).append(CR).append("Reason='").append(_errorText.data).append("'");
+			throwIueException(errorText);
+		}
+		else
+		{
+			_loadedFieldDictionary = true;
+			_loadedEnumTypeDef = true;
+		}
+	}
+	else
+	{
+		throwIueForQueryOnly();
+	}
+}
+
+void DataDictionaryImpl::publishSharedDictionary(const thomsonreuters::ema::access::EmaString& name)
+{
+	if ( !_loadedFieldDictionary )
+	{
+		thomsonreuters::ema::access::EmaString errorText("Unable to publish shared dictionary named ");
+		errorText.append(name).append(CR).append("Reason='The field dictionary information was not loaded'");
+		throwIueException(errorText);
+	}
+	else if (rsslPublishSharedDataDictionary(_pRsslDataDictionary, name.c_str(), &_errorText) < RSSL_RET_SUCCESS)
+	{
+		thomsonreuters::ema::access::EmaString errorText("Unable to publish shared dictionary named ");
+		errorText.append(name).append(CR).append("Reason='").append(_errorText.data).append("'");
+		throwIueException(errorText);
+	}
+}
+
 void DataDictionaryImpl::encodeFieldDictionary(thomsonreuters::ema::access::Series& series,
 	thomsonreuters::ema::access::UInt32 verbosity)
 {
@@ -964,7 +1020,7 @@ const thomsonreuters::ema::access::EmaString&  DataDictionaryImpl::toString() co
 	RsslEnumTypeTable* rsslEnumTypeTable = 0;
 	EnumTypeTable enumTypeTable;
 
-	for (UInt16 index = 0; index <= _pRsslDataDictionary->enumTableCount; index++)
+	for (UInt16 index = 0; index < _pRsslDataDictionary->enumTableCount; index++)
 	{
 		rsslEnumTypeTable = *(_pRsslDataDictionary->enumTables + index);
 
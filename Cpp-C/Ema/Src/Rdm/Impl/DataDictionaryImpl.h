@@ -82,6 +82,11 @@ public:
 
 	void loadEnumTypeDictionary(const thomsonreuters::ema::access::EmaString& filename);
 
+	void loadSharedDictionary(const thomsonreuters::ema::access::EmaString& name,
+		const thomsonreuters::ema::access::EmaString& fieldVersion, const thomsonreuters::ema::access::EmaString& enumVersion);
+
+	void publishSharedDictionary(const thomsonreuters::ema::access::EmaString& name);
+
 	void encodeFieldDictionary(thomsonreuters::ema::access::Series& series, thomsonreuters::ema::access::UInt32 verbosity);
 
 	bool encodeFieldDictionary(thomsonreuters::ema::access::Series& series, 
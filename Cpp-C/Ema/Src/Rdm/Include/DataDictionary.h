@@ -280,6 +280,38 @@ public:
 	*/
 	void loadEnumTypeDictionary(const thomsonreuters::ema::access::EmaString& filename);
 
+	/**
+	* Loads a field and enumerated types dictionary that was published in shared
+	* memory by another process on this host (see publishSharedDictionary()).
+	* The dictionary is attached rather than copied, so it takes little time and
+	* memory. The loaded dictionary cannot be modified; call clear() to detach it.
+	*
+	* @param[in] name specifies the name the dictionary was published with
+	* @param[in] fieldVersion specifies the expected field dictionary version
+	* @param[in] enumVersion specifies the expected enumerated types dictionary display template version
+	*
+	* @throw OmmInvalidUsageException if no such dictionary is published, if it
+	* cannot be attached, or if this DataDictionary already has a dictionary loaded.
+	*
+	*/
+	void loadSharedDictionary(const thomsonreuters::ema::access::EmaString& name,
+		const thomsonreuters::ema::access::EmaString& fieldVersion,
+		const thomsonreuters::ema::access::EmaString& enumVersion);
+
+	/**
+	* Publishes this dictionary in shared memory, so that other processes on this
+	* host can load it with loadSharedDictionary() instead of loading or downloading it.
+	* The shared dictionary is identified by \p name together with getFieldVersion()
+	* and getEnumDisplayTemplateVersion(). Does nothing if it is already published.
+	*
+	* @param[in] name specifies the name to publish the dictionary with, e.g. the service name
+	*
+	* @throw OmmInvalidUsageException if no field dictionary is loaded or
+	* the dictionary cannot be published.
+	*
+	*/
+	void publishSharedDictionary(const thomsonreuters::ema::access::EmaString& name);
+
 	/**
 	* Encode the field dictionary information into a data payload
 	* according the domain model, using the field information from the entries
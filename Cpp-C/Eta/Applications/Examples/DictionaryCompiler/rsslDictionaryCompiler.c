@@ -0,0 +1,146 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright Thomson Reuters 2018. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+/*
+ * This is the main file for the DictionaryCompiler application. It loads
+ * a field dictionary and an enumerated types dictionary and writes them
+ * as a compiled image. Applications can then call rsslMapDataDictionary()
+ * on the image instead of loading the dictionary files, which avoids
+ * parsing the files at startup and lets processes on the same machine
+ * share a single copy of the dictionary.
+ *
+ * The image can be checked by mapping it with the -verify option.
+ * See readme file for usage.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "rtr/rsslDataDictionary.h"
+
+static void printUsageAndExit(char *appName)
+{
+	printf("Usage: %s [-f <field dictionary>] [-e <enum dictionary>] [-o <output image>] [-verify]\n"
+			" -f specifies the field dictionary file. Default is RDMFieldDictionary.\n"
+			" -e specifies the enumerated types dictionary file. Default is enumtype.def.\n"
+			" -o specifies the compiled image file to write. Default is RDMDictionary.img.\n"
+			" -verify maps the image after writing it and checks it against the loaded dictionary.\n",
+			appName);
+	exit(-1);
+}
+
+/* Compares the mapped image against the loaded dictionary. */
+static int verifyImage(RsslDataDictionary *pLoaded, RsslDataDictionary *pMapped)
+{
+	int fid;
+
+	if (pLoaded->numberOfEntries != pMapped->numberOfEntries || pLoaded->enumTableCount != pMapped->enumTableCount
+			|| pLoaded->minFid != pMapped->minFid || pLoaded->maxFid != pMapped->maxFid)
+		return 0;
+
+	for (fid = RSSL_MIN_FID; fid <= RSSL_MAX_FID; ++fid)
+	{
+		RsslDictionaryEntry *pLoadedEntry = pLoaded->entriesArray[fid];
+		RsslDictionaryEntry *pMappedEntry = pMapped->entriesArray[fid];
+
+		if (pLoadedEntry == NULL || pMappedEntry == NULL)
+		{
+			if (pLoadedEntry != pMappedEntry)
+				return 0;
+			continue;
+		}
+
+		if (!rsslBufferIsEqual(&pLoadedEntry->acronym, &pMappedEntry->acronym)
+				|| pLoadedEntry->rwfType != pMappedEntry->rwfType
+				|| pLoadedEntry->rwfLength != pMappedEntry->rwfLength
+				|| (pLoadedEntry->pEnumTypeTable == NULL) != (pMappedEntry->pEnumTypeTable == NULL)
+				|| rsslDictionaryGetEntryByFieldName(pMapped, &pLoadedEntry->acronym) != pMappedEntry)
+			return 0;
+	}
+
+	return 1;
+}
+
+int main(int argc, char **argv)
+{
+	const char *fieldDictionaryFile = "RDMFieldDictionary";
+	const char *enumDictionaryFile = "enumtype.def";
+	const char *imageFile = "RDMDictionary.img";
+	int verify = 0;
+	char errorTextData[256];
+	RsslBuffer errorText;
+	RsslDataDictionary dictionary, mappedDictionary;
+	int i;
+
+	for (i = 1; i < argc; ++i)
+	{
+		if (strcmp("-f", argv[i]) == 0 && i + 1 < argc)
+			fieldDictionaryFile = argv[++i];
+		else if (strcmp("-e", argv[i]) == 0 && i + 1 < argc)
+			enumDictionaryFile = argv[++i];
+		else if (strcmp("-o", argv[i]) == 0 && i + 1 < argc)
+			imageFile = argv[++i];
+		else if (strcmp("-verify", argv[i]) == 0)
+			verify = 1;
+		else
+			printUsageAndExit(argv[0]);
+	}
+
+	errorText.data = errorTextData;
+	errorText.length = sizeof(errorTextData);
+
+	rsslClearDataDictionary(&dictionary);
+
+	if (rsslLoadFieldDictionary(fieldDictionaryFile, &dictionary, &errorText) != RSSL_RET_SUCCESS)
+	{
+		printf("Unable to load field dictionary '%s': %s\n", fieldDictionaryFile, errorText.data);
+		return -1;
+	}
+
+	if (rsslLoadEnumTypeDictionary(enumDictionaryFile, &dictionary, &errorText) != RSSL_RET_SUCCESS)
+	{
+		printf("Unable to load enum dictionary '%s': %s\n", enumDictionaryFile, errorText.data);
+		return -1;
+	}
+
+	if (rsslCompileDataDictionary(&dictionary, imageFile, &errorText) != RSSL_RET_SUCCESS)
+	{
+		printf("Unable to compile dictionary: %s\n", errorText.data);
+		rsslDeleteDataDictionary(&dictionary);
+		return -1;
+	}
+
+	printf("Compiled %d fields and %u enumerated type tables to '%s'.\n", 
+			dictionary.numberOfEntries, dictionary.enumTableCount, imageFile);
+
+	if (verify)
+	{
+		rsslClearDataDictionary(&mappedDictionary);
+		if (rsslMapDataDictionary(imageFile, &mappedDictionary, &errorText) != RSSL_RET_SUCCESS)
+		{
+			printf("Unable to map '%s': %s\n", imageFile, errorText.data);
+			rsslDeleteDataDictionary(&dictionary);
+			return -1;
+		}
+
+		if (!verifyImage(&dictionary, &mappedDictionary))
+		{
+			printf("Mapped image does not match the loaded dictionary.\n");
+			rsslDeleteDataDictionary(&mappedDictionary);
+			rsslDeleteDataDictionary(&dictionary);
+			return -1;
+		}
+
+		printf("Verified '%s'.\n", imageFile);
+		rsslDeleteDataDictionary(&mappedDictionary);
+	}
+
+	rsslDeleteDataDictionary(&dictionary);
+	return 0;
+}
@@ -12,6 +12,8 @@
 
 #include <assert.h>
 
+RsslBool marketPriceUseTemplates = RSSL_FALSE;
+
 RsslUInt32 getNextMarketPriceUpdateEstimatedContentLength(MarketPriceItem *mpItem)
 {
 	return xmlMarketPriceMsgs.updateMsgs[mpItem->iMsg].estimatedContentLength;
@@ -78,16 +80,26 @@ RsslRet encodeMarketPriceDataBody(RsslEncodeIterator *pIter, MarketPriceMsg *mpM
 	rsslClearFieldList(&fList);
 	rsslClearFieldEntry(&fEntry);
 	fList.flags = RSSL_FLF_HAS_STANDARD_DATA;
-	if ((ret = rsslEncodeFieldListInit(pIter, &fList, 0, 0)) < RSSL_RET_SUCCESS)
-		return ret;
 
-	for(i = 0; i < mpMsg->fieldEntriesCount; ++i)
+	if (marketPriceUseTemplates && mpMsg->templateValues)
+	{
+		/* Encode the fields from the message's template.  The field list is left open for the latency fields. */
+		if ((ret = rsslEncodeFieldListTemplateInit(pIter, &mpMsg->fieldListTemplate, mpMsg->templateValues)) < RSSL_RET_SUCCESS)
+			return ret;
+	}
+	else
 	{
-		if ((ret = rsslEncodeFieldEntry(pIter, 
-						&mpMsg->fieldEntries[i].fieldEntry, 
-						(!mpMsg->fieldEntries[i].isBlank) ? &mpMsg->fieldEntries[i].primitive : NULL)) 
-				< RSSL_RET_SUCCESS)
+		if ((ret = rsslEncodeFieldListInit(pIter, &fList, 0, 0)) < RSSL_RET_SUCCESS)
 			return ret;
+
+		for(i = 0; i < mpMsg->fieldEntriesCount; ++i)
+		{
+			if ((ret = rsslEncodeFieldEntry(pIter, 
+							&mpMsg->fieldEntries[i].fieldEntry, 
+							(!mpMsg->fieldEntries[i].isBlank) ? &mpMsg->fieldEntries[i].primitive : NULL)) 
+					< RSSL_RET_SUCCESS)
+				return ret;
+		}
 	}
 
 	/* Include the latency time fields in refreshes. */
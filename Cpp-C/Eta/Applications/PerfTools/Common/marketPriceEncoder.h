@@ -26,6 +26,9 @@ typedef struct {
 	RsslInt32		iMsg;
 } MarketPriceItem;
 
+/* Whether to encode MarketPrice payloads using their field list templates(-templateEnc). */
+extern RsslBool marketPriceUseTemplates;
+
 /* Encodes a MarketPrice data body for a message. */
 RsslRet encodeMarketPriceDataBody(RsslEncodeIterator *pIter, MarketPriceMsg *mpMsg,
 		RsslMsgClasses msgClass, RsslUInt encodeStartTime);
@@ -52,6 +52,7 @@ void clearProviderThreadConfig()
 	providerThreadConfig.logLatencyToFile = RSSL_FALSE;
 
 	providerThreadConfig.preEncItems = RSSL_FALSE;
+	providerThreadConfig.templateEncItems = RSSL_FALSE;
 	providerThreadConfig.takeMCastStats = RSSL_FALSE;
 	providerThreadConfig.nanoTime = RSSL_FALSE;
 	providerThreadConfig.measureEncode = RSSL_FALSE;
@@ -170,6 +171,8 @@ void providerThreadConfigInit()
 	if (xmlMsgDataInit(providerThreadConfig.msgFilename) != RSSL_RET_SUCCESS)
 		exit(-1);
 
+	marketPriceUseTemplates = providerThreadConfig.templateEncItems;
+
 	directoryServiceInit();
 }
 
@@ -66,6 +66,7 @@ typedef struct
 		_latencyGenMsgRandomArray;				/* Determines when to send latency gen msgs. */
 
 	RsslBool	preEncItems;				/* Whether to use pre-encoded data rather than fully encoding. */
+	RsslBool	templateEncItems;			/* Whether to encode MarketPrice data using field list templates(-templateEnc). */
 	RsslBool	takeMCastStats;				/* Running a multicast connection and we want stats. */
 	RsslBool	nanoTime;   				/* Configures timestamp format. */
 	RsslBool	measureEncode;				/* Measure time to encode messages(-measureEncode) */
@@ -1059,6 +1059,46 @@ RsslRet xmlMsgDataInit(char *filename)
 	return RSSL_RET_SUCCESS;
 }
 
+/* Builds a field list template for a MarketPrice message.  If any field has a type that
+ * can't be templated, templateValues is left NULL and the message is encoded normally. */
+static RsslRet initMarketPriceTemplate(MarketPriceMsg *pMsg, RsslBuffer *pMemoryBuffer)
+{
+	RsslFieldList fList;
+	RsslInt32 i;
+
+	pMsg->templateValues = NULL;
+	rsslClearFieldListTemplate(&pMsg->fieldListTemplate);
+
+	if (pMsg->fieldEntriesCount == 0)
+		return RSSL_RET_SUCCESS;
+
+	pMsg->fieldListTemplate.entries = (RsslFieldListTemplateEntry*)rsslReserveAlignedBufferMemory(pMemoryBuffer, pMsg->fieldEntriesCount, sizeof(RsslFieldListTemplateEntry));
+	if (!pMsg->fieldListTemplate.entries)
+		return RSSL_RET_BUFFER_TOO_SMALL;
+	pMsg->fieldListTemplate.maxEntries = (RsslUInt16)pMsg->fieldEntriesCount;
+
+	rsslClearFieldList(&fList);
+	fList.flags = RSSL_FLF_HAS_STANDARD_DATA;
+	if (rsslInitFieldListTemplate(&pMsg->fieldListTemplate, &fList) != RSSL_RET_SUCCESS)
+		return RSSL_RET_SUCCESS;
+
+	for (i = 0; i < pMsg->fieldEntriesCount; ++i)
+	{
+		if (rsslAddFieldListTemplateEntry(&pMsg->fieldListTemplate, pMsg->fieldEntries[i].fieldEntry.fieldId, 
+					pMsg->fieldEntries[i].fieldEntry.dataType) != RSSL_RET_SUCCESS)
+			return RSSL_RET_SUCCESS;
+	}
+
+	pMsg->templateValues = (const void**)rsslReserveAlignedBufferMemory(pMemoryBuffer, pMsg->fieldEntriesCount, sizeof(void*));
+	if (!pMsg->templateValues)
+		return RSSL_RET_BUFFER_TOO_SMALL;
+
+	for (i = 0; i < pMsg->fieldEntriesCount; ++i)
+		pMsg->templateValues[i] = pMsg->fieldEntries[i].isBlank ? NULL : &pMsg->fieldEntries[i].primitive;
+
+	return RSSL_RET_SUCCESS;
+}
+
 RsslRet parseXMLMarketPrice(xmlNode *pXmlMsgList)
 {
 	RsslRet ret;
@@ -1160,6 +1200,9 @@ RsslRet parseXMLMarketPrice(xmlNode *pXmlMsgList)
 		if ((ret = parseFieldList(pXmlFieldList, mpMsgData->fieldEntries, &mpMsgData->fieldEntriesCount, &mpMsgMemory)) != RSSL_RET_SUCCESS)
 			return ret;
 
+		if ((ret = initMarketPriceTemplate(mpMsgData, &mpMsgMemory)) != RSSL_RET_SUCCESS)
+			return ret;
+
 		/* Roughly estimate the amount of data in the message to help us figure out an appropriate buffer for encoding. */
 		mpMsgData->estimatedContentLength = getEstimatedFieldListContentLength(mpMsgData->fieldEntries, mpMsgData->fieldEntriesCount);
 
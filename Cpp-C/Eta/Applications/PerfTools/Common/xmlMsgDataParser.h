@@ -102,6 +102,8 @@ typedef struct {
 	RsslInt32	fieldEntriesCount;		/* Number of fields in list. */
 	MarketField *fieldEntries;			/* List of fields. */
 	RsslUInt32	estimatedContentLength;	/* Estimated size of payload. */
+	RsslFieldListTemplate fieldListTemplate;	/* Template of the fields, used when encoding with templates. */
+	const void	**templateValues;		/* Values for the template, or NULL if the fields can't be templated. */
 } MarketPriceMsg;
 
 RTR_C_INLINE void clearMarketPriceMsg(MarketPriceMsg *pMsg)
@@ -279,6 +279,10 @@ void initNIProvPerfConfig(int argc, char **argv)
 		{
 			providerThreadConfig.preEncItems = RSSL_TRUE;
 		}
+		else if (0 == strcmp("-templateEnc", argv[iargs]))
+		{
+			providerThreadConfig.templateEncItems = RSSL_TRUE;
+		}
 		else if (0 == strcmp("-mcastStats", argv[iargs]))
 		{
 			providerThreadConfig.takeMCastStats = RSSL_TRUE;
@@ -467,10 +471,12 @@ void printNIProvPerfConfig(FILE *file)
 
 	fprintf(file,
 			"  Pre-Encoded Updates: %s\n" 
+			"Template-Encoded Data: %s\n" 
 			"      Nanosecond Time: %s\n" 
 			"       Measure Encode: %s\n"
             "      Multicast Stats: %s\n\n",
 			providerThreadConfig.preEncItems ? "Yes" : "No",
+			providerThreadConfig.templateEncItems ? "Yes" : "No",
 			providerThreadConfig.nanoTime ? "Yes" : "No",
 			providerThreadConfig.measureEncode ? "Yes" : "No",
             providerThreadConfig.takeMCastStats ? "Yes" : "No");
@@ -529,6 +535,7 @@ void exitWithUsage()
 			" \n"
 			"  -nanoTime                        Use nanosecond precision for latency information instead of microsecond.\n"
 			"  -preEnc                          Use Pre-Encoded updates\n"
+			"  -templateEnc                     Encode MarketPrice data using field list templates.\n"
 			"  -takeMCastStats                  Take Multicast Statistics(Warning: This enables the per-channel lock).\n"
 			"  -measureEncode                   Measure encoding time of messages.\n"
 			"\n"
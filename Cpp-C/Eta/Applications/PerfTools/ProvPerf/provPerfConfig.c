@@ -239,6 +239,10 @@ void initProvPerfConfig(int argc, char **argv)
 		{
 			providerThreadConfig.preEncItems = RSSL_TRUE;
 		}
+		else if (0 == strcmp("-templateEnc", argv[iargs]))
+		{
+			providerThreadConfig.templateEncItems = RSSL_TRUE;
+		}
 		else if (0 == strcmp("-measureEncode", argv[iargs]))
 		{
 			providerThreadConfig.measureEncode = RSSL_TRUE;
@@ -370,9 +374,11 @@ void printProvPerfConfig(FILE *file)
 
 	fprintf(file,
 			"     Pre-Encoded Updates: %s\n"
+			"   Template-Encoded Data: %s\n"
 			"         Nanosecond Time: %s\n"
 			"          Measure Encode: %s\n",
 			providerThreadConfig.preEncItems ? "Yes" : "No",
+			providerThreadConfig.templateEncItems ? "Yes" : "No",
 			providerThreadConfig.nanoTime ? "Yes" : "No",
 			providerThreadConfig.measureEncode ? "Yes" : "No");
 
@@ -423,6 +429,7 @@ void exitWithUsage()
 			"                                        (e.g. \"-threads 0,1 \" creates two threads bound to CPU's 0 and 1)\n"
 			"\n"
 			"  -preEnc                              Use Pre-Encoded updates\n"
+			"  -templateEnc                         Encode MarketPrice data using field list templates.\n"
 			"  -nanoTime                            Use nanosecond precision for latency information instead of microsecond.\n"
 			"  -measureEncode                       Measure encoding time of messages.\n"
 			"\n"
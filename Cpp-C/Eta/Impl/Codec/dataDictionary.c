@@ -18,6 +18,7 @@ extern "C" {
 #include <sys/types.h>
 #include <stdarg.h>
 #include <stddef.h>
+#include <errno.h>
 
 #include "rtr/rsslDataDictionary.h"
 #include "rtr/rsslDataUtils.h"
@@ -28,6 +29,16 @@ extern "C" {
 #include "rtr/encoderTools.h"
 #include "rtr/textFileReader.h"
 #include "rtr/rsslHashTable.h"
+#include "rtr/shmem.h"
+#include "rtr/rtratomic.h"
+
+#if defined(_WIN32) || defined(WIN32)
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 #define DICTIONARY_MAX_ENTRIES 65535
 
@@ -36,17 +47,31 @@ typedef struct {
 	RsslDictionaryEntry *pDictionaryEntry;	/* Entry for this link*/
 } FieldsByNameLink;
 
+/* How a dictionary image is held in memory. */
+typedef enum {
+	RSSL_DICT_IMAGE_FILE	= 0,	/* Mapped from a compiled image file. */
+	RSSL_DICT_IMAGE_SHARED	= 1,	/* Attached from a shared memory segment. */
+	RSSL_DICT_IMAGE_HEAP	= 2		/* Private copy of a shared image that had to be relocated. */
+} RsslDictionaryImageStorage;
+
 typedef struct {
 	RsslHashTable	fieldsByName;	/* Table of fields by acronym. */
 
 	/* Indicate whether the entries in this dictionary are linked by another one, so we don't delete them on cleanup. */
 	RsslBool isLinked;
 
-	/* Hash table links to use in fieldsByName table. 
+	/* Hash table links to use in fieldsByName table(DICTIONARY_MAX_ENTRIES of them). 
 	 * The links are stored on the dictionary itself, not the entry objects. This allows rsslLinkDataDictionary to add fields to the new
 	 * dictionary without editing the links in the old dictionary (so that the table in the old dictionary can still be safely used 
 	 * without locking it). */
-	FieldsByNameLink fieldsByNameLinks[DICTIONARY_MAX_ENTRIES];
+	FieldsByNameLink *fieldsByNameLinks;
+
+	/* Set if this dictionary was mapped from a compiled image(see rsslMapDataDictionary, rsslAttachSharedDataDictionary). 
+	 * Such dictionaries are read-only. */
+	char			*pImage;
+	RsslUInt64		imageSize;
+	RsslUInt8		imageStorage;	/* See RsslDictionaryImageStorage. */
+	rtrShmSeg		sharedSegment;	/* Segment holding the image, if imageStorage is RSSL_DICT_IMAGE_SHARED. */
 } RsslDictionaryInternal;
 
 typedef struct {
@@ -58,6 +83,103 @@ typedef enum {
 	RSSL_ENUMTYPE_FL_DUPLICATE_DISPLAY	= 0x1 /* This value is one of multiple values that correspond to the same display string. */
 } RsslEnumTypeFlags;
 
+/*** Compiled dictionary images(see rsslCompileDataDictionary, rsslMapDataDictionary) ***/
+
+/* An image holds a complete dictionary -- the RsslDataDictionary structure, entriesArray, entries, enum tables and strings -- 
+ * laid out as it is in memory, with pointers encoded for the image being loaded at baseAddress. Every non-null pointer in the image 
+ * is listed in the relocation table, so that an image that cannot be mapped at baseAddress can be adjusted after loading. */
+#define RSSL_DICTIONARY_IMAGE_MAGIC "RSSLDICT"
+#define RSSL_DICTIONARY_IMAGE_VERSION 1
+#define RSSL_DICTIONARY_IMAGE_BYTE_ORDER 0x01020304
+#define RSSL_DICTIONARY_IMAGE_ALIGN(___size) (((___size) + 7) & ~((size_t)7))
+
+/* Preferred address for images. Images mapped at this address are shared with every other process mapping the same file. */
+#if defined(_WIN64) || defined(_LP64) || defined(__LP64__)
+#define RSSL_DICTIONARY_IMAGE_BASE 0x200000000000ULL
+#else
+#define RSSL_DICTIONARY_IMAGE_BASE 0 /* No preference; images are always relocated. */
+#endif
+
+typedef struct {
+	char		magic[8];			/* RSSL_DICTIONARY_IMAGE_MAGIC */
+	RsslUInt32	version;			/* RSSL_DICTIONARY_IMAGE_VERSION */
+	RsslUInt32	byteOrder;			/* RSSL_DICTIONARY_IMAGE_BYTE_ORDER, as written by the compiling machine. */
+	RsslUInt32	pointerSize;		/* Pointer size of the compiling machine. */
+	RsslUInt32	layoutSize;			/* Combined size of the dictionary structures, to catch layout differences. */
+	RsslUInt64	imageSize;			/* Total size of the image. */
+	RsslUInt64	baseAddress;		/* Address the image pointers are encoded for. */
+	RsslUInt64	dictionaryOffset;	/* Offset of the RsslDataDictionary. */
+	RsslUInt64	nameTableOffset;	/* Offset of the fields-by-name table. */
+	RsslUInt64	relocOffset;		/* Offset of the relocation table. */
+	RsslUInt32	nameTableSize;		/* Number of slots in the fields-by-name table(a power of two). */
+	RsslUInt32	relocCount;			/* Number of relocation table entries. */
+} RsslDictionaryImageHeader;
+
+#define RSSL_DICTIONARY_IMAGE_LAYOUT_SIZE ((RsslUInt32)(sizeof(RsslDictionaryImageHeader) + sizeof(RsslDataDictionary) \
+			+ sizeof(RsslDictionaryEntry) + sizeof(RsslEnumTypeTable) + sizeof(RsslEnumTypeImpl)))
+
+/* Hash for the image's fields-by-name table. This is part of the image format, so it is kept independent of the hash table utilities. */
+static RsslUInt32 _rsslDictionaryImageHash(const RsslBuffer *pName)
+{
+	RsslUInt32 i, hash = 2166136261U;
+
+	for (i = 0; i < pName->length; ++i)
+	{
+		hash ^= (RsslUInt8)pName->data[i];
+		hash *= 16777619U;
+	}
+
+	return hash;
+}
+
+RTR_C_INLINE RsslBool _isMappedDictionary(RsslDataDictionary *dictionary)
+{
+	return (dictionary->isInitialized && ((RsslDictionaryInternal*)dictionary->_internal)->pImage != NULL) ? RSSL_TRUE : RSSL_FALSE;
+}
+
+static void _rsslUnmapDictionaryImage(char *pImage, RsslUInt64 imageSize)
+{
+#if defined(_WIN32) || defined(WIN32)
+	UnmapViewOfFile(pImage);
+#else
+	munmap(pImage, (size_t)imageSize);
+#endif
+}
+
+static void _rsslReleaseDictionaryImage(RsslDictionaryInternal *pDictionaryInternal)
+{
+	switch(pDictionaryInternal->imageStorage)
+	{
+		case RSSL_DICT_IMAGE_SHARED:
+			rtrShmSegDetach(&pDictionaryInternal->sharedSegment);
+			break;
+		case RSSL_DICT_IMAGE_HEAP:
+			free(pDictionaryInternal->pImage);
+			break;
+		default:
+			_rsslUnmapDictionaryImage(pDictionaryInternal->pImage, pDictionaryInternal->imageSize);
+			break;
+	}
+}
+
+static RsslDictionaryEntry *_rsslImageGetEntryByFieldName(RsslDictionaryInternal *pDictionaryInternal, const RsslBuffer *pFieldName)
+{
+	RsslDictionaryImageHeader *pHeader = (RsslDictionaryImageHeader*)pDictionaryInternal->pImage;
+	RsslDictionaryEntry **nameTable = (RsslDictionaryEntry**)(pDictionaryInternal->pImage + pHeader->nameTableOffset);
+	RsslUInt32 mask = pHeader->nameTableSize - 1;
+	RsslUInt32 slot = _rsslDictionaryImageHash(pFieldName) & mask;
+
+	/* Linear probing; the table is never full. */
+	while (nameTable[slot] != NULL)
+	{
+		if (rsslBufferIsEqual(&nameTable[slot]->acronym, pFieldName))
+			return nameTable[slot];
+		slot = (slot + 1) & mask;
+	}
+
+	return NULL;
+}
+
 
 
 /* used for decoding local element list set definitions if user does not pass in memory */
@@ -718,8 +840,15 @@ RsslRet _initDictionary(RsslDataDictionary *dictionary, RsslBuffer *errorText)
 
 	dictionary->_internal = pDictionaryInternal;
 
-	if ( rsslHashTableInit(&pDictionaryInternal->fieldsByName, DICTIONARY_MAX_ENTRIES, rsslHashBufferSum, rsslHashBufferCompare,
-				RSSL_TRUE, &rsslErrorInfo) != RSSL_RET_SUCCESS )
+	pDictionaryInternal->fieldsByNameLinks = (FieldsByNameLink*)calloc(DICTIONARY_MAX_ENTRIES, sizeof(FieldsByNameLink));
+	if (pDictionaryInternal->fieldsByNameLinks == 0)
+	{
+		_setError(errorText, "malloc() of fields-by-name links failed.");
+		return RSSL_RET_FAILURE;
+	}
+
+	if ( rsslHashTableInit(&pDictionaryInternal->fieldsByName, 4096, rsslHashBufferSum, rsslHashBufferCompare,
+				&rsslErrorInfo) != RSSL_RET_SUCCESS )
 	{
 		_setError(errorText, "Failed to initailize fields-by-name table.");
 		return RSSL_RET_FAILURE;
@@ -849,8 +978,12 @@ RsslRet _addFieldToDictionary(RsslDataDictionary *dictionary, RsslDictionaryEntr
 	}
 
 	pDictionaryInternal->fieldsByNameLinks[pEntry->fid - (RSSL_MIN_FID)].pDictionaryEntry = pEntry;
-	rsslHashTableInsertLink(&pDictionaryInternal->fieldsByName, &pDictionaryInternal->fieldsByNameLinks[pEntry->fid - (RSSL_MIN_FID)].nameTableLink, 
-		&pEntry->acronym, &hashSum);
+	if (rsslHashTableInsertLink(&pDictionaryInternal->fieldsByName, &pDictionaryInternal->fieldsByNameLinks[pEntry->fid - (RSSL_MIN_FID)].nameTableLink, 
+		&pEntry->acronym, &hashSum) != RSSL_RET_SUCCESS)
+	{
+		_setError(errorText, "Failed to add fid %d to the field name table.", pEntry->fid);
+		return RSSL_RET_FAILURE;
+	}
 
 	dictionary->numberOfEntries++;
 	if (pEntry->fid > dictionary->maxFid) dictionary->maxFid = pEntry->fid;
@@ -978,6 +1111,12 @@ RSSL_API RsslRet rsslLoadFieldDictionary(	const char				*filename,
 		return RSSL_RET_FAILURE;
 	}
 
+	if (_isMappedDictionary(dictionary))
+	{
+		_setError(errorText, "Dictionary was mapped from an image and cannot be modified.");
+		return RSSL_RET_FAILURE;
+	}
+
 	if ((fp = fopen(filename, "r")) == NULL)
 	{
 		_setError(errorText, "Can't open file: '%s'.", filename);
@@ -1722,6 +1861,15 @@ RSSL_API RsslRet rsslDeleteDataDictionary( RsslDataDictionary *dictionary )
 	pDictionaryInternal = (RsslDictionaryInternal*)dictionary->_internal;
 	RSSL_ASSERT(pDictionaryInternal != NULL, Dictionary internal pointers is null); /* Dictionary was initialized, so this should exist. */
 
+	if (pDictionaryInternal->pImage)
+	{
+		/* Everything lives in the image. */
+		_rsslReleaseDictionaryImage(pDictionaryInternal);
+		free(pDictionaryInternal);
+		dictionary->isInitialized = RSSL_FALSE;
+		return RSSL_RET_SUCCESS;
+	}
+
 	/* Delete tag info */
 	if (dictionary->infoField_Version.data)
 		free(dictionary->infoField_Version.data);
@@ -1776,6 +1924,7 @@ RSSL_API RsslRet rsslDeleteDataDictionary( RsslDataDictionary *dictionary )
 	}
 
 	rsslHashTableCleanup(&pDictionaryInternal->fieldsByName);
+	free(pDictionaryInternal->fieldsByNameLinks);
 	free(pDictionaryInternal);
 
 	dictionary->isInitialized = RSSL_FALSE;
@@ -1806,6 +1955,12 @@ RSSL_API RsslRet rsslDecodeFieldDictionary(
 		return RSSL_RET_FAILURE;
 	}
 
+	if (_isMappedDictionary(dictionary))
+	{
+		_setError(errorText, "Dictionary was mapped from an image and cannot be modified.");
+		return RSSL_RET_FAILURE;
+	}
+
 	if (!dictionary->isInitialized && _initDictionary(dictionary, errorText) != RSSL_RET_SUCCESS)
 		return RSSL_RET_FAILURE;
 
@@ -2114,6 +2269,12 @@ RSSL_API RsslRet rsslLoadEnumTypeDictionary(	const char				*filename,
 		return RSSL_RET_FAILURE;
 	}
 
+	if (_isMappedDictionary(dictionary))
+	{
+		_setError(errorText, "Dictionary was mapped from an image and cannot be modified.");
+		return RSSL_RET_FAILURE;
+	}
+
 	if ((fp = fopen(filename, "r")) == NULL)
 	{
 		_setError(errorText, "Can't open file: '%s'.", filename);
@@ -2305,6 +2466,12 @@ RSSL_API RsslRet rsslDecodeEnumTypeDictionary(
 		return RSSL_RET_FAILURE;
 	}
 
+	if (_isMappedDictionary(dictionary))
+	{
+		_setError(errorText, "Dictionary was mapped from an image and cannot be modified.");
+		return RSSL_RET_FAILURE;
+	}
+
 	if (!dictionary->isInitialized && _initDictionary(dictionary, errorText) != RSSL_RET_SUCCESS)
 		return RSSL_RET_FAILURE;
 
@@ -3116,7 +3283,12 @@ RSSL_API RsslRet rsslExtractDictionaryType(RsslDecodeIterator *dIter,
 RSSL_API RsslDictionaryEntry *rsslDictionaryGetEntryByFieldName(RsslDataDictionary *pDictionary, const RsslBuffer *pFieldName)
 {
 	FieldsByNameLink *pFieldsByNameLink;
-	RsslHashLink *rsslHashLink = rsslHashTableFind(&((RsslDictionaryInternal*)pDictionary->_internal)->fieldsByName, (RsslBuffer*)pFieldName, NULL);
+	RsslHashLink *rsslHashLink;
+
+	if (((RsslDictionaryInternal*)pDictionary->_internal)->pImage != NULL)
+		return _rsslImageGetEntryByFieldName((RsslDictionaryInternal*)pDictionary->_internal, pFieldName);
+
+	rsslHashLink = rsslHashTableFind(&((RsslDictionaryInternal*)pDictionary->_internal)->fieldsByName, (RsslBuffer*)pFieldName, NULL);
 	
 	if (rsslHashLink == NULL)
 		return NULL;
@@ -3162,6 +3334,9 @@ RSSL_API RsslRet rsslLinkDataDictionary(RsslDataDictionary *pNewDictionary, Rssl
 	RsslDictionaryInternal *pNewDictionaryInternal = (RsslDictionaryInternal*)pNewDictionary->_internal;
 	int i;
 
+	if (_isMappedDictionary(pOldDictionary) || _isMappedDictionary(pNewDictionary))
+		return (_setError(errorText, "Dictionaries mapped from an image cannot be linked."), RSSL_RET_FAILURE);
+
 	/* Check that the new dictionary is a superset of the old dictionary before linking them. */
 
 	/* Check that major versions match. */
@@ -3347,6 +3522,805 @@ RSSL_API RsslRet rsslLinkDataDictionary(RsslDataDictionary *pNewDictionary, Rssl
 	return RSSL_RET_SUCCESS;
 }
 
+/*** Dictionary images ***/
+
+typedef struct {
+	char		*data;			/* Image being built. */
+	size_t		length;			/* Used length of the image. */
+	size_t		maxLength;		/* Allocated length of the image. */
+	RsslUInt32	*relocs;		/* Offsets of the pointers in the image. */
+	RsslUInt32	relocCount;
+	RsslUInt32	maxRelocs;
+	RsslUInt64	baseAddress;	/* Address the pointers are encoded for. */
+	RsslBool	failed;			/* Set if memory could not be allocated. */
+} RsslDictionaryImageWriter;
+
+/* Reserves zeroed, aligned space in the image and returns its offset. */
+static size_t _rsslImageReserve(RsslDictionaryImageWriter *pWriter, size_t size)
+{
+	size_t offset = RSSL_DICTIONARY_IMAGE_ALIGN(pWriter->length);
+	size_t newLength = offset + RSSL_DICTIONARY_IMAGE_ALIGN(size);
+
+	if (pWriter->failed)
+		return 0;
+
+	if (newLength > pWriter->maxLength)
+	{
+		size_t newMaxLength = pWriter->maxLength ? pWriter->maxLength : 1024 * 1024;
+		char *newData;
+
+		while (newMaxLength < newLength)
+			newMaxLength *= 2;
+
+		/* Relocation entries are 32-bit offsets. */
+		if ((RsslUInt64)newMaxLength > 0xFFFFFFFFULL || (newData = (char*)realloc(pWriter->data, newMaxLength)) == NULL)
+		{
+			pWriter->failed = RSSL_TRUE;
+			return 0;
+		}
+
+		memset(newData + pWriter->maxLength, 0, newMaxLength - pWriter->maxLength);
+		pWriter->data = newData;
+		pWriter->maxLength = newMaxLength;
+	}
+
+	pWriter->length = newLength;
+	return offset;
+}
+
+/* Stores a pointer to targetOffset at slotOffset, and records the slot in the relocation table. */
+static void _rsslImageSetPointer(RsslDictionaryImageWriter *pWriter, size_t slotOffset, size_t targetOffset)
+{
+	void *ptr;
+
+	if (pWriter->failed)
+		return;
+
+	if (pWriter->relocCount == pWriter->maxRelocs)
+	{
+		RsslUInt32 newMaxRelocs = pWriter->maxRelocs ? pWriter->maxRelocs * 2 : 65536;
+		RsslUInt32 *newRelocs = (RsslUInt32*)realloc(pWriter->relocs, newMaxRelocs * sizeof(RsslUInt32));
+
+		if (newRelocs == NULL)
+		{
+			pWriter->failed = RSSL_TRUE;
+			return;
+		}
+
+		pWriter->relocs = newRelocs;
+		pWriter->maxRelocs = newMaxRelocs;
+	}
+
+	ptr = (void*)(size_t)(pWriter->baseAddress + targetOffset);
+	memcpy(pWriter->data + slotOffset, &ptr, sizeof(void*));
+	pWriter->relocs[pWriter->relocCount++] = (RsslUInt32)slotOffset;
+}
+
+/* Returns the offset that the pointer at slotOffset refers to, or 0 if the pointer is null. */
+static size_t _rsslImageGetPointer(RsslDictionaryImageWriter *pWriter, size_t slotOffset)
+{
+	void *ptr;
+
+	memcpy(&ptr, pWriter->data + slotOffset, sizeof(void*));
+	return ptr ? (size_t)((RsslUInt64)(size_t)ptr - pWriter->baseAddress) : 0;
+}
+
+/* Copies a string into the image, for the RsslBuffer at bufferOffset. */
+static void _rsslImageCopyBuffer(RsslDictionaryImageWriter *pWriter, size_t bufferOffset, const RsslBuffer *pSource)
+{
+	size_t dataOffset;
+
+	if (pSource->data == NULL)
+		return;
+
+	dataOffset = _rsslImageReserve(pWriter, pSource->length + 1);
+	if (pWriter->failed)
+		return;
+
+	memcpy(pWriter->data + dataOffset, pSource->data, pSource->length);
+	((RsslBuffer*)(pWriter->data + bufferOffset))->length = pSource->length;
+	_rsslImageSetPointer(pWriter, bufferOffset + offsetof(RsslBuffer, data), dataOffset);
+}
+
+static void _rsslImageWriterCleanup(RsslDictionaryImageWriter *pWriter)
+{
+	free(pWriter->data);
+	free(pWriter->relocs);
+}
+
+/* Builds an image of the dictionary, with pointers encoded for the given base address. */
+static RsslRet _rsslBuildDictionaryImage(RsslDataDictionary *dictionary, RsslUInt64 baseAddress, RsslDictionaryImageWriter *pWriter, RsslBuffer *errorText)
+{
+	static const size_t infoOffsets[] = {
+		offsetof(RsslDataDictionary, infoField_Version),
+		offsetof(RsslDataDictionary, infoEnum_RT_Version),
+		offsetof(RsslDataDictionary, infoEnum_DT_Version),
+		offsetof(RsslDataDictionary, infoField_Filename),
+		offsetof(RsslDataDictionary, infoField_Desc),
+		offsetof(RsslDataDictionary, infoField_Build),
+		offsetof(RsslDataDictionary, infoField_Date),
+		offsetof(RsslDataDictionary, infoEnum_Filename),
+		offsetof(RsslDataDictionary, infoEnum_Desc),
+		offsetof(RsslDataDictionary, infoEnum_Date)
+	};
+
+	RsslDictionaryImageHeader header;
+	RsslDataDictionary dictionaryCopy;
+	size_t dictionaryOffset, entriesOffset, tablesOffset, nameTableOffset, relocOffset;
+	size_t *tableOffsets = NULL;
+	RsslUInt32 nameTableSize, i;
+	RsslInt32 fid;
+
+	memset(pWriter, 0, sizeof(RsslDictionaryImageWriter));
+	pWriter->baseAddress = baseAddress;
+
+	(void)_rsslImageReserve(pWriter, sizeof(RsslDictionaryImageHeader));
+	dictionaryOffset = _rsslImageReserve(pWriter, sizeof(RsslDataDictionary));
+
+	/* Like a loaded dictionary, the entriesArray covers the full range of fields. */
+	entriesOffset = _rsslImageReserve(pWriter, (RSSL_MAX_FID - RSSL_MIN_FID + 1) * sizeof(RsslDictionaryEntry*));
+	/* Like a loaded dictionary, the enumTables array is followed by a null entry. */
+	tablesOffset = _rsslImageReserve(pWriter, ((size_t)dictionary->enumTableCount + 1) * sizeof(RsslEnumTypeTable*));
+
+	if (dictionary->enumTableCount 
+			&& (tableOffsets = (size_t*)malloc(dictionary->enumTableCount * sizeof(size_t))) == NULL)
+		pWriter->failed = RSSL_TRUE;
+
+	/* Enum type tables. */
+	for (i = 0; i < dictionary->enumTableCount && !pWriter->failed; ++i)
+	{
+		RsslEnumTypeTable *pTable = dictionary->enumTables[i];
+		RsslEnumTypeTable table = *pTable;
+		size_t typesOffset, referencesOffset;
+		RsslUInt32 value;
+
+		tableOffsets[i] = _rsslImageReserve(pWriter, sizeof(RsslEnumTypeTable));
+		typesOffset = _rsslImageReserve(pWriter, ((size_t)pTable->maxValue + 1) * sizeof(RsslEnumType*));
+		referencesOffset = _rsslImageReserve(pWriter, pTable->fidReferenceCount * sizeof(RsslFieldId));
+		if (pWriter->failed)
+			break;
+
+		table.enumTypes = NULL;
+		table.fidReferences = NULL;
+		memcpy(pWriter->data + tableOffsets[i], &table, sizeof(RsslEnumTypeTable));
+		_rsslImageSetPointer(pWriter, tablesOffset + i * sizeof(RsslEnumTypeTable*), tableOffsets[i]);
+		_rsslImageSetPointer(pWriter, tableOffsets[i] + offsetof(RsslEnumTypeTable, enumTypes), typesOffset);
+
+		if (pTable->fidReferenceCount)
+		{
+			memcpy(pWriter->data + referencesOffset, pTable->fidReferences, pTable->fidReferenceCount * sizeof(RsslFieldId));
+			_rsslImageSetPointer(pWriter, tableOffsets[i] + offsetof(RsslEnumTypeTable, fidReferences), referencesOffset);
+		}
+
+		for (value = 0; value <= pTable->maxValue && !pWriter->failed; ++value)
+		{
+			RsslEnumTypeImpl enumType;
+			size_t enumTypeOffset;
+
+			if (pTable->enumTypes[value] == NULL)
+				continue;
+
+			enumType = *(RsslEnumTypeImpl*)pTable->enumTypes[value];
+			rsslClearBuffer(&enumType.base.display);
+			rsslClearBuffer(&enumType.base.meaning);
+
+			enumTypeOffset = _rsslImageReserve(pWriter, sizeof(RsslEnumTypeImpl));
+			if (pWriter->failed)
+				break;
+
+			memcpy(pWriter->data + enumTypeOffset, &enumType, sizeof(RsslEnumTypeImpl));
+			_rsslImageCopyBuffer(pWriter, enumTypeOffset + offsetof(RsslEnumTypeImpl, base) + offsetof(RsslEnumType, display), 
+					&pTable->enumTypes[value]->display);
+			_rsslImageCopyBuffer(pWriter, enumTypeOffset + offsetof(RsslEnumTypeImpl, base) + offsetof(RsslEnumType, meaning), 
+					&pTable->enumTypes[value]->meaning);
+			_rsslImageSetPointer(pWriter, typesOffset + value * sizeof(RsslEnumType*), enumTypeOffset);
+		}
+	}
+
+	/* Entries. */
+	for (fid = RSSL_MIN_FID; fid <= RSSL_MAX_FID && !pWriter->failed; ++fid)
+	{
+		RsslDictionaryEntry *pEntry = dictionary->entriesArray[fid];
+		RsslDictionaryEntry entry;
+		size_t entryOffset;
+
+		if (pEntry == NULL)
+			continue;
+
+		entry = *pEntry;
+		rsslClearBuffer(&entry.acronym);
+		rsslClearBuffer(&entry.ddeAcronym);
+		entry.pEnumTypeTable = NULL;
+
+		entryOffset = _rsslImageReserve(pWriter, sizeof(RsslDictionaryEntry));
+		if (pWriter->failed)
+			break;
+
+		memcpy(pWriter->data + entryOffset, &entry, sizeof(RsslDictionaryEntry));
+		_rsslImageCopyBuffer(pWriter, entryOffset + offsetof(RsslDictionaryEntry, acronym), &pEntry->acronym);
+		_rsslImageCopyBuffer(pWriter, entryOffset + offsetof(RsslDictionaryEntry, ddeAcronym), &pEntry->ddeAcronym);
+
+		if (pEntry->pEnumTypeTable)
+		{
+			for (i = 0; i < dictionary->enumTableCount && dictionary->enumTables[i] != pEntry->pEnumTypeTable; ++i);
+
+			if (i == dictionary->enumTableCount)
+			{
+				free(tableOffsets);
+				_rsslImageWriterCleanup(pWriter);
+				return (_setError(errorText, "Enum table of fid %d is not present in the dictionary.", fid), RSSL_RET_FAILURE);
+			}
+
+			_rsslImageSetPointer(pWriter, entryOffset + offsetof(RsslDictionaryEntry, pEnumTypeTable), tableOffsets[i]);
+		}
+
+		_rsslImageSetPointer(pWriter, entriesOffset + (fid - RSSL_MIN_FID) * sizeof(RsslDictionaryEntry*), entryOffset);
+	}
+
+	free(tableOffsets);
+
+	/* Dictionary structure and tags. */
+	dictionaryCopy = *dictionary;
+	dictionaryCopy.entriesArray = NULL;
+	dictionaryCopy.enumTables = NULL;
+	dictionaryCopy._internal = NULL;
+	for (i = 0; i < sizeof(infoOffsets)/sizeof(size_t); ++i)
+		rsslClearBuffer((RsslBuffer*)((char*)&dictionaryCopy + infoOffsets[i]));
+
+	if (!pWriter->failed)
+	{
+		memcpy(pWriter->data + dictionaryOffset, &dictionaryCopy, sizeof(RsslDataDictionary));
+		_rsslImageSetPointer(pWriter, dictionaryOffset + offsetof(RsslDataDictionary, entriesArray), 
+				entriesOffset + (0 - RSSL_MIN_FID) * sizeof(RsslDictionaryEntry*));
+		_rsslImageSetPointer(pWriter, dictionaryOffset + offsetof(RsslDataDictionary, enumTables), tablesOffset);
+	}
+
+	for (i = 0; i < sizeof(infoOffsets)/sizeof(size_t); ++i)
+		_rsslImageCopyBuffer(pWriter, dictionaryOffset + infoOffsets[i], (RsslBuffer*)((char*)dictionary + infoOffsets[i]));
+
+	/* Fields-by-name table, kept at most half full. Only includes the fields that a lookup on the dictionary would find. */
+	for (nameTableSize = 16; nameTableSize < (RsslUInt32)dictionary->numberOfEntries * 2; nameTableSize *= 2);
+	nameTableOffset = _rsslImageReserve(pWriter, nameTableSize * sizeof(RsslDictionaryEntry*));
+
+	for (fid = RSSL_MIN_FID; fid <= RSSL_MAX_FID && !pWriter->failed; ++fid)
+	{
+		RsslDictionaryEntry *pEntry = dictionary->entriesArray[fid];
+		RsslUInt32 slot;
+
+		if (pEntry == NULL || rsslDictionaryGetEntryByFieldName(dictionary, &pEntry->acronym) != pEntry)
+			continue;
+
+		slot = _rsslDictionaryImageHash(&pEntry->acronym) & (nameTableSize - 1);
+		while (_rsslImageGetPointer(pWriter, nameTableOffset + slot * sizeof(RsslDictionaryEntry*)) != 0)
+			slot = (slot + 1) & (nameTableSize - 1);
+
+		_rsslImageSetPointer(pWriter, nameTableOffset + slot * sizeof(RsslDictionaryEntry*), 
+				_rsslImageGetPointer(pWriter, entriesOffset + (fid - RSSL_MIN_FID) * sizeof(RsslDictionaryEntry*)));
+	}
+
+	/* Relocation table. */
+	relocOffset = _rsslImageReserve(pWriter, pWriter->relocCount * sizeof(RsslUInt32));
+
+	if (pWriter->failed)
+	{
+		_rsslImageWriterCleanup(pWriter);
+		return (_setError(errorText, "Failed to allocate memory for dictionary image."), RSSL_RET_FAILURE);
+	}
+
+	memcpy(pWriter->data + relocOffset, pWriter->relocs, pWriter->relocCount * sizeof(RsslUInt32));
+
+	memset(&header, 0, sizeof(RsslDictionaryImageHeader));
+	memcpy(header.magic, RSSL_DICTIONARY_IMAGE_MAGIC, sizeof(header.magic));
+	header.version = RSSL_DICTIONARY_IMAGE_VERSION;
+	header.byteOrder = RSSL_DICTIONARY_IMAGE_BYTE_ORDER;
+	header.pointerSize = sizeof(void*);
+	header.layoutSize = RSSL_DICTIONARY_IMAGE_LAYOUT_SIZE;
+	header.imageSize = pWriter->length;
+	header.baseAddress = baseAddress;
+	header.dictionaryOffset = dictionaryOffset;
+	header.nameTableOffset = nameTableOffset;
+	header.nameTableSize = nameTableSize;
+	header.relocOffset = relocOffset;
+	header.relocCount = pWriter->relocCount;
+	memcpy(pWriter->data, &header, sizeof(RsslDictionaryImageHeader));
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* Checks that an image header is usable on this machine and consistent with the size of the image. */
+static RsslRet _rsslCheckDictionaryImageHeader(const RsslDictionaryImageHeader *pHeader, RsslUInt64 imageSize, RsslBuffer *errorText)
+{
+	if (memcmp(pHeader->magic, RSSL_DICTIONARY_IMAGE_MAGIC, sizeof(pHeader->magic)) != 0)
+		return (_setError(errorText, "Not a dictionary image."), RSSL_RET_FAILURE);
+
+	if (pHeader->version != RSSL_DICTIONARY_IMAGE_VERSION)
+		return (_setError(errorText, "Unsupported dictionary image version %u.", pHeader->version), RSSL_RET_FAILURE);
+
+	if (pHeader->byteOrder != RSSL_DICTIONARY_IMAGE_BYTE_ORDER || pHeader->pointerSize != sizeof(void*)
+			|| pHeader->layoutSize != RSSL_DICTIONARY_IMAGE_LAYOUT_SIZE)
+		return (_setError(errorText, "Dictionary image was compiled for a different platform."), RSSL_RET_FAILURE);
+
+	if (pHeader->imageSize != imageSize
+			|| pHeader->dictionaryOffset + sizeof(RsslDataDictionary) > imageSize
+			|| pHeader->nameTableSize == 0 || (pHeader->nameTableSize & (pHeader->nameTableSize - 1)) != 0
+			|| pHeader->nameTableOffset + (RsslUInt64)pHeader->nameTableSize * sizeof(void*) > imageSize
+			|| pHeader->relocOffset + (RsslUInt64)pHeader->relocCount * sizeof(RsslUInt32) > imageSize)
+		return (_setError(errorText, "Dictionary image is truncated or corrupt."), RSSL_RET_FAILURE);
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* Checks that every pointer in the image refers to the image, and relocates them if the image is not at its base address. */
+static RsslRet _rsslFixupDictionaryImage(char *pImage, RsslUInt64 imageSize, RsslBool relocate, RsslBuffer *errorText)
+{
+	RsslDictionaryImageHeader *pHeader = (RsslDictionaryImageHeader*)pImage;
+	RsslUInt32 *relocs;
+	RsslUInt64 delta;
+	RsslUInt32 i;
+
+	if (_rsslCheckDictionaryImageHeader(pHeader, imageSize, errorText) != RSSL_RET_SUCCESS)
+		return RSSL_RET_FAILURE;
+
+	relocs = (RsslUInt32*)(pImage + pHeader->relocOffset);
+	delta = (RsslUInt64)(size_t)pImage - pHeader->baseAddress;
+
+	for (i = 0; i < pHeader->relocCount; ++i)
+	{
+		RsslUInt32 slot = relocs[i];
+		void *ptr;
+
+		if (slot % sizeof(void*) != 0 || (RsslUInt64)slot + sizeof(void*) > imageSize)
+			return (_setError(errorText, "Dictionary image is truncated or corrupt."), RSSL_RET_FAILURE);
+
+		memcpy(&ptr, pImage + slot, sizeof(void*));
+		if ((RsslUInt64)(size_t)ptr - pHeader->baseAddress >= imageSize)
+			return (_setError(errorText, "Dictionary image is truncated or corrupt."), RSSL_RET_FAILURE);
+
+		if (relocate)
+		{
+			ptr = (void*)(size_t)((RsslUInt64)(size_t)ptr + delta);
+			memcpy(pImage + slot, &ptr, sizeof(void*));
+		}
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* Sets up a dictionary that uses a fixed-up image. */
+static RsslRet _rsslInitMappedDictionary(RsslDataDictionary *dictionary, char *pImage, RsslBuffer *errorText)
+{
+	RsslDictionaryImageHeader *pHeader = (RsslDictionaryImageHeader*)pImage;
+	RsslDictionaryInternal *pDictionaryInternal;
+
+	if ((pDictionaryInternal = (RsslDictionaryInternal*)calloc(sizeof(RsslDictionaryInternal), 1)) == NULL)
+		return (_setError(errorText, "malloc() of internal dictionary failed."), RSSL_RET_FAILURE);
+
+	pDictionaryInternal->pImage = pImage;
+	pDictionaryInternal->imageSize = pHeader->imageSize;
+
+	*dictionary = *(RsslDataDictionary*)(pImage + pHeader->dictionaryOffset);
+	dictionary->_internal = pDictionaryInternal;
+	dictionary->isInitialized = RSSL_TRUE;
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_API RsslRet rsslCompileDataDictionary(RsslDataDictionary *dictionary, const char *filename, RsslBuffer *errorText)
+{
+	RsslDictionaryImageWriter writer;
+	char *tmpFilename;
+	FILE *fp;
+	size_t written;
+
+	if (filename == 0)
+		return (_setError(errorText, "NULL Filename pointer."), RSSL_RET_FAILURE);
+
+	if (dictionary == 0 || !dictionary->isInitialized)
+		return (_setError(errorText, "Dictionary is not initialized."), RSSL_RET_FAILURE);
+
+	if (_rsslBuildDictionaryImage(dictionary, RSSL_DICTIONARY_IMAGE_BASE, &writer, errorText) != RSSL_RET_SUCCESS)
+		return RSSL_RET_FAILURE;
+
+	/* Write to a temporary file and rename it, so that processes that have the old image mapped are not affected. */
+	if ((tmpFilename = (char*)malloc(strlen(filename) + 5)) == NULL)
+	{
+		_rsslImageWriterCleanup(&writer);
+		return (_setError(errorText, "Failed to allocate memory for dictionary image."), RSSL_RET_FAILURE);
+	}
+	sprintf(tmpFilename, "%s.tmp", filename);
+
+	if ((fp = fopen(tmpFilename, "wb")) == NULL)
+	{
+		_setError(errorText, "Can't open file: '%s'.", tmpFilename);
+		free(tmpFilename);
+		_rsslImageWriterCleanup(&writer);
+		return RSSL_RET_FAILURE;
+	}
+
+	written = fwrite(writer.data, 1, writer.length, fp);
+
+	if (fclose(fp) != 0 || written != writer.length)
+	{
+		_rsslImageWriterCleanup(&writer);
+		_setError(errorText, "Failed to write file: '%s'.", tmpFilename);
+		remove(tmpFilename);
+		free(tmpFilename);
+		return RSSL_RET_FAILURE;
+	}
+
+	_rsslImageWriterCleanup(&writer);
+
+#if defined(_WIN32) || defined(WIN32)
+	remove(filename); /* rename() does not replace existing files. */
+#endif
+	if (rename(tmpFilename, filename) != 0)
+	{
+		_setError(errorText, "Failed to rename '%s' to '%s'.", tmpFilename, filename);
+		remove(tmpFilename);
+		free(tmpFilename);
+		return RSSL_RET_FAILURE;
+	}
+
+	free(tmpFilename);
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_API RsslRet rsslMapDataDictionary(const char *filename, RsslDataDictionary *dictionary, RsslBuffer *errorText)
+{
+	RsslDictionaryImageHeader header;
+	RsslUInt64 imageSize;
+	RsslBool relocate = RSSL_FALSE;
+	char *pImage;
+	FILE *fp;
+#if defined(_WIN32) || defined(WIN32)
+	HANDLE hFile, hMapping;
+	DWORD oldProtect;
+#else
+	int fd;
+#endif
+
+	if (filename == 0)
+		return (_setError(errorText, "NULL Filename pointer."), RSSL_RET_FAILURE);
+
+	if (dictionary == 0)
+		return (_setError(errorText, "NULL Dictionary pointer."), RSSL_RET_FAILURE);
+
+	if (dictionary->isInitialized)
+		return (_setError(errorText, "Dictionary is already initialized."), RSSL_RET_FAILURE);
+
+	/* Read the header first to find the image's size and preferred address. */
+	if ((fp = fopen(filename, "rb")) == NULL)
+		return (_setError(errorText, "Can't open file: '%s'.", filename), RSSL_RET_FAILURE);
+
+	if (fread(&header, sizeof(RsslDictionaryImageHeader), 1, fp) != 1 || fseek(fp, 0, SEEK_END) != 0)
+	{
+		fclose(fp);
+		return (_setError(errorText, "Not a dictionary image."), RSSL_RET_FAILURE);
+	}
+
+	imageSize = (RsslUInt64)ftell(fp);
+	fclose(fp);
+
+	if (_rsslCheckDictionaryImageHeader(&header, imageSize, errorText) != RSSL_RET_SUCCESS)
+		return RSSL_RET_FAILURE;
+
+#if defined(_WIN32) || defined(WIN32)
+	hFile = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (hFile == INVALID_HANDLE_VALUE)
+		return (_setError(errorText, "Can't open file: '%s'.", filename), RSSL_RET_FAILURE);
+
+	hMapping = CreateFileMappingA(hFile, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+	if (hMapping == NULL)
+	{
+		CloseHandle(hFile);
+		return (_setError(errorText, "CreateFileMapping() failed for '%s' (error %lu).", filename, GetLastError()), RSSL_RET_FAILURE);
+	}
+
+	pImage = (char*)MapViewOfFileEx(hMapping, FILE_MAP_READ, 0, 0, 0, (LPVOID)(size_t)header.baseAddress);
+	if (pImage == NULL || (RsslUInt64)(size_t)pImage != header.baseAddress)
+	{
+		/* The preferred address is taken, so use a private copy of the pages that can be relocated. */
+		if (pImage != NULL)
+			UnmapViewOfFile(pImage);
+		pImage = (char*)MapViewOfFileEx(hMapping, FILE_MAP_COPY, 0, 0, 0, NULL);
+		relocate = RSSL_TRUE;
+	}
+
+	CloseHandle(hMapping);
+	CloseHandle(hFile);
+
+	if (pImage == NULL)
+		return (_setError(errorText, "MapViewOfFile() failed for '%s' (error %lu).", filename, GetLastError()), RSSL_RET_FAILURE);
+#else
+	if ((fd = open(filename, O_RDONLY)) < 0)
+		return (_setError(errorText, "Can't open file: '%s'.", filename), RSSL_RET_FAILURE);
+
+	pImage = (char*)mmap((void*)(size_t)header.baseAddress, (size_t)imageSize, PROT_READ, MAP_SHARED, fd, 0);
+	if (pImage != MAP_FAILED && (RsslUInt64)(size_t)pImage != header.baseAddress)
+	{
+		/* The preferred address is taken, so use a private copy of the pages that can be relocated. */
+		munmap(pImage, (size_t)imageSize);
+		pImage = (char*)mmap(NULL, (size_t)imageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+		relocate = RSSL_TRUE;
+	}
+
+	close(fd);
+
+	if (pImage == MAP_FAILED)
+		return (_setError(errorText, "mmap() failed for '%s' (errno %d).", filename, errno), RSSL_RET_FAILURE);
+#endif
+
+	if (_rsslFixupDictionaryImage(pImage, imageSize, relocate, errorText) != RSSL_RET_SUCCESS)
+	{
+		_rsslUnmapDictionaryImage(pImage, imageSize);
+		return RSSL_RET_FAILURE;
+	}
+
+	if (relocate)
+	{
+#if defined(_WIN32) || defined(WIN32)
+		VirtualProtect(pImage, (SIZE_T)imageSize, PAGE_READONLY, &oldProtect);
+#else
+		mprotect(pImage, (size_t)imageSize, PROT_READ);
+#endif
+	}
+
+	if (_rsslInitMappedDictionary(dictionary, pImage, errorText) != RSSL_RET_SUCCESS)
+	{
+		_rsslUnmapDictionaryImage(pImage, imageSize);
+		return RSSL_RET_FAILURE;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+/*** Shared dictionaries(see rsslPublishSharedDataDictionary, rsslAttachSharedDataDictionary) ***/
+
+/* A shared dictionary is a dictionary image held in a named shared memory segment, right after the segment header. 
+ * The segment is named after the dictionary's name and versions, so that processes agree on its contents without 
+ * further coordination. The first word of the image's magic is the ready flag: it is stored last, with a release store, 
+ * and read first, with an acquire barrier. An image without it is still being published. */
+
+/* Preferred addresses for shared segments. Each name gets its own 4GB slot, so that a process can attach 
+ * several shared dictionaries without relocating them. Slot collisions only cost a private, relocated copy. */
+#if defined(_WIN64) || defined(_LP64) || defined(__LP64__)
+#define RSSL_SHARED_DICTIONARY_BASE 0x210000000000ULL
+#define RSSL_SHARED_DICTIONARY_SLOT_SHIFT 32
+#define RSSL_SHARED_DICTIONARY_SLOT_MASK 0xFF
+#else
+#define RSSL_SHARED_DICTIONARY_BASE 0
+#define RSSL_SHARED_DICTIONARY_SLOT_SHIFT 0
+#define RSSL_SHARED_DICTIONARY_SLOT_MASK 0
+#endif
+
+/* Builds the segment key for a shared dictionary. Characters that cannot appear in segment names are replaced. */
+static RsslRet _rsslSharedDictionaryKey(const char *name, const RsslBuffer *pFieldVersion, const RsslBuffer *pEnumVersion,
+		char *key, size_t maxKeyLength, RsslBuffer *errorText)
+{
+	size_t i, keyLength;
+	int ret;
+
+	if (name == 0 || *name == '\0')
+		return (_setError(errorText, "Shared dictionary name is empty."), RSSL_RET_FAILURE);
+
+	ret = snprintf(key, maxKeyLength, "rssldict.%s.%.*s.%.*s", name, 
+			pFieldVersion ? (int)pFieldVersion->length : 0, pFieldVersion && pFieldVersion->data ? pFieldVersion->data : "",
+			pEnumVersion ? (int)pEnumVersion->length : 0, pEnumVersion && pEnumVersion->data ? pEnumVersion->data : "");
+
+	if (ret < 0 || (size_t)ret >= maxKeyLength)
+		return (_setError(errorText, "Shared dictionary name '%s' is too long.", name), RSSL_RET_FAILURE);
+
+	keyLength = (size_t)ret;
+	for (i = 0; i < keyLength; ++i)
+	{
+		if (!isalnum((unsigned char)key[i]) && key[i] != '.' && key[i] != '-' && key[i] != '_')
+			key[i] = '_';
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* Address the image in a shared segment is encoded for. */
+static RsslUInt64 _rsslSharedDictionaryImageBase(const char *key)
+{
+	RsslBuffer keyBuffer;
+	RsslUInt64 segmentBase;
+
+	if (RSSL_SHARED_DICTIONARY_BASE == 0)
+		return 0;
+
+	keyBuffer.data = (char*)key;
+	keyBuffer.length = (RsslUInt32)strlen(key);
+	segmentBase = RSSL_SHARED_DICTIONARY_BASE 
+		+ ((RsslUInt64)(_rsslDictionaryImageHash(&keyBuffer) & RSSL_SHARED_DICTIONARY_SLOT_MASK) << RSSL_SHARED_DICTIONARY_SLOT_SHIFT);
+
+	return segmentBase + RTR_SHM_ALIGNBYTES(sizeof(rtrShmHdr));
+}
+
+/* Value of the ready flag of a published image (the first word of RSSL_DICTIONARY_IMAGE_MAGIC). */
+static rtr_atomic_val _rsslSharedDictionaryReadyValue()
+{
+	rtr_atomic_val readyValue;
+
+	memcpy(&readyValue, RSSL_DICTIONARY_IMAGE_MAGIC, sizeof(rtr_atomic_val));
+	return readyValue;
+}
+
+/* Returns the image in an attached segment if it has been completely published. */
+static char *_rsslSharedDictionaryImage(rtrShmSeg *pSeg, RsslUInt64 *pImageSize)
+{
+	char *pImage = pSeg->base + pSeg->hdr->headerLen;
+	RsslUInt64 imageSize = (RsslUInt64)(pSeg->hdr->totalLen - pSeg->hdr->headerLen);
+
+	if (imageSize < sizeof(RsslDictionaryImageHeader)
+			|| *(volatile rtr_atomic_val*)pImage != _rsslSharedDictionaryReadyValue())
+		return NULL;
+
+	/* Nothing else in the image may be read before the ready flag. */
+#if defined(_WIN32) || defined(WIN32)
+	MemoryBarrier();
+#else
+	__sync_synchronize();
+#endif
+
+	if (memcmp(((RsslDictionaryImageHeader*)pImage)->magic, RSSL_DICTIONARY_IMAGE_MAGIC, sizeof(((RsslDictionaryImageHeader*)pImage)->magic)) != 0)
+		return NULL;
+
+	*pImageSize = imageSize;
+	return pImage;
+}
+
+RSSL_API RsslRet rsslPublishSharedDataDictionary(RsslDataDictionary *dictionary, const char *name, RsslBuffer *errorText)
+{
+	RsslDictionaryImageWriter writer;
+	RsslUInt64 imageSize;
+	char key[__MY_MAX_ADDR - 16]; /* Leaves room for the segment name decoration. */
+	char shmError[256];
+	rtrShmSeg seg;
+	char *pImage;
+
+	if (dictionary == 0 || !dictionary->isInitialized)
+		return (_setError(errorText, "Dictionary is not initialized."), RSSL_RET_FAILURE);
+
+	if (_rsslSharedDictionaryKey(name, &dictionary->infoField_Version, &dictionary->infoEnum_DT_Version, key, sizeof(key), errorText) 
+			!= RSSL_RET_SUCCESS)
+		return RSSL_RET_FAILURE;
+
+	/* Nothing to do if another process already published this dictionary. */
+	if (rtrShmSegAttachReadOnly(&seg, key, NULL, shmError) > 0)
+	{
+		pImage = _rsslSharedDictionaryImage(&seg, &imageSize);
+		rtrShmSegDetach(&seg);
+		if (pImage == NULL)
+			return (_setError(errorText, "Shared dictionary '%s' is being published by another process, or its publisher failed.", key), 
+					RSSL_RET_FAILURE);
+		return RSSL_RET_SUCCESS;
+	}
+
+	if (_rsslBuildDictionaryImage(dictionary, _rsslSharedDictionaryImageBase(key), &writer, errorText) != RSSL_RET_SUCCESS)
+		return RSSL_RET_FAILURE;
+
+	/* The segment can be large and is only read, so it is not locked into memory. */
+	if (rtrShmSegCreatePageable(&seg, key, writer.length, shmError) < 0)
+	{
+		_rsslImageWriterCleanup(&writer);
+		return (_setError(errorText, "Failed to create shared dictionary '%s': %s", key, shmError), RSSL_RET_FAILURE);
+	}
+
+	if ((pImage = rtrShmBytesReserve(&seg, writer.length)) == NULL || pImage != seg.base + seg.hdr->headerLen)
+	{
+		_rsslImageWriterCleanup(&writer);
+		rtrShmSegDestroy(&seg);
+		return (_setError(errorText, "Failed to reserve space for shared dictionary '%s'.", key), RSSL_RET_FAILURE);
+	}
+
+	/* Publish the ready flag last, with a release store, so that attaching processes never see a partial image. */
+	memcpy(pImage + sizeof(rtr_atomic_val), writer.data + sizeof(rtr_atomic_val), writer.length - sizeof(rtr_atomic_val));
+	RTR_ATOMIC_SET(*(rtr_atomic_val*)pImage, _rsslSharedDictionaryReadyValue());
+
+	_rsslImageWriterCleanup(&writer);
+
+	/* Leave the segment in place for other processes. */
+#if defined(_WIN32) || defined(WIN32)
+	/* A named mapping only lasts while a handle to it is open, so the handle is kept for the life of the process. */
+	UnmapViewOfFile(seg.base);
+#else
+	free(seg.hdr->name);
+	seg.hdr->name = 0;
+	rtrShmSegDetach(&seg);
+#endif
+
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_API RsslRet rsslAttachSharedDataDictionary(const char *name, const RsslBuffer *fieldVersion, const RsslBuffer *enumVersion,
+		RsslDataDictionary *dictionary, RsslBuffer *errorText)
+{
+	RsslDictionaryInternal *pDictionaryInternal;
+	RsslUInt64 imageSize, imageBase;
+	char key[__MY_MAX_ADDR - 16];
+	char shmError[256];
+	rtrShmSeg seg;
+	char *pImage;
+
+	if (dictionary == 0)
+		return (_setError(errorText, "NULL Dictionary pointer."), RSSL_RET_FAILURE);
+
+	if (dictionary->isInitialized)
+		return (_setError(errorText, "Dictionary is already initialized."), RSSL_RET_FAILURE);
+
+	if (_rsslSharedDictionaryKey(name, fieldVersion, enumVersion, key, sizeof(key), errorText) != RSSL_RET_SUCCESS)
+		return RSSL_RET_FAILURE;
+
+	imageBase = _rsslSharedDictionaryImageBase(key);
+
+	if (rtrShmSegAttachReadOnly(&seg, key, imageBase ? (void*)(size_t)(imageBase - RTR_SHM_ALIGNBYTES(sizeof(rtrShmHdr))) : NULL, 
+				shmError) < 0)
+		return (_setError(errorText, "Failed to attach shared dictionary '%s': %s", key, shmError), RSSL_RET_FAILURE);
+
+	if ((pImage = _rsslSharedDictionaryImage(&seg, &imageSize)) == NULL)
+	{
+		rtrShmSegDetach(&seg);
+		return (_setError(errorText, "Shared dictionary '%s' is not completely published.", key), RSSL_RET_FAILURE);
+	}
+
+	if (_rsslCheckDictionaryImageHeader((RsslDictionaryImageHeader*)pImage, imageSize, errorText) != RSSL_RET_SUCCESS)
+	{
+		rtrShmSegDetach(&seg);
+		return RSSL_RET_FAILURE;
+	}
+
+	if ((RsslUInt64)(size_t)pImage == ((RsslDictionaryImageHeader*)pImage)->baseAddress)
+	{
+		if (_rsslFixupDictionaryImage(pImage, imageSize, RSSL_FALSE, errorText) != RSSL_RET_SUCCESS
+				|| _rsslInitMappedDictionary(dictionary, pImage, errorText) != RSSL_RET_SUCCESS)
+		{
+			rtrShmSegDetach(&seg);
+			return RSSL_RET_FAILURE;
+		}
+
+		pDictionaryInternal = (RsslDictionaryInternal*)dictionary->_internal;
+		pDictionaryInternal->imageStorage = RSSL_DICT_IMAGE_SHARED;
+		pDictionaryInternal->sharedSegment = seg;
+		return RSSL_RET_SUCCESS;
+	}
+	else
+	{
+		/* The preferred address is taken, so use a private copy that can be relocated. */
+		char *pCopy = (char*)malloc((size_t)imageSize);
+
+		if (pCopy == NULL)
+		{
+			rtrShmSegDetach(&seg);
+			return (_setError(errorText, "Failed to allocate memory for dictionary image."), RSSL_RET_FAILURE);
+		}
+
+		memcpy(pCopy, pImage, (size_t)imageSize);
+		rtrShmSegDetach(&seg);
+
+		if (_rsslFixupDictionaryImage(pCopy, imageSize, RSSL_TRUE, errorText) != RSSL_RET_SUCCESS
+				|| _rsslInitMappedDictionary(dictionary, pCopy, errorText) != RSSL_RET_SUCCESS)
+		{
+			free(pCopy);
+			return RSSL_RET_FAILURE;
+		}
+
+		((RsslDictionaryInternal*)dictionary->_internal)->imageStorage = RSSL_DICT_IMAGE_HEAP;
+		return RSSL_RET_SUCCESS;
+	}
+}
+
+RSSL_API RsslRet rsslRemoveSharedDataDictionary(const char *name, const RsslBuffer *fieldVersion, const RsslBuffer *enumVersion,
+		RsslBuffer *errorText)
+{
+	char key[__MY_MAX_ADDR - 16];
+
+	if (_rsslSharedDictionaryKey(name, fieldVersion, enumVersion, key, sizeof(key), errorText) != RSSL_RET_SUCCESS)
+		return RSSL_RET_FAILURE;
+
+	rtrShmSegUnlink(key);
+	return RSSL_RET_SUCCESS;
+}
+
 #ifdef __cplusplus
 }
 #endif
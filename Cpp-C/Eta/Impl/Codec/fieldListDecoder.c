@@ -241,6 +241,213 @@ RSSL_API RsslRet rsslDecodeFieldEntry(
 	return RSSL_RET_SUCCESS;
 }
 
+/* Field IDs in a field list tend to be small and dense, so their low bits spread them across the slots well. */
+#define _RSSL_FL_INDEX_SLOT(fieldId) ((RsslUInt16)(fieldId) & (RSSL_FIELD_LIST_INDEX_SLOTS - 1))
+
+RSSL_API RsslRet rsslDecodeFieldListIndex(
+				RsslDecodeIterator	*iIter,
+				RsslFieldListIndex	*pIndex )
+{
+	char 				*position;
+	char				*_endBufPtr;
+	RsslFieldList		*fieldList;
+	RsslDecodingLevel	*_levelInfo;
+	RsslFieldListIndexEntry	*pEntry;
+	RsslUInt32			entryCount, i, slot;
+
+	RSSL_ASSERT(iIter && pIndex, Invalid parameters or parameters passed in as NULL);
+	RSSL_ASSERT(iIter->_decodingLevel > -1 && iIter->_decodingLevel < RSSL_ITER_MAX_LEVELS, Invalid or incorrect iterator used);
+
+	_levelInfo = &iIter->_levelInfo[iIter->_decodingLevel];
+
+	RSSL_ASSERT(_levelInfo->_containerType == RSSL_DT_FIELD_LIST && _levelInfo->_listType, Invalid decoding attempted);
+
+	fieldList = (RsslFieldList*)_levelInfo->_listType;
+
+	/* Clear the slots used by the previous field list. */
+	if (pIndex->_decodingLevel >= 0)
+	{
+		for (i = 0; i < pIndex->entryCount; ++i)
+			pIndex->_slots[_RSSL_FL_INDEX_SLOT(pIndex->entries[i].fieldEntry.fieldId)] = 0;
+	}
+
+	entryCount = _levelInfo->_itemCount;
+	if (entryCount > pIndex->maxEntries)
+	{
+		pIndex->entryCount = entryCount;
+		pIndex->_decodingLevel = -1;
+		return RSSL_RET_BUFFER_TOO_SMALL;
+	}
+
+	pIndex->entryCount = 0;
+	pIndex->_decodingLevel = -1;
+	pEntry = pIndex->entries;
+
+	/* Decode any set-defined entries, restoring the iterator afterward so that rsslDecodeFieldEntry is unaffected. */
+	if (_levelInfo->_setCount > 0)
+	{
+		char	*curBufPtr = iIter->_curBufPtr;
+		char	*nextEntryPtr = _levelInfo->_nextEntryPtr;
+		RsslRet	ret = RSSL_RET_SUCCESS;
+
+		_levelInfo->_nextEntryPtr = fieldList->encSetData.data;
+
+		for (i = 0; i < _levelInfo->_setCount; ++i, ++pEntry)
+		{
+			RsslFieldSetDefEntry *encoding = &_levelInfo->_fieldListSetDef->pEntries[i];
+
+			iIter->_curBufPtr = _levelInfo->_nextEntryPtr;
+			pEntry->fieldEntry.fieldId = encoding->fieldId;
+			if ((ret = _rsslDecodeSet(iIter, encoding->dataType, &pEntry->fieldEntry.encData)) != RSSL_RET_SUCCESS)
+				break;
+			pEntry->fieldEntry.dataType = _rsslPrimitiveType(encoding->dataType);
+		}
+
+		iIter->_curBufPtr = curBufPtr;
+		_levelInfo->_nextEntryPtr = nextEntryPtr;
+
+		if (ret != RSSL_RET_SUCCESS)
+			return ret;
+	}
+	else
+		i = 0;
+
+	/* Scan the standard entry headers. Each is a two-byte field ID followed by a length that is one byte
+	 * in the common case, so this only touches the headers and skips over the entry data. */
+	position = fieldList->encEntries.data;
+	_endBufPtr = fieldList->encEntries.data + fieldList->encEntries.length;
+
+	for (; i < entryCount; ++i, ++pEntry)
+	{
+		/* The length is one byte, or a 0xFE marker followed by two more. */
+		if (_endBufPtr - position < 3 || ((RsslUInt8)position[2] >= 0xFE && _endBufPtr - position < 5))
+			return RSSL_RET_INCOMPLETE_DATA;
+
+		position += rwfGet16(pEntry->fieldEntry.fieldId, position);
+		pEntry->fieldEntry.dataType = RSSL_DT_UNKNOWN;
+		position += rwfGetBuffer16(&pEntry->fieldEntry.encData, position);
+
+		if (position > _endBufPtr)
+			return RSSL_RET_INCOMPLETE_DATA;
+	}
+
+	/* Chain the entries from their slots. Later entries are added first, so each chain is in reverse order. */
+	for (i = 0; i < entryCount; ++i)
+	{
+		slot = _RSSL_FL_INDEX_SLOT(pIndex->entries[i].fieldEntry.fieldId);
+		pIndex->entries[i]._nextEntry = pIndex->_slots[slot];
+		pIndex->_slots[slot] = i + 1;
+	}
+
+	pIndex->entryCount = entryCount;
+	pIndex->_decodingLevel = iIter->_decodingLevel;
+	pIndex->_encEntries = fieldList->encEntries;
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_API RsslRet rsslDecodeFieldEntryById(
+				RsslDecodeIterator	*iIter,
+				RsslFieldListIndex	*pIndex,
+				RsslFieldId			fieldId,
+				RsslFieldEntry		*oField )
+{
+	RsslFieldListIndexEntry	*pFound = 0;
+	RsslDecodingLevel		*_levelInfo;
+	RsslFieldList			*fieldList;
+	RsslUInt32				entry;
+
+	RSSL_ASSERT(iIter && pIndex && oField, Invalid parameters or parameters passed in as NULL);
+
+	/* The index must have been built for the field list the iterator is decoding now. */
+	if (iIter->_decodingLevel < 0 || iIter->_decodingLevel != pIndex->_decodingLevel)
+		return RSSL_RET_INVALID_ARGUMENT;
+
+	_levelInfo = &iIter->_levelInfo[iIter->_decodingLevel];
+	if (_levelInfo->_containerType != RSSL_DT_FIELD_LIST || !_levelInfo->_listType)
+		return RSSL_RET_INVALID_ARGUMENT;
+
+	fieldList = (RsslFieldList*)_levelInfo->_listType;
+	if (fieldList->encEntries.data != pIndex->_encEntries.data
+			|| fieldList->encEntries.length != pIndex->_encEntries.length)
+		return RSSL_RET_INVALID_ARGUMENT;
+
+	/* Chains are in reverse order, so the last match is the first entry in the field list. */
+	for (entry = pIndex->_slots[_RSSL_FL_INDEX_SLOT(fieldId)]; entry != 0; entry = pIndex->entries[entry - 1]._nextEntry)
+	{
+		if (pIndex->entries[entry - 1].fieldEntry.fieldId == fieldId)
+			pFound = &pIndex->entries[entry - 1];
+	}
+
+	if (!pFound)
+		return RSSL_RET_END_OF_CONTAINER;
+
+	*oField = pFound->fieldEntry;
+
+	/* Position the iterator on the entry, as rsslDecodeFieldEntry does. */
+	iIter->_curBufPtr = oField->encData.data;
+	iIter->_levelInfo[iIter->_decodingLevel+1]._endBufPtr = oField->encData.data + oField->encData.length;
+
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_API RsslRet rsslDecodeFieldListPatchMap(
+				RsslDecodeIterator		*iIter,
+				RsslFieldListPatchMap	*pMap )
+{
+	char 				*position;
+	char				*_endBufPtr;
+	RsslFieldList		*fieldList;
+	RsslDecodingLevel	*_levelInfo;
+	RsslFieldListPatchEntry	*pEntry;
+	RsslBuffer			value;
+	RsslUInt32			entryLength;
+
+	RSSL_ASSERT(iIter && pMap, Invalid parameters or parameters passed in as NULL);
+	RSSL_ASSERT(iIter->_decodingLevel > -1 && iIter->_decodingLevel < RSSL_ITER_MAX_LEVELS, Invalid or incorrect iterator used);
+
+	_levelInfo = &iIter->_levelInfo[iIter->_decodingLevel];
+
+	RSSL_ASSERT(_levelInfo->_containerType == RSSL_DT_FIELD_LIST && _levelInfo->_listType, Invalid decoding attempted);
+
+	fieldList = (RsslFieldList*)_levelInfo->_listType;
+
+	pMap->entryCount = 0;
+	pMap->_nextEntry = 0;
+
+	position = fieldList->encEntries.data;
+	_endBufPtr = fieldList->encEntries.data + fieldList->encEntries.length;
+
+	/* Entries can only change length if nothing follows them, and nothing encloses them, that would need its own
+	 * length updated. A message payload qualifies: the message header does not record the payload length. */
+	pMap->_canResize = (_endBufPtr == iIter->_pBuffer->data + iIter->_pBuffer->length
+			&& (iIter->_decodingLevel == 0
+				|| (iIter->_decodingLevel == 1 && iIter->_levelInfo[0]._containerType == RSSL_DT_MSG))) ? RSSL_TRUE : RSSL_FALSE;
+
+	while (position < _endBufPtr)
+	{
+		/* The length is one byte, or a 0xFE marker followed by two more. */
+		if (_endBufPtr - position < 3 || ((RsslUInt8)position[2] >= 0xFE && _endBufPtr - position < 5))
+			return RSSL_RET_INCOMPLETE_DATA;
+
+		if (pMap->entryCount == pMap->maxEntries)
+			return RSSL_RET_BUFFER_TOO_SMALL;
+
+		pEntry = &pMap->entries[pMap->entryCount++];
+		position += rwfGet16(pEntry->fieldId, position);
+
+		entryLength = rwfGetBuffer16(&value, position);
+		pEntry->_position = (RsslUInt32)(position - iIter->_pBuffer->data);
+		pEntry->_length = (RsslUInt16)value.length;
+		pEntry->_prefixLength = (RsslUInt8)(entryLength - value.length);
+		position += entryLength;
+	}
+
+	if (position > _endBufPtr)
+		return RSSL_RET_INCOMPLETE_DATA;
+
+	return RSSL_RET_SUCCESS;
+}
+
 RSSL_API RsslRet rsslDecodeLocalFieldSetDefDb(
 				RsslDecodeIterator				*pIter,
 				RsslLocalFieldSetDefDb			*oLocalSetDb )
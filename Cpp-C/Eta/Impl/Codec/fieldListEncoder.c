@@ -677,3 +677,415 @@ RSSL_API RsslRet rsslEncodeLocalFieldSetDefDb(
 	rwfPut8(_levelInfo->_countWritePtr, defCount);
 	return RSSL_RET_SUCCESS;
 }
+
+/* Field list templates */
+
+RSSL_API RsslRet rsslInitFieldListTemplate(
+				RsslFieldListTemplate	*pTemplate,
+				const RsslFieldList		*pFieldList )
+{
+	RsslFieldList *pTemplateList = &pTemplate->_fieldList;
+	char *curPos = pTemplate->_header;
+
+	RSSL_ASSERT(pTemplate && pFieldList, Invalid parameters or parameters passed in as NULL);
+
+	if (pFieldList->flags & (RSSL_FLF_HAS_SET_DATA | RSSL_FLF_HAS_SET_ID))
+		return RSSL_RET_INVALID_ARGUMENT;
+
+	pTemplate->count = 0;
+	pTemplate->_fixedLength = 0;
+	pTemplate->_variableCount = 0;
+
+	rsslClearFieldList(pTemplateList);
+	pTemplateList->flags = RSSL_FLF_HAS_STANDARD_DATA | (pFieldList->flags & RSSL_FLF_HAS_FIELD_LIST_INFO);
+	pTemplateList->dictionaryId = pFieldList->dictionaryId;
+	pTemplateList->fieldListNum = pFieldList->fieldListNum;
+
+	/* The header is the same every time, so build it now (see rsslEncodeFieldListInit). 
+	 * The count that follows it is written by rsslEncodeFieldListComplete, since the
+	 * application may add entries after the template's. */
+	curPos += rwfPut8(curPos, pTemplateList->flags);
+
+	if (rsslFieldListCheckHasInfo(pTemplateList))
+	{
+		char *startPos = curPos;
+
+		if (pTemplateList->dictionaryId > 16383 || pTemplateList->dictionaryId < -16384)
+			return RSSL_RET_INVALID_ARGUMENT;
+
+		curPos += 1;
+		curPos += rwfPutResBitI15(curPos, pTemplateList->dictionaryId);
+		curPos += rwfPut16(curPos, pTemplateList->fieldListNum);
+		rwfPut8(startPos, (RsslUInt8)(curPos - startPos - 1));
+	}
+
+	pTemplate->_headerLength = (RsslUInt8)(curPos - pTemplate->_header);
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_API RsslRet rsslAddFieldListTemplateEntry(
+				RsslFieldListTemplate	*pTemplate,
+				RsslFieldId				fieldId,
+				RsslDataType			dataType )
+{
+	RsslFieldListTemplateEntry *pEntry;
+	RsslDataType primitiveType = _rsslPrimitiveType(dataType);
+	RsslUInt8 maxLength;
+
+	RSSL_ASSERT(pTemplate, Invalid parameters or parameters passed in as NULL);
+
+	switch(primitiveType)
+	{
+		case RSSL_DT_INT:
+		case RSSL_DT_UINT:
+		case RSSL_DT_FLOAT:
+		case RSSL_DT_DOUBLE:
+		case RSSL_DT_REAL:
+		case RSSL_DT_DATE:
+		case RSSL_DT_TIME:
+		case RSSL_DT_DATETIME:
+		case RSSL_DT_QOS:
+		case RSSL_DT_ENUM:
+			/* FieldId, plus the largest length-specified encoding of the type */
+			maxLength = 2 + _rsslDataTypeInfo[primitiveType].maxEncodedSize;
+			break;
+		case RSSL_DT_BUFFER:
+		case RSSL_DT_ASCII_STRING:
+		case RSSL_DT_UTF8_STRING:
+		case RSSL_DT_RMTES_STRING:
+			/* Measured when encoding */
+			maxLength = 0;
+			break;
+		default:
+			return RSSL_RET_UNSUPPORTED_DATA_TYPE;
+	}
+
+	if (pTemplate->count >= pTemplate->maxEntries)
+		return RSSL_RET_BUFFER_TOO_SMALL;
+
+	pEntry = &pTemplate->entries[pTemplate->count++];
+	pEntry->fieldId = fieldId;
+	pEntry->dataType = (RsslUInt8)primitiveType;
+	pEntry->_maxLength = maxLength;
+
+	if (maxLength)
+		pTemplate->_fixedLength += maxLength;
+	else
+	{
+		pTemplate->_fixedLength += 2;
+		++pTemplate->_variableCount;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_API RsslRet rsslAddFieldListTemplateSetDef(
+				RsslFieldListTemplate	*pTemplate,
+				const RsslFieldSetDef	*pSetDef )
+{
+	RsslRet ret;
+	int i;
+
+	RSSL_ASSERT(pTemplate && pSetDef, Invalid parameters or parameters passed in as NULL);
+
+	for (i = 0; i < pSetDef->count; ++i)
+	{
+		if ((ret = rsslAddFieldListTemplateEntry(pTemplate, pSetDef->pEntries[i].fieldId, pSetDef->pEntries[i].dataType)) != RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* Writes a length-specified value of one of the fixed-size types accepted by rsslAddFieldListTemplateEntry.
+ * The caller has made sure there is room for it. */
+RTR_C_ALWAYS_INLINE RsslRet _rsslPutFixedFieldValue(RsslEncodeIterator *pIter, char **ppCurPos, RsslUInt8 dataType, const void *pData)
+{
+	char *curPos = *ppCurPos;
+	RsslRet ret;
+
+	switch(dataType)
+	{
+		case RSSL_DT_UINT:
+			curPos += rwfPutLenSpecU64(curPos, *(const RsslUInt64*)pData);
+			break;
+		case RSSL_DT_INT:
+			curPos += rwfPutLenSpecI64(curPos, *(const RsslInt64*)pData);
+			break;
+		case RSSL_DT_ENUM:
+			curPos += rwfPutLenSpecU16(curPos, *(const RsslEnum*)pData);
+			break;
+		case RSSL_DT_REAL:
+		{
+			const RsslReal *pReal = (const RsslReal*)pData;
+
+			if (pReal->isBlank)
+				curPos += rwfPutLenSpecBlank(curPos);
+			else switch(pReal->hint)
+			{
+				case RSSL_RH_INFINITY:
+				case RSSL_RH_NEG_INFINITY:
+				case RSSL_RH_NOT_A_NUMBER:
+					curPos += rwfPut8(curPos, 1);
+					curPos += rwfPut8(curPos, pReal->hint);
+					break;
+				case 31: /* 31 and 32 are currently reserved */
+				case 32:
+					return RSSL_RET_INVALID_DATA;
+				default:
+					if (pReal->hint > RSSL_RH_NOT_A_NUMBER)
+						return RSSL_RET_INVALID_DATA;
+					curPos += rwfPutLenSpecReal64(curPos, pReal->value, pReal->hint);
+					break;
+			}
+			break;
+		}
+		case RSSL_DT_FLOAT:
+			curPos += rwfPut8(curPos, __RSZFLT);
+			curPos += rwfPutFloat(curPos, *(const RsslFloat*)pData);
+			break;
+		case RSSL_DT_DOUBLE:
+			curPos += rwfPut8(curPos, __RSZDBL);
+			curPos += rwfPutDouble(curPos, *(const RsslDouble*)pData);
+			break;
+		case RSSL_DT_DATE:
+		{
+			const RsslDate *pDate = (const RsslDate*)pData;
+			curPos += rwfPut8(curPos, __RSZDT);
+			curPos += rwfPut8(curPos, pDate->day);
+			curPos += rwfPut8(curPos, pDate->month);
+			curPos += rwfPut16(curPos, pDate->year);
+			break;
+		}
+		default:
+			/* Time, DateTime and Qos lengths depend on the value, so use their encoders. */
+			pIter->_curBufPtr = curPos;
+			pIter->_levelInfo[pIter->_encodingLevel]._encodingState = RSSL_EIS_PRIMITIVE;
+			if ((ret = (*(_rsslDataTypeInfo[dataType].rawEncoders))(pIter, pData)) < 0)
+				return ret;
+			curPos = pIter->_curBufPtr;
+			break;
+	}
+
+	*ppCurPos = curPos;
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_API RsslRet rsslEncodeFieldListTemplateInit(
+				RsslEncodeIterator			*pIter,
+				const RsslFieldListTemplate	*pTemplate,
+				const void * const			*pValues )
+{
+	RsslEncodingLevel *_levelInfo;
+	const RsslFieldListTemplateEntry *pEntry = pTemplate->entries;
+	const RsslFieldListTemplateEntry *pEndEntry = pTemplate->entries + pTemplate->count;
+	const void * const *pValue;
+	RsslUInt32 encSize;
+	char *curPos;
+	RsslRet ret;
+
+	/* Assertions */
+	RSSL_ASSERT(pIter && pTemplate, Invalid parameters or parameters passed in as NULL);
+	RSSL_ASSERT(pValues || pTemplate->count == 0, Invalid parameters or parameters passed in as NULL);
+
+	_levelInfo = &pIter->_levelInfo[++pIter->_encodingLevel]; if (pIter->_encodingLevel >= RSSL_ITER_MAX_LEVELS) return RSSL_RET_ITERATOR_OVERRUN;
+	_rsslInitEncodeIterator(_levelInfo,RSSL_DT_FIELD_LIST,RSSL_EIS_NONE,(RsslFieldList*)&pTemplate->_fieldList, pIter->_curBufPtr);
+
+	/* Fixed-size fields were sized when the template was built; only strings need measuring. */
+	encSize = pTemplate->_headerLength + 2 + pTemplate->_fixedLength;
+	if (pTemplate->_variableCount)
+	{
+		for (pValue = pValues; pEntry < pEndEntry; ++pEntry, ++pValue)
+		{
+			const RsslBuffer *pBuffer = (const RsslBuffer*)*pValue;
+
+			if (pEntry->_maxLength != 0)
+				continue;
+
+			if (!pBuffer)
+				encSize += 1;
+			else if (pBuffer->length > RWF_MAX_16)
+			{
+				_levelInfo->_encodingState = RSSL_EIS_WAIT_COMPLETE;
+				return RSSL_RET_INVALID_DATA;
+			}
+			else
+				encSize += pBuffer->length + ((pBuffer->length < 0xFE) ? 1 : 3);
+		}
+		pEntry = pTemplate->entries;
+	}
+
+	/* Make sure that everything can be encoded; no further checks are needed. */
+	if (_rsslBufferOverrunEndPtr( pIter->_curBufPtr, encSize, pIter->_endBufPtr ))
+	{
+		_levelInfo->_encodingState = RSSL_EIS_WAIT_COMPLETE;
+		return(RSSL_RET_BUFFER_TOO_SMALL);
+	}
+
+	curPos = pIter->_curBufPtr;
+	memcpy(curPos, pTemplate->_header, pTemplate->_headerLength);
+	curPos += pTemplate->_headerLength;
+
+	_levelInfo->_countWritePtr = curPos;
+	curPos += 2;
+
+	for (pValue = pValues; pEntry < pEndEntry; ++pEntry, ++pValue)
+	{
+		const void *pData = *pValue;
+
+		curPos += rwfPut16(curPos, pEntry->fieldId);
+
+		if (!pData)
+		{
+			curPos += rwfPut8(curPos, 0);
+			continue;
+		}
+
+		switch(pEntry->dataType)
+		{
+			case RSSL_DT_BUFFER:
+			case RSSL_DT_ASCII_STRING:
+			case RSSL_DT_UTF8_STRING:
+			case RSSL_DT_RMTES_STRING:
+				curPos = _rsslEncodeBuffer16(curPos, (const RsslBuffer*)pData);
+				break;
+			default:
+				if ((ret = _rsslPutFixedFieldValue(pIter, &curPos, pEntry->dataType, pData)) < 0)
+				{
+					pIter->_curBufPtr = _levelInfo->_containerStartPos;
+					_levelInfo->_encodingState = RSSL_EIS_WAIT_COMPLETE;
+					return ret;
+				}
+				break;
+		}
+	}
+
+	pIter->_curBufPtr = curPos;
+	_levelInfo->_currentCount = pTemplate->count;
+	_levelInfo->_encodingState = RSSL_EIS_ENTRIES;
+	return RSSL_RET_SUCCESS;
+}
+
+/* Field list patching */
+
+RSSL_API RsslRet rsslPatchFieldListEntry(
+				RsslBuffer				*pBuffer,
+				RsslUInt32				maxLength,
+				RsslFieldListPatchMap	*pMap,
+				const RsslFieldEntry	*pField,
+				const void				*pData )
+{
+	RsslFieldListPatchEntry *pEntry;
+	RsslFieldListPatchEntry *pEndEntry = pMap->entries + pMap->entryCount;
+	RsslFieldListPatchEntry *pNextEntry;
+	RsslEncodeIterator encIter;
+	char valueBuf[32];
+	char *curPos = valueBuf;
+	char *pos;
+	RsslBuffer value;
+	RsslUInt8 prefixLength;
+	RsslUInt32 oldLength, newLength;
+	RsslRet ret;
+
+	RSSL_ASSERT(pBuffer && pMap && pField, Invalid parameters or parameters passed in as NULL);
+
+	/* Fields are usually patched in the order they were encoded, so start looking after the last one patched. */
+	for (pEntry = pMap->entries + pMap->_nextEntry; pEntry < pEndEntry; ++pEntry)
+	{
+		if (pEntry->fieldId == pField->fieldId)
+			break;
+	}
+
+	if (pEntry == pEndEntry)
+	{
+		for (pEntry = pMap->entries; pEntry < pEndEntry; ++pEntry)
+		{
+			if (pEntry->fieldId == pField->fieldId)
+				break;
+		}
+
+		if (pEntry == pEndEntry)
+			return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	pMap->_nextEntry = (RsslUInt32)(pEntry + 1 - pMap->entries);
+
+	if (!pData)
+	{
+		value.data = valueBuf;
+		value.length = 0;
+	}
+	else switch(_rsslPrimitiveType(pField->dataType))
+	{
+		case RSSL_DT_INT:
+		case RSSL_DT_UINT:
+		case RSSL_DT_FLOAT:
+		case RSSL_DT_DOUBLE:
+		case RSSL_DT_REAL:
+		case RSSL_DT_DATE:
+		case RSSL_DT_TIME:
+		case RSSL_DT_DATETIME:
+		case RSSL_DT_QOS:
+		case RSSL_DT_ENUM:
+			/* Only the buffer bounds and the level's state are used by the primitive encoders,
+			 * so the iterator does not need a full clear. */
+			encIter._curBufPtr = valueBuf;
+			encIter._endBufPtr = valueBuf + sizeof(valueBuf);
+			encIter._encodingLevel = 0;
+			if ((ret = _rsslPutFixedFieldValue(&encIter, &curPos, _rsslPrimitiveType(pField->dataType), pData)) < 0)
+				return ret;
+
+			/* Fixed-size values always have a one-byte length. */
+			value.data = valueBuf + 1;
+			value.length = (RsslUInt32)(curPos - value.data);
+			break;
+		case RSSL_DT_BUFFER:
+		case RSSL_DT_ASCII_STRING:
+		case RSSL_DT_UTF8_STRING:
+		case RSSL_DT_RMTES_STRING:
+			value = *(const RsslBuffer*)pData;
+			if (value.length > RWF_MAX_16)
+				return RSSL_RET_INVALID_DATA;
+			break;
+		default:
+			return RSSL_RET_UNSUPPORTED_DATA_TYPE;
+	}
+
+	pos = pBuffer->data + pEntry->_position;
+	prefixLength = (value.length < 0xFE) ? 1 : 3;
+	oldLength = pEntry->_prefixLength + pEntry->_length;
+	newLength = prefixLength + value.length;
+
+	if (newLength != oldLength)
+	{
+		/* Move the rest of the message to fit the new value. */
+		char *pTail = pos + oldLength;
+		RsslUInt32 tailLength = (RsslUInt32)(pBuffer->data + pBuffer->length - pTail);
+
+		if (!pMap->_canResize)
+			return RSSL_RET_FAILURE;
+
+		if (pBuffer->length - oldLength + newLength > maxLength)
+			return RSSL_RET_BUFFER_TOO_SMALL;
+
+		memmove(pos + newLength, pTail, tailLength);
+		pBuffer->length = pBuffer->length - oldLength + newLength;
+
+		for (pNextEntry = pEntry + 1; pNextEntry < pEndEntry; ++pNextEntry)
+			pNextEntry->_position = pNextEntry->_position - oldLength + newLength;
+	}
+
+	pEntry->_length = (RsslUInt16)value.length;
+	pEntry->_prefixLength = prefixLength;
+
+	if (prefixLength == 1)
+		pos += rwfPut8(pos, value.length);
+	else
+	{
+		pos += rwfPut8(pos, 0xFE);
+		pos += rwfPut16(pos, value.length);
+	}
+	memcpy(pos, value.data, value.length);
+
+	return RSSL_RET_SUCCESS;
+}
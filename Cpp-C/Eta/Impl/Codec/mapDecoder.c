@@ -7,6 +7,7 @@
  */
 
 #include "rtr/rsslMap.h"
+#include "rtr/rsslFieldList.h"
 #include "rtr/decoderTools.h"
 #include "rtr/rsslIteratorUtilsInt.h"
 #include "rtr/rsslPrimitiveDecoders.h"
@@ -200,6 +201,205 @@ RSSL_API RsslRet rsslDecodeMapEntry(
 	}
 }
 
+/* Size of one value in a column or key array, indexed by primitive type. Zero for types that cannot be decoded into one. */
+static const RsslUInt8 _rsslColumnValueSize[RSSL_DT_RMTES_STRING + 1] =
+{
+	0,						/* RSSL_DT_UNKNOWN */
+	0,
+	0,
+	sizeof(RsslInt),		/* RSSL_DT_INT */
+	sizeof(RsslUInt),		/* RSSL_DT_UINT */
+	sizeof(RsslFloat),		/* RSSL_DT_FLOAT */
+	sizeof(RsslDouble),		/* RSSL_DT_DOUBLE */
+	0,
+	sizeof(RsslReal),		/* RSSL_DT_REAL */
+	sizeof(RsslDate),		/* RSSL_DT_DATE */
+	sizeof(RsslTime),		/* RSSL_DT_TIME */
+	sizeof(RsslDateTime),	/* RSSL_DT_DATETIME */
+	0,						/* RSSL_DT_QOS */
+	0,						/* RSSL_DT_STATE */
+	sizeof(RsslEnum),		/* RSSL_DT_ENUM */
+	0,						/* RSSL_DT_ARRAY */
+	sizeof(RsslBuffer),		/* RSSL_DT_BUFFER */
+	sizeof(RsslBuffer),		/* RSSL_DT_ASCII_STRING */
+	sizeof(RsslBuffer),		/* RSSL_DT_UTF8_STRING */
+	sizeof(RsslBuffer)		/* RSSL_DT_RMTES_STRING */
+};
+
+#define _rsslGetColumnValueSize(dataType) (((dataType) <= RSSL_DT_RMTES_STRING) ? _rsslColumnValueSize[(dataType)] : 0)
+
+/* Decodes the field the iterator is positioned on into its column, if it has one. */
+RTR_C_ALWAYS_INLINE RsslRet _rsslDecodeColumnValue(RsslDecodeIterator *iIter, RsslMapFieldListColumns *pColumns, RsslFieldId fieldId, RsslUInt32 row)
+{
+	RsslMapFieldListColumn	*pColumn = pColumns->columns;
+	RsslMapFieldListColumn	*pEnd = pColumn + pColumns->columnCount;
+	RsslRet					ret;
+
+	for (; pColumn != pEnd; ++pColumn)
+	{
+		if (pColumn->fieldId != fieldId)
+			continue;
+
+		if ((ret = rsslDecodePrimitiveType(iIter, pColumn->dataType,
+						(char*)pColumn->values + row * _rsslColumnValueSize[pColumn->dataType])) < RSSL_RET_SUCCESS)
+			return ret;
+
+		pColumn->present[row] = (ret == RSSL_RET_SUCCESS) ? RSSL_TRUE : RSSL_FALSE;
+		return RSSL_RET_SUCCESS;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_API RsslRet rsslDecodeMapFieldListColumns(
+				RsslDecodeIterator		*iIter,
+				RsslLocalFieldSetDefDb	*pLocalSetDb,
+				RsslMapFieldListColumns	*pColumns )
+{
+	RsslDecodingLevel	*_levelInfo;
+	RsslMap				*map;
+	RsslMapEntry		mapEntry;
+	RsslFieldList		fieldList;
+	RsslFieldEntry		fieldEntry;
+	RsslUInt32			keySize = 0, row, col;
+	RsslRet				ret;
+
+	RSSL_ASSERT(iIter && pColumns, Invalid parameters or parameters passed in as NULL);
+	RSSL_ASSERT(iIter->_decodingLevel > -1 && iIter->_decodingLevel < RSSL_ITER_MAX_LEVELS, Invalid or incorrect iterator used);
+
+	_levelInfo = &iIter->_levelInfo[iIter->_decodingLevel];
+
+	RSSL_ASSERT(_levelInfo->_containerType == RSSL_DT_MAP && _levelInfo->_listType, Invalid decoding attempted);
+
+	map = (RsslMap*)_levelInfo->_listType;
+	pColumns->rowCount = 0;
+
+	if (map->containerType != RSSL_DT_FIELD_LIST || pColumns->maxRows == 0)
+		return RSSL_RET_INVALID_ARGUMENT;
+
+	/* Entries are decoded one level below the map. */
+	if (iIter->_decodingLevel + 1 >= RSSL_ITER_MAX_LEVELS)
+		return RSSL_RET_ITERATOR_OVERRUN;
+
+	if (pColumns->keys && (keySize = _rsslGetColumnValueSize(map->keyPrimitiveType)) == 0)
+		return RSSL_RET_INVALID_ARGUMENT;
+
+	for (col = 0; col < pColumns->columnCount; ++col)
+	{
+		if (_rsslGetColumnValueSize(pColumns->columns[col].dataType) == 0)
+			return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	for (row = 0; row < pColumns->maxRows; ++row)
+	{
+		RsslUInt8	flags;
+
+		if ((ret = rsslDecodeMapEntry(iIter, &mapEntry, pColumns->keys ? (char*)pColumns->keys + row * keySize : 0)) != RSSL_RET_SUCCESS)
+		{
+			pColumns->rowCount = row;
+			return (ret == RSSL_RET_END_OF_CONTAINER) ? RSSL_RET_SUCCESS : ret;
+		}
+
+		pColumns->actions[row] = mapEntry.action;
+		if (pColumns->encKeys)
+			pColumns->encKeys[row] = mapEntry.encKey;
+
+		for (col = 0; col < pColumns->columnCount; ++col)
+			pColumns->columns[col].present[row] = RSSL_FALSE;
+
+		if (mapEntry.action == RSSL_MPEA_DELETE_ENTRY || mapEntry.encData.length == 0)
+			continue;
+
+		rwfGet8(flags, mapEntry.encData.data);
+
+		if (!(flags & RSSL_FLF_HAS_SET_DATA))
+		{
+			/* No set data, so walk the entry headers directly instead of going through rsslDecodeFieldList()
+			 * and rsslDecodeFieldEntry(). Primitives are decoded from the level below the map. */
+			char		*position = mapEntry.encData.data + 1;
+			char		*_endBufPtr = mapEntry.encData.data + mapEntry.encData.length;
+			RsslUInt16	entryCount = 0;
+
+			if (flags & RSSL_FLF_HAS_FIELD_LIST_INFO)
+			{
+				RsslUInt8 infoLen;
+
+				if (position >= _endBufPtr)
+				{
+					pColumns->rowCount = row;
+					return RSSL_RET_INCOMPLETE_DATA;
+				}
+				position += rwfGet8(infoLen, position);
+				position += infoLen;
+			}
+
+			if (flags & RSSL_FLF_HAS_STANDARD_DATA)
+			{
+				if (_endBufPtr - position < 2)
+				{
+					pColumns->rowCount = row;
+					return RSSL_RET_INCOMPLETE_DATA;
+				}
+				position += rwfGet16(entryCount, position);
+			}
+
+			for (; entryCount > 0; --entryCount)
+			{
+				/* The length is one byte, or a 0xFE marker followed by two more. */
+				if (_endBufPtr - position < 3 || ((RsslUInt8)position[2] >= 0xFE && _endBufPtr - position < 5))
+				{
+					pColumns->rowCount = row;
+					return RSSL_RET_INCOMPLETE_DATA;
+				}
+
+				position += rwfGet16(fieldEntry.fieldId, position);
+				position += rwfGetBuffer16(&fieldEntry.encData, position);
+
+				if (position > _endBufPtr)
+				{
+					pColumns->rowCount = row;
+					return RSSL_RET_INCOMPLETE_DATA;
+				}
+
+				iIter->_curBufPtr = fieldEntry.encData.data;
+				iIter->_levelInfo[iIter->_decodingLevel+1]._endBufPtr = position;
+
+				if ((ret = _rsslDecodeColumnValue(iIter, pColumns, fieldEntry.fieldId, row)) < RSSL_RET_SUCCESS)
+				{
+					pColumns->rowCount = row;
+					return ret;
+				}
+			}
+		}
+		else
+		{
+			if ((ret = rsslDecodeFieldList(iIter, &fieldList, pLocalSetDb)) < RSSL_RET_SUCCESS)
+			{
+				pColumns->rowCount = row;
+				return ret;
+			}
+
+			while ((ret = rsslDecodeFieldEntry(iIter, &fieldEntry)) != RSSL_RET_END_OF_CONTAINER)
+			{
+				if (ret < RSSL_RET_SUCCESS
+						|| (ret = _rsslDecodeColumnValue(iIter, pColumns, fieldEntry.fieldId, row)) < RSSL_RET_SUCCESS)
+				{
+					pColumns->rowCount = row;
+					return ret;
+				}
+			}
+		}
+	}
+
+	pColumns->rowCount = row;
+
+	if (_levelInfo->_nextItemPosition < _levelInfo->_itemCount)
+		return RSSL_RET_BUFFER_TOO_SMALL;
+
+	_endOfList(iIter);
+	return RSSL_RET_SUCCESS;
+}
+
 RSSL_API RsslRet rsslMapFlagsToOmmString(RsslBuffer *oBuffer, RsslUInt8 flags)
 {
 	const char *flagStrings[5 /* The max possible number of flags */];
@@ -14,6 +14,7 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <stddef.h>
 
 
 #include <math.h>
@@ -45,61 +46,82 @@
 #endif
 
 
-static RsslDouble powHintsEx[] = {100000000000000.0, 10000000000000.0, 1000000000000.0, 100000000000.0, 10000000000.0, 1000000000.0, 100000000.0, 10000000.0, 1000000.0, 100000.0, 10000.0, 1000.0, 100.0, 10.0, 1.0, 0.1, 0.01, 0.001, 0.0001, 0.00001, 0.000001, 0.0000001, 1, 2, 4, 8, 16, 32, 64, 128, 256 };
+/* Scale factors for each exponent and fraction hint. A REAL converts to a double as value * realToDoubleFactors[hint], and a 
+ * double converts to a REAL as floor(double * doubleToRealFactors[hint] + 0.5). */
+static const RsslDouble doubleToRealFactors[RSSL_RH_MAX_DIVISOR + 1] = {100000000000000.0, 10000000000000.0, 1000000000000.0, 100000000000.0, 10000000000.0, 1000000000.0, 100000000.0, 10000000.0, 1000000.0, 100000.0, 10000.0, 1000.0, 100.0, 10.0, 1.0, 0.1, 0.01, 0.001, 0.0001, 0.00001, 0.000001, 0.0000001, 1, 2, 4, 8, 16, 32, 64, 128, 256 };
 
-static RsslDouble powHints[] = {0.00000000000001, 0.0000000000001, 0.000000000001, 0.00000000001, 0.0000000001, 0.000000001, 0.00000001, 0.0000001, 0.000001, 0.00001, 0.0001, 0.001, 0.01, 0.1, 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 1, 0.5, 0.25, 0.125, 0.0625, 0.03125, 0.015625, 0.0078125, 0.00390625 };
+static const RsslDouble realToDoubleFactors[RSSL_RH_MAX_DIVISOR + 1] = {0.00000000000001, 0.0000000000001, 0.000000000001, 0.00000000001, 0.0000000001, 0.000000001, 0.00000001, 0.0000001, 0.000001, 0.00001, 0.0001, 0.001, 0.01, 0.1, 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 1, 0.5, 0.25, 0.125, 0.0625, 0.03125, 0.015625, 0.0078125, 0.00390625 };
 
+/* floor(value + 0.5), without calling floor(). */
+RTR_C_ALWAYS_INLINE RsslInt _rsslRoundHalfUp(RsslDouble value)
+{
+	RsslDouble rounded = value + 0.5;
+	RsslInt truncated = (RsslInt)rounded;
 
-RSSL_API RsslRet rsslDoubleToReal(RsslReal * oReal, RsslDouble * iValue, RsslUInt8 iHint)
+	/* Truncation rounds negative values up, so correct them. Out of range values convert to the minimum, as with a cast. */
+	return truncated - (rounded < (RsslDouble)truncated && truncated != RTR_LL(0x8000000000000000));
+}
+
+/* Sets the hint for infinity and NaN values. Returns RSSL_FALSE for other values. */
+RTR_C_ALWAYS_INLINE RsslBool _rsslSpecialDoubleToReal(RsslReal *oReal, RsslDouble value)
 {
-	RSSL_ASSERT(oReal, Invalid parameters or parameters passed in as NULL);
+	if (value - value == 0.0) /* Finite */
+		return RSSL_FALSE;
 
-	if (iHint > RSSL_RH_NOT_A_NUMBER || iHint == 31)
-		return RSSL_RET_FAILURE;
+	oReal->isBlank = RSSL_FALSE;
+	oReal->value = 0;
 
-	if (*iValue == INFINITY)
-	{
+	if (value != value)
+		oReal->hint = RSSL_RH_NOT_A_NUMBER;
+	else if (value > 0)
 		oReal->hint = RSSL_RH_INFINITY;
-		oReal->isBlank = RSSL_FALSE;
-		oReal->value = 0;		
-	}
-	else if (*iValue == NEG_INFINITY)
-	{
+	else
 		oReal->hint = RSSL_RH_NEG_INFINITY;
-		oReal->isBlank = RSSL_FALSE;
-		oReal->value = 0;		
-	}
-	else if (*iValue == NAN)
+
+	return RSSL_TRUE;
+}
+
+/* Converts a REAL with a special or invalid hint. */
+static RsslRet _rsslSpecialRealToDouble(RsslDouble *oValue, RsslUInt8 hint)
+{
+	switch(hint)
 	{
-		oReal->hint = RSSL_RH_NOT_A_NUMBER;
-		oReal->isBlank = RSSL_FALSE;
-		oReal->value = 0;		
+		case RSSL_RH_NOT_A_NUMBER:
+			*oValue = NAN;
+			return RSSL_RET_SUCCESS;
+		case RSSL_RH_INFINITY:
+			*oValue = (RsslDouble)INFINITY;
+			return RSSL_RET_SUCCESS;
+		case RSSL_RH_NEG_INFINITY:
+			*oValue = (RsslDouble)NEG_INFINITY;
+			return RSSL_RET_SUCCESS;
+		default:
+			return RSSL_RET_FAILURE;
 	}
-	else
-	{
-		oReal->hint = iHint;
+}
 
-		if (!iValue)
-		{
-			/* blank value */
-			oReal->isBlank = RSSL_TRUE;
-			oReal->value = 0;
-			return RSSL_RET_SUCCESS;
-		}
+RSSL_API RsslRet rsslDoubleToReal(RsslReal * oReal, RsslDouble * iValue, RsslUInt8 iHint)
+{
+	RSSL_ASSERT(oReal, Invalid parameters or parameters passed in as NULL);
 
-#if defined (WIN32) || defined (_WIN32)
-		if (iHint < RSSL_RH_FRACTION_1)
-		{
-			oReal->value = (RsslInt)(floor(((*iValue) / (pow((double)10, (double)(iHint - RSSL_RH_EXPONENT0)))) + 0.5));
-		}
-		else
-			oReal->value = (RsslInt)((*iValue)*(pow((double)2, (double)(iHint - RSSL_RH_FRACTION_1))));	
-#else
-			oReal->value = floor((*iValue) * powHintsEx[iHint] + 0.5);
-#endif
+	if (iHint > RSSL_RH_NOT_A_NUMBER || iHint == 31)
+		return RSSL_RET_FAILURE;
 
-		oReal->isBlank = RSSL_FALSE;
+	if (!iValue)
+	{
+		/* blank value */
+		oReal->hint = iHint;
+		oReal->isBlank = RSSL_TRUE;
+		oReal->value = 0;
+		return RSSL_RET_SUCCESS;
 	}
+
+	if (_rsslSpecialDoubleToReal(oReal, *iValue))
+		return RSSL_RET_SUCCESS;
+
+	oReal->hint = iHint;
+	oReal->isBlank = RSSL_FALSE;
+	oReal->value = (iHint <= RSSL_RH_MAX_DIVISOR) ? _rsslRoundHalfUp((*iValue) * doubleToRealFactors[iHint]) : 0;
 	return RSSL_RET_SUCCESS;
 }
 	
@@ -110,47 +132,21 @@ RSSL_API RsslRet rsslFloatToReal(RsslReal * oReal, RsslFloat * iValue, RsslUInt8
 	if (iHint > RSSL_RH_NOT_A_NUMBER || iHint == 31)
 		return RSSL_RET_FAILURE;
 
-	if ((double)(*iValue) == INFINITY)
-	{
-		oReal->hint = RSSL_RH_INFINITY;
-		oReal->isBlank = RSSL_FALSE;
-		oReal->value = 0;		
-	}
-	else if ((double)(*iValue) == NEG_INFINITY)
-	{
-		oReal->hint = RSSL_RH_NEG_INFINITY;
-		oReal->isBlank = RSSL_FALSE;
-		oReal->value = 0;		
-	}
-	else if ((double)(*iValue) == NAN)
-	{
-		oReal->hint = RSSL_RH_NOT_A_NUMBER;
-		oReal->isBlank = RSSL_FALSE;
-		oReal->value = 0;		
-	}
-
-	oReal->hint = iHint;
-
 	if (!iValue)
 	{
 		/* blank value */
+		oReal->hint = iHint;
 		oReal->isBlank = RSSL_TRUE;
 		oReal->value = 0;
 		return RSSL_RET_SUCCESS;
 	}
 
-#if defined (WIN32) || defined (_WIN32)
-	if (iHint < RSSL_RH_FRACTION_1)
-	{
-		oReal->value = (RsslInt)(floor(((*iValue)/(pow((float)10, (float)(iHint - RSSL_RH_EXPONENT0)))) + 0.5));
-	}
-	else
-		oReal->value = (RsslInt)((*iValue)*(pow((float)2, (float)(iHint - RSSL_RH_FRACTION_1))));	
-#else
-		oReal->value = floor((*iValue) * powHintsEx[iHint] + 0.5);
-#endif
-	
+	if (_rsslSpecialDoubleToReal(oReal, (RsslDouble)(*iValue)))
+		return RSSL_RET_SUCCESS;
+
+	oReal->hint = iHint;
 	oReal->isBlank = RSSL_FALSE;
+	oReal->value = (iHint <= RSSL_RH_MAX_DIVISOR) ? _rsslRoundHalfUp((RsslDouble)(*iValue) * doubleToRealFactors[iHint]) : 0;
 	return RSSL_RET_SUCCESS;
 }
 
@@ -234,37 +230,217 @@ RSSL_API RsslRet rsslRealToDouble(RsslDouble * oValue, RsslReal * iReal)
 
 	if (iReal->isBlank == RSSL_TRUE)
 		return RSSL_RET_FAILURE;
-	
-	/* TODO: Better checking here if we change hints */
-	switch(iReal->hint)
+
+	if (iReal->hint > RSSL_RH_MAX_DIVISOR)
+		return _rsslSpecialRealToDouble(oValue, iReal->hint);
+
+	*oValue = iReal->value * realToDoubleFactors[iReal->hint];
+	return RSSL_RET_SUCCESS;
+}
+
+/*** Batch conversions ***/
+
+/* The batch conversions use AVX-512 when the processor supports it. The library is built for the baseline instruction set, 
+ * so that code is compiled separately for that target and selected at runtime.
+ * The vector code relies on the 64-bit layout of RsslReal (two qwords: flags, then value), so it is only built for x86-64; 
+ * other targets use the scalar loops. */
+#if defined(__GNUC__) && defined(__x86_64__) && (__GNUC__ >= 6 || defined(__clang__))
+#define RSSL_REAL_BATCH_AVX512
+#include <immintrin.h>
+
+/* Fails to compile if RsslReal is not 16 bytes, with its value in the second qword. */
+typedef char _rsslRealBatchLayoutCheck[(sizeof(RsslReal) == 16 && offsetof(RsslReal, value) == 8) ? 1 : -1];
+#endif
+
+/* Converts one REAL in a batch; blank REALs become NaN. Returns RSSL_RET_FAILURE if the hint is invalid. */
+RTR_C_ALWAYS_INLINE RsslRet _rsslBatchRealToDouble(RsslDouble *oValue, const RsslReal *iReal)
+{
+	if (!iReal->isBlank && iReal->hint <= RSSL_RH_MAX_DIVISOR)
 	{
-		case RSSL_RH_NOT_A_NUMBER:
-			*oValue = NAN;
-			return RSSL_RET_SUCCESS;
-		break;
-		case RSSL_RH_INFINITY:
-			*oValue = (RsslDouble)INFINITY;
-			return RSSL_RET_SUCCESS;
-		break;
-		case RSSL_RH_NEG_INFINITY:
-			*oValue = (RsslDouble)NEG_INFINITY;
-			return RSSL_RET_SUCCESS;
-		break;
+		*oValue = iReal->value * realToDoubleFactors[iReal->hint];
+		return RSSL_RET_SUCCESS;
 	}
 
-	if (iReal->hint > RSSL_RH_MAX_DIVISOR)
+	if (iReal->isBlank)
+	{
+		*oValue = NAN;
+		return RSSL_RET_SUCCESS;
+	}
+
+	if (_rsslSpecialRealToDouble(oValue, iReal->hint) != RSSL_RET_SUCCESS)
+	{
+		*oValue = NAN;
 		return RSSL_RET_FAILURE;
-#if defined (WIN32) || defined (_WIN32)
-	if (iReal->hint < RSSL_RH_FRACTION_1)
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+RTR_C_ALWAYS_INLINE void _rsslBatchDoubleToReal(RsslReal *oReal, RsslDouble value, RsslUInt8 iHint, RsslDouble factor)
+{
+	if (_rsslSpecialDoubleToReal(oReal, value))
+		return;
+
+	oReal->isBlank = RSSL_FALSE;
+	oReal->hint = iHint;
+	oReal->value = _rsslRoundHalfUp(value * factor);
+}
+
+static RsslRet _rsslRealsToDoublesGeneric(RsslDouble *oValues, const RsslReal *iReals, RsslUInt32 count)
+{
+	RsslRet ret = RSSL_RET_SUCCESS;
+	RsslUInt32 i;
+
+	for (i = 0; i < count; ++i)
 	{
-		*oValue = iReal->value*(pow((double)10, (double)(iReal->hint - RSSL_RH_EXPONENT0)));
+		if (_rsslBatchRealToDouble(&oValues[i], &iReals[i]) != RSSL_RET_SUCCESS)
+			ret = RSSL_RET_FAILURE;
 	}
-	else
-		*oValue = iReal->value/(pow((double)2, (double)(iReal->hint - RSSL_RH_FRACTION_1)));	
-#else
- 	*oValue = (iReal->value*powHints[iReal->hint]);
+
+	return ret;
+}
+
+static void _rsslDoublesToRealsGeneric(RsslReal *oReals, const RsslDouble *iValues, RsslUInt8 iHint, RsslUInt32 count)
+{
+	RsslDouble factor = doubleToRealFactors[iHint];
+	RsslUInt32 i;
+
+	for (i = 0; i < count; ++i)
+		_rsslBatchDoubleToReal(&oReals[i], iValues[i], iHint, factor);
+}
+
+#ifdef RSSL_REAL_BATCH_AVX512
+
+/* Lane indices that gather the first or second qword of each 16-byte RsslReal from a pair of vectors, and the reverse. */
+#define RSSL_REAL_AVX512_FLAGS_INDEX _mm512_set_epi64(14, 12, 10, 8, 6, 4, 2, 0)
+#define RSSL_REAL_AVX512_VALUES_INDEX _mm512_set_epi64(15, 13, 11, 9, 7, 5, 3, 1)
+#define RSSL_REAL_AVX512_LOW_INDEX _mm512_set_epi64(11, 3, 10, 2, 9, 1, 8, 0)
+#define RSSL_REAL_AVX512_HIGH_INDEX _mm512_set_epi64(15, 7, 14, 6, 13, 5, 12, 4)
+
+__attribute__((target("avx512f,avx512dq")))
+static RsslRet _rsslRealsToDoublesAvx512(RsslDouble *oValues, const RsslReal *iReals, RsslUInt32 count)
+{
+	RsslRet ret = RSSL_RET_SUCCESS;
+	RsslDouble factors[32];
+	__m512d factors0, factors1, factors2, factors3;
+	RsslUInt32 i, j;
+
+	/* The factor table is held in four registers and indexed with permutes rather than gathers. */
+	memcpy(factors, realToDoubleFactors, sizeof(realToDoubleFactors));
+	factors[31] = 0;
+	factors0 = _mm512_loadu_pd(factors);
+	factors1 = _mm512_loadu_pd(factors + 8);
+	factors2 = _mm512_loadu_pd(factors + 16);
+	factors3 = _mm512_loadu_pd(factors + 24);
+
+	for (i = 0; i + 8 <= count; i += 8)
+	{
+		__m512i first = _mm512_loadu_si512((const void*)&iReals[i]);
+		__m512i second = _mm512_loadu_si512((const void*)&iReals[i + 4]);
+		__m512i flags = _mm512_permutex2var_epi64(first, RSSL_REAL_AVX512_FLAGS_INDEX, second);
+		__m512i values = _mm512_permutex2var_epi64(first, RSSL_REAL_AVX512_VALUES_INDEX, second);
+		__m512i blank = _mm512_and_epi64(flags, _mm512_set1_epi64(0xFF));
+		__m512i hints = _mm512_and_epi64(_mm512_srli_epi64(flags, 8), _mm512_set1_epi64(0xFF));
+		__mmask8 regular = _mm512_cmpeq_epi64_mask(blank, _mm512_setzero_si512())
+			& _mm512_cmple_epu64_mask(hints, _mm512_set1_epi64(RSSL_RH_MAX_DIVISOR));
+		__m512d factor = _mm512_mask_blend_pd(_mm512_cmpge_epu64_mask(hints, _mm512_set1_epi64(16)),
+				_mm512_permutex2var_pd(factors0, hints, factors1), _mm512_permutex2var_pd(factors2, hints, factors3));
+
+		_mm512_storeu_pd(&oValues[i], _mm512_mul_pd(_mm512_cvtepi64_pd(values), factor));
+
+		/* Blank and special values are rare; convert them individually. */
+		if (regular != 0xFF)
+		{
+			for (j = 0; j < 8; ++j)
+			{
+				if (!(regular & (1 << j)) && _rsslBatchRealToDouble(&oValues[i + j], &iReals[i + j]) != RSSL_RET_SUCCESS)
+					ret = RSSL_RET_FAILURE;
+			}
+		}
+	}
+
+	if (_rsslRealsToDoublesGeneric(&oValues[i], &iReals[i], count - i) != RSSL_RET_SUCCESS)
+		ret = RSSL_RET_FAILURE;
+
+	return ret;
+}
+
+__attribute__((target("avx512f,avx512dq")))
+static void _rsslDoublesToRealsAvx512(RsslReal *oReals, const RsslDouble *iValues, RsslUInt8 iHint, RsslUInt32 count)
+{
+	__m512d factor = _mm512_set1_pd(doubleToRealFactors[iHint]);
+	__m512i flags = _mm512_set1_epi64((RsslInt64)iHint << 8);
+	RsslUInt32 i, j;
+
+	for (i = 0; i + 8 <= count; i += 8)
+	{
+		__m512d x = _mm512_loadu_pd(&iValues[i]);
+		/* The explicitly rounded forms keep the compiler from fusing the multiply and add, so results match the scalar conversion. */
+		__m512d scaled = _mm512_add_round_pd(_mm512_mul_round_pd(x, factor, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC),
+				_mm512_set1_pd(0.5), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+		__m512i values = _mm512_cvt_roundpd_epi64(scaled, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+		/* Infinity and NaN */
+		__mmask8 special = _mm512_fpclass_pd_mask(x, 0x01 | 0x08 | 0x10 | 0x80);
+
+		_mm512_storeu_si512((void*)&oReals[i], _mm512_permutex2var_epi64(flags, RSSL_REAL_AVX512_LOW_INDEX, values));
+		_mm512_storeu_si512((void*)&oReals[i + 4], _mm512_permutex2var_epi64(flags, RSSL_REAL_AVX512_HIGH_INDEX, values));
+
+		if (special)
+		{
+			for (j = 0; j < 8; ++j)
+			{
+				if (special & (1 << j))
+					_rsslSpecialDoubleToReal(&oReals[i + j], iValues[i + j]);
+			}
+		}
+	}
+
+	_rsslDoublesToRealsGeneric(&oReals[i], &iValues[i], iHint, count - i);
+}
+
+static RsslBool _rsslRealBatchUseAvx512()
+{
+	static int useAvx512 = -1;
+
+	if (useAvx512 == -1)
+	{
+		__builtin_cpu_init();
+		useAvx512 = (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq")) ? 1 : 0;
+	}
+
+	return useAvx512 ? RSSL_TRUE : RSSL_FALSE;
+}
+
 #endif
-	
+
+RSSL_API RsslRet rsslRealsToDoubles(RsslDouble * oValues, const RsslReal * iReals, RsslUInt32 count)
+{
+	RSSL_ASSERT((iReals && oValues) || count == 0, Invalid parameters or parameters passed in as NULL);
+
+#ifdef RSSL_REAL_BATCH_AVX512
+	if (count >= 8 && _rsslRealBatchUseAvx512())
+		return _rsslRealsToDoublesAvx512(oValues, iReals, count);
+#endif
+
+	return _rsslRealsToDoublesGeneric(oValues, iReals, count);
+}
+
+RSSL_API RsslRet rsslDoublesToReals(RsslReal * oReals, const RsslDouble * iValues, RsslUInt8 iHint, RsslUInt32 count)
+{
+	RSSL_ASSERT((oReals && iValues) || count == 0, Invalid parameters or parameters passed in as NULL);
+
+	if (iHint > RSSL_RH_MAX_DIVISOR)
+		return RSSL_RET_FAILURE;
+
+#ifdef RSSL_REAL_BATCH_AVX512
+	if (count >= 8 && _rsslRealBatchUseAvx512())
+	{
+		_rsslDoublesToRealsAvx512(oReals, iValues, iHint, count);
+		return RSSL_RET_SUCCESS;
+	}
+#endif
+
+	_rsslDoublesToRealsGeneric(oReals, iValues, iHint, count);
 	return RSSL_RET_SUCCESS;
 }
 
@@ -294,32 +470,10 @@ RSSL_API RsslRet rsslNumericStringToDouble(RsslDouble * oValue, RsslBuffer * iNu
 	else if (ret != RSSL_RET_SUCCESS)
 		return (ret);
 
-	switch(real64.hint)
-	{
-		case RSSL_RH_NOT_A_NUMBER:
-			*oValue = NAN;
-			return RSSL_RET_SUCCESS;
-		break;
-		case RSSL_RH_INFINITY:
-			*oValue = (RsslDouble)INFINITY;
-			return RSSL_RET_SUCCESS;
-		break;
-		case RSSL_RH_NEG_INFINITY:
-			*oValue = (RsslDouble)NEG_INFINITY;
-			return RSSL_RET_SUCCESS;
-		break;
-	}
+	if (real64.hint > RSSL_RH_MAX_DIVISOR)
+		return _rsslSpecialRealToDouble(oValue, real64.hint);
 
-#if defined (WIN32) || defined (_WIN32)
-	if (real64.hint < RSSL_RH_FRACTION_1)
-	{
-		*oValue = real64.value*(pow((double)10, (double)(real64.hint - RSSL_RH_EXPONENT0)));
-	}
-	else
-		*oValue = real64.value/(pow((double)2, (double)(real64.hint - RSSL_RH_FRACTION_1)));
-#else
-	*oValue = (real64.value*powHints[real64.hint]);
-#endif
+	*oValue = real64.value * realToDoubleFactors[real64.hint];
 	return RSSL_RET_SUCCESS;
 }
 
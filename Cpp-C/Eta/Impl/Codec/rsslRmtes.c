@@ -11,6 +11,12 @@ extern "C" {
 #endif
 
 #include "limits.h"
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define RSSL_RMTES_ASCII_SSE2
+#endif
 
 #include "rtr/rsslTypes.h"
 
@@ -563,17 +569,44 @@ int controlParse(unsigned char* curPtr, unsigned char* endPtr, RsslRmtesWorkingS
 	}
 }
 	
-/* Assumptions: all updates have already been applied to the RMTES buffer... there should be no repeat or cursor move commands */
-RSSL_API RsslRet rsslRMTESToUTF8(RsslRmtesCacheBuffer *pRmtesBuffer, RsslBuffer *pStringBuffer)
+/* Returns the number of leading bytes in [pIn, pEnd) that are printable ASCII (0x20 - 0x7E).
+ * Under the default working set these bytes contain no control or shift codes and
+ * convert to themselves, so a run of them can be copied straight to the output. */
+static RsslUInt32 rmtesAsciiRun(const unsigned char *pIn, const unsigned char *pEnd)
+{
+	const unsigned char *pIter = pIn;
+
+#ifdef RSSL_RMTES_ASCII_SSE2
+	/* Signed compares: bytes 0x80 - 0xFF are negative, so they fall below 0x20 as well. */
+	const __m128i lowest = _mm_set1_epi8(0x20);
+	const __m128i highest = _mm_set1_epi8(0x7E);
+
+	while (pEnd - pIter >= 16)
+	{
+		__m128i chars = _mm_loadu_si128((const __m128i*)pIter);
+
+		if (_mm_movemask_epi8(_mm_or_si128(_mm_cmplt_epi8(chars, lowest), _mm_cmpgt_epi8(chars, highest))) != 0)
+			break; /* Scalar loop below finds the exact position */
+
+		pIter += 16;
+	}
+#endif
+
+	while (pIter < pEnd && *pIter >= 0x20 && *pIter <= 0x7E)
+		++pIter;
+
+	return (RsslUInt32)(pIter - pIn);
+}
+
+/* Converts [inIter, endInput) to UTF8 starting from the default working set.
+ * On success, *ppOutEnd is set to the end of the converted data. */
+static RsslRet rmtesToUTF8(unsigned char *inIter, unsigned char *endInput, char *outIter, char *endOutput, char **ppOutEnd)
 {
 	RMTESParseState state = NORMAL;
 	ESCReturnCode retCode;
 	int ret;
 	int tempRet;
-	unsigned char* inIter;
-	char* outIter;
-	unsigned char* endInput;
-	char* endOutput;
+	RsslUInt32 run;
 	EncodeType encType = TYPE_RMTES;
 
 	unsigned char* tempChar;
@@ -583,20 +616,6 @@ RSSL_API RsslRet rsslRMTESToUTF8(RsslRmtesCacheBuffer *pRmtesBuffer, RsslBuffer
 	RsslRmtesCharSet * shiftGL = NULL;
 	RsslRmtesCharSet * tmpGL;
 
-	RSSL_ASSERT(pRmtesBuffer != NULL, Invalid parameter passed as NULL);
-	RSSL_ASSERT(pStringBuffer != NULL, Invalid parameter passed as NULL);
-	
-	if (pRmtesBuffer->data == NULL || pRmtesBuffer->allocatedLength == 0)
-		return RSSL_RET_INVALID_DATA;
-
-	if (pStringBuffer->data == NULL || pStringBuffer->length == 0)
-		return RSSL_RET_BUFFER_TOO_SMALL;
-
-	inIter = (unsigned char*)pRmtesBuffer->data;
-	outIter = pStringBuffer->data;
-	endInput = (unsigned char*)pRmtesBuffer->data + pRmtesBuffer->length;
-	endOutput = pStringBuffer->data + pStringBuffer->length;
-	
 	initWorkingSet(&curWorkingSet);
 	
 	retCode = ESC_SUCCESS;
@@ -605,7 +624,18 @@ RSSL_API RsslRet rsslRMTESToUTF8(RsslRmtesCacheBuffer *pRmtesBuffer, RsslBuffer
 	{
 		if(encType == TYPE_RMTES)
 		{
-			if(*inIter < 0x20)  /* CL character */
+			if(*inIter >= 0x20 && *inIter <= 0x7E && shiftGL == NULL && *curWorkingSet.GL == (RsslRmtesCharSet*)&_rsslReuterBasic1)
+			/* Plain ASCII under the default GL set; copy the whole run at once */
+			{
+				run = rmtesAsciiRun(inIter, endInput);
+				if(run > (RsslUInt32)(endOutput - outIter))
+					return RSSL_RET_BUFFER_TOO_SMALL;
+
+				memcpy(outIter, inIter, run);
+				outIter += run;
+				inIter += run;
+			}
+			else if(*inIter < 0x20)  /* CL character */
 			{
 				if(shiftGL != NULL)
 					return RSSL_RET_FAILURE;
@@ -616,7 +646,7 @@ RSSL_API RsslRet rsslRMTESToUTF8(RsslRmtesCacheBuffer *pRmtesBuffer, RsslBuffer
 						return RSSL_RET_FAILURE;
 					else if(retCode == END_CHAR) /* Parse is done, return success after triming data length */
 					{
-						pStringBuffer->length = (rtrUInt32)(outIter - pStringBuffer->data);
+						*ppOutEnd = outIter;
 						return RSSL_RET_SUCCESS;
 					}
 					else if(retCode == ESC_SUCCESS)
@@ -812,18 +842,45 @@ RSSL_API RsslRet rsslRMTESToUTF8(RsslRmtesCacheBuffer *pRmtesBuffer, RsslBuffer
 				else
 					inIter += ret;
 			}
-			else /* Just copy the data, since it's already encoded in UTF8 */
+			else /* Just copy the data up to the next escape, since it's already encoded in UTF8 */
 			{
-				*outIter = *inIter;
-				outIter++;
-				inIter++;
+				tempChar = (unsigned char*)memchr(inIter, 0x1B, endInput - inIter);
+				run = (RsslUInt32)((tempChar ? tempChar : endInput) - inIter);
+				if(run > (RsslUInt32)(endOutput - outIter))
+					return RSSL_RET_BUFFER_TOO_SMALL;
+
+				memcpy(outIter, inIter, run);
+				outIter += run;
+				inIter += run;
 			}
 		}
 	}
 
-	/* Trim output buffer length */
+	*ppOutEnd = outIter;
+	return RSSL_RET_SUCCESS;
+}
+
+/* Assumptions: all updates have already been applied to the RMTES buffer... there should be no repeat or cursor move commands */
+RSSL_API RsslRet rsslRMTESToUTF8(RsslRmtesCacheBuffer *pRmtesBuffer, RsslBuffer *pStringBuffer)
+{
+	RsslRet ret;
+	char *outEnd;
+
+	RSSL_ASSERT(pRmtesBuffer != NULL, Invalid parameter passed as NULL);
+	RSSL_ASSERT(pStringBuffer != NULL, Invalid parameter passed as NULL);
 	
-	pStringBuffer->length = (rtrUInt32)(outIter - pStringBuffer->data);
+	if (pRmtesBuffer->data == NULL || pRmtesBuffer->allocatedLength == 0)
+		return RSSL_RET_INVALID_DATA;
+
+	if (pStringBuffer->data == NULL || pStringBuffer->length == 0)
+		return RSSL_RET_BUFFER_TOO_SMALL;
+
+	if ((ret = rmtesToUTF8((unsigned char*)pRmtesBuffer->data, (unsigned char*)pRmtesBuffer->data + pRmtesBuffer->length,
+			pStringBuffer->data, pStringBuffer->data + pStringBuffer->length, &outEnd)) != RSSL_RET_SUCCESS)
+		return ret;
+
+	/* Trim output buffer length */
+	pStringBuffer->length = (rtrUInt32)(outEnd - pStringBuffer->data);
 	return RSSL_RET_SUCCESS;
 }
 
@@ -1122,9 +1179,10 @@ RSSL_API RsslBool rsslHasPartialRMTESUpdate(RsslBuffer *pBuffer)
 /* Applies the inBuffer's partial update data to the outBuffer.
  * Preconditions: outBuffer is large enough to handle the additional data
  *                outBuffer has already been populated with data
- * Result: inBuffer's partial update(s) are applied to outBuffer
+ * Result: inBuffer's partial update(s) are applied to outBuffer, and *pFirstWrite
+ *         is lowered to the first cache position that was written.
  */
-RSSL_API RsslRet rsslRMTESApplyToCache(RsslBuffer *inBuffer, RsslRmtesCacheBuffer *cacheBuf)
+static RsslRet rmtesApplyToCache(RsslBuffer *inBuffer, RsslRmtesCacheBuffer *cacheBuf, RsslUInt32 *pFirstWrite)
 {
 	RsslUInt32 inBufPos = 0;
 	RsslUInt32 cacheBufPos = 0;
@@ -1135,9 +1193,6 @@ RSSL_API RsslRet rsslRMTESApplyToCache(RsslBuffer *inBuffer, RsslRmtesCacheBuffe
 	RMTESParseState state = NORMAL;
 	rtrUInt32 maxLen = 0;
 
-	RSSL_ASSERT(inBuffer != NULL, Invalid paramter passed as NULL);
-	RSSL_ASSERT(cacheBuf != NULL, Invalid paramter passed as NULL);
-
 	if (inBuffer->data == NULL || inBuffer->length == 0)
 		return RSSL_RET_INVALID_ARGUMENT;
 
@@ -1174,6 +1229,8 @@ RSSL_API RsslRet rsslRMTESApplyToCache(RsslBuffer *inBuffer, RsslRmtesCacheBuffe
 						/*Out of space */
 						return RSSL_RET_BUFFER_TOO_SMALL;
 					}
+					if(cacheBufPos < *pFirstWrite)
+						*pFirstWrite = cacheBufPos;
 					prevChar = inBuffer->data[inBufPos];
 					cacheBuf->data[cacheBufPos] = inBuffer->data[inBufPos];
 					cacheBufPos++;
@@ -1192,6 +1249,8 @@ RSSL_API RsslRet rsslRMTESApplyToCache(RsslBuffer *inBuffer, RsslRmtesCacheBuffe
 						/* Error: Out of space */
 							return RSSL_RET_BUFFER_TOO_SMALL;
 						}
+						if(cacheBufPos < *pFirstWrite)
+							*pFirstWrite = cacheBufPos;
 						cacheBuf->data[cacheBufPos++] = ESC_CHAR;
 						cacheBuf->data[cacheBufPos++] = 0x25;
 						cacheBuf->data[cacheBufPos++] = 0x30;
@@ -1211,6 +1270,8 @@ RSSL_API RsslRet rsslRMTESApplyToCache(RsslBuffer *inBuffer, RsslRmtesCacheBuffe
 					{
 						return RSSL_RET_BUFFER_TOO_SMALL;
 					}
+					if(cacheBufPos < *pFirstWrite)
+						*pFirstWrite = cacheBufPos;
 					cacheBuf->data[cacheBufPos++] = ESC_CHAR;
 					cacheBuf->data[cacheBufPos++] = inBuffer->data[inBufPos];
 				}					
@@ -1257,6 +1318,8 @@ RSSL_API RsslRet rsslRMTESApplyToCache(RsslBuffer *inBuffer, RsslRmtesCacheBuffe
 					}
 					if(cacheBuf->allocatedLength < cacheBufPos+numCount)
 						return RSSL_RET_BUFFER_TOO_SMALL;
+					if(numCount > 0 && cacheBufPos < *pFirstWrite)
+						*pFirstWrite = cacheBufPos;
 					for(i = 0; i < numCount; i++)
 					{
 						cacheBuf->data[cacheBufPos++] = prevChar;
@@ -1297,6 +1360,73 @@ RSSL_API RsslRet rsslRMTESApplyToCache(RsslBuffer *inBuffer, RsslRmtesCacheBuffe
 	return RSSL_RET_SUCCESS;
 }
 
+RSSL_API RsslRet rsslRMTESApplyToCache(RsslBuffer *inBuffer, RsslRmtesCacheBuffer *cacheBuf)
+{
+	RsslUInt32 firstWrite = UINT_MAX;
+
+	RSSL_ASSERT(inBuffer != NULL, Invalid paramter passed as NULL);
+	RSSL_ASSERT(cacheBuf != NULL, Invalid paramter passed as NULL);
+
+	return rmtesApplyToCache(inBuffer, cacheBuf, &firstWrite);
+}
+
+/* The first asciiLength bytes of the cache are plain ASCII under the default working set,
+ * so they are byte-for-byte identical in the UTF8 output and carry no state into the bytes
+ * that follow.  Conversion after an update only has to restart from the lower of that
+ * point and the first position the update wrote. */
+RSSL_API RsslRet rsslRMTESApplyToUTF8Stream(RsslBuffer *inBuffer, RsslRmtesCacheBuffer *cacheBuf, RsslRmtesUTF8Stream *pStream)
+{
+	RsslRet ret;
+	RsslUInt32 resumePos;
+	RsslUInt32 firstWrite = UINT_MAX;
+	char *outEnd;
+
+	RSSL_ASSERT(inBuffer != NULL, Invalid paramter passed as NULL);
+	RSSL_ASSERT(cacheBuf != NULL, Invalid paramter passed as NULL);
+	RSSL_ASSERT(pStream != NULL, Invalid paramter passed as NULL);
+
+	if (pStream->utf8.data == NULL || pStream->allocatedLength == 0)
+		return RSSL_RET_BUFFER_TOO_SMALL;
+
+	resumePos = pStream->asciiLength;
+
+	ret = rmtesApplyToCache(inBuffer, cacheBuf, &firstWrite);
+
+	if (firstWrite < resumePos)
+		resumePos = firstWrite;
+	if (cacheBuf->length < resumePos)
+		resumePos = cacheBuf->length;
+
+	/* Whatever happens next, output past resumePos no longer matches the cache. */
+	pStream->asciiLength = resumePos;
+
+	if (ret != RSSL_RET_SUCCESS)
+	{
+		pStream->utf8.length = resumePos;
+		return ret;
+	}
+
+	resumePos += rmtesAsciiRun((unsigned char*)cacheBuf->data + resumePos, (unsigned char*)cacheBuf->data + cacheBuf->length);
+	if (resumePos > pStream->allocatedLength)
+	{
+		pStream->utf8.length = pStream->asciiLength;
+		return RSSL_RET_BUFFER_TOO_SMALL;
+	}
+
+	memcpy(pStream->utf8.data + pStream->asciiLength, cacheBuf->data + pStream->asciiLength, resumePos - pStream->asciiLength);
+	pStream->asciiLength = resumePos;
+
+	if ((ret = rmtesToUTF8((unsigned char*)cacheBuf->data + resumePos, (unsigned char*)cacheBuf->data + cacheBuf->length,
+			pStream->utf8.data + resumePos, pStream->utf8.data + pStream->allocatedLength, &outEnd)) != RSSL_RET_SUCCESS)
+	{
+		pStream->utf8.length = resumePos;
+		return ret;
+	}
+
+	pStream->utf8.length = (rtrUInt32)(outEnd - pStream->utf8.data);
+	return RSSL_RET_SUCCESS;
+}
+
 #ifdef __cplusplus
 }
 #endif
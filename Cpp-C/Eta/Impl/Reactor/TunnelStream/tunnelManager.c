@@ -52,7 +52,7 @@ TunnelManager *tunnelManagerOpen(RsslReactor *pReactor, RsslReactorChannel *pRea
 
 	pManagerImpl->_pParentReactor = pReactor;
 
-	if (rsslHashTableInit(&pManagerImpl->_streamIdToTunnelStreamTable, 13, rsslHashU32Sum, rsslHashU32Compare, RSSL_FALSE, pErrorInfo)
+	if (rsslHashTableInit(&pManagerImpl->_streamIdToTunnelStreamTable, 13, rsslHashU32Sum, rsslHashU32Compare, pErrorInfo)
 			!= RSSL_RET_SUCCESS)
 	{
 		rsslSetErrorInfoLocation(pErrorInfo, __FILE__, __LINE__);
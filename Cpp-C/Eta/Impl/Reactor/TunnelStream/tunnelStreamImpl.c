@@ -243,7 +243,7 @@ RsslTunnelStream* tunnelStreamOpen(TunnelManager *pManager, RsslTunnelStreamOpen
 	{
 		rsslInitQueue(&pTunnelImpl->_substreams);
 		if (rsslHashTableInit(&pTunnelImpl->_substreamsById, 101, rsslHashU32Sum, rsslHashU32Compare,
-					RSSL_TRUE, pErrorInfo) != RSSL_RET_SUCCESS)
+					pErrorInfo) != RSSL_RET_SUCCESS)
 		{
 			tunnelStreamDestroy((RsslTunnelStream*)pTunnelImpl);
 			return NULL;
@@ -252,7 +252,7 @@ RsslTunnelStream* tunnelStreamOpen(TunnelManager *pManager, RsslTunnelStreamOpen
 
 	rsslInitQueue(&pTunnelImpl->_fragmentationProgressQueue);
 	if (rsslHashTableInit(&pTunnelImpl->_fragmentationProgressHashTable, 11, rsslHashU16Sum, rsslHashU16Compare,
-				RSSL_TRUE, pErrorInfo) != RSSL_RET_SUCCESS)
+				pErrorInfo) != RSSL_RET_SUCCESS)
 	{
 		tunnelStreamDestroy((RsslTunnelStream*)pTunnelImpl);
 		return NULL;
@@ -413,7 +413,13 @@ RsslTunnelStream* tunnelStreamOpen(TunnelManager *pManager, RsslTunnelStreamOpen
 	}
 
 	rsslHashLinkInit(&pTunnelImpl->_managerHashLink);
-	rsslHashTableInsertLink(&pTunnelImpl->_manager->_streamIdToTunnelStreamTable, &pTunnelImpl->_managerHashLink, &pTunnelImpl->base.streamId, NULL);
+	if (rsslHashTableInsertLink(&pTunnelImpl->_manager->_streamIdToTunnelStreamTable, &pTunnelImpl->_managerHashLink, &pTunnelImpl->base.streamId, NULL) != RSSL_RET_SUCCESS)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, 
+				__FILE__, __LINE__, "Memory allocation failed.");
+		tunnelStreamDestroy((RsslTunnelStream*)pTunnelImpl);
+		return NULL;
+	}
 	rsslQueueAddLinkToBack(&pTunnelImpl->_manager->_tunnelStreamsOpen, &pTunnelImpl->_managerOpenLink);
 	pTunnelImpl->_flags |= TSF_ACTIVE;
 	pTunnelImpl->_streamVersion = streamVersion;
@@ -581,7 +587,13 @@ RsslRet tunnelStreamSubmitMsg(RsslTunnelStream *pTunnel,
 									pErrorInfo)) == NULL)
 						return pErrorInfo->rsslError.rsslErrorId;
 
-					rsslHashTableInsertLink(&pTunnelImpl->_substreamsById, &pSubstream->_tunnelTableLink, &pSubstream->_streamId, NULL);
+					if (rsslHashTableInsertLink(&pTunnelImpl->_substreamsById, &pSubstream->_tunnelTableLink, &pSubstream->_streamId, NULL) != RSSL_RET_SUCCESS)
+					{
+						tunnelSubstreamDestroy(pSubstream);
+						rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, 
+								__FILE__, __LINE__, "Memory allocation failed.");
+						return RSSL_RET_FAILURE;
+					}
 					rsslQueueAddLinkToBack(&pTunnelImpl->_substreams, &pSubstream->_tunnelQueueLink);
 					break;
 
@@ -3245,12 +3257,23 @@ static RsslRet _tunnelStreamHandleFragmentedMsg(TunnelStreamImpl *pTunnelImpl, T
 		pFragmentationProgress->pBigBuffer = pBigBuffer;
 		pFragmentationProgress->bytesAlreadyCopied = pFragmentedData->length;
 
-		// put fragmentation progress structure into hash table indexed by message id
-		rsslHashLinkInit(&pFragmentationProgress->fragmentationHashLink);
-		rsslHashTableInsertLink(&pTunnelImpl->_fragmentationProgressHashTable, &pFragmentationProgress->fragmentationHashLink, &pDataMsg->messageId, NULL);
+		// a re-assembly that was already in progress is still in the hash table and queue
+		if (pHashLink == NULL)
+		{
+			// put fragmentation progress structure into hash table indexed by message id
+			rsslHashLinkInit(&pFragmentationProgress->fragmentationHashLink);
+			if (rsslHashTableInsertLink(&pTunnelImpl->_fragmentationProgressHashTable, &pFragmentationProgress->fragmentationHashLink, &pDataMsg->messageId, NULL) != RSSL_RET_SUCCESS)
+			{
+				bigBufferPoolRelease(&pTunnelImpl->_bigBufferPool, &pBigBuffer->_poolBuffer);
+				free(pFragmentationProgress);
+				rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, 
+						__FILE__, __LINE__, "Memory allocation failed.");
+				return RSSL_RET_FAILURE;
+			}
 
-		// also insert into fragmentation queue
-		rsslQueueAddLinkToBack(&pTunnelImpl->_fragmentationProgressQueue, &pFragmentationProgress->fragmentationQueueLink);		
+			// also insert into fragmentation queue
+			rsslQueueAddLinkToBack(&pTunnelImpl->_fragmentationProgressQueue, &pFragmentationProgress->fragmentationQueueLink);		
+		}
 	}
 
 	return ret;
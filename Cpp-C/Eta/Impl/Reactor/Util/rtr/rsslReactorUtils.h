@@ -19,6 +19,7 @@ extern "C" {
 #include <windows.h>
 #else
 #include <sys/time.h>
+#include <time.h>
 #endif
 #include <stdlib.h>
 
@@ -58,6 +59,28 @@ RTR_C_INLINE RsslInt64 getCurrentTimeMs(RsslInt64 ticksPerMsec)
 	return timeMs;
 }
 
+/* Gets the current time in microseconds from a monotonic clock, so that deadlines are not affected
+ * by changes to the system time.  Only meaningful for measuring intervals.  ticksPerMsec is used only on windows. */
+RTR_C_INLINE RsslInt64 getCurrentTimeUsec(RsslInt64 ticksPerMsec)
+{
+	RsslInt64 timeUsec;
+#ifdef WIN32
+	LARGE_INTEGER	queryTime;
+
+	QueryPerformanceCounter(&queryTime);
+	timeUsec = (RsslInt64)((double)queryTime.QuadPart * 1000 / ticksPerMsec);
+#else
+	struct timespec currentTime;
+
+	clock_gettime(CLOCK_MONOTONIC, &currentTime);
+
+	timeUsec = currentTime.tv_sec;
+	timeUsec *= 1000000;
+	timeUsec += currentTime.tv_nsec / 1000;
+#endif
+	return timeUsec;
+}
+
 /* Estimates the encoded length of an RsslMsg.  */
 RTR_C_INLINE RsslUInt32 rsslGetEstimatedEncodedLength(RsslMsg *pRsslMsg)
 {
@@ -44,6 +44,9 @@ RsslWatchlist *rsslWatchlistCreate(RsslWatchlistCreateOptions *pCreateOptions,
 	baseInitOpts.ticksPerMsec = pCreateOptions->ticksPerMsec;
 	baseInitOpts.maxOutstandingPosts = pCreateOptions->maxOutstandingPosts;
 	baseInitOpts.postAckTimeout = pCreateOptions->postAckTimeout;
+	baseInitOpts.filterFanoutByView = pCreateOptions->filterFanoutByView;
+	baseInitOpts.itemRequestRate = pCreateOptions->itemRequestRate;
+	baseInitOpts.requestBatchSize = pCreateOptions->requestBatchSize;
 
 	if ((ret = wlBaseInit(&pWatchlistImpl->base, &baseInitOpts, pErrorInfo)) != RSSL_RET_SUCCESS)
 	{
@@ -108,14 +111,12 @@ RsslInt64 rsslWatchlistProcessFTGroupPing(RsslWatchlist *pWatchlist, RsslUInt8 f
 
 	if (!pGroup) return WL_TIME_UNSET;
 
-	/* Received a ping for an FTGroup we're using. Reset the timer and put it on
-	 * the back of the timeout queue. */
-	rsslQueueRemoveLink(&pWatchlistImpl->items.ftGroupTimerQueue, &pGroup->qlGroups);
-	rsslQueueAddLinkToBack(&pWatchlistImpl->items.ftGroupTimerQueue, &pGroup->qlGroups);
-	pGroup->expireTime = currentTime + pWatchlistImpl->base.pRsslChannel->pingTimeout * 1000;
+	/* Received a ping for an FTGroup we're using. Reset the timer. */
+	wlTimerWheelArm(&pWatchlistImpl->base.timerWheel, &pGroup->timer, currentTime,
+			pWatchlistImpl->base.pRsslChannel->pingTimeout * 1000);
 	pWatchlist->state |= RSSLWL_STF_NEED_TIMER;
 
-	return pGroup->expireTime;
+	return pGroup->timer.expireTime;
 }
 
 void rsslWatchlistDestroy(RsslWatchlist *pWatchlist)
@@ -183,7 +184,8 @@ void rsslWatchlistDestroy(RsslWatchlist *pWatchlist)
 	for(i = 0; i < WL_FTGROUP_TABLE_SIZE; ++i)
 	{
 		if (pWatchlistImpl->items.ftGroupTable[i])
-			wlFTGroupRemove(&pWatchlistImpl->items, pWatchlistImpl->items.ftGroupTable[i]);
+			wlFTGroupRemove(&pWatchlistImpl->base, &pWatchlistImpl->items, 
+					pWatchlistImpl->items.ftGroupTable[i]);
 	}
 
 	while(pLink = rsslQueueRemoveFirstLink(&pWatchlistImpl->base.openStreams))
@@ -434,7 +436,11 @@ RsslRet rsslWatchlistDispatch(RsslWatchlist *pWatchlist, RsslInt64 currentTime,
 		{
 			pWatchlistImpl->base.pWriteCallAgainBuffer = NULL;
 			if (ret > 0)
+			{
 				pWatchlistImpl->base.watchlist.state |= RSSLWL_STF_NEED_FLUSH;
+				++pWatchlistImpl->base.watchlist.writtenMsgs;
+				pWatchlistImpl->base.watchlist.writeRet = ret;
+			}
 		}
 	}
 
@@ -444,8 +450,17 @@ RsslRet rsslWatchlistDispatch(RsslWatchlist *pWatchlist, RsslInt64 currentTime,
 	{
 		WlStream *pStream = RSSL_QUEUE_LINK_TO_OBJECT(WlStream,
 				base.qlStreamsPendingRequest, pLink);
-		if ((ret = wlStreamSubmitMsg(pWatchlistImpl, pStream,
-						pErrorInfo)) < RSSL_RET_SUCCESS)
+		RsslRequestMsg batchMsg;
+		RsslUInt32 itemCount;
+
+		if (wlItemStreamGetBatchRequest(pWatchlistImpl, pStream, &batchMsg))
+			ret = wlItemStreamSubmitBatch(pWatchlistImpl, &pWatchlistImpl->base.streamsPendingRequest,
+					(WlItemStream*)pStream, &batchMsg, pWatchlistImpl->base.config.requestBatchSize,
+					&itemCount, pErrorInfo);
+		else
+			ret = wlStreamSubmitMsg(pWatchlistImpl, pStream, pErrorInfo);
+
+		if (ret < RSSL_RET_SUCCESS)
 		{
 			switch(ret)
 			{
@@ -459,55 +474,96 @@ RsslRet rsslWatchlistDispatch(RsslWatchlist *pWatchlist, RsslInt64 currentTime,
 		}
 	}
 
+	/* Send item requests waiting for the item request rate, as credit allows. */
+	if (wlPacerGetPendingCount(&pWatchlistImpl->base))
+	{
+		int pacingClass;
+
+		wlPacerRefill(&pWatchlistImpl->base, currentTime);
+
+		for (pacingClass = 0; pacingClass < WL_PC_COUNT; ++pacingClass)
+		{
+			RsslQueue *pQueue = &pWatchlistImpl->base.pacer.queues[pacingClass];
+
+			RSSL_QUEUE_FOR_EACH_LINK(pQueue, pLink)
+			{
+				WlStream *pStream = RSSL_QUEUE_LINK_TO_OBJECT(WlStream,
+						base.qlStreamsPendingRequest, pLink);
+				RsslRequestMsg batchMsg;
+				RsslUInt32 itemCount = 1;
+
+				if (pWatchlistImpl->base.pacer.credit < 1000)
+					break;
+
+				/* A batch costs one request's credit for each item in it. */
+				if (wlItemStreamGetBatchRequest(pWatchlistImpl, pStream, &batchMsg))
+					ret = wlItemStreamSubmitBatch(pWatchlistImpl, pQueue, (WlItemStream*)pStream,
+							&batchMsg, (RsslUInt32)(pWatchlistImpl->base.pacer.credit / 1000),
+							&itemCount, pErrorInfo);
+				else
+					ret = wlStreamSubmitMsg(pWatchlistImpl, pStream, pErrorInfo);
+
+				if (ret < RSSL_RET_SUCCESS)
+				{
+					switch(ret)
+					{
+						case RSSL_RET_BUFFER_NO_BUFFERS:
+							pWatchlistImpl->base.watchlist.state |= RSSLWL_STF_NEED_FLUSH;
+							wlPacerSetTimer(&pWatchlistImpl->base);
+							return RSSL_RET_SUCCESS;
+						default:
+							return ret;
+
+					}
+				}
+
+				for (; itemCount > 0; --itemCount)
+					wlPacerTakeCredit(&pWatchlistImpl->base);
+			}
+		}
+
+		wlPacerSetTimer(&pWatchlistImpl->base);
+	}
+
 	return (pWatchlistImpl->base.streamsPendingRequest.count 
 			|| pWatchlistImpl->base.newRequests.count) ? 1 : RSSL_RET_SUCCESS;
 }
 
-RsslInt64 rsslWatchlistGetNextTimeout(RsslWatchlist *pWatchlist)
+void rsslWatchlistGetPacingStats(RsslWatchlist *pWatchlist, RsslWatchlistPacingStats *pStats)
 {
 	RsslWatchlistImpl *pWatchlistImpl = (RsslWatchlistImpl*)pWatchlist;
-	RsslQueueLink *pLink;
-	RsslInt64 time = WL_TIME_UNSET;
-	
-	if ((pLink = rsslQueuePeekFront(&pWatchlistImpl->base.streamsPendingResponse)))
-	{
-		WlStreamBase *pStream = RSSL_QUEUE_LINK_TO_OBJECT(WlStreamBase, qlStreamsPendingResponse, 
-				pLink);
-		time = pStream->requestExpireTime;
-	}
+	WlBase *pBase = &pWatchlistImpl->base;
+	RsslInt64 creditNeeded;
 
-	if ((pLink = rsslQueuePeekFront(&pWatchlistImpl->items.ftGroupTimerQueue)))
-	{
-		WlFTGroup *pGroup = RSSL_QUEUE_LINK_TO_OBJECT(WlFTGroup, qlGroups, pLink);
-		if (pGroup->expireTime < time) time = pGroup->expireTime;
-	}
+	pStats->itemRequestRate = pBase->config.itemRequestRate;
+	pStats->pendingRequests = wlPacerGetPendingCount(pBase);
+	pStats->pendingCriticalRequests = rsslQueueGetElementCount(&pBase->pacer.queues[WL_PC_CRITICAL]);
+	pStats->pacedRequestsSent = pBase->pacer.requestsSent;
 
-	if ((pLink = rsslQueuePeekFront(&pWatchlistImpl->base.postTable.timeoutQueue)))
-	{
-		WlPostRecord *pRecord = RSSL_QUEUE_LINK_TO_OBJECT(WlPostRecord, qlTimeout, pLink);
-		if (pRecord->expireTime < time) time = pRecord->expireTime;
-	}
+	creditNeeded = (RsslInt64)pStats->pendingRequests * 1000 - pBase->pacer.credit;
+	pStats->estimatedTimeRemaining = (creditNeeded > 0) ?
+		(RsslUInt64)((creditNeeded + pBase->config.itemRequestRate - 1) / pBase->config.itemRequestRate) : 0;
+}
 
-	if (pWatchlistImpl->items.gapExpireTime < time) time = pWatchlistImpl->items.gapExpireTime;
+RsslInt64 rsslWatchlistGetNextTimeout(RsslWatchlist *pWatchlist)
+{
+	RsslWatchlistImpl *pWatchlistImpl = (RsslWatchlistImpl*)pWatchlist;
 
-	return time;
+	return wlTimerWheelGetNextExpireTime(&pWatchlistImpl->base.timerWheel);
 }
 
 RsslRet rsslWatchlistProcessTimer(RsslWatchlist *pWatchlist, RsslInt64 currentTime,
 		RsslErrorInfo *pErrorInfo)
 {
 	RsslWatchlistImpl		*pWatchlistImpl = (RsslWatchlistImpl*)pWatchlist;
-	RsslQueueLink			*pLink;
+	WlTimer					*pTimer;
 	RsslStatusMsg			statusMsg;
 	RsslAckMsg				ackMsg;
 	RsslWatchlistMsgEvent	msgEvent;
+	RsslBool				gapTimerExpired = RSSL_FALSE;
 	RsslRet					ret;
 
-	if (!rsslQueueGetElementCount(&pWatchlistImpl->base.streamsPendingResponse)
-			&& !rsslQueueGetElementCount(&pWatchlistImpl->items.ftGroupTimerQueue)
-			&& !rsslQueueGetElementCount(&pWatchlistImpl->items.gapStreamQueue)
-			&& !rsslQueueGetElementCount(&pWatchlistImpl->base.postTable.timeoutQueue)
-			)
+	if (!wlTimerWheelGetCount(&pWatchlistImpl->base.timerWheel))
 		return RSSL_RET_SUCCESS;
 
 	rsslClearStatusMsg(&statusMsg);
@@ -517,300 +573,311 @@ RsslRet rsslWatchlistProcessTimer(RsslWatchlist *pWatchlist, RsslInt64 currentTi
 	statusMsg.state.dataState = RSSL_DATA_SUSPECT;
 	statusMsg.state.code = RSSL_SC_TIMEOUT;
 
-	wlMsgEventClear(&msgEvent);
-	msgEvent.pRsslMsg = (RsslMsg*)&statusMsg;
-	msgEvent._flags = WL_MEF_SEND_CLOSE;
+	rsslClearAckMsg(&ackMsg);
+	ackMsg.msgBase.containerType = RSSL_DT_NO_DATA;
+	ackMsg.nakCode = RSSL_NAKC_NO_RESPONSE;
+	rssl_set_buffer_to_string(ackMsg.text, "Acknowledgement timed out.");
 
 	pWatchlistImpl->base.watchlist.state &= ~RSSLWL_STF_NEED_TIMER;
 
-	/* Check stream timeouts. */
-	rssl_set_buffer_to_string(statusMsg.state.text, "Request timed out.");
-	statusMsg.state.code = RSSL_SC_TIMEOUT;
-	while ((pLink = rsslQueuePeekFront(&pWatchlistImpl->base.streamsPendingResponse)))
+	/* Handle each expired timer according to its owner. */
+	while ((pTimer = wlTimerWheelPopExpired(&pWatchlistImpl->base.timerWheel, currentTime)))
 	{
-		WlStream *pStream = (WlStream*)RSSL_QUEUE_LINK_TO_OBJECT(WlStream,
-				base.qlStreamsPendingResponse, pLink);
-
-		statusMsg.msgBase.domainType = pStream->base.domainType;
-
-		/* Next timeout in queue has not expired yet. */
-		if (pStream->base.requestExpireTime > currentTime)
-		{
-			pWatchlistImpl->base.watchlist.state |= RSSLWL_STF_NEED_TIMER;
-			break;
-		}
-		
-		wlUnsetStreamMsgPending(&pWatchlistImpl->base, &pStream->base);
+		wlMsgEventClear(&msgEvent);
+		msgEvent.pRsslMsg = (RsslMsg*)&statusMsg;
+		msgEvent._flags = WL_MEF_SEND_CLOSE;
+		statusMsg.state.streamState = RSSL_STREAM_CLOSED_RECOVER;
 
-		switch(pStream->base.domainType)
+		switch(pTimer->timerType)
 		{
-			case RSSL_DMT_LOGIN:
+			case WL_TMT_REQUEST:
 			{
-				RsslDecodeIterator dIter;
-				RsslRDMLoginMsg loginMsg;
-				WlLoginProviderAction loginAction;
-				RsslInt32 streamId = pWatchlistImpl->login.pStream->base.streamId;
+				/* Check stream timeouts. */
+				WlStream *pStream = (WlStream*)RSSL_QUEUE_LINK_TO_OBJECT(WlStream,
+						base.requestTimer, pTimer);
 
-				rsslClearDecodeIterator(&dIter);
-				rsslSetDecodeIteratorRWFVersion(&dIter, RSSL_RWF_MAJOR_VERSION, 
-						RSSL_RWF_MINOR_VERSION);
+				rssl_set_buffer_to_string(statusMsg.state.text, "Request timed out.");
+				statusMsg.state.code = RSSL_SC_TIMEOUT;
+				statusMsg.msgBase.domainType = pStream->base.domainType;
 
-				msgEvent.pRsslMsg->msgBase.streamId = pWatchlistImpl->login.pStream->base.streamId;
+				pStream->base.requestState &= ~WL_STRS_PENDING_RESPONSE;
+				wlUnsetStreamMsgPending(&pWatchlistImpl->base, &pStream->base);
 
-				if ((ret = wlLoginProcessProviderMsg(&pWatchlistImpl->login, &pWatchlistImpl->base, 
-								&dIter, (RsslMsg*)&statusMsg, &loginMsg, &loginAction, pErrorInfo)) 
-						!= RSSL_RET_SUCCESS)
-					return ret;
+				switch(pStream->base.domainType)
+				{
+					case RSSL_DMT_LOGIN:
+					{
+						RsslDecodeIterator dIter;
+						RsslRDMLoginMsg loginMsg;
+						WlLoginProviderAction loginAction;
 
-				/* Should be told to recover. */
-				assert(loginAction == WL_LGPA_RECOVER);
+						rsslClearDecodeIterator(&dIter);
+						rsslSetDecodeIteratorRWFVersion(&dIter, RSSL_RWF_MAJOR_VERSION, 
+								RSSL_RWF_MINOR_VERSION);
 
-				/* Close old login stream */
-				wlLoginStreamClose(&pWatchlistImpl->base, &pWatchlistImpl->login, RSSL_TRUE);
+						msgEvent.pRsslMsg->msgBase.streamId = pWatchlistImpl->login.pStream->base.streamId;
 
-				/* Create new login stream. */
-				statusMsg.state.streamState = RSSL_STREAM_OPEN;
-				if (!(pWatchlistImpl->login.pStream = wlLoginStreamCreate(
-								&pWatchlistImpl->base, &pWatchlistImpl->login, pErrorInfo)))
-					return pErrorInfo->rsslError.rsslErrorId;
-				pWatchlistImpl->login.pRequest->base.pStream = &pWatchlistImpl->login.pStream->base;
+						if ((ret = wlLoginProcessProviderMsg(&pWatchlistImpl->login, &pWatchlistImpl->base, 
+										&dIter, (RsslMsg*)&statusMsg, &loginMsg, &loginAction, pErrorInfo)) 
+								!= RSSL_RET_SUCCESS)
+							return ret;
 
-				msgEvent.pRsslMsg = NULL;
-				msgEvent.pRdmMsg = (RsslRDMMsg*)&loginMsg;
-				loginMsg.rdmMsgBase.streamId = pWatchlistImpl->login.pRequest->base.streamId;
-				if ((ret = (*pWatchlistImpl->base.config.msgCallback)
-							((RsslWatchlist*)&pWatchlistImpl->base.watchlist, &msgEvent, pErrorInfo)) 
-						!= RSSL_RET_SUCCESS)
-					return ret;
+						/* Should be told to recover. */
+						assert(loginAction == WL_LGPA_RECOVER);
 
-				break;
-			}
+						/* Close old login stream */
+						wlLoginStreamClose(&pWatchlistImpl->base, &pWatchlistImpl->login, RSSL_TRUE);
 
-			case RSSL_DMT_SOURCE:
-			{
-				RsslDecodeIterator dIter;
-				RsslInt32 streamId = pWatchlistImpl->directory.pStream->base.streamId;
-
-				rsslClearDecodeIterator(&dIter);
-				rsslSetDecodeIteratorRWFVersion(&dIter, RSSL_RWF_MAJOR_VERSION, 
-						RSSL_RWF_MINOR_VERSION);
-				if ((ret = wlDirectoryProcessProviderMsgEvent(&pWatchlistImpl->base,
-						&pWatchlistImpl->directory, &dIter, &msgEvent, pErrorInfo))
-						!= RSSL_RET_SUCCESS)
-					return ret;
+						/* Create new login stream. */
+						statusMsg.state.streamState = RSSL_STREAM_OPEN;
+						if (!(pWatchlistImpl->login.pStream = wlLoginStreamCreate(
+										&pWatchlistImpl->base, &pWatchlistImpl->login, pErrorInfo)))
+							return pErrorInfo->rsslError.rsslErrorId;
+						pWatchlistImpl->login.pRequest->base.pStream = &pWatchlistImpl->login.pStream->base;
 
-				/* Close old directory stream and create new one. */
-				assert (pWatchlistImpl->base.channelState == WL_CHS_LOGGED_IN);
+						msgEvent.pRsslMsg = NULL;
+						msgEvent.pRdmMsg = (RsslRDMMsg*)&loginMsg;
+						loginMsg.rdmMsgBase.streamId = pWatchlistImpl->login.pRequest->base.streamId;
+						if ((ret = (*pWatchlistImpl->base.config.msgCallback)
+									((RsslWatchlist*)&pWatchlistImpl->base.watchlist, &msgEvent, pErrorInfo)) 
+								!= RSSL_RET_SUCCESS)
+							return ret;
 
-				wlDirectoryStreamClose(&pWatchlistImpl->base, &pWatchlistImpl->directory, 
-						RSSL_TRUE);
+						break;
+					}
 
-				if (!(pWatchlistImpl->directory.pStream = wlDirectoryStreamCreate(
-								&pWatchlistImpl->base, &pWatchlistImpl->directory, 
-								pErrorInfo)))
-					return pErrorInfo->rsslError.rsslErrorId;
+					case RSSL_DMT_SOURCE:
+					{
+						RsslDecodeIterator dIter;
 
-				pWatchlistImpl->base.channelState = WL_CHS_READY;
-				break;
-			}
-			default:
-			{
-				if ((ret = wlFanoutItemMsgEvent(pWatchlistImpl, &pStream->item, &msgEvent, 
-								pErrorInfo)) != RSSL_RET_SUCCESS)
-					return ret;
-				pWatchlistImpl->items.pCurrentFanoutStream = NULL;
+						rsslClearDecodeIterator(&dIter);
+						rsslSetDecodeIteratorRWFVersion(&dIter, RSSL_RWF_MAJOR_VERSION, 
+								RSSL_RWF_MINOR_VERSION);
+						if ((ret = wlDirectoryProcessProviderMsgEvent(&pWatchlistImpl->base,
+								&pWatchlistImpl->directory, &dIter, &msgEvent, pErrorInfo))
+								!= RSSL_RET_SUCCESS)
+							return ret;
 
-				break;
-			}
-		}
-	}
+						/* Close old directory stream and create new one. */
+						assert (pWatchlistImpl->base.channelState == WL_CHS_LOGGED_IN);
 
-	/* Check FTGroups. */
-	rssl_set_buffer_to_string(statusMsg.state.text, "Fault-tolerant Group timeout.");
-	statusMsg.state.code = RSSL_SC_TIMEOUT;
-	while ((pLink = rsslQueuePeekFront(&pWatchlistImpl->items.ftGroupTimerQueue)))
-	{
-		RsslQueueLink *pStreamLink;
-		WlFTGroup *pGroup = RSSL_QUEUE_LINK_TO_OBJECT(WlFTGroup, qlGroups, pLink);
+						wlDirectoryStreamClose(&pWatchlistImpl->base, &pWatchlistImpl->directory, 
+								RSSL_TRUE);
 
-		/* Next timeout in queue has not expired yet. */
-		if (pGroup->expireTime > currentTime)
-		{
-			pWatchlistImpl->base.watchlist.state |= RSSLWL_STF_NEED_TIMER;
-			break;
-		}
+						if (!(pWatchlistImpl->directory.pStream = wlDirectoryStreamCreate(
+										&pWatchlistImpl->base, &pWatchlistImpl->directory, 
+										pErrorInfo)))
+							return pErrorInfo->rsslError.rsslErrorId;
 
-		pWatchlistImpl->items.pCurrentFanoutFTGroup = pGroup;
+						pWatchlistImpl->base.channelState = WL_CHS_READY;
+						break;
+					}
+					default:
+					{
+						if ((ret = wlFanoutItemMsgEvent(pWatchlistImpl, &pStream->item, &msgEvent, 
+										pErrorInfo)) != RSSL_RET_SUCCESS)
+							return ret;
+						pWatchlistImpl->items.pCurrentFanoutStream = NULL;
 
-		RSSL_QUEUE_FOR_EACH_LINK(&pGroup->openStreamList, pStreamLink)
-		{
-			WlItemStream *pItemStream = RSSL_QUEUE_LINK_TO_OBJECT(WlItemStream, qlFTGroup, 
-					pStreamLink);
+						break;
+					}
+				}
+				break;
+			}
 
-			statusMsg.msgBase.domainType = pItemStream->base.domainType;
-			if ((ret = wlFanoutItemMsgEvent(pWatchlistImpl, pItemStream, &msgEvent, 
-							pErrorInfo)) != RSSL_RET_SUCCESS)
-				return ret;
-			pWatchlistImpl->items.pCurrentFanoutStream = NULL;
-		}
+			case WL_TMT_FT_GROUP:
+			{
+				/* Check FTGroups. */
+				RsslQueueLink *pStreamLink;
+				WlFTGroup *pGroup = RSSL_QUEUE_LINK_TO_OBJECT(WlFTGroup, timer, pTimer);
 
-		pWatchlistImpl->items.pCurrentFanoutFTGroup = NULL;
+				rssl_set_buffer_to_string(statusMsg.state.text, "Fault-tolerant Group timeout.");
+				statusMsg.state.code = RSSL_SC_TIMEOUT;
 
-		if (!rsslQueueGetElementCount(&pGroup->openStreamList))
-			wlFTGroupRemove(&pWatchlistImpl->items, pGroup); 
+				pWatchlistImpl->items.pCurrentFanoutFTGroup = pGroup;
 
-	}
+				RSSL_QUEUE_FOR_EACH_LINK(&pGroup->openStreamList, pStreamLink)
+				{
+					WlItemStream *pItemStream = RSSL_QUEUE_LINK_TO_OBJECT(WlItemStream, qlFTGroup, 
+							pStreamLink);
 
-	rssl_set_buffer_to_string(statusMsg.state.text, "Gap in sequence number.");
-	statusMsg.state.code = RSSL_SC_GAP_DETECTED;
+					statusMsg.msgBase.domainType = pItemStream->base.domainType;
+					if ((ret = wlFanoutItemMsgEvent(pWatchlistImpl, pItemStream, &msgEvent, 
+									pErrorInfo)) != RSSL_RET_SUCCESS)
+						return ret;
+					pWatchlistImpl->items.pCurrentFanoutStream = NULL;
+				}
 
-	/* Check gap detection timer. */
-	if (pWatchlistImpl->items.gapExpireTime < currentTime)
-	{
-		while ((pLink = rsslQueuePeekFront(&pWatchlistImpl->items.gapStreamQueue)))
-		{
-			WlItemStream *pItemStream = RSSL_QUEUE_LINK_TO_OBJECT(WlItemStream, qlGap, pLink);
+				pWatchlistImpl->items.pCurrentFanoutFTGroup = NULL;
 
+				if (!rsslQueueGetElementCount(&pGroup->openStreamList))
+					wlFTGroupRemove(&pWatchlistImpl->base, &pWatchlistImpl->items, pGroup); 
 
-			if (pWatchlistImpl->base.gapRecovery)
-			{
-				statusMsg.msgBase.domainType = pItemStream->base.domainType;
-				if ((ret = wlFanoutItemMsgEvent(pWatchlistImpl, pItemStream, &msgEvent, 
-								pErrorInfo)) != RSSL_RET_SUCCESS)
-					return ret;
-				pWatchlistImpl->items.pCurrentFanoutStream = NULL;
+				break;
 			}
-			else
+
+			case WL_TMT_GAP:
 			{
-				WlBufferedMsg *pBufferedMsg;
-				RsslWatchlistMsgEvent bufferedMsgEvent;
+				/* Check gap detection timer. */
+				RsslQueueLink *pLink;
 
-				assert(pItemStream->flags & WL_IOSF_BC_BEHIND_UC);
+				rssl_set_buffer_to_string(statusMsg.state.text, "Gap in sequence number.");
+				statusMsg.state.code = RSSL_SC_GAP_DETECTED;
+				gapTimerExpired = RSSL_TRUE;
 
-				/* If gap recovery is not enabled, this means that the stream was placed
-				 * here due to receiving a unicast message ahead of the broadcast stream
-				 * while reodering. Since the broadcast stream has not caught up yet, 
-				 * assume the expected messages have been lost and forward currently 
-				 * buffered messages. */
+				while ((pLink = rsslQueuePeekFront(&pWatchlistImpl->items.gapStreamQueue)))
+				{
+					WlItemStream *pItemStream = RSSL_QUEUE_LINK_TO_OBJECT(WlItemStream, qlGap, pLink);
 
-				/* Since multiple messages may be forwarded, set fanout stream
-				 * so we can stop if the stream is closed (either due to a closed streamState
-				 * or because the application closed it from inside the callback. */
-				pWatchlistImpl->items.pCurrentFanoutStream = pItemStream;
 
-				while ( pBufferedMsg = wlMsgReorderQueuePop(
-							&pItemStream->bufferedMsgQueue))
-				{
-					wlMsgEventClear(&bufferedMsgEvent);
-					bufferedMsgEvent.pSeqNum = &pBufferedMsg->seqNum;
-					bufferedMsgEvent.pRsslMsg = wlBufferedMsgGetRsslMsg(pBufferedMsg);
-					if (pBufferedMsg->flags & WL_BFMSG_HAS_FT_GROUP_ID)
-						bufferedMsgEvent.pFTGroupId = &pBufferedMsg->ftGroupId;
-
-					/* If a sequence number isn't set for the broadcast stream,
-					 * update the sequence number that we have (this way, if
-					 * any other refreshes come with the same number, we still
-					 * let them through). */
-					if (!(pItemStream->flags & WL_IOSF_HAS_BC_SEQ_NUM))
+					if (pWatchlistImpl->base.gapRecovery)
 					{
-						pItemStream->flags |= WL_IOSF_HAS_UC_SEQ_NUM;
-						pItemStream->seqNum = pBufferedMsg->seqNum;
+						statusMsg.msgBase.domainType = pItemStream->base.domainType;
+						if ((ret = wlFanoutItemMsgEvent(pWatchlistImpl, pItemStream, &msgEvent, 
+										pErrorInfo)) != RSSL_RET_SUCCESS)
+							return ret;
+						pWatchlistImpl->items.pCurrentFanoutStream = NULL;
 					}
+					else
+					{
+						WlBufferedMsg *pBufferedMsg;
+						RsslWatchlistMsgEvent bufferedMsgEvent;
 
-					ret = wlFanoutItemMsgEvent(pWatchlistImpl, pItemStream, 
-							&bufferedMsgEvent, 
-							pErrorInfo);
+						assert(pItemStream->flags & WL_IOSF_BC_BEHIND_UC);
 
-					wlBufferedMsgDestroy(pBufferedMsg);
-					if (ret != RSSL_RET_SUCCESS)
-						return ret;
+						/* If gap recovery is not enabled, this means that the stream was placed
+						 * here due to receiving a unicast message ahead of the broadcast stream
+						 * while reodering. Since the broadcast stream has not caught up yet, 
+						 * assume the expected messages have been lost and forward currently 
+						 * buffered messages. */
 
-					/* If stream was closed, stop. */
-					if (pWatchlistImpl->items.pCurrentFanoutStream == NULL)
-						break;
-				}
+						/* Since multiple messages may be forwarded, set fanout stream
+						 * so we can stop if the stream is closed (either due to a closed streamState
+						 * or because the application closed it from inside the callback. */
+						pWatchlistImpl->items.pCurrentFanoutStream = pItemStream;
 
-				/* If stream was closed, stop. */
-				if (pWatchlistImpl->items.pCurrentFanoutStream == NULL)
-					continue;
+						while ( pBufferedMsg = wlMsgReorderQueuePop(
+									&pItemStream->bufferedMsgQueue))
+						{
+							wlMsgEventClear(&bufferedMsgEvent);
+							bufferedMsgEvent.pSeqNum = &pBufferedMsg->seqNum;
+							bufferedMsgEvent.pRsslMsg = wlBufferedMsgGetRsslMsg(pBufferedMsg);
+							if (pBufferedMsg->flags & WL_BFMSG_HAS_FT_GROUP_ID)
+								bufferedMsgEvent.pFTGroupId = &pBufferedMsg->ftGroupId;
+
+							/* If a sequence number isn't set for the broadcast stream,
+							 * update the sequence number that we have (this way, if
+							 * any other refreshes come with the same number, we still
+							 * let them through). */
+							if (!(pItemStream->flags & WL_IOSF_HAS_BC_SEQ_NUM))
+							{
+								pItemStream->flags |= WL_IOSF_HAS_UC_SEQ_NUM;
+								pItemStream->seqNum = pBufferedMsg->seqNum;
+							}
 
-				/* Done forwarding messages. */
-				pWatchlistImpl->items.pCurrentFanoutStream = NULL;
+							ret = wlFanoutItemMsgEvent(pWatchlistImpl, pItemStream, 
+									&bufferedMsgEvent, 
+									pErrorInfo);
 
-				wlUnsetGapTimer(pWatchlistImpl, pItemStream, WL_IOSF_BC_BEHIND_UC);
+							wlBufferedMsgDestroy(pBufferedMsg);
+							if (ret != RSSL_RET_SUCCESS)
+								return ret;
+
+							/* If stream was closed, stop. */
+							if (pWatchlistImpl->items.pCurrentFanoutStream == NULL)
+								break;
+						}
+
+						/* If stream was closed, stop. */
+						if (pWatchlistImpl->items.pCurrentFanoutStream == NULL)
+							continue;
+
+						/* Done forwarding messages. */
+						pWatchlistImpl->items.pCurrentFanoutStream = NULL;
+
+						wlUnsetGapTimer(pWatchlistImpl, pItemStream, WL_IOSF_BC_BEHIND_UC);
+					}
+				}
+				break;
 			}
-		}
-	}
 
-	/* Check timeouts for outstanding post acknowledgements. */
-	wlMsgEventClear(&msgEvent);
-	msgEvent.pRsslMsg = (RsslMsg*)&ackMsg;
+			case WL_TMT_POST:
+			{
+				/* Check timeouts for outstanding post acknowledgements. */
+				WlPostRecord *pRecord = RSSL_QUEUE_LINK_TO_OBJECT(WlPostRecord, timer, pTimer);
+				WlRequest *pRequest = (WlRequest*)pRecord->pUserSpec;
 
-	rsslClearAckMsg(&ackMsg);
-	ackMsg.msgBase.containerType = RSSL_DT_NO_DATA;
-	ackMsg.nakCode = RSSL_NAKC_NO_RESPONSE;
-	rssl_set_buffer_to_string(ackMsg.text, "Acknowledgement timed out.");
+				msgEvent.pRsslMsg = (RsslMsg*)&ackMsg;
+				msgEvent._flags = 0;
 
-	while ((pLink = rsslQueuePeekFront(&pWatchlistImpl->base.postTable.timeoutQueue)))
-	{
-		WlPostRecord *pRecord = RSSL_QUEUE_LINK_TO_OBJECT(WlPostRecord, qlTimeout, pLink);
-		WlRequest *pRequest;
+				ackMsg.msgBase.domainType = pRequest->base.domainType;
+				ackMsg.flags = RSSL_AKMF_HAS_TEXT | RSSL_AKMF_HAS_NAK_CODE;
+				ackMsg.ackId = pRecord->postId;
+				ackMsg.msgBase.streamId = pRequest->base.streamId;
+				ackMsg.msgBase.domainType = pRecord->domainType;
 
-		if (pRecord->expireTime > currentTime) 
-		{
-			pWatchlistImpl->base.watchlist.state |= RSSLWL_STF_NEED_TIMER;
-			break;
-		}
+				if (pRecord->flags & RSSL_PSMF_HAS_SEQ_NUM)
+				{
+					ackMsg.flags |= RSSL_AKMF_HAS_SEQ_NUM;
+					ackMsg.seqNum = pRecord->seqNum;
+				}
 
-		pRequest = (WlRequest*)pRecord->pUserSpec;
+				rsslQueueRemoveLink(&pRequest->base.openPosts, &pRecord->qlUser);
+				wlPostTableRemoveRecord(&pWatchlistImpl->base.postTable, pRecord);
 
-		ackMsg.msgBase.domainType = pRequest->base.domainType;
-		ackMsg.flags = RSSL_AKMF_HAS_TEXT | RSSL_AKMF_HAS_NAK_CODE;
-		ackMsg.ackId = pRecord->postId;
-		ackMsg.msgBase.streamId = pRequest->base.streamId;
-		ackMsg.msgBase.domainType = pRecord->domainType;
+				if (pRequest->base.domainType == RSSL_DMT_LOGIN)
+				{
+					/* Off-stream post */
+					RsslWatchlistStreamInfo streamInfo;
+					wlStreamInfoClear(&streamInfo);
+					streamInfo.pUserSpec = pRequest->base.pUserSpec;
+					msgEvent.pStreamInfo = &streamInfo;
 
-		if (pRecord->flags & RSSL_PSMF_HAS_SEQ_NUM)
-		{
-			ackMsg.flags |= RSSL_AKMF_HAS_SEQ_NUM;
-			ackMsg.seqNum = pRecord->seqNum;
-		}
+					if ((ret = (*pWatchlistImpl->base.config.msgCallback)
+								((RsslWatchlist*)&pWatchlistImpl->base.watchlist, &msgEvent, pErrorInfo)) 
+							!= RSSL_RET_SUCCESS)
+						return ret;
+				}
+				else
+				{
+					/* Onstream post */
+					if ((ret = wlSendMsgEventToItemRequest(pWatchlistImpl, &msgEvent, (WlItemRequest*)pRequest, pErrorInfo))
+						!= RSSL_RET_SUCCESS)
+						return ret;
+				}
+				break;
+			}
 
-		rsslQueueRemoveLink(&pRequest->base.openPosts, &pRecord->qlUser);
-		wlPostTableRemoveRecord(&pWatchlistImpl->base.postTable, pRecord);
+			case WL_TMT_PACING:
+				/* Credit is available for more item requests; they are sent on the next dispatch. */
+				wlPacerRefill(&pWatchlistImpl->base, currentTime);
+				break;
 
-		if (pRequest->base.domainType == RSSL_DMT_LOGIN)
-		{
-			/* Off-stream post */
-			RsslWatchlistStreamInfo streamInfo;
-			wlStreamInfoClear(&streamInfo);
-			streamInfo.pUserSpec = pRequest->base.pUserSpec;
-			msgEvent.pStreamInfo = &streamInfo;
+			case WL_TMT_CONFLATION:
+			{
+				/* Deliver the update a request has conflated over its interval. */
+				WlItemRequest *pItemRequest = RSSL_QUEUE_LINK_TO_OBJECT(WlItemRequest, 
+						conflationTimer, pTimer);
 
-			if ((ret = (*pWatchlistImpl->base.config.msgCallback)
-						((RsslWatchlist*)&pWatchlistImpl->base.watchlist, &msgEvent, pErrorInfo)) 
-					!= RSSL_RET_SUCCESS)
-				return ret;
-		}
-		else
-		{
-			/* Onstream post */
-			if ((ret = wlSendMsgEventToItemRequest(pWatchlistImpl, &msgEvent, (WlItemRequest*)pRequest, pErrorInfo))
-				!= RSSL_RET_SUCCESS)
-				return ret;
-		}
+				if ((ret = wlItemRequestDeliverConflatedUpdate(&pWatchlistImpl->base, pItemRequest,
+								pErrorInfo)) != RSSL_RET_SUCCESS)
+					return ret;
+				break;
+			}
 
+			default:
+				assert(0);
+				break;
+		}
 	}
 
-	/* Update gap timer. */
-	if ((pLink = rsslQueuePeekFront(&pWatchlistImpl->items.gapStreamQueue)))
-	{
-		pWatchlistImpl->items.gapExpireTime = pWatchlistImpl->base.currentTime + 
-			pWatchlistImpl->base.gapTimeout;
+	/* Update gap timer, if any streams remain after it expired. */
+	if (gapTimerExpired && rsslQueuePeekFront(&pWatchlistImpl->items.gapStreamQueue))
+		wlTimerWheelArm(&pWatchlistImpl->base.timerWheel, &pWatchlistImpl->items.gapTimer,
+				pWatchlistImpl->base.currentTime, pWatchlistImpl->base.gapTimeout);
+
+	if (wlTimerWheelGetCount(&pWatchlistImpl->base.timerWheel))
 		pWatchlistImpl->base.watchlist.state |= RSSLWL_STF_NEED_TIMER;
-	}
-	else
-		pWatchlistImpl->items.gapExpireTime = WL_TIME_UNSET;
 
 	return RSSL_RET_SUCCESS;
 }
@@ -819,11 +886,11 @@ void rsslWatchlistResetGapTimer(RsslWatchlist *pWatchlist)
 {
 	RsslWatchlistImpl *pWatchlistImpl = (RsslWatchlistImpl*)pWatchlist;
 
-	if (pWatchlistImpl->items.gapExpireTime == WL_TIME_UNSET)
+	if (!wlTimerIsArmed(&pWatchlistImpl->items.gapTimer))
 		return;
 
-	pWatchlistImpl->items.gapExpireTime = pWatchlistImpl->base.currentTime + 
-		pWatchlistImpl->base.gapTimeout;
+	wlTimerWheelArm(&pWatchlistImpl->base.timerWheel, &pWatchlistImpl->items.gapTimer,
+			pWatchlistImpl->base.currentTime, pWatchlistImpl->base.gapTimeout);
 	pWatchlistImpl->base.watchlist.state |= RSSLWL_STF_NEED_TIMER;
 }
 
@@ -1196,8 +1263,38 @@ RsslRet rsslWatchlistReadMsg(RsslWatchlist *pWatchlist,
 		if (pOptions->pRsslMsg->msgBase.streamId != 0)
 		{
 			const RsslState *pState = rsslGetState(pOptions->pRsslMsg);
+			WlItemStream *pBatchStream = NULL;
 
-			if (pState && pState->streamState != RSSL_STREAM_OPEN)
+			/* The provider closes the stream of a batch request once it has opened the items;
+			 * this needs no close. */
+			if (pOptions->pRsslMsg->msgBase.streamId >= MIN_STREAM_ID
+					&& pOptions->pRsslMsg->msgBase.streamId < MAX_STREAM_ID)
+			{
+				RsslInt32 nextStreamId = pOptions->pRsslMsg->msgBase.streamId + 1;
+
+				if ((pHashLink = rsslHashTableFind(&pWatchlistImpl->base.streamsById,
+								(void*)&nextStreamId, NULL)))
+				{
+					WlStream *pNextStream = RSSL_HASH_LINK_TO_OBJECT(WlStream, base.hlStreamId,
+							pHashLink);
+
+					switch(pNextStream->base.domainType)
+					{
+						case RSSL_DMT_LOGIN:
+						case RSSL_DMT_SOURCE:
+							break;
+						default:
+							if (((WlItemStream*)pNextStream)->flags & WL_IOSF_BATCH_FIRST)
+							{
+								pBatchStream = (WlItemStream*)pNextStream;
+								pBatchStream->flags &= ~WL_IOSF_BATCH_FIRST;
+							}
+							break;
+					}
+				}
+			}
+
+			if (pState && pState->streamState != RSSL_STREAM_OPEN && !pBatchStream)
 			{
 				WlStreamBase *pStreamBase = (WlStreamBase*)malloc(sizeof(WlStreamBase));
 				verify_malloc(pStreamBase, pErrorInfo, RSSL_RET_FAILURE);
@@ -1515,8 +1612,8 @@ static void wlSetGapTimer(RsslWatchlistImpl *pWatchlistImpl, WlItemStream *pItem
 		if (!(pItemStream->flags & (WL_IOSF_HAS_BC_SEQ_GAP | WL_IOSF_HAS_PART_GAP | WL_IOSF_BC_BEHIND_UC)))
 		{
 			/* Move back gap timer. */
-			pWatchlistImpl->items.gapExpireTime = pWatchlistImpl->base.currentTime + 
-				pWatchlistImpl->base.gapTimeout;
+			wlTimerWheelArm(&pWatchlistImpl->base.timerWheel, &pWatchlistImpl->items.gapTimer,
+					pWatchlistImpl->base.currentTime, pWatchlistImpl->base.gapTimeout);
 			pWatchlistImpl->base.watchlist.state |= RSSLWL_STF_NEED_TIMER;
 
 			rsslQueueAddLinkToBack(&pWatchlistImpl->items.gapStreamQueue,
@@ -1546,7 +1643,8 @@ static void wlUnsetGapTimer(RsslWatchlistImpl *pWatchlistImpl, WlItemStream *pIt
 
 			/* If all streams have been removed, reset gap timer. */
 			if (rsslQueueGetElementCount(&pWatchlistImpl->items.gapStreamQueue) == 0)
-				pWatchlistImpl->items.gapExpireTime = WL_TIME_UNSET;
+				wlTimerWheelCancel(&pWatchlistImpl->base.timerWheel, 
+						&pWatchlistImpl->items.gapTimer);
 		}
 	}
 }
@@ -2898,6 +2996,9 @@ RsslRet rsslWatchlistSubmitMsg(RsslWatchlist *pWatchlist,
 						opts.pRequestMsg = (RsslRequestMsg*)pOptions->pRsslMsg;
 						opts.pServiceName = pOptions->pServiceName;
 						opts.pUserSpec = pOptions->pUserSpec;
+						opts.critical = pOptions->critical;
+						opts.conflateUpdates = pOptions->conflateUpdates;
+						opts.conflationInterval = pOptions->conflationInterval;
 						opts.majorVersion = pOptions->majorVersion;
 						opts.minorVersion = pOptions->minorVersion;
 
@@ -3470,7 +3571,22 @@ RsslRet rsslWatchlistSubmitMsg(RsslWatchlist *pWatchlist,
 										&pDirectoryRequest->qlRequestedService);
 							}
 
-							wlAddRequest(&pWatchlistImpl->base, &pDirectoryRequest->base);
+							if (wlAddRequest(&pWatchlistImpl->base, &pDirectoryRequest->base) != RSSL_RET_SUCCESS)
+							{
+								rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+										"Memory allocation failed.");
+								if (pDirectoryRequest->pRequestedService)
+								{
+									rsslQueueRemoveLink(&pDirectoryRequest->pRequestedService->directoryRequests,
+											&pDirectoryRequest->qlRequestedService);
+									wlRequestedServiceCheckRefCount(&pWatchlistImpl->base, pDirectoryRequest->pRequestedService);
+								}
+								else
+									rsslQueueRemoveLink(&pWatchlistImpl->directory.requests,
+											&pDirectoryRequest->qlRequestedService);
+								wlDirectoryRequestDestroy(pDirectoryRequest);
+								return RSSL_RET_FAILURE;
+							}
 
 							pDirectoryRequest->base.pStateQueue = &pWatchlistImpl->base.newRequests;
 							rsslQueueAddLinkToBack(&pWatchlistImpl->base.newRequests, 
@@ -3564,6 +3680,9 @@ RsslRet rsslWatchlistSubmitMsg(RsslWatchlist *pWatchlist,
 				opts.pRequestMsg = (RsslRequestMsg*)&requestMsg;
 				opts.pServiceName = pOptions->pServiceName;
 				opts.pUserSpec = pOptions->pUserSpec;
+				opts.critical = pOptions->critical;
+				opts.conflateUpdates = pOptions->conflateUpdates;
+				opts.conflationInterval = pOptions->conflationInterval;
 				opts.majorVersion = pOptions->majorVersion;
 				opts.minorVersion = pOptions->minorVersion;
 
@@ -3608,6 +3727,7 @@ static RsslRet wlWriteBuffer(RsslWatchlistImpl *pWatchlistImpl, RsslBuffer *pWri
 				if (pWatchlistImpl->base.pRsslChannel->state == RSSL_CH_STATE_ACTIVE)
 				{
 					pWatchlistImpl->base.watchlist.state |= RSSLWL_STF_NEED_FLUSH;
+					++pWatchlistImpl->base.watchlist.writtenMsgs;
 					return 1;
 				}
 				else
@@ -3624,7 +3744,11 @@ static RsslRet wlWriteBuffer(RsslWatchlistImpl *pWatchlistImpl, RsslBuffer *pWri
 		}
 	}
 	else if (ret > RSSL_RET_SUCCESS)
+	{
 		pWatchlistImpl->base.watchlist.state |= RSSLWL_STF_NEED_FLUSH;
+		++pWatchlistImpl->base.watchlist.writtenMsgs;
+		pWatchlistImpl->base.watchlist.writeRet = ret;
+	}
 
 	return ret;
 
@@ -3819,6 +3943,85 @@ static RsslRet wlEncodeAndSubmitMsg(RsslWatchlistImpl *pWatchlistImpl,
 	} while (1);
 }
 
+/* Commits the state of an item stream after its request message was sent. */
+static void wlItemStreamCommitRequest(RsslWatchlistImpl *pWatchlistImpl,
+		WlItemStream *pItemStream, RsslRequestMsg *pRequestMsg, RsslBool hasViewFlag,
+		WlAggregateView *pView)
+{
+	if (!(pRequestMsg->flags & RSSL_RQMF_NO_REFRESH))
+	{
+		RsslQueueLink *pLink;
+		RSSL_QUEUE_FOR_EACH_LINK(&pItemStream->requestsRecovering, pLink)
+		{
+			WlRequest *pRequest = RSSL_QUEUE_LINK_TO_OBJECT(WlRequest, base.qlStateQueue, pLink);
+			pRequest->base.pStateQueue = &pItemStream->requestsPendingRefresh;
+		}
+
+		assert(pItemStream->refreshState == WL_ISRS_REQUEST_REFRESH);
+		rsslQueueAppend(&pItemStream->requestsPendingRefresh,
+				&pItemStream->requestsRecovering);
+		pItemStream->refreshState = WL_ISRS_PENDING_REFRESH;
+
+		if (!(pRequestMsg->flags & RSSL_RQMF_STREAMING))
+			pItemStream->flags |= WL_IOSF_PENDING_SNAPSHOT;
+
+		/* Restart buffering. */
+		if (pItemStream->flags & WL_IOSF_HAS_BC_SEQ_NUM)
+		{
+			assert(pItemStream->flags & WL_IOSF_HAS_UC_SEQ_NUM);
+			/* Use the last broadcast sequence number as the
+			 * new starting point instead of the original. */
+			pItemStream->flags &= ~WL_IOSF_HAS_BC_SEQ_NUM;
+		}
+
+		if (pWatchlistImpl->base.pRsslChannel)
+			wlSetStreamPendingResponse(&pWatchlistImpl->base, &pItemStream->base);
+
+	}
+
+	wlUnsetStreamMsgPending(&pWatchlistImpl->base, &pItemStream->base);
+	pItemStream->flags |= WL_IOSF_REQUESTED;
+
+	/* If we sent new priority info, commit the change. */
+	pItemStream->flags &= ~WL_IOSF_PENDING_PRIORITY_CHANGE;
+	if (pRequestMsg->flags & RSSL_RQMF_HAS_PRIORITY)
+	{
+		pItemStream->priorityClass = pRequestMsg->priorityClass;
+		pItemStream->priorityCount = pRequestMsg->priorityCount;
+	}
+
+	/* New encDataBody/extendedHeader sent (if it was present). */
+	pItemStream->pRequestWithExtraInfo = NULL;
+
+	if (pWatchlistImpl->base.config.supportViewRequests)
+	{
+		if (pItemStream->flags & WL_IOSF_PENDING_VIEW_CHANGE)
+		{
+			/* Sent the new view, commit changes. */
+			pItemStream->flags &= ~WL_IOSF_PENDING_VIEW_CHANGE;
+
+			if (!(pRequestMsg->flags & RSSL_RQMF_NO_REFRESH))
+				pItemStream->flags |= WL_IOSF_PENDING_VIEW_REFRESH;
+
+			if (pView) 
+			{
+				pItemStream->flags |= WL_IOSF_VIEWED;
+				wlAggregateViewCommitViews(pItemStream->pAggregateView);
+			}
+			else if (!hasViewFlag)
+				pItemStream->flags &= ~WL_IOSF_VIEWED;
+
+			/* Destroy view if no longer needed. */
+			if(pItemStream->pAggregateView
+					&& pItemStream->requestsWithViewCount == 0)
+			{
+				wlAggregateViewDestroy(pItemStream->pAggregateView);
+				pItemStream->pAggregateView = NULL;
+			}
+		}
+	}
+}
+
 static RsslRet wlStreamSubmitMsg(RsslWatchlistImpl *pWatchlistImpl,
 		WlStream *pStream, RsslErrorInfo *pError)
 {
@@ -4099,87 +4302,248 @@ static RsslRet wlStreamSubmitMsg(RsslWatchlistImpl *pWatchlistImpl,
 
 				if (ret >= RSSL_RET_SUCCESS)
 				{
-					if (!(requestMsg.flags & RSSL_RQMF_NO_REFRESH))
-					{
-						RsslQueueLink *pLink;
-						RSSL_QUEUE_FOR_EACH_LINK(&pItemStream->requestsRecovering, pLink)
-						{
-							WlRequest *pRequest = RSSL_QUEUE_LINK_TO_OBJECT(WlRequest, base.qlStateQueue, pLink);
-							pRequest->base.pStateQueue = &pItemStream->requestsPendingRefresh;
-						}
+					wlItemStreamCommitRequest(pWatchlistImpl, pItemStream, &requestMsg,
+							hasViewFlag, pView);
+					return ret;
+				}
 
-						assert(pItemStream->refreshState == WL_ISRS_REQUEST_REFRESH);
-						rsslQueueAppend(&pItemStream->requestsPendingRefresh,
-								&pItemStream->requestsRecovering);
-						pItemStream->refreshState = WL_ISRS_PENDING_REFRESH;
+				break;
+			}
+		}
 
-						if (!(requestMsg.flags & RSSL_RQMF_STREAMING))
-							pItemStream->flags |= WL_IOSF_PENDING_SNAPSHOT;
+	}
 
-						/* Restart buffering. */
-						if (pItemStream->flags & WL_IOSF_HAS_BC_SEQ_NUM)
-						{
-							assert(pItemStream->flags & WL_IOSF_HAS_UC_SEQ_NUM);
-							/* Use the last broadcast sequence number as the
-							 * new starting point instead of the original. */
-							pItemStream->flags &= ~WL_IOSF_HAS_BC_SEQ_NUM;
-						}
+	return ret;
+}
 
-						if (pWatchlistImpl->base.pRsslChannel)
-							wlSetStreamPendingResponse(&pWatchlistImpl->base, &pItemStream->base);
+static RsslBool wlItemStreamGetBatchRequest(RsslWatchlistImpl *pWatchlistImpl,
+		WlStream *pStream, RsslRequestMsg *pRequestMsg)
+{
+	WlItemStream *pItemStream;
+	WlStreamAttributes *pAttributes;
 
-					}
+	if (pWatchlistImpl->base.config.requestBatchSize < 2
+			|| !pWatchlistImpl->base.config.supportBatchRequests
+			|| pStream->base.isClosing)
+		return RSSL_FALSE;
 
-					wlUnsetStreamMsgPending(&pWatchlistImpl->base, &pItemStream->base);
+	switch(pStream->base.domainType)
+	{
+		case RSSL_DMT_LOGIN:
+		case RSSL_DMT_SOURCE:
+			return RSSL_FALSE;
+		default:
+			break;
+	}
 
-					/* If we sent new priority info, commit the change. */
-					pItemStream->flags &= ~WL_IOSF_PENDING_PRIORITY_CHANGE;
-					if (requestMsg.flags & RSSL_RQMF_HAS_PRIORITY)
-					{
-						pItemStream->priorityClass = requestMsg.priorityClass;
-						pItemStream->priorityCount = requestMsg.priorityCount;
-					}
+	pItemStream = (WlItemStream*)pStream;
+	pAttributes = &pItemStream->streamAttributes;
+
+	/* Only new requests that carry nothing specific to the item can be batched. A stream
+	 * already requested from the provider must keep its stream ID. */
+	if (pItemStream->refreshState != WL_ISRS_REQUEST_REFRESH
+			|| pItemStream->flags & (WL_IOSF_REQUESTED | WL_IOSF_PRIVATE | WL_IOSF_QUALIFIED
+				| WL_IOSF_PAUSED | WL_IOSF_VIEWED)
+			|| pItemStream->requestsPausedCount
+			|| pItemStream->requestsWithViewCount
+			|| pItemStream->pRequestWithExtraInfo
+			|| !pItemStream->pWlService
+			|| !(pAttributes->msgKey.flags & RSSL_MKF_HAS_NAME)
+			|| pAttributes->msgKey.flags & ~(RSSL_MKF_HAS_NAME | RSSL_MKF_HAS_NAME_TYPE
+				| RSSL_MKF_HAS_SERVICE_ID))
+		return RSSL_FALSE;
+
+	rsslClearRequestMsg(pRequestMsg);
+	pRequestMsg->flags = RSSL_RQMF_HAS_BATCH;
+	pRequestMsg->msgBase.domainType = pAttributes->domainType;
+	pRequestMsg->msgBase.containerType = RSSL_DT_ELEMENT_LIST;
+
+	/* The batch's key has everything but the names. */
+	pRequestMsg->msgBase.msgKey.flags = RSSL_MKF_HAS_SERVICE_ID;
+	pRequestMsg->msgBase.msgKey.serviceId = (RsslUInt16)pItemStream->pWlService->pService->rdm.serviceId;
+	if (pAttributes->msgKey.flags & RSSL_MKF_HAS_NAME_TYPE)
+	{
+		pRequestMsg->msgBase.msgKey.flags |= RSSL_MKF_HAS_NAME_TYPE;
+		pRequestMsg->msgBase.msgKey.nameType = pAttributes->msgKey.nameType;
+	}
 
-					/* New encDataBody/extendedHeader sent (if it was present). */
-					pItemStream->pRequestWithExtraInfo = NULL;
+	if (pAttributes->qos.timeliness != RSSL_QOS_TIME_UNSPECIFIED)
+	{
+		pRequestMsg->flags |= RSSL_RQMF_HAS_QOS;
+		pRequestMsg->qos = pAttributes->qos;
+	}
 
-					if (pWatchlistImpl->base.config.supportViewRequests)
-					{
-						if (pItemStream->flags & WL_IOSF_PENDING_VIEW_CHANGE)
-						{
-							/* Sent the new view, commit changes. */
-							pItemStream->flags &= ~WL_IOSF_PENDING_VIEW_CHANGE;
+	if (pItemStream->requestsStreamingCount)
+	{
+		pRequestMsg->flags |= RSSL_RQMF_STREAMING;
 
-							if (!(requestMsg.flags & RSSL_RQMF_NO_REFRESH))
-								pItemStream->flags |= WL_IOSF_PENDING_VIEW_REFRESH;
+		if (pItemStream->flags & WL_IOSF_PENDING_PRIORITY_CHANGE
+				&& wlItemStreamMergePriority(pItemStream, &pRequestMsg->priorityClass,
+					&pRequestMsg->priorityCount))
+			pRequestMsg->flags |= RSSL_RQMF_HAS_PRIORITY;
+	}
 
-							if (pView) 
-							{
-								pItemStream->flags |= WL_IOSF_VIEWED;
-								wlAggregateViewCommitViews(pItemStream->pAggregateView);
-							}
-							else if (!hasViewFlag)
-								pItemStream->flags &= ~WL_IOSF_VIEWED;
+	return RSSL_TRUE;
+}
 
-							/* Destroy view if no longer needed. */
-							if(pItemStream->pAggregateView
-									&& pItemStream->requestsWithViewCount == 0)
-							{
-								wlAggregateViewDestroy(pItemStream->pAggregateView);
-								pItemStream->pAggregateView = NULL;
-							}
-						}
-					}
+/* Indicates whether two requests can be sent in the same batch. */
+static RsslBool wlBatchRequestsMatch(RsslRequestMsg *pRequestMsg1, RsslRequestMsg *pRequestMsg2)
+{
+	if (pRequestMsg1->msgBase.domainType != pRequestMsg2->msgBase.domainType
+			|| pRequestMsg1->flags != pRequestMsg2->flags
+			|| pRequestMsg1->msgBase.msgKey.flags != pRequestMsg2->msgBase.msgKey.flags
+			|| pRequestMsg1->msgBase.msgKey.serviceId != pRequestMsg2->msgBase.msgKey.serviceId)
+		return RSSL_FALSE;
+
+	if (pRequestMsg1->msgBase.msgKey.flags & RSSL_MKF_HAS_NAME_TYPE
+			&& pRequestMsg1->msgBase.msgKey.nameType != pRequestMsg2->msgBase.msgKey.nameType)
+		return RSSL_FALSE;
+
+	if (pRequestMsg1->flags & RSSL_RQMF_HAS_QOS
+			&& !rsslQosIsEqual(&pRequestMsg1->qos, &pRequestMsg2->qos))
+		return RSSL_FALSE;
+
+	if (pRequestMsg1->flags & RSSL_RQMF_HAS_PRIORITY
+			&& (pRequestMsg1->priorityClass != pRequestMsg2->priorityClass
+				|| pRequestMsg1->priorityCount != pRequestMsg2->priorityCount))
+		return RSSL_FALSE;
+
+	return RSSL_TRUE;
+}
 
-					return ret;
-				}
+static RsslRet wlItemStreamSubmitBatch(RsslWatchlistImpl *pWatchlistImpl, RsslQueue *pQueue,
+		WlItemStream *pItemStream, RsslRequestMsg *pBatchMsg, RsslUInt32 maxItems,
+		RsslUInt32 *pItemCount, RsslErrorInfo *pError)
+{
+	WlBase *pBase = &pWatchlistImpl->base;
+	WlStreamBase **batchStreams = pBase->batchStreams;
+	RsslQueueLink *pLink;
+	RsslRequestMsg requestMsg;
+	RsslEncodeIterator eIter;
+	RsslElementList elementList;
+	RsslElementEntry elementEntry;
+	RsslArray batchArray;
+	RsslBuffer encodeBuffer;
+	RsslUInt32 itemCount, i, bufferLength;
+	RsslInt32 streamId;
+	RsslRet ret;
 
-				break;
-			}
+	if (maxItems > pBase->config.requestBatchSize)
+		maxItems = pBase->config.requestBatchSize;
+
+	/* Find the streams to combine with this one. Streams are taken in the order they are
+	 * waiting, so that they are combined the same way each time the queue is walked. */
+	batchStreams[0] = &pItemStream->base;
+	itemCount = 1;
+	bufferLength = 64 + pItemStream->streamAttributes.msgKey.name.length + 8;
+	for (pLink = rsslQueuePeekNext(pQueue, &pItemStream->base.qlStreamsPendingRequest);
+			pLink && itemCount < maxItems; pLink = rsslQueuePeekNext(pQueue, pLink))
+	{
+		WlStream *pStream = RSSL_QUEUE_LINK_TO_OBJECT(WlStream, base.qlStreamsPendingRequest, pLink);
+
+		if (!wlItemStreamGetBatchRequest(pWatchlistImpl, pStream, &requestMsg)
+				|| !wlBatchRequestsMatch(pBatchMsg, &requestMsg))
+			continue;
+
+		batchStreams[itemCount++] = &pStream->base;
+		bufferLength += pStream->item.streamAttributes.msgKey.name.length + 8;
+	}
+
+	*pItemCount = 0;
+
+	/* Nothing to combine it with. */
+	if (itemCount == 1)
+	{
+		if ((ret = wlStreamSubmitMsg(pWatchlistImpl, (WlStream*)pItemStream, pError))
+				>= RSSL_RET_SUCCESS)
+			*pItemCount = 1;
+		return ret;
+	}
+
+	/* Encode the list of names. */
+	if (bufferLength > pBase->tempEncodeBuffer.length
+			&& rsslHeapBufferResize(&pBase->tempEncodeBuffer, bufferLength, RSSL_FALSE)
+				!= RSSL_RET_SUCCESS)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+				"Memory allocation failed.");
+		return RSSL_RET_FAILURE;
+	}
+
+	encodeBuffer = pBase->tempEncodeBuffer;
+	rsslClearEncodeIterator(&eIter);
+	rsslSetEncodeIteratorRWFVersion(&eIter, pBase->pRsslChannel->majorVersion,
+			pBase->pRsslChannel->minorVersion);
+	rsslSetEncodeIteratorBuffer(&eIter, &encodeBuffer);
+
+	rsslClearElementList(&elementList);
+	elementList.flags = RSSL_ELF_HAS_STANDARD_DATA;
+	rsslClearElementEntry(&elementEntry);
+	elementEntry.name = RSSL_ENAME_BATCH_ITEM_LIST;
+	elementEntry.dataType = RSSL_DT_ARRAY;
+	rsslClearArray(&batchArray);
+	batchArray.primitiveType = RSSL_DT_ASCII_STRING;
+
+	if ((ret = rsslEncodeElementListInit(&eIter, &elementList, NULL, 0)) != RSSL_RET_SUCCESS
+			|| (ret = rsslEncodeElementEntryInit(&eIter, &elementEntry, 0)) != RSSL_RET_SUCCESS
+			|| (ret = rsslEncodeArrayInit(&eIter, &batchArray)) != RSSL_RET_SUCCESS)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, ret, __FILE__, __LINE__, 
+				"Failed to encode batch request item list.");
+		return RSSL_RET_FAILURE;
+	}
+
+	for (i = 0; i < itemCount; ++i)
+	{
+		WlItemStream *pBatchStream = (WlItemStream*)batchStreams[i];
+
+		if ((ret = rsslEncodeArrayEntry(&eIter, NULL,
+						&pBatchStream->streamAttributes.msgKey.name)) != RSSL_RET_SUCCESS)
+		{
+			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, ret, __FILE__, __LINE__, 
+					"Failed to encode batch request item list.");
+			return RSSL_RET_FAILURE;
 		}
+	}
+
+	if ((ret = rsslEncodeArrayComplete(&eIter, RSSL_TRUE)) != RSSL_RET_SUCCESS
+			|| (ret = rsslEncodeElementEntryComplete(&eIter, RSSL_TRUE)) != RSSL_RET_SUCCESS
+			|| (ret = rsslEncodeElementListComplete(&eIter, RSSL_TRUE)) != RSSL_RET_SUCCESS)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, ret, __FILE__, __LINE__, 
+				"Failed to encode batch request item list.");
+		return RSSL_RET_FAILURE;
+	}
+
+	/* The batch takes the first stream ID, and its items take the IDs that follow. */
+	streamId = wlBaseTakeStreamIdRange(pBase, itemCount + 1);
+
+	pBatchMsg->msgBase.streamId = streamId;
+	pBatchMsg->msgBase.encDataBody.data = encodeBuffer.data;
+	pBatchMsg->msgBase.encDataBody.length = rsslGetEncodedBufferLength(&eIter);
+
+	if ((ret = wlEncodeAndSubmitMsg(pWatchlistImpl, (RsslMsg*)pBatchMsg, NULL, RSSL_FALSE, NULL,
+					pError)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	/* Move each stream to its ID in the batch and commit its request. */
+	for (i = 0; i < itemCount; ++i)
+	{
+		WlItemStream *pBatchStream = (WlItemStream*)batchStreams[i];
+
+		rsslHashTableRemoveLink(&pBase->streamsById, &pBatchStream->base.hlStreamId);
+		pBatchStream->base.streamId = ++streamId;
+		/* Cannot fail: the stream was just removed, so the table is below its resize threshold. */
+		rsslHashTableInsertLink(&pBase->streamsById, &pBatchStream->base.hlStreamId,
+				(void*)&pBatchStream->base.streamId, NULL);
+
+		if (i == 0)
+			pBatchStream->flags |= WL_IOSF_BATCH_FIRST;
 
+		wlItemStreamCommitRequest(pWatchlistImpl, pBatchStream, pBatchMsg, RSSL_FALSE, NULL);
 	}
 
+	*pItemCount = itemCount;
 	return ret;
 }
 
@@ -83,6 +83,19 @@ RsslInt64 rsslWatchlistGetNextTimeout(RsslWatchlist *pWatchlist);
 RsslRet rsslWatchlistProcessTimer(RsslWatchlist *pWatchlist, RsslInt64 currentTime,
 		RsslErrorInfo *pErrorInfo);
 
+/* Progress of item requests waiting to be sent under the item request rate. */
+typedef struct
+{
+	RsslUInt32	itemRequestRate;			/* Item requests per second; 0 if unlimited. */
+	RsslUInt32	pendingRequests;			/* Item requests waiting to be sent. */
+	RsslUInt32	pendingCriticalRequests;	/* Waiting item requests for critical items. */
+	RsslUInt64	pacedRequestsSent;			/* Item requests sent under the rate. */
+	RsslUInt64	estimatedTimeRemaining;		/* Time until all waiting requests are sent, in milliseconds. */
+} RsslWatchlistPacingStats;
+
+/* Retrieves the progress of item requests waiting to be sent. */
+void rsslWatchlistGetPacingStats(RsslWatchlist *pWatchlist, RsslWatchlistPacingStats *pStats);
+
 /* Resets gap timeout to its starting value. Should be called when
  * gaps are detected in the transport. */
 void rsslWatchlistResetGapTimer(RsslWatchlist *pWatchlist);
@@ -101,6 +114,9 @@ typedef struct
 	RsslUInt32					maxOutstandingPosts;
 	RsslUInt32					postAckTimeout;
 	RsslInt64					ticksPerMsec;
+	RsslBool					filterFanoutByView;
+	RsslUInt32					itemRequestRate;
+	RsslUInt32					requestBatchSize;
 } RsslWatchlistCreateOptions;
 
 /* Reactor-facing watchlist structure. */
@@ -108,6 +124,8 @@ struct RsslWatchlist
 {
 	void				*pUserSpec;
 	RsslUInt32			state;
+	RsslUInt32			writtenMsgs;	/* Messages written that need the channel to be flushed, since the reactor last took them. */
+	RsslInt32			writeRet;		/* Bytes pending flush, as returned by the watchlist's last rsslWrite call. */
 };
 
 RTR_C_INLINE void rsslWatchlistClearCreateOptions(RsslWatchlistCreateOptions *pOptions)
@@ -145,6 +163,9 @@ typedef struct
 	RsslUInt32			viewElemCount;
 	void				*viewElemList;
 	void				*pUserSpec;
+	RsslBool			critical;
+	RsslBool			conflateUpdates;
+	RsslUInt32			conflationInterval;
 	RsslUInt32			majorVersion;
 	RsslUInt32			minorVersion;
 	RsslUInt8			*pFTGroupId;
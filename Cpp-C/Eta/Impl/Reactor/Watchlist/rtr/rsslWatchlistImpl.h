@@ -71,10 +71,27 @@ static RsslRet wlSendRefreshEventToItemRequest(RsslWatchlistImpl *pWatchlistImpl
 static RsslRet wlFanoutItemMsgEvent(RsslWatchlistImpl *pWatchlistImpl, WlItemStream *pItemStream,
 		RsslWatchlistMsgEvent *pEvent, RsslErrorInfo *pErrorInfo);
 
+/* Commits the state of an item stream after its request message was sent. */
+static void wlItemStreamCommitRequest(RsslWatchlistImpl *pWatchlistImpl,
+		WlItemStream *pItemStream, RsslRequestMsg *pRequestMsg, RsslBool hasViewFlag,
+		WlAggregateView *pView);
+
 /* Constructs and sends a request message for a stream. */
 static RsslRet wlStreamSubmitMsg(RsslWatchlistImpl *pWatchlistImpl,
 		WlStream *pStream, RsslErrorInfo *pError);
 
+/* Indicates whether a stream's request can be combined into a batch request. If so, the request
+ * is set up with the attributes that a batch containing it must share. */
+static RsslBool wlItemStreamGetBatchRequest(RsslWatchlistImpl *pWatchlistImpl,
+		WlStream *pStream, RsslRequestMsg *pRequestMsg);
+
+/* Constructs and sends a batch request for a stream, combined with the streams after it in
+ * pQueue that are waiting to send matching requests. At most maxItems requests are combined;
+ * the number sent is returned in pItemCount. */
+static RsslRet wlItemStreamSubmitBatch(RsslWatchlistImpl *pWatchlistImpl, RsslQueue *pQueue,
+		WlItemStream *pItemStream, RsslRequestMsg *pBatchMsg, RsslUInt32 maxItems,
+		RsslUInt32 *pItemCount, RsslErrorInfo *pError);
+
 static RsslRet wlProcessRemovedService(RsslWatchlistImpl *pWatchlistImpl,
 		WlService *pWlService, RsslErrorInfo *pErrorInfo);
 
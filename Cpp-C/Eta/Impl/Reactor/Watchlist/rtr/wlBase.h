@@ -17,10 +17,9 @@
 #include "rtr/rsslQueue.h"
 #include "rtr/rsslTypes.h"
 #include "rtr/wlPostIdTable.h"
+#include "rtr/wlTimerWheel.h"
 #include <assert.h>
 
-static const RsslInt64 WL_TIME_UNSET = 0x7fffffffffffffffLL;
-
 #define rssl_set_buffer_to_string(__buffer, __string) \
 	(__buffer.data = (char*)__string, __buffer.length = sizeof(__string) - 1) 
 
@@ -82,22 +81,44 @@ typedef enum
 {
 	WL_STRS_NONE				= 0x0,	/* Stream has no request to send. */
 	WL_STRS_PENDING_REQUEST		= 0x1,	/* Stream needs to send a request. */
-	WL_STRS_PENDING_RESPONSE	= 0x2	/* Stream has sent a request and is awaiting response. */
+	WL_STRS_PENDING_RESPONSE	= 0x2,	/* Stream has sent a request and is awaiting response. */
+	WL_STRS_PACED				= 0x4	/* Stream's request is waiting for the item request rate
+										 * (set along with WL_STRS_PENDING_REQUEST). */
 } WlStreamBaseRequestState;
 
+/* Order in which requests waiting for the item request rate are sent. */
+typedef enum
+{
+	WL_PC_CRITICAL		= 0,	/* Critical items and dictionaries. */
+	WL_PC_NORMAL		= 1,	/* All other items. */
+	WL_PC_COUNT			= 2
+} WlPacingClass;
+
+/* Identifies the owner of a timer in the watchlist's timing wheel. */
+typedef enum
+{
+	WL_TMT_REQUEST		= 1,	/* Request timeout of a stream (WlStreamBase). */
+	WL_TMT_FT_GROUP		= 2,	/* Ping timeout of a fault-tolerant group (WlFTGroup). */
+	WL_TMT_GAP			= 3,	/* Gap recovery timer for item streams (WlItems). */
+	WL_TMT_POST			= 4,	/* Acknowledgement timeout of a post (WlPostRecord). */
+	WL_TMT_PACING		= 5,	/* Item request rate credit (WlRequestPacer). */
+	WL_TMT_CONFLATION	= 6		/* Delivery of a conflated update (WlItemRequest). */
+} WlTimerType;
+
 /* Base structure for streams. */
 struct WlStreamBase
 {
 	RsslHashLink	hlStreamId;
 	RsslQueueLink	qlStreamsList;
 	RsslQueueLink	qlStreamsPendingRequest;
-	RsslQueueLink	qlStreamsPendingResponse;
+	WlTimer			requestTimer;				/* Armed while awaiting a response; expires when the 
+												 * request is considered timed out. */
 	RsslInt32		streamId;
 	RsslUInt8		domainType;
-	RsslInt64		requestExpireTime;			/* Time at which the request is considered timed out. */
 	RsslBool		isClosing;
 	RsslBool		tempStream;
 	RsslUInt8		requestState;
+	RsslUInt8		pacingClass;				/* WlPacingClass, if WL_STRS_PACED is set. */
 };
 
 /* Initializes a WlStreamBase. */
@@ -106,6 +127,7 @@ RTR_C_INLINE void wlStreamBaseInit(WlStreamBase *pBase, RsslInt32 streamId, Rssl
 	memset(pBase, 0, sizeof(WlStreamBase));
 	pBase->streamId = streamId;
 	pBase->domainType = domainType;
+	wlTimerInit(&pBase->requestTimer, WL_TMT_REQUEST);
 }
 
 /* Contains configuration. May be set at watchlist initialiation, or by login request/refresh. */
@@ -113,13 +135,30 @@ typedef struct
 {
 	RsslUInt					supportOptimizedPauseResume;	/* Login refresh parameter, SupportOptimizedPauseResume. */
 	RsslUInt					supportViewRequests;			/* Login refresh parameter, SupportViewRequests. */
+	RsslUInt					supportBatchRequests;			/* Login refresh parameter, SupportBatchRequests. */
 	RsslUInt					singleOpen;						/* Login request parameter, SingleOpen. */
 	RsslUInt					allowSuspectData;				/* Login request parameter, AllowSuspectData. */
 	RsslWatchlistMsgCallback	*msgCallback;					/* Callback the watchlist should use to forward messages. */
 	RsslBool					obeyOpenWindow;					/* Whether the watchlist obeys a service's OpenWindow. */
 	RsslUInt32					requestTimeout;					/* Request timeout, in milliseconds. */
+	RsslBool					filterFanoutByView;				/* Whether messages fanned out to requests with field ID views
+																 * are filtered down to those views. */
+	RsslUInt32					itemRequestRate;				/* Item requests per second; 0 if unlimited. */
+	RsslUInt32					requestBatchSize;				/* Most item requests combined into one batch request;
+																 * 0 or 1 if requests are not combined. */
 } WlConfig;
 
+/* Sends item requests no faster than the configured item request rate. Waiting requests
+ * are sent by class, then in the order they were queued. */
+typedef struct
+{
+	RsslQueue			queues[WL_PC_COUNT];	/* Streams waiting to send a request, by WlPacingClass. */
+	WlTimer				timer;					/* Armed while requests are waiting for credit. */
+	RsslInt64			credit;					/* Available credit, in thousandths of a request. */
+	RsslInt64			lastRefillTime;			/* Time credit was last added. */
+	RsslUInt64			requestsSent;			/* Number of requests sent from the queues. */
+} WlRequestPacer;
+
 /* Represents the state of the current channel session. */
 typedef enum 
 {
@@ -146,6 +185,13 @@ typedef struct WlBase
 	RsslBuffer			tempDecodeBuffer;		/* Reusable decoding buffer. */
 	RsslBuffer			tempEncodeBuffer;		/* Reusable encoding buffer. */
 	RsslBuffer			tempFanoutBuffer;		/* Reusable fanout buffer. */
+	RsslFieldEntry		*conflationEntries;		/* Reusable array of decoded entries, used when merging
+												 * conflated updates. */
+	RsslUInt32			conflationEntryCount;	/* Size of the conflationEntries array. */
+	RsslUInt16			*conflationFieldTable;	/* Position of each field ID among the conflationEntries
+												 * (plus one), used when merging conflated updates. */
+	WlStreamBase		**batchStreams;			/* Reusable array of the streams combined into one batch
+												 * request; requestBatchSize long. */
 	RsslHashTable		streamsById;			/* Table of open streams, by Stream ID. */
 	RsslHashTable		requestsByStreamId;		/* Table of requests, by stream ID. */
 	RsslUInt32			channelMaxFragmentSize;	/* Channel's maxFragmentSize. */
@@ -154,7 +200,9 @@ typedef struct WlBase
 	RsslBuffer			*pWriteCallAgainBuffer;	/* Used to handle RSSL_RET_WRITE_CALL_AGAIN codes from rsslWrite. */
 	WlServiceCache		*pServiceCache;			/* Serivce cache. */
 	RsslQueue			streamsPendingRequest;	/* Streams that need to send a request. */
-	RsslQueue			streamsPendingResponse;	/* Streams opened but waiting for a response. */
+	WlRequestPacer		pacer;					/* Item requests waiting for the item request rate. */
+	WlTimerWheel		timerWheel;				/* Timers for request timeouts, FTGroup pings, gap recovery
+												 * and post acknowledgements. */
 	RsslMemoryPool		requestPool;			/* Pool of WlRequest structures. */
 	RsslMemoryPool		streamPool;				/* Pool of WlStream structures. */
 	RsslInt64			currentTime;			/* Latest timestamp set by caller, in milliseconds. */
@@ -183,6 +231,9 @@ typedef struct
 	RsslInt64						ticksPerMsec;			/* Ticks per millisecond. Used when getting current time (windows only) */
 	RsslUInt32						maxOutstandingPosts;	/* Acknowledgement pool limit. */
 	RsslUInt32						postAckTimeout;			/* Timeout for acks of onstream posts. */
+	RsslBool						filterFanoutByView;		/* Whether to filter fanout to requests' field ID views. */
+	RsslUInt32						itemRequestRate;		/* Item requests per second; 0 if unlimited. */
+	RsslUInt32						requestBatchSize;		/* Most item requests combined into one batch request. */
 } WlBaseInitOptions;
 
 /* Initializes a WlBase structure. */
@@ -191,8 +242,8 @@ RsslRet wlBaseInit(WlBase *pBase, WlBaseInitOptions *pOpts, RsslErrorInfo *pErro
 /* Cleans up a WlBase structure. */
 void wlBaseCleanup(WlBase *pBase);
 
-/* Adds a request to the watchlist. */
-void wlAddRequest(WlBase *pBase, WlRequestBase *pRequestBase);
+/* Adds a request to the watchlist. Fails if the request table could not grow. */
+RsslRet wlAddRequest(WlBase *pBase, WlRequestBase *pRequestBase);
 
 /* Removes a request from the watchlist. */
 void wlRemoveRequest(WlBase *pBase, WlRequestBase *pRequestBase);
@@ -222,9 +273,34 @@ static void wlInitMsgEvent(WlBase *pBase, RsslWatchlistMsgEvent *pMsgEvent,
 /* Sets a stream to send a message. */
 void wlSetStreamMsgPending(WlBase *pBase, WlStreamBase *pStreamBase);
 
+/* Sets a stream to send a request under the item request rate. If no rate is set, this is the
+ * same as wlSetStreamMsgPending. If the stream is already waiting, it is moved up if
+ * pacingClass is higher than its current class. */
+void wlSetStreamMsgPaced(WlBase *pBase, WlStreamBase *pStreamBase, WlPacingClass pacingClass);
+
 /* Removes a stream from the message pending queue. */
 void wlUnsetStreamMsgPending(WlBase *pBase, WlStreamBase *pStreamBase);
 
+/* Adds credit for the time elapsed up to currentTime. */
+void wlPacerRefill(WlBase *pBase, RsslInt64 currentTime);
+
+/* Takes credit for sending one request. Returns RSSL_FALSE if there is not enough. */
+RsslBool wlPacerTakeCredit(WlBase *pBase);
+
+/* Arms the pacer's timer for when the next request can be sent, if any are waiting. */
+void wlPacerSetTimer(WlBase *pBase);
+
+/* Returns the number of requests waiting for credit. */
+RTR_C_INLINE RsslUInt32 wlPacerGetPendingCount(WlBase *pBase)
+{
+	RsslUInt32 count = 0;
+	int i;
+
+	for (i = 0; i < WL_PC_COUNT; ++i)
+		count += rsslQueueGetElementCount(&pBase->pacer.queues[i]);
+	return count;
+}
+
 /* Sets stream to wait for a response. */
 void wlSetStreamPendingResponse(WlBase *pBase, WlStreamBase *pStreamBase);
 
@@ -240,6 +316,9 @@ void wlUnsetStreamFromPendingLists(WlBase *pBase, WlStreamBase *pStreamBase);
 /* Retrieves an unused stream ID. */
 RsslInt32 wlBaseTakeStreamId(WlBase *pBase);
 
+/* Retrieves a range of consecutive unused stream IDs, returning the first. */
+RsslInt32 wlBaseTakeStreamIdRange(WlBase *pBase, RsslUInt32 count);
+
 /* Retrieves an unused stream ID. */
 RsslInt32 wlBaseTakeProviderStreamId(WlBase *pBase);
 
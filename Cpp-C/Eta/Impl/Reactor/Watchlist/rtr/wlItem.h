@@ -58,7 +58,9 @@ typedef enum
 	WL_IOSF_BC_BEHIND_UC				= 0x1000,	/* Broadcast stream is behind unicast stream. */
 	WL_IOSF_HAS_BC_SYNCH_SEQ_NUM		= 0x2000,	/* WlItemStream::bcSynchSeqNum contains the sequence number of a broadcast message that was used to syncrhonize. */
 	WL_IOSF_CLOSED						= 0x4000,	/* If closing this stream, do we need to send a close upstream? */
-	WL_IOSF_QUALIFIED					= 0x8000	/* Stream is qualified. */
+	WL_IOSF_QUALIFIED					= 0x8000,	/* Stream is qualified. */
+	WL_IOSF_REQUESTED					= 0x10000,	/* Stream has been requested from the provider, so further requests must use its stream ID. */
+	WL_IOSF_BATCH_FIRST					= 0x20000	/* Stream was the first item of a batch request; the batch used the preceding stream ID. */
 } WlItemStreamFlags;
 
 /* Maintains information about a stream open on the network. */
@@ -125,7 +127,10 @@ typedef enum
 	WL_IRQF_BATCH			= 0x10,	/* Request is a batch request and needs acknowledgement. */
 	WL_IRQF_HAS_PROV_KEY	= 0x20,	/* Request is provider driven but has received a message with 
 									 * a key. */
-	WL_IRQF_QUALIFIED		= 0x40	/* Request is for a qualified stream. */
+	WL_IRQF_QUALIFIED		= 0x40,	/* Request is for a qualified stream. */
+	WL_IRQF_CRITICAL		= 0x80,	/* Request is for a critical item, whose requests are sent
+									 * ahead of others under the item request rate. */
+	WL_IRQF_CONFLATE		= 0x100	/* Request conflates updates. */
 } WlItemRequestFlags;
 
 struct WlItemRequest
@@ -148,6 +153,17 @@ struct WlItemRequest
 	WlView					*pView;					/* View set by this request. */
 	RsslBuffer				encDataBody;			/* Encoded dataBody. */
 	RsslBuffer				extendedHeader;			/* Extended header, if any. */
+	WlTimer					conflationTimer;		/* Armed while a conflated update is pending; expires
+													 * when it should be delivered. */
+	RsslUInt32				conflationInterval;		/* Time over which updates are conflated, in milliseconds. */
+	RsslBuffer				conflatedDataMemory;	/* Memory for the pending conflated update's payload. */
+	RsslUInt32				conflatedDataLength;	/* Length of the pending conflated update's payload. */
+	RsslBuffer				conflatedPermMemory;	/* Memory for the pending update's permission data. */
+	RsslUInt32				conflatedPermLength;	/* Length of the pending update's permission data. */
+	RsslUInt16				conflatedUpdateFlags;	/* Flags of the pending update (RsslUpdateFlags). */
+	RsslUInt8				conflatedUpdateType;	/* Update type of the latest conflated update. */
+	RsslUInt32				conflatedSeqNum;		/* Sequence number of the latest conflated update. */
+	RsslUInt32				conflationCount;		/* Number of updates in the pending update. */
 };
 
 /* Closes an item request. */
@@ -213,11 +229,10 @@ void wlItemGroupRemove(WlItemGroup *pItemGroup);
 /* Represents a fault-tolerant multicast group. */
 struct WlFTGroup
 {
-	RsslQueueLink	qlGroups;			/* Group list list. */
+	WlTimer			timer;				/* Expires at the next time before which we should receive
+										 * a ping for this group. */
 	RsslUInt8		ftGroupId;			/* FTGroup ID. */
 	RsslQueue		openStreamList;		/* List of streams provided by this group. */
-	RsslInt64		expireTime;			/* Next time before which we should receive a ping for
-										 * this group. */
 };
 
 /* Adds an item stream to an FTGroup. Creates the FTGroup if it does not exist. */
@@ -225,10 +240,10 @@ RsslRet wlFTGroupAddStream(WlBase *pBase, WlItems *pItems, RsslUInt8 ftGroupId,
 		WlItemStream *pItemStream, RsslErrorInfo *pErrorInfo);
 
 /* Removes an item stream from an FTGroup. Destroys the FTGroup if it is emptied. */
-void wlFTGroupRemoveStream(WlItems *pItems, WlItemStream *pItemStream);
+void wlFTGroupRemoveStream(WlBase *pBase, WlItems *pItems, WlItemStream *pItemStream);
 
 /* Removes an FTGroup from the table of groups and destroys it (used during general cleanup). */
-void wlFTGroupRemove(WlItems *pItems, WlFTGroup *pGroup);
+void wlFTGroupRemove(WlBase *pBase, WlItems *pItems, WlFTGroup *pGroup);
 
 
 /* Handles item requests. */
@@ -238,10 +253,8 @@ struct WlItems
 	RsslHashTable	providerRequestsByAttrib;	/* Provider-driven streams. */
 	WlFTGroup*		ftGroupTable[WL_FTGROUP_TABLE_SIZE];
 												/* FTGroup table. */
-	RsslQueue		ftGroupTimerQueue;			/* FTGroup list. Should be ordered
-												 * by each group's expireTime. */
 	RsslQueue		gapStreamQueue;				/* Streams that have detected a gap. */
-	RsslInt64		gapExpireTime;				/* Time at which streams begin any recovery from
+	WlTimer			gapTimer;					/* Expires when streams begin any recovery from
 												 * gaps. */
 	WlItemStream	*pCurrentFanoutStream;		/* Used to detect a close of the current stream while
 												 * fanning out. */
@@ -272,6 +285,9 @@ typedef struct
 	void*			viewElemList;
 	RsslUInt32		viewElemCount;
 	void			*pUserSpec;
+	RsslBool		critical;
+	RsslBool		conflateUpdates;
+	RsslUInt32		conflationInterval;
 	RsslUInt		slDataStreamFlags;
 	RsslUInt32		majorVersion;
 	RsslUInt32		minorVersion;
@@ -318,6 +334,10 @@ RsslRet wlItemStreamClose(WlBase *pBase, WlItems *pItems, WlItemStream *pItemStr
 RsslRet wlItemRequestSendMsgEvent(WlBase *pBase,
 		RsslWatchlistMsgEvent *pEvent, WlItemRequest *pItemRequest, RsslErrorInfo *pErrorInfo);
 
+/* Delivers an item request's pending conflated update, if any. */
+RsslRet wlItemRequestDeliverConflatedUpdate(WlBase *pBase, WlItemRequest *pItemRequest,
+		RsslErrorInfo *pErrorInfo);
+
 /* Creates a message event and sends it to an item request. */
 RsslRet wlItemRequestSendMsg(WlBase *pBase,
 		WlItemRequest *pItemRequest, RsslMsg *pRsslMsg, RsslErrorInfo *pErrorInfo);
@@ -9,6 +9,7 @@
 #define WL_POST_ID_TABLE_H
 
 #include "rtr/rsslReactorUtils.h"
+#include "rtr/wlTimerWheel.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -28,7 +29,7 @@ typedef struct
 {
 	RsslQueueLink	qlUser;			/* Link for either the pool or the stream's list of
 									 * open records. */
-	RsslQueueLink	qlTimeout;
+	WlTimer			timer;			/* Expires when this post is assumed to have been lost. */
 	void			*pUserSpec;		/* General pointer (intended to point to a WlItemRequest) */
 
 	RsslHashLink	hlTable;
@@ -39,7 +40,6 @@ typedef struct
 	RsslUInt32		seqNum;			/* Sequence number. */
 	RsslBool		fromAckMsg;		/* Indicates whether the record is being used to match
 									 * an AckMsg, rather than checking PostMsg duplicate. */
-	RsslInt64		expireTime;		/* Time at which this post is assumed to have been lost.  */
 	RsslUInt8		domainType;		/* Domain type of the post message. */
 } WlPostRecord;
 
@@ -48,12 +48,12 @@ typedef struct
 	RsslQueue 		pool;				/* Pool of WlPostRecord structures. */
 	RsslHashTable	records;			/* Table of active post records. */
 	RsslUInt32		postAckTimeout;		/* Timeout for acknowledgement of posts. */
-	RsslQueue		timeoutQueue;		/* Queue of outstanding posts, by their expire time. */
+	WlTimerWheel	*pTimerWheel;		/* Wheel on which post timers are armed. */
 } WlPostTable;
 
 /* Initializes a Post ID table. */
 RsslRet wlPostTableInit(WlPostTable *pTable, RsslUInt32 maxPoolSize,
-		RsslUInt32 postAckTimeout, RsslErrorInfo *pErrorInfo);
+		RsslUInt32 postAckTimeout, WlTimerWheel *pTimerWheel, RsslErrorInfo *pErrorInfo);
 
 /* Cleans up a Post ID table. */
 void wlPostTableCleanup(WlPostTable *pTable);
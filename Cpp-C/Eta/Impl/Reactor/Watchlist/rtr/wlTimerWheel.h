@@ -0,0 +1,95 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright Thomson Reuters 2015. All rights reserved.
+*/
+
+#ifndef WL_TIMER_WHEEL_H
+#define WL_TIMER_WHEEL_H
+
+#include "rtr/rsslQueue.h"
+#include "rtr/rsslTypes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Hierarchical timing wheel used for the watchlist's timers.
+ * Time is kept in milliseconds. Level 0 holds timers that expire within the next WL_TW_SLOTS
+ * milliseconds, one slot per millisecond; each higher level covers WL_TW_SLOTS times the span of
+ * the level below it, and its timers are moved down (cascaded) as the wheel turns.
+ * Arming and cancelling a timer are constant-time. */
+
+static const RsslInt64 WL_TIME_UNSET = 0x7fffffffffffffffLL;
+
+#define WL_TW_LEVELS 4
+#define WL_TW_SLOT_BITS 8
+#define WL_TW_SLOTS (1 << WL_TW_SLOT_BITS)
+#define WL_TW_SLOT_MASK (WL_TW_SLOTS - 1)
+
+/* A timer. Embedded in the structure that owns it. */
+typedef struct
+{
+	RsslQueueLink	qlTimer;		/* Link for the slot (or expired queue) the timer is in. */
+	RsslQueue		*pQueue;		/* Slot the timer is in; NULL if the timer is not armed. */
+	RsslInt64		expireTime;		/* Time at which the timer expires. */
+	RsslUInt8		timerType;		/* Identifies the owner of the timer. */
+} WlTimer;
+
+/* Initializes a timer. */
+RTR_C_INLINE void wlTimerInit(WlTimer *pTimer, RsslUInt8 timerType)
+{
+	pTimer->pQueue = NULL;
+	pTimer->expireTime = WL_TIME_UNSET;
+	pTimer->timerType = timerType;
+}
+
+/* Indicates whether a timer is armed. */
+RTR_C_INLINE RsslBool wlTimerIsArmed(WlTimer *pTimer)
+{
+	return pTimer->pQueue != NULL;
+}
+
+typedef struct
+{
+	RsslInt64	nextTime;							/* Next time (millisecond) the wheel has not yet
+													 * processed. */
+	RsslUInt32	count;								/* Number of armed timers. */
+	RsslUInt32	levelCounts[WL_TW_LEVELS];			/* Number of armed timers on each level. */
+	RsslQueue	expiredQueue;						/* Timers that have expired but not been
+													 * retrieved yet. */
+	RsslQueue	slots[WL_TW_LEVELS][WL_TW_SLOTS];	/* Timer slots. */
+} WlTimerWheel;
+
+/* Initializes a timing wheel. */
+void wlTimerWheelInit(WlTimerWheel *pWheel, RsslInt64 currentTime);
+
+/* Arms a timer to expire at currentTime + timeout. If the timer is already armed, it is
+ * re-armed. */
+void wlTimerWheelArm(WlTimerWheel *pWheel, WlTimer *pTimer, RsslInt64 currentTime,
+		RsslInt64 timeout);
+
+/* Cancels a timer. Does nothing if the timer is not armed. */
+void wlTimerWheelCancel(WlTimerWheel *pWheel, WlTimer *pTimer);
+
+/* Retrieves the next timer that has expired as of currentTime, or NULL if there are none.
+ * The returned timer is no longer armed. Timers are returned in order of expiration. */
+WlTimer *wlTimerWheelPopExpired(WlTimerWheel *pWheel, RsslInt64 currentTime);
+
+/* Returns the next time at which the wheel should be serviced, or WL_TIME_UNSET if no timers are
+ * armed. This is either the expiration of the next timer, or the time at which timers on a
+ * higher level should be cascaded (which is no later than any of their expirations). */
+RsslInt64 wlTimerWheelGetNextExpireTime(WlTimerWheel *pWheel);
+
+/* Returns the number of armed timers. */
+RTR_C_INLINE RsslUInt32 wlTimerWheelGetCount(WlTimerWheel *pWheel)
+{
+	return pWheel->count;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -62,6 +62,10 @@ typedef struct
 	RsslUInt32		elemCount;
 	void			*elemList;
 	char			*nameBuf;			/* Memory that stores names for element list views. */
+	RsslFieldId		fidBitmapMin;		/* First field ID covered by fidBitmap. */
+	RsslUInt32		fidBitmapBits;		/* Number of field IDs covered by fidBitmap. */
+	RsslUInt32		*fidBitmap;			/* Field ID list views: dense bitset of the view's field IDs,
+										 * from fidBitmapMin to the highest field ID in the view. */
 } WlView;
 
 /* Initializes a view structure. Sorts the fields and removes any duplicates or instances
@@ -71,6 +75,16 @@ WlView *wlViewCreate(void *elemList, RsslUInt32 elemCount, RsslUInt viewType,
 
 void wlViewDestroy(WlView *pView);
 
+/* Checks whether a field ID list view contains the given field ID. */
+RTR_C_INLINE RsslBool wlViewContainsFieldId(WlView *pView, RsslFieldId fieldId)
+{
+	/* Field IDs below fidBitmapMin wrap around to large offsets. */
+	RsslUInt32 offset = (RsslUInt32)((RsslInt32)fieldId - (RsslInt32)pView->fidBitmapMin);
+
+	return (offset < pView->fidBitmapBits 
+			&& (pView->fidBitmap[offset >> 5] & (1U << (offset & 31)))) ? RSSL_TRUE : RSSL_FALSE;
+}
+
 /* If the viewType is RDM_VIEW_TYPE_FIELD_ID_LIST, the aggregate viewElemList will consist of 
  * these.*/
 typedef struct
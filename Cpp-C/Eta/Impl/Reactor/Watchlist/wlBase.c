@@ -76,6 +76,7 @@ RsslRet wlBaseInit(WlBase *pBase, WlBaseInitOptions *pOpts, RsslErrorInfo *pErro
 	WlServiceCacheCreateOptions		serviceCacheOpts;
 	WlServiceCache					*pServiceCache;
 	RsslRet ret;
+	int i;
 
 	wlServiceCacheClearCreateOptions(&serviceCacheOpts);
 	serviceCacheOpts.serviceUpdateCallback = pOpts->updateCallback;
@@ -108,6 +109,20 @@ RsslRet wlBaseInit(WlBase *pBase, WlBaseInitOptions *pOpts, RsslErrorInfo *pErro
 	pBase->config.msgCallback = pOpts->msgCallback;
 	pBase->config.obeyOpenWindow = pOpts->obeyOpenWindow;
 	pBase->config.requestTimeout = pOpts->requestTimeout;
+	pBase->config.filterFanoutByView = pOpts->filterFanoutByView;
+	pBase->config.itemRequestRate = pOpts->itemRequestRate;
+	pBase->config.requestBatchSize = pOpts->requestBatchSize;
+
+	if (pBase->config.requestBatchSize > 1
+			&& !(pBase->batchStreams = (WlStreamBase**)malloc(
+					pBase->config.requestBatchSize * sizeof(WlStreamBase*))))
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+				"Memory allocation failure.");
+		wlBaseCleanup(pBase);
+		return RSSL_RET_FAILURE;
+	}
+
 	pBase->watchlist.state = 0;
 	pBase->channelState = WL_CHS_START;
 	pBase->pRsslChannel = NULL;
@@ -118,36 +133,36 @@ RsslRet wlBaseInit(WlBase *pBase, WlBaseInitOptions *pOpts, RsslErrorInfo *pErro
 	pBase->nextProviderStreamId = MIN_STREAM_ID;
 	pBase->ticksPerMsec = pOpts->ticksPerMsec;
 
-	if ((ret = rsslHashTableInit(&pBase->requestsByStreamId, 10007, rsslHashU32Sum, 
-			rsslHashU32Compare, RSSL_TRUE, pErrorInfo)) != RSSL_RET_SUCCESS)
+	if ((ret = rsslHashTableInit(&pBase->requestsByStreamId, 1024, rsslHashU32Sum, 
+			rsslHashU32Compare, pErrorInfo)) != RSSL_RET_SUCCESS)
 	{
 		wlBaseCleanup(pBase);
 		return ret;
 	}
 
-	if ((ret = rsslHashTableInit(&pBase->openStreamsByAttrib, 100003, wlStreamAttributesHashSum, 
-			wlStreamAttributesHashCompare, RSSL_TRUE, pErrorInfo)) != RSSL_RET_SUCCESS)
+	if ((ret = rsslHashTableInit(&pBase->openStreamsByAttrib, 1024, wlStreamAttributesHashSum, 
+			wlStreamAttributesHashCompare, pErrorInfo)) != RSSL_RET_SUCCESS)
 	{
 		wlBaseCleanup(pBase);
 		return ret;
 	}
 
-	if ((ret = rsslHashTableInit(&pBase->streamsById, 100003, rsslHashU32Sum, 
-			rsslHashU32Compare, RSSL_TRUE, pErrorInfo)) != RSSL_RET_SUCCESS)
+	if ((ret = rsslHashTableInit(&pBase->streamsById, 1024, rsslHashU32Sum, 
+			rsslHashU32Compare, pErrorInfo)) != RSSL_RET_SUCCESS)
 	{
 		wlBaseCleanup(pBase);
 		return ret;
 	}
 
-	if ((ret = rsslHashTableInit(&pBase->requestedSvcByName, 10007, rsslHashBufferSum, 
-			rsslHashBufferCompare, RSSL_TRUE, pErrorInfo)) != RSSL_RET_SUCCESS)
+	if ((ret = rsslHashTableInit(&pBase->requestedSvcByName, 16, rsslHashBufferSum, 
+			rsslHashBufferCompare, pErrorInfo)) != RSSL_RET_SUCCESS)
 	{
 		wlBaseCleanup(pBase);
 		return ret;
 	}
 
-	if ((ret = rsslHashTableInit(&pBase->requestedSvcById, 10007, rsslHashU64Sum, 
-			rsslHashU64Compare, RSSL_TRUE, pErrorInfo)) != RSSL_RET_SUCCESS)
+	if ((ret = rsslHashTableInit(&pBase->requestedSvcById, 16, rsslHashU64Sum, 
+			rsslHashU64Compare, pErrorInfo)) != RSSL_RET_SUCCESS)
 	{
 		wlBaseCleanup(pBase);
 		return ret;
@@ -157,7 +172,14 @@ RsslRet wlBaseInit(WlBase *pBase, WlBaseInitOptions *pOpts, RsslErrorInfo *pErro
 	rsslInitQueue(&pBase->requestedServices);
 	rsslInitQueue(&pBase->streamsPendingRequest);
 
-	rsslInitQueue(&pBase->streamsPendingResponse);
+	for (i = 0; i < WL_PC_COUNT; ++i)
+		rsslInitQueue(&pBase->pacer.queues[i]);
+	wlTimerInit(&pBase->pacer.timer, WL_TMT_PACING);
+	pBase->pacer.credit = (RsslInt64)pBase->config.itemRequestRate * 1000; /* Start with a full second. */
+	pBase->pacer.lastRefillTime = pBase->currentTime;
+	pBase->pacer.requestsSent = 0;
+
+	wlTimerWheelInit(&pBase->timerWheel, pBase->currentTime);
 	rsslInitQueue(&pBase->openStreams);
 
 	if ((ret = rsslMemoryPoolInit(&pBase->streamPool, pOpts->streamPoolBlockSize, 
@@ -175,7 +197,7 @@ RsslRet wlBaseInit(WlBase *pBase, WlBaseInitOptions *pOpts, RsslErrorInfo *pErro
 	}
 
 	if ((ret = wlPostTableInit(&pBase->postTable, pOpts->maxOutstandingPosts, 
-					pOpts->postAckTimeout, pErrorInfo))
+					pOpts->postAckTimeout, &pBase->timerWheel, pErrorInfo))
 			!= RSSL_RET_SUCCESS)
 	{
 		wlBaseCleanup(pBase);
@@ -193,6 +215,13 @@ void wlBaseCleanup(WlBase *pBase)
 	wlServiceCacheDestroy(pBase->pServiceCache);
 	rsslHeapBufferCleanup(&pBase->tempDecodeBuffer);
 	rsslHeapBufferCleanup(&pBase->tempEncodeBuffer);
+	rsslHeapBufferCleanup(&pBase->tempFanoutBuffer);
+	if (pBase->conflationEntries)
+		free(pBase->conflationEntries);
+	if (pBase->conflationFieldTable)
+		free(pBase->conflationFieldTable);
+	if (pBase->batchStreams)
+		free(pBase->batchStreams);
 	rsslHashTableCleanup(&pBase->requestsByStreamId);
 	rsslHashTableCleanup(&pBase->openStreamsByAttrib);
 	rsslHashTableCleanup(&pBase->streamsById);
@@ -203,10 +232,10 @@ void wlBaseCleanup(WlBase *pBase)
 	wlPostTableCleanup(&pBase->postTable);
 }
 
-void wlAddRequest(WlBase *pBase, WlRequestBase *pRequestBase)
+RsslRet wlAddRequest(WlBase *pBase, WlRequestBase *pRequestBase)
 {
 	rsslHashLinkInit(&pRequestBase->hlStreamId);
-	rsslHashTableInsertLink(&pBase->requestsByStreamId, &pRequestBase->hlStreamId, 
+	return rsslHashTableInsertLink(&pBase->requestsByStreamId, &pRequestBase->hlStreamId, 
 			&pRequestBase->streamId, NULL);
 }
 
@@ -233,17 +262,94 @@ void wlSetStreamMsgPending(WlBase *pBase, WlStreamBase *pStreamBase)
 				&pStreamBase->qlStreamsPendingRequest);
 		pStreamBase->requestState |= WL_STRS_PENDING_REQUEST;
 	}
+	else if (pStreamBase->requestState & WL_STRS_PACED && pStreamBase->isClosing)
+	{
+		/* Don't hold up a close behind the item request rate. */
+		rsslQueueRemoveLink(&pBase->pacer.queues[pStreamBase->pacingClass],
+				&pStreamBase->qlStreamsPendingRequest);
+		rsslQueueAddLinkToBack(&pBase->streamsPendingRequest, 
+				&pStreamBase->qlStreamsPendingRequest);
+		pStreamBase->requestState &= ~WL_STRS_PACED;
+	}
+}
+
+void wlSetStreamMsgPaced(WlBase *pBase, WlStreamBase *pStreamBase, WlPacingClass pacingClass)
+{
+	if (!pBase->config.itemRequestRate)
+	{
+		wlSetStreamMsgPending(pBase, pStreamBase);
+		return;
+	}
+
+	if (!(pStreamBase->requestState & WL_STRS_PENDING_REQUEST))
+	{
+		rsslQueueAddLinkToBack(&pBase->pacer.queues[pacingClass],
+				&pStreamBase->qlStreamsPendingRequest);
+		pStreamBase->requestState |= (WL_STRS_PENDING_REQUEST | WL_STRS_PACED);
+		pStreamBase->pacingClass = (RsslUInt8)pacingClass;
+	}
+	else if (pStreamBase->requestState & WL_STRS_PACED && pacingClass < pStreamBase->pacingClass)
+	{
+		rsslQueueRemoveLink(&pBase->pacer.queues[pStreamBase->pacingClass],
+				&pStreamBase->qlStreamsPendingRequest);
+		rsslQueueAddLinkToBack(&pBase->pacer.queues[pacingClass],
+				&pStreamBase->qlStreamsPendingRequest);
+		pStreamBase->pacingClass = (RsslUInt8)pacingClass;
+	}
+}
+
+void wlPacerRefill(WlBase *pBase, RsslInt64 currentTime)
+{
+	WlRequestPacer *pPacer = &pBase->pacer;
+	RsslInt64 maxCredit = (RsslInt64)pBase->config.itemRequestRate * 1000;
+
+	if (currentTime <= pPacer->lastRefillTime)
+		return;
+
+	/* Rate is per second and credit is in thousandths, so each millisecond adds the rate. */
+	pPacer->credit += (currentTime - pPacer->lastRefillTime) * pBase->config.itemRequestRate;
+	if (pPacer->credit > maxCredit)
+		pPacer->credit = maxCredit;
+	pPacer->lastRefillTime = currentTime;
+}
+
+RsslBool wlPacerTakeCredit(WlBase *pBase)
+{
+	if (pBase->pacer.credit < 1000)
+		return RSSL_FALSE;
+
+	pBase->pacer.credit -= 1000;
+	++pBase->pacer.requestsSent;
+	return RSSL_TRUE;
+}
+
+void wlPacerSetTimer(WlBase *pBase)
+{
+	WlRequestPacer *pPacer = &pBase->pacer;
+	RsslInt64 rate = pBase->config.itemRequestRate;
+
+	if (!wlPacerGetPendingCount(pBase))
+	{
+		wlTimerWheelCancel(&pBase->timerWheel, &pPacer->timer);
+		return;
+	}
+
+	if (wlTimerIsArmed(&pPacer->timer))
+		return;
+
+	/* Wake up when there is credit for the next request. */
+	wlTimerWheelArm(&pBase->timerWheel, &pPacer->timer, pPacer->lastRefillTime,
+			(pPacer->credit >= 1000) ? 0 : (1000 - pPacer->credit + rate - 1) / rate);
+	pBase->watchlist.state |= RSSLWL_STF_NEED_TIMER;
 }
 
 void wlSetStreamPendingResponse(WlBase *pBase, WlStreamBase *pStreamBase)
 {
 	if (!(pStreamBase->requestState & WL_STRS_PENDING_RESPONSE))
 	{
-		rsslQueueAddLinkToBack(&pBase->streamsPendingResponse,
-				&pStreamBase->qlStreamsPendingResponse);
+		wlTimerWheelArm(&pBase->timerWheel, &pStreamBase->requestTimer, pBase->currentTime,
+				pBase->config.requestTimeout);
 		pStreamBase->requestState |= WL_STRS_PENDING_RESPONSE;
-
-		pStreamBase->requestExpireTime = pBase->currentTime + pBase->config.requestTimeout;
 		pBase->watchlist.state |= RSSLWL_STF_NEED_TIMER;
 	}
 }
@@ -261,8 +367,7 @@ void wlUnsetStreamPendingResponse(WlBase *pBase, WlStreamBase *pStreamBase)
 {
 	if (pStreamBase->requestState & WL_STRS_PENDING_RESPONSE)
 	{
-		rsslQueueRemoveLink(&pBase->streamsPendingResponse,
-				&pStreamBase->qlStreamsPendingResponse);
+		wlTimerWheelCancel(&pBase->timerWheel, &pStreamBase->requestTimer);
 		pStreamBase->requestState &= ~WL_STRS_PENDING_RESPONSE;
 	}
 }
@@ -271,9 +376,10 @@ void wlUnsetStreamMsgPending(WlBase *pBase, WlStreamBase *pStreamBase)
 {
 	if (pStreamBase->requestState & WL_STRS_PENDING_REQUEST)
 	{
-		rsslQueueRemoveLink(&pBase->streamsPendingRequest, 
+		rsslQueueRemoveLink((pStreamBase->requestState & WL_STRS_PACED) ?
+				&pBase->pacer.queues[pStreamBase->pacingClass] : &pBase->streamsPendingRequest,
 				&pStreamBase->qlStreamsPendingRequest);
-		pStreamBase->requestState &= ~WL_STRS_PENDING_REQUEST;
+		pStreamBase->requestState &= ~(WL_STRS_PENDING_REQUEST | WL_STRS_PACED);
 	}
 }
 
@@ -294,6 +400,29 @@ RsslInt32 wlBaseTakeStreamId(WlBase *pBase)
 	return pBase->nextStreamId;
 }
 
+RsslInt32 wlBaseTakeStreamIdRange(WlBase *pBase, RsslUInt32 count)
+{
+	RsslInt32 firstStreamId;
+	RsslUInt32 i;
+
+	do
+	{
+		firstStreamId = pBase->nextStreamId + 1;
+		if (firstStreamId > MAX_STREAM_ID - (RsslInt32)count)
+			firstStreamId = MIN_STREAM_ID;
+
+		/* On a collision, continue searching after the ID in use. */
+		for (i = 0; i < count; ++i)
+		{
+			pBase->nextStreamId = firstStreamId + i;
+			if (rsslHashTableFind(&pBase->streamsById, &pBase->nextStreamId, NULL))
+				break;
+		}
+	} while (i < count);
+
+	return firstStreamId;
+}
+
 RsslInt32 wlBaseTakeProviderStreamId(WlBase *pBase)
 {
 	RsslInt32 streamId;
@@ -65,8 +65,15 @@ WlDirectoryStream *wlDirectoryStreamCreate(WlBase *pBase, WlDirectory *pDirector
 
 	wlStreamBaseInit(&pDirectory->pStream->base, streamId, RSSL_DMT_SOURCE);
 
-	rsslHashTableInsertLink(&pBase->streamsById, &pDirectory->pStream->base.hlStreamId, 
-			&pDirectory->pStream->base.streamId, NULL);
+	if (rsslHashTableInsertLink(&pBase->streamsById, &pDirectory->pStream->base.hlStreamId, 
+			&pDirectory->pStream->base.streamId, NULL) != RSSL_RET_SUCCESS)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+				"Memory allocation failed.");
+		free(pDirectory->pStream);
+		pDirectory->pStream = NULL;
+		return NULL;
+	}
 
 	wlSetStreamMsgPending(pBase, &pDirectory->pStream->base);
 
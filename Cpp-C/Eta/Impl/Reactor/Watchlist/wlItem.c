@@ -83,18 +83,17 @@ RsslRet wlItemsInit(WlItems *pItems, RsslErrorInfo *pErrorInfo)
 {
 	RsslRet ret;
 
-	if ((ret = rsslHashTableInit(&pItems->providerRequestsByAttrib, 100003, 
-			wlProviderRequestHashSum, wlProviderRequestHashCompare, RSSL_TRUE, pErrorInfo))
+	if ((ret = rsslHashTableInit(&pItems->providerRequestsByAttrib, 1024, 
+			wlProviderRequestHashSum, wlProviderRequestHashCompare, pErrorInfo))
 			!= RSSL_RET_SUCCESS)
 		return ret;
 
 	memset(pItems->ftGroupTable, 0, sizeof(pItems->ftGroupTable));
 
 	
-	rsslInitQueue(&pItems->ftGroupTimerQueue);
 	rsslInitQueue(&pItems->gapStreamQueue);
 
-	pItems->gapExpireTime = WL_TIME_UNSET;
+	wlTimerInit(&pItems->gapTimer, WL_TMT_GAP);
 
 	return RSSL_RET_SUCCESS;
 }
@@ -185,6 +184,16 @@ RsslRet wlItemRequestInit(WlItemRequest *pItemRequest, WlBase *pBase, WlItems *p
 			pRequestMsg->msgBase.domainType,
 			pOpts->pUserSpec);
 
+	if (pOpts->critical)
+		pItemRequest->flags |= WL_IRQF_CRITICAL;
+
+	wlTimerInit(&pItemRequest->conflationTimer, WL_TMT_CONFLATION);
+	if (pOpts->conflateUpdates)
+	{
+		pItemRequest->flags |= WL_IRQF_CONFLATE;
+		pItemRequest->conflationInterval = pOpts->conflationInterval;
+	}
+
 	switch(pOpts->viewAction)
 	{
 		case WL_IVA_SET:
@@ -247,7 +256,14 @@ RsslRet wlItemRequestInit(WlItemRequest *pItemRequest, WlBase *pBase, WlItems *p
 		return RSSL_RET_FAILURE;
 	}
 
-	wlAddRequest(pBase, &pItemRequest->base);
+	if (wlAddRequest(pBase, &pItemRequest->base) != RSSL_RET_SUCCESS)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+				"Memory allocation failed.");
+		wlRequestedServiceCheckRefCount(pBase, pRequestedService);
+		wlItemRequestCleanup(pItemRequest);
+		return RSSL_RET_FAILURE;
+	}
 
 	pItemRequest->base.pStateQueue = &pBase->newRequests;
 	rsslQueueAddLinkToBack(&pBase->newRequests, &pItemRequest->base.qlStateQueue);
@@ -553,9 +569,16 @@ RsslRet wlItemGroupAddStream(WlItems *pItems, RsslBuffer *pGroupId, WlItemStream
 		pItemGroup->pWlService = pWlService;
 		rsslInitQueue(&pItemGroup->openStreamList);
 
+		if (rsslHashTableInsertLink(&pWlService->itemGroupTable, &pItemGroup->hlItemGroupTable,
+				&pItemGroup->groupId, &hashSum) != RSSL_RET_SUCCESS)
+		{
+			rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+					"Memory allocation failed.");
+			rsslHeapBufferCleanup(&pItemGroup->groupId);
+			free(pItemGroup);
+			return RSSL_RET_FAILURE;
+		}
 		rsslQueueAddLinkToBack(&pWlService->itemGroups, &pItemGroup->qlItemGroups);
-		rsslHashTableInsertLink(&pWlService->itemGroupTable, &pItemGroup->hlItemGroupTable,
-				&pItemGroup->groupId, &hashSum);
 	}
 
 	pItemStream->pItemGroup = pItemGroup;
@@ -612,6 +635,8 @@ void wlItemGroupMerge(WlItemGroup *pItemGroup, WlService *pWlService, RsslBuffer
 		rsslHeapBufferCopy(&pItemGroup->groupId, pNewGroupId,
 				&pItemGroup->groupId);
 
+		/* Cannot fail: the group was removed from the table above, so the table is below
+		 * its resize threshold. */
 		rsslHashTableInsertLink(&pWlService->itemGroupTable, &pItemGroup->hlItemGroupTable,
 				(void*)&pItemGroup->groupId, NULL);
 		rsslQueueAddLinkToBack(&pWlService->itemGroups, &pItemGroup->qlItemGroups);
@@ -644,8 +669,9 @@ RsslRet wlFTGroupAddStream(WlBase *pBase, WlItems *pItems, RsslUInt8 ftGroupId,
 
 		pGroup->ftGroupId = ftGroupId;
 		pItems->ftGroupTable[ftGroupId] = pGroup;
-		rsslQueueAddLinkToBack(&pItems->ftGroupTimerQueue, &pGroup->qlGroups);
-		pGroup->expireTime = pBase->currentTime + pBase->pRsslChannel->pingTimeout * 1000;
+		wlTimerInit(&pGroup->timer, WL_TMT_FT_GROUP);
+		wlTimerWheelArm(&pBase->timerWheel, &pGroup->timer, pBase->currentTime,
+				pBase->pRsslChannel->pingTimeout * 1000);
 		pBase->watchlist.state |= RSSLWL_STF_NEED_TIMER;
 		rsslInitQueue(&pGroup->openStreamList);
 		
@@ -657,7 +683,7 @@ RsslRet wlFTGroupAddStream(WlBase *pBase, WlItems *pItems, RsslUInt8 ftGroupId,
 	return RSSL_RET_SUCCESS;
 }
 
-void wlFTGroupRemoveStream(WlItems *pItems, WlItemStream *pItemStream)
+void wlFTGroupRemoveStream(WlBase *pBase, WlItems *pItems, WlItemStream *pItemStream)
 {
 	WlFTGroup *pGroup;
 
@@ -666,13 +692,13 @@ void wlFTGroupRemoveStream(WlItems *pItems, WlItemStream *pItemStream)
 	rsslQueueRemoveLink(&pGroup->openStreamList, &pItemStream->qlFTGroup);
 	if (pItems->pCurrentFanoutFTGroup != pGroup
 			&& !rsslQueueGetElementCount(&pGroup->openStreamList))
-		wlFTGroupRemove(pItems, pGroup); /* Group is now empty, so remove it. */
+		wlFTGroupRemove(pBase, pItems, pGroup); /* Group is now empty, so remove it. */
 }
 
-void wlFTGroupRemove(WlItems *pItems, WlFTGroup *pGroup)
+void wlFTGroupRemove(WlBase *pBase, WlItems *pItems, WlFTGroup *pGroup)
 {
 	pItems->ftGroupTable[pGroup->ftGroupId] = NULL;
-	rsslQueueRemoveLink(&pItems->ftGroupTimerQueue, &pGroup->qlGroups);
+	wlTimerWheelCancel(&pBase->timerWheel, &pGroup->timer);
 	free(pGroup);
 }
 
@@ -884,6 +910,28 @@ RsslRet wlItemRequestReissue(WlBase *pBase, WlItems *pItems, WlItemRequest *pIte
 			   	< RSSL_RET_SUCCESS)
 		return ret;
 
+	if (pOpts->critical)
+		pItemRequest->flags |= WL_IRQF_CRITICAL;
+
+	/* Any update already pending is still delivered if conflation is turned off. */
+	if (pOpts->conflateUpdates)
+	{
+		pItemRequest->flags |= WL_IRQF_CONFLATE;
+
+		/* A pending update is delivered on the new interval, counted from now. */
+		if (pItemRequest->conflationInterval != pOpts->conflationInterval
+				&& wlTimerIsArmed(&pItemRequest->conflationTimer))
+		{
+			wlTimerWheelArm(&pBase->timerWheel, &pItemRequest->conflationTimer, 
+					getCurrentTimeMs(pBase->ticksPerMsec), pOpts->conflationInterval);
+			pBase->watchlist.state |= RSSLWL_STF_NEED_TIMER;
+		}
+
+		pItemRequest->conflationInterval = pOpts->conflationInterval;
+	}
+	else
+		pItemRequest->flags &= ~WL_IRQF_CONFLATE;
+
 	/* Process modified request message. */
 	if (pItemStream)
 	{
@@ -922,9 +970,18 @@ RsslRet wlItemRequestCreate(WlBase *pBase, WlItems *pItems, WlItemRequestCreateO
 		if (!(pOpts->slDataStreamFlags & RDM_SYMBOL_LIST_DATA_SNAPSHOTS))
 		{
 			assert(pItemRequest->requestMsgFlags & RSSL_RQMF_STREAMING);
-			rsslHashTableInsertLink(&pItems->providerRequestsByAttrib,
+			if (rsslHashTableInsertLink(&pItems->providerRequestsByAttrib,
 					&pItemRequest->hlProviderRequestsByAttrib, 
-					(void*)pItemRequest, NULL);
+					(void*)pItemRequest, NULL) != RSSL_RET_SUCCESS)
+			{
+				rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+						"Memory allocation failed.");
+				pItemRequest->flags &= ~WL_IRQF_PROV_DRIVEN;
+				wlItemRequestClose(pBase, pItems, pItemRequest);
+				wlRequestedServiceCheckRefCount(pBase, pItemRequest->pRequestedService);
+				wlItemRequestDestroy(pBase, pItemRequest);
+				return RSSL_RET_FAILURE;
+			}
 		}
 	}
 
@@ -947,6 +1004,9 @@ RsslRet wlItemRequestCleanup(WlItemRequest *pItemRequest)
 	if (pItemRequest->pView)
 		wlViewDestroy(pItemRequest->pView);
 
+	rsslHeapBufferCleanup(&pItemRequest->conflatedDataMemory);
+	rsslHeapBufferCleanup(&pItemRequest->conflatedPermMemory);
+
 	return RSSL_RET_SUCCESS;
 }
 
@@ -976,6 +1036,9 @@ void wlItemRequestClose(WlBase *pBase, WlItems *pItems, WlItemRequest *pItemRequ
 	}
 
 
+	/* A pending conflated update is still delivered ahead of any final message to the request. */
+	wlTimerWheelCancel(&pBase->timerWheel, &pItemRequest->conflationTimer);
+
 	wlRemoveRequest(pBase, &pItemRequest->base);
 
 	rsslQueueRemoveLink(&pItemRequest->pRequestedService->itemRequests, 
@@ -1427,8 +1490,14 @@ RsslRet wlItemRequestFindStream(WlBase *pBase, WlItems *pItems, WlItemRequest *p
 
 			if (!(pItemRequest->flags & WL_IRQF_PRIVATE))
 			{
-				rsslHashTableInsertLink(&pBase->openStreamsByAttrib, 
-						&pStream->hlStreamsByAttrib, (void*)&pStream->streamAttributes, &hashSum);
+				if (rsslHashTableInsertLink(&pBase->openStreamsByAttrib, 
+						&pStream->hlStreamsByAttrib, (void*)&pStream->streamAttributes, &hashSum) != RSSL_RET_SUCCESS)
+				{
+					rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+							"Memory allocation failed.");
+					wlItemStreamDestroy(pBase, pStream);
+					return RSSL_RET_FAILURE;
+				}
 			}
 			else
 			{
@@ -1460,10 +1529,18 @@ RsslRet wlItemRequestFindStream(WlBase *pBase, WlItems *pItems, WlItemRequest *p
 
 			pStream->pWlService = pWlService;
 
+			if (rsslHashTableInsertLink(&pBase->streamsById, &pStream->base.hlStreamId,
+					(void*)&pStream->base.streamId, NULL) != RSSL_RET_SUCCESS)
+			{
+				rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+						"Memory allocation failed.");
+				if (!(pStream->flags & WL_IOSF_PRIVATE))
+					rsslHashTableRemoveLink(&pBase->openStreamsByAttrib, &pStream->hlStreamsByAttrib);
+				wlItemStreamDestroy(pBase, pStream);
+				return RSSL_RET_FAILURE;
+			}
 			rsslQueueAddLinkToBack(&pWlService->openStreamList, &pStream->qlServiceStreams);
 			rsslQueueAddLinkToBack(&pBase->openStreams, &pStream->base.qlStreamsList);
-			rsslHashTableInsertLink(&pBase->streamsById, &pStream->base.hlStreamId,
-					(void*)&pStream->base.streamId, NULL);
 
 		}
 
@@ -1528,8 +1605,126 @@ static void wlItemRequestAddServiceIdToKey(WlItemRequest *pItemRequest, RsslMsgK
 	}
 }
 
+/* Re-encodes the field list payload of a refresh or update so that it contains only the fields
+ * in a field ID list view. The filtered payload is encoded into the watchlist's fanout buffer.
+ * Returns:
+ * - RSSL_RET_SUCCESS if the payload was filtered, with the number of fields kept in pFieldCount
+ * - RSSL_RET_NO_DATA if the payload should be delivered unchanged (every field is in the view,
+ *   or the payload contains set-defined data)
+ * - Errors */
+static RsslRet _wlItemRequestFilterView(WlBase *pBase, WlView *pView, RsslBuffer *pEncDataBody,
+		RsslBuffer *pFilteredBody, RsslUInt32 *pFieldCount, RsslErrorInfo *pErrorInfo)
+{
+	RsslDecodeIterator dIter;
+	RsslEncodeIterator eIter;
+	RsslFieldList fieldList;
+	RsslFieldEntry fieldEntry;
+	RsslBuffer encodeBuffer;
+	RsslUInt32 droppedCount = 0;
+	RsslRet ret;
+
+	rsslClearDecodeIterator(&dIter);
+	rsslSetDecodeIteratorRWFVersion(&dIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+	rsslSetDecodeIteratorBuffer(&dIter, pEncDataBody);
+
+	if (rsslDecodeFieldList(&dIter, &fieldList, NULL) != RSSL_RET_SUCCESS
+			|| fieldList.flags & RSSL_FLF_HAS_SET_DATA
+			|| !(fieldList.flags & RSSL_FLF_HAS_STANDARD_DATA))
+		return RSSL_RET_NO_DATA;
+
+	/* Entries are copied as they were encoded, so the filtered list is no longer than the original. */
+	if (rsslHeapBufferResize(&pBase->tempFanoutBuffer, pEncDataBody->length, RSSL_FALSE) 
+			!= RSSL_RET_SUCCESS)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+				"Memory allocation failure.");
+		return RSSL_RET_FAILURE;
+	}
+
+	encodeBuffer = pBase->tempFanoutBuffer;
+	rsslClearEncodeIterator(&eIter);
+	rsslSetEncodeIteratorRWFVersion(&eIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+	rsslSetEncodeIteratorBuffer(&eIter, &encodeBuffer);
+
+	if (rsslEncodeFieldListInit(&eIter, &fieldList, NULL, 0) != RSSL_RET_SUCCESS)
+		return RSSL_RET_NO_DATA;
+
+	*pFieldCount = 0;
+	while ((ret = rsslDecodeFieldEntry(&dIter, &fieldEntry)) != RSSL_RET_END_OF_CONTAINER)
+	{
+		/* Let the application see any decoding problem in the original payload. */
+		if (ret != RSSL_RET_SUCCESS)
+			return RSSL_RET_NO_DATA;
+
+		if (!wlViewContainsFieldId(pView, fieldEntry.fieldId))
+		{
+			++droppedCount;
+			continue;
+		}
+
+		if (rsslEncodeFieldEntry(&eIter, &fieldEntry, NULL) != RSSL_RET_SUCCESS)
+			return RSSL_RET_NO_DATA;
+		++*pFieldCount;
+	}
+
+	if (!droppedCount || rsslEncodeFieldListComplete(&eIter, RSSL_TRUE) != RSSL_RET_SUCCESS)
+		return RSSL_RET_NO_DATA;
+
+	pFilteredBody->data = encodeBuffer.data;
+	pFilteredBody->length = rsslGetEncodedBufferLength(&eIter);
+	return RSSL_RET_SUCCESS;
+}
+
+static RsslRet _wlItemRequestDeliverMsgEvent(WlBase *pBase,
+		RsslWatchlistMsgEvent *pEvent, WlItemRequest *pItemRequest, RsslErrorInfo *pErrorInfo);
+
+static RsslRet _wlItemRequestConflateMsgEvent(WlBase *pBase,
+		RsslWatchlistMsgEvent *pEvent, WlItemRequest *pItemRequest, RsslErrorInfo *pErrorInfo);
+
 RsslRet wlItemRequestSendMsgEvent(WlBase *pBase,
 		RsslWatchlistMsgEvent *pEvent, WlItemRequest *pItemRequest, RsslErrorInfo *pErrorInfo)
+{
+	RsslMsg *pRsslMsg = pEvent->pRsslMsg;
+	RsslBuffer encDataBody, encMsgBuffer;
+	RsslUInt32 fieldCount;
+	RsslRet ret;
+
+	if (!pBase->config.filterFanoutByView || !pItemRequest->pView || !pItemRequest->pView->fidBitmap
+			|| pRsslMsg->msgBase.containerType != RSSL_DT_FIELD_LIST
+			|| (pRsslMsg->msgBase.msgClass != RSSL_MC_REFRESH && pRsslMsg->msgBase.msgClass != RSSL_MC_UPDATE))
+		return _wlItemRequestConflateMsgEvent(pBase, pEvent, pItemRequest, pErrorInfo);
+
+	encDataBody = pRsslMsg->msgBase.encDataBody;
+	encMsgBuffer = pRsslMsg->msgBase.encMsgBuffer;
+
+	switch (ret = _wlItemRequestFilterView(pBase, pItemRequest->pView, &encDataBody, 
+				&pRsslMsg->msgBase.encDataBody, &fieldCount, pErrorInfo))
+	{
+		case RSSL_RET_SUCCESS:
+			/* An update that carries none of the request's fields is not delivered. */
+			if (fieldCount == 0 && pRsslMsg->msgBase.msgClass == RSSL_MC_UPDATE)
+				ret = RSSL_RET_SUCCESS;
+			else
+			{
+				/* The encoded message still holds every field, so it no longer matches
+				 * what is delivered. Deliver it without one, as with conflated updates. */
+				rsslClearBuffer(&pRsslMsg->msgBase.encMsgBuffer);
+				ret = _wlItemRequestConflateMsgEvent(pBase, pEvent, pItemRequest, pErrorInfo);
+			}
+			pRsslMsg->msgBase.encDataBody = encDataBody;
+			pRsslMsg->msgBase.encMsgBuffer = encMsgBuffer;
+			return ret;
+
+		case RSSL_RET_NO_DATA:
+			return _wlItemRequestConflateMsgEvent(pBase, pEvent, pItemRequest, pErrorInfo);
+
+		default:
+			return ret;
+	}
+}
+
+static RsslRet _wlItemRequestDeliverMsgEvent(WlBase *pBase,
+		RsslWatchlistMsgEvent *pEvent, WlItemRequest *pItemRequest, RsslErrorInfo *pErrorInfo)
 {
 	RsslRet ret;
 	RsslMsg rsslMsg, *pRsslMsg;
@@ -1645,6 +1840,309 @@ RsslRet wlItemRequestSendMsgEvent(WlBase *pBase,
 
 }
 
+/* Clears the conflation field table of the positions set for the given entries. */
+static void _wlConflationClearFieldTable(WlBase *pBase, RsslUInt32 entryCount)
+{
+	RsslUInt32 i;
+
+	for (i = 0; i < entryCount; ++i)
+		pBase->conflationFieldTable[(RsslUInt16)pBase->conflationEntries[i].fieldId] = 0;
+}
+
+/* Merges the field list payload of an update into the request's pending conflated update.
+ * Each field in the update replaces the same field in the pending update, and fields that are not
+ * yet in the pending update are added to its end. Entries are copied as they were encoded, so no
+ * dictionary is needed.
+ * Returns:
+ * - RSSL_RET_SUCCESS if the update was merged
+ * - RSSL_RET_NO_DATA if the update cannot be merged and should be delivered by itself
+ * - Errors */
+static RsslRet _wlItemRequestConflateUpdate(WlBase *pBase, WlItemRequest *pItemRequest,
+		RsslUpdateMsg *pUpdateMsg, RsslErrorInfo *pErrorInfo)
+{
+	RsslDecodeIterator dIter;
+	RsslEncodeIterator eIter;
+	RsslFieldList fieldList, pendingFieldList;
+	RsslFieldEntry fieldEntry;
+	RsslBuffer encodeBuffer, pendingData;
+	RsslUInt32 entryCount = 0, encodedLength, i;
+	RsslUInt16 *fieldTable;
+	RsslRet ret;
+
+	if (pUpdateMsg->msgBase.containerType != RSSL_DT_FIELD_LIST
+			|| pUpdateMsg->flags & (RSSL_UPMF_DO_NOT_CONFLATE | RSSL_UPMF_DO_NOT_RIPPLE
+				| RSSL_UPMF_HAS_EXTENDED_HEADER | RSSL_UPMF_HAS_MSG_KEY | RSSL_UPMF_HAS_POST_USER_INFO))
+		return RSSL_RET_NO_DATA;
+
+	rsslClearDecodeIterator(&dIter);
+	rsslSetDecodeIteratorRWFVersion(&dIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+	rsslSetDecodeIteratorBuffer(&dIter, &pUpdateMsg->msgBase.encDataBody);
+
+	if (rsslDecodeFieldList(&dIter, &fieldList, NULL) != RSSL_RET_SUCCESS
+			|| fieldList.flags & RSSL_FLF_HAS_SET_DATA
+			|| !(fieldList.flags & RSSL_FLF_HAS_STANDARD_DATA))
+		return RSSL_RET_NO_DATA;
+
+	if (!pBase->conflationFieldTable 
+			&& !(pBase->conflationFieldTable = (RsslUInt16*)calloc(65536, sizeof(RsslUInt16))))
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+				"Memory allocation failure.");
+		return RSSL_RET_FAILURE;
+	}
+	fieldTable = pBase->conflationFieldTable;
+
+	/* Decode the update's entries, noting the position of each field (the last one, if a field
+	 * appears more than once). */
+	while ((ret = rsslDecodeFieldEntry(&dIter, &fieldEntry)) != RSSL_RET_END_OF_CONTAINER)
+	{
+		if (ret != RSSL_RET_SUCCESS)
+		{
+			_wlConflationClearFieldTable(pBase, entryCount);
+			return RSSL_RET_NO_DATA;
+		}
+
+		if (entryCount == pBase->conflationEntryCount)
+		{
+			RsslUInt32 newCount = entryCount ? entryCount * 2 : 64;
+			RsslFieldEntry *newEntries = (RsslFieldEntry*)realloc(pBase->conflationEntries,
+					newCount * sizeof(RsslFieldEntry));
+
+			if (!newEntries)
+			{
+				_wlConflationClearFieldTable(pBase, entryCount);
+				rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+						"Memory allocation failure.");
+				return RSSL_RET_FAILURE;
+			}
+
+			pBase->conflationEntries = newEntries;
+			pBase->conflationEntryCount = newCount;
+		}
+
+		pBase->conflationEntries[entryCount++] = fieldEntry;
+		fieldTable[(RsslUInt16)fieldEntry.fieldId] = (RsslUInt16)entryCount;
+	}
+
+	/* The merged list holds at most the entries of both lists. */
+	encodedLength = pItemRequest->conflatedDataLength + pUpdateMsg->msgBase.encDataBody.length;
+	if (rsslHeapBufferResize(&pBase->tempEncodeBuffer, encodedLength, RSSL_FALSE) 
+			!= RSSL_RET_SUCCESS)
+	{
+		_wlConflationClearFieldTable(pBase, entryCount);
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+				"Memory allocation failure.");
+		return RSSL_RET_FAILURE;
+	}
+
+	encodeBuffer = pBase->tempEncodeBuffer;
+	rsslClearEncodeIterator(&eIter);
+	rsslSetEncodeIteratorRWFVersion(&eIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+	rsslSetEncodeIteratorBuffer(&eIter, &encodeBuffer);
+
+	if (rsslEncodeFieldListInit(&eIter, &fieldList, NULL, 0) != RSSL_RET_SUCCESS)
+	{
+		_wlConflationClearFieldTable(pBase, entryCount);
+		return RSSL_RET_NO_DATA;
+	}
+
+	/* Copy the pending entries, replacing those the update changes. */
+	if (pItemRequest->conflationCount)
+	{
+		pendingData.data = pItemRequest->conflatedDataMemory.data;
+		pendingData.length = pItemRequest->conflatedDataLength;
+
+		rsslClearDecodeIterator(&dIter);
+		rsslSetDecodeIteratorRWFVersion(&dIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+		rsslSetDecodeIteratorBuffer(&dIter, &pendingData);
+
+		if (rsslDecodeFieldList(&dIter, &pendingFieldList, NULL) != RSSL_RET_SUCCESS)
+		{
+			_wlConflationClearFieldTable(pBase, entryCount);
+			return RSSL_RET_NO_DATA;
+		}
+
+		while ((ret = rsslDecodeFieldEntry(&dIter, &fieldEntry)) != RSSL_RET_END_OF_CONTAINER)
+		{
+			RsslUInt16 position;
+
+			if (ret != RSSL_RET_SUCCESS)
+			{
+				_wlConflationClearFieldTable(pBase, entryCount);
+				return RSSL_RET_NO_DATA;
+			}
+
+			if ((position = fieldTable[(RsslUInt16)fieldEntry.fieldId]))
+			{
+				ret = rsslEncodeFieldEntry(&eIter, &pBase->conflationEntries[position - 1], NULL);
+				fieldTable[(RsslUInt16)fieldEntry.fieldId] = 0;
+			}
+			else
+				ret = rsslEncodeFieldEntry(&eIter, &fieldEntry, NULL);
+
+			if (ret != RSSL_RET_SUCCESS)
+			{
+				_wlConflationClearFieldTable(pBase, entryCount);
+				return RSSL_RET_NO_DATA;
+			}
+		}
+	}
+
+	/* Add the fields that are new to the pending update. */
+	for (i = 0; i < entryCount; ++i)
+	{
+		RsslFieldEntry *pEntry = &pBase->conflationEntries[i];
+
+		if (fieldTable[(RsslUInt16)pEntry->fieldId] != i + 1)
+			continue;
+
+		fieldTable[(RsslUInt16)pEntry->fieldId] = 0;
+		if (rsslEncodeFieldEntry(&eIter, pEntry, NULL) != RSSL_RET_SUCCESS)
+		{
+			_wlConflationClearFieldTable(pBase, entryCount);
+			return RSSL_RET_NO_DATA;
+		}
+	}
+
+	if (rsslEncodeFieldListComplete(&eIter, RSSL_TRUE) != RSSL_RET_SUCCESS)
+		return RSSL_RET_NO_DATA;
+
+	encodedLength = rsslGetEncodedBufferLength(&eIter);
+	if (rsslHeapBufferResize(&pItemRequest->conflatedDataMemory, encodedLength, RSSL_FALSE) 
+			!= RSSL_RET_SUCCESS)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+				"Memory allocation failure.");
+		return RSSL_RET_FAILURE;
+	}
+	memcpy(pItemRequest->conflatedDataMemory.data, encodeBuffer.data, encodedLength);
+	pItemRequest->conflatedDataLength = encodedLength;
+
+	/* The merged update carries the header of the latest update. */
+	if (pUpdateMsg->flags & RSSL_UPMF_HAS_PERM_DATA)
+	{
+		if (rsslHeapBufferResize(&pItemRequest->conflatedPermMemory, 
+					pUpdateMsg->permData.length, RSSL_FALSE) != RSSL_RET_SUCCESS)
+		{
+			rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+					"Memory allocation failure.");
+			return RSSL_RET_FAILURE;
+		}
+		memcpy(pItemRequest->conflatedPermMemory.data, pUpdateMsg->permData.data,
+				pUpdateMsg->permData.length);
+		pItemRequest->conflatedPermLength = pUpdateMsg->permData.length;
+		pItemRequest->conflatedUpdateFlags |= RSSL_UPMF_HAS_PERM_DATA;
+	}
+
+	if (pUpdateMsg->flags & RSSL_UPMF_HAS_SEQ_NUM)
+	{
+		pItemRequest->conflatedSeqNum = pUpdateMsg->seqNum;
+		pItemRequest->conflatedUpdateFlags |= RSSL_UPMF_HAS_SEQ_NUM;
+	}
+
+	pItemRequest->conflatedUpdateType = pUpdateMsg->updateType;
+
+	if (pUpdateMsg->flags & RSSL_UPMF_HAS_CONF_INFO && pUpdateMsg->conflationCount)
+		pItemRequest->conflationCount += pUpdateMsg->conflationCount;
+	else
+		++pItemRequest->conflationCount;
+
+	if (!wlTimerIsArmed(&pItemRequest->conflationTimer))
+	{
+		wlTimerWheelArm(&pBase->timerWheel, &pItemRequest->conflationTimer, 
+				getCurrentTimeMs(pBase->ticksPerMsec), pItemRequest->conflationInterval);
+		pBase->watchlist.state |= RSSLWL_STF_NEED_TIMER;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+RsslRet wlItemRequestDeliverConflatedUpdate(WlBase *pBase, WlItemRequest *pItemRequest,
+		RsslErrorInfo *pErrorInfo)
+{
+	RsslWatchlistMsgEvent msgEvent;
+	RsslUpdateMsg updateMsg;
+
+	wlTimerWheelCancel(&pBase->timerWheel, &pItemRequest->conflationTimer);
+
+	if (!pItemRequest->conflationCount)
+		return RSSL_RET_SUCCESS;
+
+	rsslClearUpdateMsg(&updateMsg);
+	updateMsg.msgBase.domainType = pItemRequest->base.domainType;
+	updateMsg.msgBase.containerType = RSSL_DT_FIELD_LIST;
+	updateMsg.msgBase.encDataBody.data = pItemRequest->conflatedDataMemory.data;
+	updateMsg.msgBase.encDataBody.length = pItemRequest->conflatedDataLength;
+	updateMsg.updateType = pItemRequest->conflatedUpdateType;
+	updateMsg.flags = pItemRequest->conflatedUpdateFlags;
+
+	if (updateMsg.flags & RSSL_UPMF_HAS_SEQ_NUM)
+		updateMsg.seqNum = pItemRequest->conflatedSeqNum;
+
+	if (updateMsg.flags & RSSL_UPMF_HAS_PERM_DATA)
+	{
+		updateMsg.permData.data = pItemRequest->conflatedPermMemory.data;
+		updateMsg.permData.length = pItemRequest->conflatedPermLength;
+	}
+
+	if (pItemRequest->conflationCount > 1)
+	{
+		updateMsg.flags |= RSSL_UPMF_HAS_CONF_INFO;
+		updateMsg.conflationCount = pItemRequest->conflationCount < 0xffff ?
+			(RsslUInt16)pItemRequest->conflationCount : 0xffff;
+		updateMsg.conflationTime = pItemRequest->conflationInterval < 0xffff ?
+			(RsslUInt16)pItemRequest->conflationInterval : 0xffff;
+	}
+
+	pItemRequest->conflationCount = 0;
+	pItemRequest->conflatedUpdateFlags = 0;
+
+	wlMsgEventClear(&msgEvent);
+	msgEvent.pRsslMsg = (RsslMsg*)&updateMsg;
+	return _wlItemRequestDeliverMsgEvent(pBase, &msgEvent, pItemRequest, pErrorInfo);
+}
+
+/* Indicates whether a request is still open (i.e. it was not closed during a callback). */
+static RsslBool _wlItemRequestIsOpen(WlBase *pBase, WlItemRequest *pItemRequest, RsslInt32 streamId)
+{
+	return rsslHashTableFind(&pBase->requestsByStreamId, &streamId, NULL) 
+		== &pItemRequest->base.hlStreamId;
+}
+
+/* Delivers a message to an item request, or merges it into the request's pending update if the
+ * request conflates updates. */
+static RsslRet _wlItemRequestConflateMsgEvent(WlBase *pBase,
+		RsslWatchlistMsgEvent *pEvent, WlItemRequest *pItemRequest, RsslErrorInfo *pErrorInfo)
+{
+	RsslInt32 streamId = pItemRequest->base.streamId;
+	RsslBool isOpen;
+	RsslRet ret;
+
+	if (pItemRequest->flags & WL_IRQF_CONFLATE 
+			&& pEvent->pRsslMsg->msgBase.msgClass == RSSL_MC_UPDATE)
+	{
+		if ((ret = _wlItemRequestConflateUpdate(pBase, pItemRequest, &pEvent->pRsslMsg->updateMsg,
+						pErrorInfo)) != RSSL_RET_NO_DATA)
+			return ret;
+	}
+
+	if (pItemRequest->conflationCount)
+	{
+		/* Deliver the pending update first, so that messages stay in order. A request may
+		 * already have been closed by the watchlist when its final message is sent. */
+		isOpen = _wlItemRequestIsOpen(pBase, pItemRequest, streamId);
+
+		if ((ret = wlItemRequestDeliverConflatedUpdate(pBase, pItemRequest, pErrorInfo))
+				!= RSSL_RET_SUCCESS)
+			return ret;
+
+		if (isOpen && !_wlItemRequestIsOpen(pBase, pItemRequest, streamId))
+			return RSSL_RET_SUCCESS;
+	}
+
+	return _wlItemRequestDeliverMsgEvent(pBase, pEvent, pItemRequest, pErrorInfo);
+}
+
 RsslRet wlItemRequestSendMsg(WlBase *pBase,
 		WlItemRequest *pItemRequest, RsslMsg *pRsslMsg, RsslErrorInfo *pErrorInfo)
 {
@@ -1702,13 +2200,17 @@ RsslRet wlItemStreamClose(WlBase *pBase, WlItems *pItems, WlItemStream *pItemStr
 		wlItemGroupRemoveStream(pItems, pItemStream->pItemGroup, pItemStream);
 
 	if (pItemStream->pFTGroup)
-		wlFTGroupRemoveStream(pItems, pItemStream);
+		wlFTGroupRemoveStream(pBase, pItems, pItemStream);
 
 	if (!(pItemStream->flags & WL_IOSF_PRIVATE))
 		rsslHashTableRemoveLink(&pBase->openStreamsByAttrib, &pItemStream->hlStreamsByAttrib);
 
 	if (pItemStream->flags & (WL_IOSF_HAS_BC_SEQ_GAP | WL_IOSF_HAS_PART_GAP | WL_IOSF_BC_BEHIND_UC))
+	{
 		rsslQueueRemoveLink(&pItems->gapStreamQueue, &pItemStream->qlGap);
+		if (!rsslQueueGetElementCount(&pItems->gapStreamQueue))
+			wlTimerWheelCancel(&pBase->timerWheel, &pItems->gapTimer);
+	}
 
 	rsslQueueRemoveLink(&pBase->openStreams, &pItemStream->base.qlStreamsList);
 	rsslHashTableRemoveLink(&pBase->streamsById, &pItemStream->base.hlStreamId);
@@ -1743,6 +2245,34 @@ RsslRet wlItemStreamClose(WlBase *pBase, WlItems *pItems, WlItemStream *pItemStr
 	return RSSL_RET_SUCCESS;
 }
 
+/* Returns the class in which the stream's request waits for the item request rate. */
+static WlPacingClass wlItemStreamGetPacingClass(WlItemStream *pItemStream)
+{
+	RsslQueue *queues[3];
+	RsslQueueLink *pLink;
+	int i;
+
+	if (pItemStream->base.domainType == RSSL_DMT_DICTIONARY)
+		return WL_PC_CRITICAL;
+
+	queues[0] = &pItemStream->requestsRecovering;
+	queues[1] = &pItemStream->requestsPendingRefresh;
+	queues[2] = &pItemStream->requestsOpen;
+
+	for (i = 0; i < 3; ++i)
+	{
+		RSSL_QUEUE_FOR_EACH_LINK(queues[i], pLink)
+		{
+			WlItemRequest *pItemRequest = RSSL_QUEUE_LINK_TO_OBJECT(WlItemRequest,
+					base.qlStateQueue, pLink);
+			if (pItemRequest->flags & WL_IRQF_CRITICAL)
+				return WL_PC_CRITICAL;
+		}
+	}
+
+	return WL_PC_NORMAL;
+}
+
 void wlItemStreamSetMsgPending(WlBase *pBase, WlItemStream *pItemStream, RsslBool requestRefresh)
 {
 	if (requestRefresh)
@@ -1764,12 +2294,19 @@ void wlItemStreamSetMsgPending(WlBase *pBase, WlItemStream *pItemStream, RsslBoo
 			}
 			else
 			{
-				wlSetStreamMsgPending(pBase, &pItemStream->base);
+				wlSetStreamMsgPaced(pBase, &pItemStream->base,
+						wlItemStreamGetPacingClass(pItemStream));
 				pItemStream->refreshState = WL_ISRS_REQUEST_REFRESH;
 				rsslQueueAddLinkToBack(&pWlService->streamsPendingRefresh,
 						&pItemStream->qlOpenWindow);
 			}
 		}
+		else if (pItemStream->refreshState == WL_ISRS_REQUEST_REFRESH)
+		{
+			/* Request has not been sent yet; a critical request may move it up. */
+			wlSetStreamMsgPaced(pBase, &pItemStream->base,
+					wlItemStreamGetPacingClass(pItemStream));
+		}
 		else if (pItemStream->refreshState != WL_ISRS_PENDING_OPEN_WINDOW)
 			wlSetStreamMsgPending(pBase, &pItemStream->base);
 	}
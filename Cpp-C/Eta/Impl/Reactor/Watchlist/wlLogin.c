@@ -98,9 +98,16 @@ WlLoginStream *wlLoginStreamCreate(WlBase *pBase, WlLogin *pLogin, RsslErrorInfo
 	wlStreamBaseInit(&pLoginStream->base, pLoginStream->base.streamId, RSSL_DMT_LOGIN);
 	pLoginStream->flags = WL_LSF_NONE;
 
+	if (rsslHashTableInsertLink(&pBase->streamsById, &pLoginStream->base.hlStreamId, 
+			&pLoginStream->base.streamId, NULL) != RSSL_RET_SUCCESS)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+				"Memory allocation failed.");
+		free(pLoginStream);
+		return NULL;
+	}
+
 	pLogin->pStream = pLoginStream;
-	rsslHashTableInsertLink(&pBase->streamsById, &pLogin->pStream->base.hlStreamId, 
-			&pLogin->pStream->base.streamId, NULL);
 
 	wlSetStreamMsgPending(pBase, &pLogin->pStream->base);
 
@@ -259,6 +266,11 @@ RsslRet wlLoginProcessProviderMsg(WlLogin *pLogin, WlBase *pBase,
 					else
 						pLoginRefresh->singleOpen = 1;
 
+					/* The watchlist can combine requests into batches only if the provider
+					 * supports them. */
+					pBase->config.supportBatchRequests
+						= pLoginRefresh->supportBatchRequests & RDM_LOGIN_BATCH_SUPPORT_REQUESTS;
+
 					pLoginRefresh->flags |= RDM_LG_RFF_HAS_SUPPORT_BATCH;
 					pLoginRefresh->supportBatchRequests = 1;
 
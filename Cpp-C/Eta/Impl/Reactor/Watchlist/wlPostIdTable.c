@@ -61,7 +61,7 @@ RsslBool wlPostRecordCompare(void *pKey1, void *pKey2)
 }
 
 RsslRet wlPostTableInit(WlPostTable *pTable, RsslUInt32 maxPoolSize,
-		RsslUInt32 postAckTimeout, RsslErrorInfo *pErrorInfo)
+		RsslUInt32 postAckTimeout, WlTimerWheel *pTimerWheel, RsslErrorInfo *pErrorInfo)
 {
 	RsslUInt32 ui;
 	RsslRet ret;
@@ -69,12 +69,12 @@ RsslRet wlPostTableInit(WlPostTable *pTable, RsslUInt32 maxPoolSize,
 	memset(pTable, 0, sizeof(WlPostTable));
 
 	if ((ret = rsslHashTableInit(&pTable->records, maxPoolSize, wlPostRecordSum, wlPostRecordCompare, 
-			RSSL_FALSE, pErrorInfo)) != RSSL_RET_SUCCESS)
+			pErrorInfo)) != RSSL_RET_SUCCESS)
 		return ret;
 
 	pTable->postAckTimeout = postAckTimeout;
 	rsslInitQueue(&pTable->pool);
-	rsslInitQueue(&pTable->timeoutQueue);
+	pTable->pTimerWheel = pTimerWheel;
 
 	for (ui = 0; ui < maxPoolSize; ++ui)
 	{
@@ -222,12 +222,19 @@ WlPostRecord *wlPostTableAddRecord(struct WlBase *pBase, WlPostTable *pTable,
 		}
 	}
 
-	rsslHashTableInsertLink(&pTable->records, &pRecord->hlTable, (void*)pRecord, &hashSum);
+	if (rsslHashTableInsertLink(&pTable->records, &pRecord->hlTable, (void*)pRecord, &hashSum) != RSSL_RET_SUCCESS)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+				"Memory allocation failed.");
+		rsslQueueAddLinkToBack(&pTable->pool, pLink);
+		return NULL;
+	}
 
 	/* Add timer. */
 	/* Time is currently only set when dispatching, so we must get an up-to-date time. */
-	pRecord->expireTime = getCurrentTimeMs(pBase->ticksPerMsec) + pTable->postAckTimeout;
-	rsslQueueAddLinkToBack(&pTable->timeoutQueue, &pRecord->qlTimeout);
+	wlTimerInit(&pRecord->timer, WL_TMT_POST);
+	wlTimerWheelArm(pTable->pTimerWheel, &pRecord->timer, getCurrentTimeMs(pBase->ticksPerMsec),
+			pTable->postAckTimeout);
 	pBase->watchlist.state |= RSSLWL_STF_NEED_TIMER;
 
 	return pRecord;
@@ -237,5 +244,5 @@ void wlPostTableRemoveRecord(WlPostTable *pTable, WlPostRecord *pRecord)
 {
 	rsslHashTableRemoveLink(&pTable->records, &pRecord->hlTable);
 	rsslQueueAddLinkToBack(&pTable->pool, &pRecord->qlUser);
-	rsslQueueRemoveLink(&pTable->timeoutQueue, &pRecord->qlTimeout);
+	wlTimerWheelCancel(pTable->pTimerWheel, &pRecord->timer);
 }
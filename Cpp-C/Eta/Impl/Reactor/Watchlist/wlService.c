@@ -22,7 +22,7 @@ WlService *wlServiceCreate(RDMCachedService *pService, RsslErrorInfo *pErrorInfo
 	rsslInitQueue(&pWlService->itemGroups);
 	
 	if (rsslHashTableInit(&pWlService->itemGroupTable, 10, rsslHashBufferSum, rsslHashBufferCompare,
-				RSSL_TRUE, pErrorInfo) != RSSL_RET_SUCCESS)
+				pErrorInfo) != RSSL_RET_SUCCESS)
 	{
 		wlServiceDestroy(pWlService);
 		return NULL;
@@ -107,9 +107,16 @@ WlRequestedService* wlRequestedServiceOpen(WlBase *pBase, RsslBuffer *pServiceNa
 
 		memcpy(pRequestedService->serviceName.data, pServiceName->data, pServiceName->length);
 
-		rsslHashTableInsertLink(&pBase->requestedSvcByName, 
+		if (rsslHashTableInsertLink(&pBase->requestedSvcByName, 
 				&pRequestedService->hlServiceRequests, 
-				(void*)&pRequestedService->serviceName, &hashSum);
+				(void*)&pRequestedService->serviceName, &hashSum) != RSSL_RET_SUCCESS)
+		{
+			rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+					"Memory allocation failed.");
+			free(pRequestedService->serviceName.data);
+			free(pRequestedService);
+			return NULL;
+		}
 
 	}
 	else /* Service ID. */
@@ -117,9 +124,15 @@ WlRequestedService* wlRequestedServiceOpen(WlBase *pBase, RsslBuffer *pServiceNa
 		pRequestedService->flags |= WL_RSVC_HAS_ID;
 		pRequestedService->serviceId = *pServiceId;
 
-		rsslHashTableInsertLink(&pBase->requestedSvcById, 
+		if (rsslHashTableInsertLink(&pBase->requestedSvcById, 
 				&pRequestedService->hlServiceRequests, 
-				(void*)&pRequestedService->serviceId, &hashSum);
+				(void*)&pRequestedService->serviceId, &hashSum) != RSSL_RET_SUCCESS)
+		{
+			rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+					"Memory allocation failed.");
+			free(pRequestedService);
+			return NULL;
+		}
 	}
 
 	rsslQueueAddLinkToBack(&pBase->requestedServices,
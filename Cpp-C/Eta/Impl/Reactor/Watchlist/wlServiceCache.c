@@ -44,14 +44,14 @@ WlServiceCache* wlServiceCacheCreate(WlServiceCacheCreateOptions *pOptions,
 
 	pServiceCache->pUserSpec = pOptions->pUserSpec;
 	if (rsslHashTableInit(&pServiceCache->_servicesByName, 100, rsslHashBufferSum, 
-					rsslHashBufferCompare, RSSL_TRUE, pErrorInfo) != RSSL_RET_SUCCESS)
+					rsslHashBufferCompare, pErrorInfo) != RSSL_RET_SUCCESS)
 	{
 		wlServiceCacheDestroy(pServiceCache);
 		return NULL;
 	}
 
 	if (rsslHashTableInit(&pServiceCache->_servicesById, 100, rsslHashU64Sum, rsslHashU64Compare, 
-				RSSL_TRUE, pErrorInfo) != RSSL_RET_SUCCESS)
+				pErrorInfo) != RSSL_RET_SUCCESS)
 	{
 		wlServiceCacheDestroy(pServiceCache);
 		return NULL;
@@ -214,8 +214,14 @@ RsslRet wlServiceCacheProcessDirectoryMsg(WlServiceCache *pServiceCache,
 				return RSSL_RET_FAILURE;
 
 			pCachedService->rdm.serviceId = pServiceEntry->serviceId;
-			rsslHashTableInsertLink(&pServiceCache->_servicesById,
-					&pCachedService->_idLink, &pCachedService->rdm.serviceId, NULL);
+			if (rsslHashTableInsertLink(&pServiceCache->_servicesById,
+					&pCachedService->_idLink, &pCachedService->rdm.serviceId, NULL) != RSSL_RET_SUCCESS)
+			{
+				rscDestroyService(pCachedService);
+				rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+						"Memory allocation failed.");
+				return RSSL_RET_FAILURE;
+			}
 			rsslQueueAddLinkToBack(&pServiceCache->_serviceList, &pCachedService->_fullListLink);
 
 		}
@@ -256,14 +262,14 @@ RDMCachedService *rscCreateService(RsslErrorInfo *pErrorInfo)
 	rsslHeapBufferInit(&pCachedService->tempLinkArrayBuffer, sizeof(RsslRDMServiceLink));
 
 	if (rsslHashTableInit(&pCachedService->_itemGroupsById, 101, rsslHashBufferSum, 
-				rsslHashBufferCompare, RSSL_TRUE, pErrorInfo) != RSSL_RET_SUCCESS)
+				rsslHashBufferCompare, pErrorInfo) != RSSL_RET_SUCCESS)
 	{
 		rscDestroyService(pCachedService);
 		return NULL;
 	}
 
 	if (rsslHashTableInit(&pCachedService->linkTable, 11, rsslHashBufferSum, rsslHashBufferCompare, 
-			RSSL_TRUE, pErrorInfo) != RSSL_RET_SUCCESS)
+			pErrorInfo) != RSSL_RET_SUCCESS)
 	{
 		rscDestroyService(pCachedService);
 		return NULL;
@@ -300,9 +306,16 @@ RsslRet rscUpdateLink(RDMCachedService *pCachedService, RsslRDMServiceLink *pUpd
 			return RSSL_RET_FAILURE;
 		}
 
+		if (rsslHashTableInsertLink(&pCachedService->linkTable, &pCachedLink->hlLinkTable,
+				(void*)&pCachedLink->link.name, &hashSum) != RSSL_RET_SUCCESS)
+		{
+			rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+					"Memory allocation failed.");
+			rsslHeapBufferCleanup(&pCachedLink->link.name);
+			free(pCachedLink);
+			return RSSL_RET_FAILURE;
+		}
 		rsslQueueAddLinkToBack(&pCachedService->linkList, &pCachedLink->qlLinkList);
-		rsslHashTableInsertLink(&pCachedService->linkTable, &pCachedLink->hlLinkTable,
-				(void*)&pCachedLink->link.name, &hashSum);
 	}
 	else
 		pCachedLink = RSSL_HASH_LINK_TO_OBJECT(RDMCachedLink, hlLinkTable, pHashLink);
@@ -534,8 +547,14 @@ RsslRet rscUpdateService(WlServiceCache *pServiceCache, RDMCachedService *pCache
 							rsslHeapBufferCopy(&pCachedInfo->serviceName, &pUpdatedInfo->serviceName,
 									&pCachedInfo->serviceName);
 
-							rsslHashTableInsertLink(&pServiceCache->_servicesByName,
-									&pCachedService->_nameLink, &pCachedInfo->serviceName, &hashSum);
+							if (rsslHashTableInsertLink(&pServiceCache->_servicesByName,
+									&pCachedService->_nameLink, &pCachedInfo->serviceName, &hashSum) != RSSL_RET_SUCCESS)
+							{
+								pCachedService->hasServiceName = RSSL_FALSE;
+								rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+										"Memory allocation failed.");
+								return RSSL_RET_FAILURE;
+							}
 						}
 					}
 					else
@@ -559,10 +578,15 @@ RsslRet rscUpdateService(WlServiceCache *pServiceCache, RDMCachedService *pCache
 							return RSSL_RET_FAILURE;
 						}
 
-						pCachedService->hasServiceName = RSSL_TRUE;
+						if (rsslHashTableInsertLink(&pServiceCache->_servicesByName,
+								&pCachedService->_nameLink, &pCachedInfo->serviceName, &hashSum) != RSSL_RET_SUCCESS)
+						{
+							rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+									"Memory allocation failed.");
+							return RSSL_RET_FAILURE;
+						}
 
-						rsslHashTableInsertLink(&pServiceCache->_servicesByName,
-								&pCachedService->_nameLink, &pCachedInfo->serviceName, &hashSum);
+						pCachedService->hasServiceName = RSSL_TRUE;
 					}
 
 					/* Vendor */
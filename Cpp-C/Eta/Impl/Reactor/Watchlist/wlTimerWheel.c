@@ -0,0 +1,214 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright Thomson Reuters 2015. All rights reserved.
+*/
+
+#include "rtr/wlTimerWheel.h"
+
+/* Farthest a timer can be placed from the wheel's current time. Timers beyond this are placed
+ * in the farthest slot, and are placed again when that slot is cascaded. */
+#define WL_TW_MAX_SPAN (((RsslInt64)1 << (WL_TW_SLOT_BITS * WL_TW_LEVELS)) - 1)
+
+/* Places a timer into the slot corresponding to its expiration. */
+static void _wlTimerWheelInsert(WlTimerWheel *pWheel, WlTimer *pTimer)
+{
+	RsslInt64 slotTime = pTimer->expireTime;
+	RsslInt64 delta;
+	int level;
+
+	if (slotTime < pWheel->nextTime)
+		slotTime = pWheel->nextTime;
+	else if (slotTime - pWheel->nextTime > WL_TW_MAX_SPAN)
+		slotTime = pWheel->nextTime + WL_TW_MAX_SPAN;
+
+	delta = slotTime - pWheel->nextTime;
+	for (level = 0; level < WL_TW_LEVELS - 1
+			&& delta >= ((RsslInt64)1 << (WL_TW_SLOT_BITS * (level + 1))); ++level);
+
+	pTimer->pQueue = &pWheel->slots[level][(slotTime >> (WL_TW_SLOT_BITS * level)) & WL_TW_SLOT_MASK];
+	rsslQueueAddLinkToBack(pTimer->pQueue, &pTimer->qlTimer);
+	++pWheel->levelCounts[level];
+}
+
+/* Moves the timers in a slot of a higher level down to the lower levels. */
+static void _wlTimerWheelCascade(WlTimerWheel *pWheel, int level, RsslUInt32 index)
+{
+	RsslQueue *pSlot = &pWheel->slots[level][index];
+	RsslQueueLink *pLink;
+
+	while ((pLink = rsslQueueRemoveFirstLink(pSlot)))
+	{
+		--pWheel->levelCounts[level];
+		_wlTimerWheelInsert(pWheel, RSSL_QUEUE_LINK_TO_OBJECT(WlTimer, qlTimer, pLink));
+	}
+}
+
+/* Turns the wheel up to and including currentTime, moving expired timers to the expired queue. */
+static void _wlTimerWheelAdvance(WlTimerWheel *pWheel, RsslInt64 currentTime)
+{
+	while (pWheel->nextTime <= currentTime)
+	{
+		RsslQueue *pSlot;
+		RsslQueueLink *pLink;
+		int level;
+
+		if (pWheel->count == rsslQueueGetElementCount(&pWheel->expiredQueue))
+		{
+			/* Nothing left on the wheel. */
+			pWheel->nextTime = currentTime + 1;
+			return;
+		}
+
+		/* On a slot boundary, cascade the higher levels. */
+		if (!(pWheel->nextTime & WL_TW_SLOT_MASK))
+		{
+			for (level = 1; level < WL_TW_LEVELS; ++level)
+			{
+				RsslUInt32 index = (RsslUInt32)(pWheel->nextTime >> (WL_TW_SLOT_BITS * level))
+					& WL_TW_SLOT_MASK;
+
+				_wlTimerWheelCascade(pWheel, level, index);
+				if (index)
+					break;
+			}
+		}
+
+		pSlot = &pWheel->slots[0][pWheel->nextTime & WL_TW_SLOT_MASK];
+		while ((pLink = rsslQueueRemoveFirstLink(pSlot)))
+		{
+			WlTimer *pTimer = RSSL_QUEUE_LINK_TO_OBJECT(WlTimer, qlTimer, pLink);
+			--pWheel->levelCounts[0];
+			pTimer->pQueue = &pWheel->expiredQueue;
+			rsslQueueAddLinkToBack(&pWheel->expiredQueue, &pTimer->qlTimer);
+		}
+
+		++pWheel->nextTime;
+
+		/* If the lower levels are empty, skip ahead to the next time the lowest occupied level
+		 * is cascaded. */
+		for (level = 0; level < WL_TW_LEVELS && !pWheel->levelCounts[level]; ++level);
+
+		if (level > 0 && level < WL_TW_LEVELS)
+		{
+			RsslInt64 span = (RsslInt64)1 << (WL_TW_SLOT_BITS * level);
+			RsslInt64 boundaryTime = (pWheel->nextTime + span - 1) & ~(span - 1);
+
+			pWheel->nextTime = (boundaryTime <= currentTime) ? boundaryTime : currentTime + 1;
+		}
+	}
+}
+
+void wlTimerWheelInit(WlTimerWheel *pWheel, RsslInt64 currentTime)
+{
+	int level, index;
+
+	pWheel->nextTime = currentTime;
+	pWheel->count = 0;
+
+	rsslInitQueue(&pWheel->expiredQueue);
+	for (level = 0; level < WL_TW_LEVELS; ++level)
+	{
+		pWheel->levelCounts[level] = 0;
+		for (index = 0; index < WL_TW_SLOTS; ++index)
+			rsslInitQueue(&pWheel->slots[level][index]);
+	}
+}
+
+void wlTimerWheelArm(WlTimerWheel *pWheel, WlTimer *pTimer, RsslInt64 currentTime,
+		RsslInt64 timeout)
+{
+	wlTimerWheelCancel(pWheel, pTimer);
+
+	/* If the wheel is empty, it can be brought straight to the current time. */
+	if (!pWheel->count)
+		pWheel->nextTime = currentTime;
+
+	pTimer->expireTime = currentTime + timeout;
+	_wlTimerWheelInsert(pWheel, pTimer);
+	++pWheel->count;
+}
+
+void wlTimerWheelCancel(WlTimerWheel *pWheel, WlTimer *pTimer)
+{
+	RsslQueue *pQueue = pTimer->pQueue;
+
+	if (!pQueue)
+		return;
+
+	rsslQueueRemoveLink(pQueue, &pTimer->qlTimer);
+	if (pQueue != &pWheel->expiredQueue)
+		--pWheel->levelCounts[(pQueue - &pWheel->slots[0][0]) / WL_TW_SLOTS];
+
+	pTimer->pQueue = NULL;
+	--pWheel->count;
+}
+
+WlTimer *wlTimerWheelPopExpired(WlTimerWheel *pWheel, RsslInt64 currentTime)
+{
+	RsslQueueLink *pLink;
+	WlTimer *pTimer;
+
+	if (!rsslQueueGetElementCount(&pWheel->expiredQueue))
+		_wlTimerWheelAdvance(pWheel, currentTime);
+
+	if (!(pLink = rsslQueueRemoveFirstLink(&pWheel->expiredQueue)))
+		return NULL;
+
+	pTimer = RSSL_QUEUE_LINK_TO_OBJECT(WlTimer, qlTimer, pLink);
+	pTimer->pQueue = NULL;
+	--pWheel->count;
+	return pTimer;
+}
+
+RsslInt64 wlTimerWheelGetNextExpireTime(WlTimerWheel *pWheel)
+{
+	RsslInt64 time = WL_TIME_UNSET;
+	RsslQueueLink *pLink;
+	int level;
+
+	if ((pLink = rsslQueuePeekFront(&pWheel->expiredQueue)))
+		return RSSL_QUEUE_LINK_TO_OBJECT(WlTimer, qlTimer, pLink)->expireTime;
+
+	if (pWheel->levelCounts[0])
+	{
+		RsslInt64 slotTime;
+
+		/* Timers in a level-0 slot expire at that slot's time (or were armed to expire
+		 * before the wheel's current time, and so are in its current slot). */
+		for (slotTime = pWheel->nextTime; slotTime < pWheel->nextTime + WL_TW_SLOTS; ++slotTime)
+		{
+			if (rsslQueueGetElementCount(&pWheel->slots[0][slotTime & WL_TW_SLOT_MASK]))
+			{
+				time = slotTime;
+				break;
+			}
+		}
+	}
+
+	for (level = 1; level < WL_TW_LEVELS; ++level)
+	{
+		int shift = WL_TW_SLOT_BITS * level;
+		RsslInt64 slotNumber, firstSlotNumber;
+
+		if (!pWheel->levelCounts[level])
+			continue;
+
+		/* Find the next slot on this level that will be cascaded. If the wheel is exactly on a
+		 * boundary, the current slot has yet to be cascaded. */
+		firstSlotNumber = (pWheel->nextTime >> shift)
+			+ ((pWheel->nextTime & (((RsslInt64)1 << shift) - 1)) ? 1 : 0);
+		for (slotNumber = firstSlotNumber; slotNumber < firstSlotNumber + WL_TW_SLOTS; ++slotNumber)
+		{
+			if (rsslQueueGetElementCount(&pWheel->slots[level][slotNumber & WL_TW_SLOT_MASK]))
+			{
+				if ((slotNumber << shift) < time)
+					time = slotNumber << shift;
+				break;
+			}
+		}
+	}
+
+	return time;
+}
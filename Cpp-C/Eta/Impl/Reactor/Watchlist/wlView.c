@@ -504,6 +504,31 @@ WlView *wlViewCreate(void *elemList, RsslUInt32 elemCount, RsslUInt viewType,
 				  viewFieldIdList[nextValidPos] = viewFieldIdList[i];
 				++nextValidPos;
 			  }
+
+			/* Build the bitset used to filter fanout to this view. */
+			pView->fidBitmap = NULL;
+			pView->fidBitmapBits = 0;
+			pView->fidBitmapMin = 0;
+
+			if (pView->elemCount)
+			{
+				pView->fidBitmapMin = viewFieldIdList[0];
+				pView->fidBitmapBits = (RsslUInt32)((RsslInt32)viewFieldIdList[pView->elemCount - 1]
+						- (RsslInt32)viewFieldIdList[0]) + 1;
+
+				if (!(pView->fidBitmap = (RsslUInt32*)calloc((pView->fidBitmapBits + 31) / 32, sizeof(RsslUInt32))))
+				{
+					free(pView);
+					verify_malloc(0, pErrorInfo, NULL);
+				}
+
+				for (ui = 0; ui < pView->elemCount; ++ui)
+				{
+					RsslUInt32 offset = (RsslUInt32)((RsslInt32)viewFieldIdList[ui] - (RsslInt32)pView->fidBitmapMin);
+					pView->fidBitmap[offset >> 5] |= 1U << (offset & 31);
+				}
+			}
+
 			return pView;
 		}
 		else
@@ -514,6 +539,8 @@ WlView *wlViewCreate(void *elemList, RsslUInt32 elemCount, RsslUInt viewType,
 			pView->elemList = NULL;
 			pView->elemCount = 0;
 			pView->nameBuf = NULL;
+			pView->fidBitmap = NULL;
+			pView->fidBitmapBits = 0;
 			return pView;
 		}
 	}
@@ -541,6 +568,9 @@ WlView *wlViewCreate(void *elemList, RsslUInt32 elemCount, RsslUInt viewType,
 			pView->elemCount = elemCount;
 			pView->elemList = (void*)viewNameList;
 			pView->pParentQueue = NULL;
+			pView->nameBuf = NULL;
+			pView->fidBitmap = NULL;
+			pView->fidBitmapBits = 0;
 
 			memcpy(viewNameList, nameList, elemCount * sizeof(RsslBuffer));
 
@@ -589,6 +619,8 @@ WlView *wlViewCreate(void *elemList, RsslUInt32 elemCount, RsslUInt viewType,
 			pView->elemList = NULL;
 			pView->elemCount = 0;
 			pView->nameBuf = NULL;
+			pView->fidBitmap = NULL;
+			pView->fidBitmapBits = 0;
 			return pView;
 		}
 	}
@@ -601,6 +633,8 @@ void wlViewDestroy(WlView *pView)
 {
 	if (pView->nameBuf)
 		free(pView->nameBuf);
+	if (pView->fidBitmap)
+		free(pView->fidBitmap);
 	free(pView);
 }
 
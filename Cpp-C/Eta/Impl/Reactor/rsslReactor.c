@@ -35,6 +35,9 @@ static RsslRet _reactorDispatchFromChannel(RsslReactorImpl *pReactorImpl, RsslRe
 /* Reads and handles an event from the given queue. */
 static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, RsslReactorEventQueue *pQueue, RsslErrorInfo *pError);
 
+/* Switches between busy-polling and using the notifier, based on whether the last dispatch call processed anything. */
+static RsslRet _reactorUpdateBusyPoll(RsslReactorImpl *pReactorImpl, RsslBool busyPoll, RsslBool dispatched, RsslErrorInfo *pError);
+
 /* Sets whether we are in a callback call */
 static void _reactorSetInCallback(RsslReactorImpl *pReactorImpl, RsslBool inCallback);
 
@@ -145,6 +148,16 @@ static RsslRet _reactorSubmit(RsslReactorImpl *pReactorImpl, RsslReactorChannelI
 
 static void _reactorMoveChannel(RsslQueue *pNewList, RsslReactorChannelImpl *pReactorChannel)
 { 
+	RsslReactorImpl *pReactorImpl = pReactorChannel->pParentReactor;
+
+	if (pReactorChannel->reactorParentQueue == &pReactorImpl->activeChannels)
+	{
+		/* Channel is no longer read or checked for ping timeout. */
+		if (rsslQueueLinkInAList(&pReactorChannel->readyLink))
+			rsslQueueRemoveLink(&pReactorImpl->readyChannels, &pReactorChannel->readyLink);
+		wlTimerWheelCancel(&pReactorImpl->pingTimerWheel, &pReactorChannel->pingReadTimer);
+	}
+
 	if (pReactorChannel->reactorParentQueue)
 	{
 		rsslQueueRemoveLink(pReactorChannel->reactorParentQueue, &pReactorChannel->reactorQueueLink);
@@ -157,6 +170,24 @@ static void _reactorMoveChannel(RsslQueue *pNewList, RsslReactorChannelImpl *pRe
 		rsslQueueAddLinkToBack(pNewList, &pReactorChannel->reactorQueueLink);
 }
 
+/* Adds an active channel to the channels that may have something to read, if it is not there already. */
+static void _reactorSetChannelReady(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel)
+{
+	if (!rsslQueueLinkInAList(&pReactorChannel->readyLink))
+		rsslQueueAddLinkToBack(&pReactorImpl->readyChannels, &pReactorChannel->readyLink);
+}
+
+/* Arms the timer that checks whether a channel has passed its ping timeout, which happens once more than pingTimeout seconds pass 
+ * without reading a message or ping. */
+static void _reactorArmPingReadTimer(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel)
+{
+	RsslInt64 timeoutMs = pReactorChannel->lastPingReadMs + (RsslInt64)pReactorChannel->reactorChannel.pRsslChannel->pingTimeout * 1000 + 1
+		- pReactorImpl->lastRecordedTimeMs;
+
+	wlTimerWheelArm(&pReactorImpl->pingTimerWheel, &pReactorChannel->pingReadTimer, pReactorImpl->lastRecordedTimeMs, 
+			timeoutMs > 0 ? timeoutMs : 1);
+}
+
 static RsslReactorChannelImpl* _reactorTakeChannel(RsslReactorImpl *pReactorImpl, RsslQueue *pList)
 {
 	RsslQueueLink *pLink = rsslQueueRemoveFirstLink(pList);
@@ -171,7 +202,11 @@ static RsslReactorChannelImpl* _reactorTakeChannel(RsslReactorImpl *pReactorImpl
 
 		rsslClearReactorChannelImpl(pReactorImpl, pReactorChannel);
 		rsslInitQueueLink(&pReactorChannel->reactorQueueLink);
-		rsslInitReactorEventQueue(&pReactorChannel->eventQueue, 5, &pReactorImpl->activeEventQueueGroup);
+		if (rsslInitReactorEventQueue(&pReactorChannel->eventQueue, 5, &pReactorImpl->activeEventQueueGroup) != RSSL_RET_SUCCESS)
+		{
+			free(pReactorChannel);
+			return NULL;
+		}
 
 		if ((pReactorChannel->pWorkerNotifierEvent = rsslCreateNotifierEvent()) == NULL)
 			return NULL;
@@ -190,30 +225,82 @@ static RsslReactorChannelImpl* _reactorTakeChannel(RsslReactorImpl *pReactorImpl
 	return pReactorChannel;
 }
 
+/* Returns whether a channel has reached one of the flush high-water marks, so the worker should flush it without waiting for the flush delay. */
+static RsslBool _reactorFlushHighWaterMarkReached(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel)
+{
+	if (pReactorImpl->flushHighWaterMarkBytes && (RsslUInt32)pReactorChannel->writeRet >= pReactorImpl->flushHighWaterMarkBytes)
+		return RSSL_TRUE;
+
+	if (pReactorImpl->flushHighWaterMarkMsgs && pReactorChannel->flushPendingMsgs >= pReactorImpl->flushHighWaterMarkMsgs)
+		return RSSL_TRUE;
+
+	return RSSL_FALSE;
+}
+
+/* Takes the messages the watchlist wrote, and the bytes its last rsslWrite left pending, so that a flush can be requested for them. */
+static void _reactorTakeWatchlistWrites(RsslReactorChannelImpl *pReactorChannel)
+{
+	RsslWatchlist *pWatchlist = pReactorChannel->pWatchlist;
+
+	pReactorChannel->unflushedMsgs += pWatchlist->writtenMsgs;
+
+	/* A flush is needed even if the last write happened to leave nothing pending. */
+	pReactorChannel->writeRet = (pWatchlist->writeRet > 0) ? pWatchlist->writeRet : 1;
+
+	pWatchlist->writtenMsgs = 0;
+	pWatchlist->writeRet = 0;
+}
+
 static RsslRet _reactorSendFlushRequest(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslErrorInfo *pError)
 {
-	if (!pReactorChannel->requestedFlush)
-	{
-		/* Signal worker to flush for this channel */
-		RsslReactorEventImpl *pEvent = rsslReactorEventQueueGetFromPool(&pReactorImpl->reactorWorker.workerQueue);
+	RsslReactorEventImpl *pEvent;
+	RsslReactorFlushEventType flushEventType = RSSL_RCIMPL_FET_START_FLUSH;
+	RsslUInt32 newMsgs = pReactorChannel->unflushedMsgs;
 
-		if (pReactorChannel->pWatchlist)
-			pReactorChannel->pWatchlist->state &= ~RSSLWL_STF_NEED_FLUSH;
+	pReactorChannel->unflushedMsgs = 0;
 
-		pReactorChannel->requestedFlush = RSSL_TRUE;
-		pReactorChannel->writeRet = 0; /* Set writeRet to 0. If it gets set again later we know we've called rsslWrite since the last flush request. */
+	if (pReactorImpl->flushDelayUsec)
+	{
+		/* Flushing is delayed, so messages accumulate until the worker's deadline passes. 
+		 * If enough has accumulated, tell the worker to flush now instead. */
+		pReactorChannel->flushPendingMsgs += newMsgs;
 
-		rsslInitFlushEvent(&pEvent->flushEvent);
-		pEvent->flushEvent.pReactorChannel = (RsslReactorChannel*)pReactorChannel;
-		pEvent->flushEvent.flushEventType = RSSL_RCIMPL_FET_START_FLUSH;
-		if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(&pReactorImpl->reactorWorker.workerQueue, pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, pError))
+		if (!pReactorChannel->flushNowRequested && _reactorFlushHighWaterMarkReached(pReactorImpl, pReactorChannel))
 		{
-			_reactorShutdown(pReactorImpl, pError);
-			_reactorSendShutdownEvent(pReactorImpl, pError);
-			return RSSL_RET_FAILURE;
+			flushEventType = RSSL_RCIMPL_FET_FLUSH_NOW;
+			pReactorChannel->flushNowRequested = RSSL_TRUE;
+			pReactorChannel->flushPendingMsgs = 0;
+			++pReactorChannel->highWaterMarkFlushes;
 		}
 	}
 
+	if (flushEventType == RSSL_RCIMPL_FET_START_FLUSH && pReactorChannel->requestedFlush)
+	{
+		/* Worker will already flush this channel. */
+		pReactorChannel->coalescedMsgs += newMsgs;
+		return RSSL_RET_SUCCESS;
+	}
+
+	/* Signal worker to flush for this channel */
+	pEvent = rsslReactorEventQueueGetFromPool(&pReactorImpl->reactorWorker.workerQueue);
+
+	if (pReactorChannel->pWatchlist)
+		pReactorChannel->pWatchlist->state &= ~RSSLWL_STF_NEED_FLUSH;
+
+	pReactorChannel->requestedFlush = RSSL_TRUE;
+	pReactorChannel->writeRet = 0; /* Set writeRet to 0. If it gets set again later we know we've called rsslWrite since the last flush request. */
+	++pReactorChannel->flushRequests;
+
+	rsslInitFlushEvent(&pEvent->flushEvent);
+	pEvent->flushEvent.pReactorChannel = (RsslReactorChannel*)pReactorChannel;
+	pEvent->flushEvent.flushEventType = flushEventType;
+	if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(&pReactorImpl->reactorWorker.workerQueue, pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, pError))
+	{
+		_reactorShutdown(pReactorImpl, pError);
+		_reactorSendShutdownEvent(pReactorImpl, pError);
+		return RSSL_RET_FAILURE;
+	}
+
 	return RSSL_RET_SUCCESS;
 }
 
@@ -259,7 +346,8 @@ static RsslRet _reactorSendShutdownEvent(RsslReactorImpl *pReactorImpl, RsslErro
 	return RSSL_RET_SUCCESS;
 }
 
-RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpts, RsslErrorInfo *pError)
+/* Creates a reactor, or a single shard of a sharded reactor. */
+static RsslReactorImpl *_reactorCreate(RsslCreateReactorOptions *pReactorOpts, RsslErrorInfo *pError)
 {
 	RsslReactorImpl *pReactorImpl;
 	RsslInt32 i;
@@ -290,6 +378,22 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
 	pReactorImpl->dispatchDecodeMemoryBufferSize = pReactorOpts->dispatchDecodeMemoryBufferSize;
 	pReactorImpl->reactor.userSpecPtr = pReactorOpts->userSpecPtr;
 
+	switch(pReactorOpts->notifierType)
+	{
+		case RSSL_RC_NT_DEFAULT: pReactorImpl->notifierType = RSSL_NT_DEFAULT; break;
+		case RSSL_RC_NT_EPOLL: pReactorImpl->notifierType = RSSL_NT_EPOLL; break;
+		default:
+			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Invalid notifierType.");
+			free(pReactorImpl);
+			return NULL;
+	}
+
+	pReactorImpl->busyPollDispatch = pReactorOpts->busyPollDispatch;
+	pReactorImpl->busyPollIdleSpinLimit = pReactorOpts->busyPollIdleSpinLimit;
+	pReactorImpl->flushDelayUsec = pReactorOpts->flushDelayUsec;
+	pReactorImpl->flushHighWaterMarkBytes = pReactorOpts->flushHighWaterMarkBytes;
+	pReactorImpl->flushHighWaterMarkMsgs = pReactorOpts->flushHighWaterMarkMsgs;
+
 	pReactorImpl->state = RSSL_REACTOR_ST_ACTIVE;
 
 
@@ -306,6 +410,10 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
 		return NULL;
 	}
 
+	/* When busy-polling, dispatch checks the event queues directly so they don't need to signal the eventFd. */
+	if (pReactorImpl->busyPollDispatch)
+		rsslReactorEventQueueGroupSetSignalEnabled(&pReactorImpl->activeEventQueueGroup, RSSL_FALSE);
+
 #ifdef WIN32
 	/* On Windows, time checks use the performance counter, so we need to obtain its frequency. */
 	QueryPerformanceFrequency(&perfFrequency);
@@ -318,6 +426,7 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
 	rsslInitQueue(&pReactorImpl->channelPool);
 	rsslInitQueue(&pReactorImpl->initializingChannels);
 	rsslInitQueue(&pReactorImpl->activeChannels);
+	rsslInitQueue(&pReactorImpl->readyChannels);
 	rsslInitQueue(&pReactorImpl->inactiveChannels);
 	rsslInitQueue(&pReactorImpl->closingChannels);
 	rsslInitQueue(&pReactorImpl->reconnectingChannels);
@@ -326,6 +435,7 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
 	RSSL_MUTEX_INIT(&pReactorImpl->interfaceLock);
 
 	pReactorImpl->lastRecordedTimeMs = getCurrentTimeMs(pReactorImpl->ticksPerMsec);
+	wlTimerWheelInit(&pReactorImpl->pingTimerWheel, pReactorImpl->lastRecordedTimeMs);
 
 	/* Initialize channel pool */
 	for (i = 0; i < 10; ++i)
@@ -339,7 +449,12 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
 		}
 		rsslClearReactorChannelImpl(pReactorImpl, pNewChannel);
 		rsslInitQueueLink(&pNewChannel->reactorQueueLink);
-		rsslInitReactorEventQueue(&pNewChannel->eventQueue, 5, &pReactorImpl->activeEventQueueGroup);
+		if (rsslInitReactorEventQueue(&pNewChannel->eventQueue, 5, &pReactorImpl->activeEventQueueGroup) != RSSL_RET_SUCCESS)
+		{
+			free(pNewChannel);
+			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to create reactor channel pool.");
+			return NULL;
+		}
 
 		if ((pNewChannel->pNotifierEvent = rsslCreateNotifierEvent()) == NULL)
 			return NULL;
@@ -350,7 +465,7 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
 		_reactorMoveChannel(&pReactorImpl->channelPool, pNewChannel);
 	}
 
-	if ((pReactorImpl->pNotifier = rsslCreateNotifier(1024)) == NULL)
+	if ((pReactorImpl->pNotifier = rsslCreateNotifierEx(1024, pReactorImpl->notifierType)) == NULL)
 	{
 		_reactorWorkerCleanupReactor(pReactorImpl);
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to create reactor notifier.");
@@ -398,9 +513,78 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
 		return NULL;
 	}
 
+	return pReactorImpl;
+}
+
+RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpts, RsslErrorInfo *pError)
+{
+	RsslReactorImpl *pReactorImpl, *pShard;
+	RsslErrorInfo destroyError;
+
+	if (!(pReactorImpl = _reactorCreate(pReactorOpts, pError)))
+		return NULL;
+
+	if (pReactorOpts->shardCount <= 1)
+		return (RsslReactor*)pReactorImpl;
+
+	/* Create the remaining shards. The reactor itself is the first. */
+	if (!(pReactorImpl->pShards = (RsslReactorImpl**)malloc(pReactorOpts->shardCount * sizeof(RsslReactorImpl*))))
+	{
+		rsslDestroyReactor((RsslReactor*)pReactorImpl, &destroyError);
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to create reactor shard list.");
+		return NULL;
+	}
+
+	pReactorImpl->pShards[0] = pReactorImpl;
+	pReactorImpl->shardCount = 1;
+
+	while (pReactorImpl->shardCount < pReactorOpts->shardCount)
+	{
+		if (!(pShard = _reactorCreate(pReactorOpts, pError)))
+		{
+			rsslDestroyReactor((RsslReactor*)pReactorImpl, &destroyError);
+			return NULL;
+		}
+
+		pShard->pShardParent = pReactorImpl;
+		pReactorImpl->pShards[pReactorImpl->shardCount++] = pShard;
+	}
+
 	return (RsslReactor*)pReactorImpl;
 }
 
+RSSL_VA_API RsslReactor *rsslReactorGetShard(RsslReactor *pReactor, RsslUInt32 shardIndex, RsslErrorInfo *pError)
+{
+	RsslReactorImpl *pReactorImpl = (RsslReactorImpl*)pReactor;
+
+	if (shardIndex == 0)
+		return pReactor;
+
+	if (shardIndex >= pReactorImpl->shardCount)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Invalid shard index %u.", shardIndex);
+		return NULL;
+	}
+
+	return (RsslReactor*)pReactorImpl->pShards[shardIndex];
+}
+
+/* Returns the shard that a new channel should be assigned to, which is the one with the fewest channels. 
+ * The channel counts are read without taking each shard's lock, so this is only a balancing hint. */
+static RsslReactorImpl *_reactorSelectShard(RsslReactorImpl *pReactorImpl)
+{
+	RsslReactorImpl *pSelected = pReactorImpl;
+	RsslUInt32 i;
+
+	for (i = 1; i < pReactorImpl->shardCount; ++i)
+	{
+		if (*(volatile RsslInt32*)&pReactorImpl->pShards[i]->channelCount < *(volatile RsslInt32*)&pSelected->channelCount)
+			pSelected = pReactorImpl->pShards[i];
+	}
+
+	return pSelected;
+}
+
 static void _reactorShutdown(RsslReactorImpl *pReactorImpl, RsslErrorInfo *pError)
 {
 	switch(pReactorImpl->state)
@@ -446,10 +630,9 @@ static RsslRet _reactorCleanupReactor(RsslReactorImpl *pReactorImpl)
 	return RSSL_RET_SUCCESS;
 }
 
-RSSL_VA_API RsslRet rsslDestroyReactor(RsslReactor *pReactor, RsslErrorInfo *pError)
+/* Destroys a reactor, or a single shard of a sharded reactor. */
+static RsslRet _reactorDestroy(RsslReactorImpl *pReactorImpl, RsslErrorInfo *pError)
 {
-	RsslReactorImpl *pReactorImpl = (RsslReactorImpl*)pReactor;
-
 	switch(pReactorImpl->state)
 	{
 		case RSSL_REACTOR_ST_ACTIVE:
@@ -469,6 +652,36 @@ RSSL_VA_API RsslRet rsslDestroyReactor(RsslReactor *pReactor, RsslErrorInfo *pEr
 	}
 }
 
+RSSL_VA_API RsslRet rsslDestroyReactor(RsslReactor *pReactor, RsslErrorInfo *pError)
+{
+	RsslReactorImpl *pReactorImpl = (RsslReactorImpl*)pReactor;
+	RsslRet ret, shardRet = RSSL_RET_SUCCESS;
+
+	if (pReactorImpl->pShardParent)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Reactor is a shard; destroy the sharded reactor instead.");
+		return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	if (pReactorImpl->pShards)
+	{
+		RsslUInt32 i;
+
+		for (i = 1; i < pReactorImpl->shardCount; ++i)
+		{
+			if ((ret = _reactorDestroy(pReactorImpl->pShards[i], pError)) != RSSL_RET_SUCCESS)
+				shardRet = ret;
+		}
+
+		free(pReactorImpl->pShards);
+		pReactorImpl->pShards = NULL;
+		pReactorImpl->shardCount = 0;
+	}
+
+	ret = _reactorDestroy(pReactorImpl, pError);
+	return (shardRet != RSSL_RET_SUCCESS) ? shardRet : ret;
+}
+
 static RsslRet _reactorAddChannel(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslErrorInfo *pError)
 {
 	RsslReactorChannelEventImpl *pEvent = (RsslReactorChannelEventImpl*)rsslReactorEventQueueGetFromPool(&pReactorImpl->reactorWorker.workerQueue);
@@ -599,7 +812,7 @@ static RsslRet _validateRole(RsslReactorChannelRole *pRole, RsslErrorInfo *pErro
 
 RSSL_VA_API RsslRet rsslReactorConnect(RsslReactor *pReactor, RsslReactorConnectOptions *pOpts, RsslReactorChannelRole *pRole, RsslErrorInfo *pError )
 {
-	RsslReactorImpl *pReactorImpl = (RsslReactorImpl*)pReactor;
+	RsslReactorImpl *pReactorImpl = _reactorSelectShard((RsslReactorImpl*)pReactor);
 
 	RsslWatchlist *pWatchlist = NULL;
 	RsslChannel *pChannel;
@@ -653,6 +866,9 @@ RSSL_VA_API RsslRet rsslReactorConnect(RsslReactor *pReactor, RsslReactorConnect
 		watchlistCreateOpts.maxOutstandingPosts = pRole->ommConsumerRole.watchlistOptions.maxOutstandingPosts;
 		watchlistCreateOpts.postAckTimeout = pRole->ommConsumerRole.watchlistOptions.postAckTimeout;
 		watchlistCreateOpts.requestTimeout = pRole->ommConsumerRole.watchlistOptions.requestTimeout;
+		watchlistCreateOpts.filterFanoutByView = pRole->ommConsumerRole.watchlistOptions.filterFanoutByView;
+		watchlistCreateOpts.itemRequestRate = pRole->ommConsumerRole.watchlistOptions.itemRequestRate;
+		watchlistCreateOpts.requestBatchSize = pRole->ommConsumerRole.watchlistOptions.requestBatchSize;
 		watchlistCreateOpts.ticksPerMsec = pReactorImpl->ticksPerMsec;
 		pWatchlist = rsslWatchlistCreate(&watchlistCreateOpts, pError);
 		if (!pWatchlist) goto reactorConnectFail;
@@ -660,7 +876,7 @@ RSSL_VA_API RsslRet rsslReactorConnect(RsslReactor *pReactor, RsslReactorConnect
 	else
 		pWatchlist = NULL;
 
-	if ((pReactorChannel->pTunnelManager = tunnelManagerOpen(pReactor, (RsslReactorChannel*)pReactorChannel, pError)) == NULL)
+	if ((pReactorChannel->pTunnelManager = tunnelManagerOpen((RsslReactor*)pReactorImpl, (RsslReactorChannel*)pReactorChannel, pError)) == NULL)
 		goto reactorConnectFail;
 
 	if (_reactorChannelCopyRole(pReactorChannel, pRole, pError) != RSSL_RET_SUCCESS)
@@ -804,7 +1020,7 @@ reactorConnectFail:
 
 RSSL_VA_API RsslRet rsslReactorAccept(RsslReactor *pReactor, RsslServer *pServer, RsslReactorAcceptOptions *pOpts, RsslReactorChannelRole *pRole, RsslErrorInfo *pError )
 {
-	RsslReactorImpl *pReactorImpl = (RsslReactorImpl*)pReactor;
+	RsslReactorImpl *pReactorImpl = _reactorSelectShard((RsslReactorImpl*)pReactor);
 
 	RsslChannel *pChannel;
 	RsslReactorChannelImpl *pReactorChannel;
@@ -816,17 +1032,17 @@ RSSL_VA_API RsslRet rsslReactorAccept(RsslReactor *pReactor, RsslServer *pServer
 	if (pReactorImpl->state != RSSL_REACTOR_ST_ACTIVE)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Reactor is shutting down.");
-		return (reactorUnlockInterface((RsslReactorImpl*)pReactor), RSSL_RET_FAILURE);
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
 	}
 
 	if (!pServer)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Server not provided.");
-		return (reactorUnlockInterface((RsslReactorImpl*)pReactor), RSSL_RET_INVALID_ARGUMENT);
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
 	}
 
 	if (_validateRole(pRole, pError) != RSSL_RET_SUCCESS)
-		return (reactorUnlockInterface((RsslReactorImpl*)pReactor), RSSL_RET_INVALID_ARGUMENT);
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
 
 	if (!(pChannel = rsslAccept(pServer, &pOpts->rsslAcceptOptions, &pError->rsslError)))
 	{
@@ -855,7 +1071,7 @@ RSSL_VA_API RsslRet rsslReactorAccept(RsslReactor *pReactor, RsslServer *pServer
 	pReactorChannel->reactorChannel.userSpecPtr = pOpts->rsslAcceptOptions.userSpecPtr;
 	pReactorChannel->initializationTimeout = pOpts->initializationTimeout;
 
-	if ((pReactorChannel->pTunnelManager = tunnelManagerOpen(pReactor, (RsslReactorChannel*)pReactorChannel, pError)) == NULL)
+	if ((pReactorChannel->pTunnelManager = tunnelManagerOpen((RsslReactor*)pReactorImpl, (RsslReactorChannel*)pReactorChannel, pError)) == NULL)
 		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
 
 	if (!RSSL_ERROR_INFO_CHECK((ret = _reactorAddChannel(pReactorImpl, pReactorChannel, pError)) == RSSL_RET_SUCCESS, ret, pError))
@@ -872,10 +1088,12 @@ RSSL_VA_API RsslRet rsslReactorAccept(RsslReactor *pReactor, RsslServer *pServer
 
 RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispatchOptions *pDispatchOpts, RsslErrorInfo *pError)
 {
-	RsslReactorImpl *pReactorImpl = (RsslReactorImpl*)pReactor;
+	RsslReactorImpl *pReactorImpl = rsslReactorGetChannelShard(pReactor, pDispatchOpts->pReactorChannel);
 	RsslRet ret;
-	RsslUInt32  channelsToCheck, channelsWithData;
+	RsslUInt32  channelsToCheck;
 	RsslUInt32 maxMsgs = pDispatchOpts->maxMessages;
+	RsslBool busyPoll;				/* Reading channels and checking queues directly instead of using the notifier. */
+	RsslBool dispatched = RSSL_FALSE;	/* Whether any event or message was processed. */
 
 	if ((ret = reactorLockInterface(pReactorImpl, RSSL_FALSE, pError)) != RSSL_RET_SUCCESS)
 		return ret;
@@ -883,8 +1101,11 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 	/* Record current time. */
 	pReactorImpl->lastRecordedTimeMs = getCurrentTimeMs(pReactorImpl->ticksPerMsec);
 
+	busyPoll = pReactorImpl->busyPollDispatch 
+		&& (pReactorImpl->busyPollIdleSpinLimit == 0 || pReactorImpl->busyPollIdleSpinCount < pReactorImpl->busyPollIdleSpinLimit);
+
 	/* See which channels have something to read. */
-	if ((ret = rsslNotifierWait(pReactorImpl->pNotifier, 0)) < 0)
+	if (!busyPoll && (ret = rsslNotifierWait(pReactorImpl->pNotifier, 0)) < 0)
 	{
 #ifdef WIN32
 		int notifierErrno = WSAGetLastError();
@@ -909,111 +1130,125 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 		if (!pDispatchOpts->pReactorChannel)
 		{
 			RsslReactorChannelImpl *pReactorChannel;
+			RsslQueueLink *pLink;
+			WlTimer *pTimer;
 
-			if (rsslNotifierEventIsReadable(pReactorImpl->pQueueNotifierEvent))
+			/* Queue the channels that have something to read. Channels may remain queued from the last call, either because the last 
+			 * return from rsslRead() was greater than zero, indicating there were still bytes in RSSL's queue, or because the desired 
+			 * number of messages was dispatched before they were read. This is done before any callback, since a callback may remove
+			 * notifier events. */
+			if (busyPoll)
+			{
+				/* When busy-polling, read every channel rather than waiting for its descriptor to be reported. */
+				RSSL_QUEUE_FOR_EACH_LINK(&pReactorImpl->activeChannels, pLink)
+					_reactorSetChannelReady(pReactorImpl, RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, reactorQueueLink, pLink));
+			}
+			else
+			{
+				int i;
+
+				/* Only the notified events need to be checked, so this does not depend on how many channels are active. */
+				for (i = 0; i < pReactorImpl->pNotifier->notifiedEventCount; ++i)
+				{
+					RsslNotifierEvent *pNotifierEvent = pReactorImpl->pNotifier->notifiedEvents[i];
+
+					if (pNotifierEvent == pReactorImpl->pQueueNotifierEvent || !rsslNotifierEventIsReadable(pNotifierEvent))
+						continue;
+
+					pReactorChannel = (RsslReactorChannelImpl*)rsslNotifierEventGetObject(pNotifierEvent);
+					if (pReactorChannel->reactorParentQueue == &pReactorImpl->activeChannels)
+						_reactorSetChannelReady(pReactorImpl, pReactorChannel);
+				}
+			}
+
+			if (busyPoll ? rsslReactorEventQueueGroupIsActive(&pReactorImpl->activeEventQueueGroup) 
+					: rsslNotifierEventIsReadable(pReactorImpl->pQueueNotifierEvent))
 			{
 				RsslReactorEventQueue *pQueue;
 
 				/* Dispatch events from queues in a round-robin fashion until all are processed. */
 				while (maxMsgs > 0 && (pQueue = rsslReactorEventQueueGroupShift(&pReactorImpl->activeEventQueueGroup)))
 				{
-					if ((ret = _reactorDispatchEventFromQueue(pReactorImpl, pQueue, pError)) < RSSL_RET_SUCCESS)
+					/* RSSL_RET_READ_WOULD_BLOCK may be returned if an event is still being added to the queue by another thread. */
+					if ((ret = _reactorDispatchEventFromQueue(pReactorImpl, pQueue, pError)) < RSSL_RET_SUCCESS && ret != RSSL_RET_READ_WOULD_BLOCK)
 					{
 						_reactorShutdown(pReactorImpl, pError);
 						_reactorSendShutdownEvent(pReactorImpl, pError);
 						return (reactorUnlockInterface(pReactorImpl), ret);
 					}
+					if (ret != RSSL_RET_READ_WOULD_BLOCK) dispatched = RSSL_TRUE;
 					if (maxMsgs > 0) --maxMsgs;
 				}
 			}
 
-			channelsWithData = channelsToCheck = rsslQueueGetElementCount(&pReactorImpl->activeChannels);
-
-			while(maxMsgs > 0 && channelsWithData > 0)
+			/* Read from the queued channels in round-robin fashion until the desired number of messages has been dispatched or there is
+			 * nothing more to read. */
+			while (maxMsgs > 0 && (pLink = rsslQueueRemoveFirstLink(&pReactorImpl->readyChannels)))
 			{
-				RsslQueueLink *pLink;
-				RsslBool isFdReadable;
+				pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, readyLink, pLink);
+
+				if ((ret = _reactorDispatchFromChannel(pReactorImpl, pReactorChannel, pError)) < RSSL_RET_SUCCESS)
+				{
+					/* _reactorDispatchFromChannel from channel will disconnect the channel if it needs to. If if fails,
+					 * then it had a problem doing that and there's nothing more we can do to handle it. */
+					_reactorShutdown(pReactorImpl, pError);
+					_reactorSendShutdownEvent(pReactorImpl, pError);
+					return (reactorUnlockInterface(pReactorImpl), ret);
+				}
+				else if (pReactorChannel->reactorParentQueue != &pReactorImpl->activeChannels)
+				{
+					/* Channel is no longer active */
+					dispatched = RSSL_TRUE;
+				}
+				else if (pReactorChannel->readRet > 0)
+				{
+					/* More to read; requeue the channel behind the others. */
+					_reactorSetChannelReady(pReactorImpl, pReactorChannel);
+					dispatched = RSSL_TRUE;
+				}
+				else
+				{
+					rsslNotifierEventClearNotifiedFlags(pReactorChannel->pNotifierEvent);
 
-				pLink = rsslQueueRemoveFirstLink(&pReactorImpl->activeChannels);
-				rsslQueueAddLinkToBack(&pReactorImpl->activeChannels, pLink);
+					if (pReactorChannel->readRet != RSSL_RET_READ_WOULD_BLOCK)
+						dispatched = RSSL_TRUE;
+				}
 
-				pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, reactorQueueLink, pLink);
+				--maxMsgs;
+			}
 
-				isFdReadable = rsslNotifierEventIsReadable(pReactorChannel->pNotifierEvent);
+			/* Check the ping timeouts whose time has come, rather than the ping timeout of every active channel. */
+			while ((pTimer = wlTimerWheelPopExpired(&pReactorImpl->pingTimerWheel, pReactorImpl->lastRecordedTimeMs)))
+			{
+				pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, pingReadTimer, pTimer);
 
-				/* A channel has something to read if either:
-				 * - The last return from rsslRead() was greater than zero, indicating there were still bytes in RSSL's queue
-				 * - The file descriptor is set because there is data from the socket */
-				if (pReactorChannel->readRet > 0 || isFdReadable)
+				/* A channel that is still queued has something to read, so it is not considered idle. Otherwise, if it has read a message
+				 * or ping since the timer was armed, check again when its ping timeout can next pass. */
+				if (rsslQueueLinkInAList(&pReactorChannel->readyLink)
+						|| (pReactorImpl->lastRecordedTimeMs - pReactorChannel->lastPingReadMs) <= pReactorChannel->reactorChannel.pRsslChannel->pingTimeout * 1000)
 				{
-					if ((ret = _reactorDispatchFromChannel(pReactorImpl, pReactorChannel, pError)) < RSSL_RET_SUCCESS)
-					{
-						/* _reactorDispatchFromChannel from channel will disconnect the channel if it needs to. If if fails,
-						 * then it had a problem doing that and there's nothing more we can do to handle it. */
-						_reactorShutdown(pReactorImpl, pError);
-						_reactorSendShutdownEvent(pReactorImpl, pError);
-						return (reactorUnlockInterface(pReactorImpl), ret);
-					}
-					else if (pReactorChannel->reactorParentQueue != &pReactorImpl->activeChannels)
-					{
-						/* Channel is no longer active */
-						--channelsWithData;
-					}
-					else if (pReactorChannel->readRet <= RSSL_RET_SUCCESS)
-					{
-						--channelsWithData;
-						if (isFdReadable)
-							rsslNotifierEventClearNotifiedFlags(pReactorChannel->pNotifierEvent);
-					}
-					if (channelsToCheck > 0) --channelsToCheck;
-					if (maxMsgs > 0) --maxMsgs;
+					_reactorArmPingReadTimer(pReactorImpl, pReactorChannel);
+					continue;
 				}
-				/* If not triggered to read, check if this channel has passed its ping timeout without sending either a ping or some data. */
-				else 
+
+				rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Channel ping timeout expired.");
+				if (_reactorHandleChannelDown(pReactorImpl, pReactorChannel, pError) != RSSL_RET_SUCCESS)
 				{
-					if ((pReactorImpl->lastRecordedTimeMs - pReactorChannel->lastPingReadMs) > pReactorChannel->reactorChannel.pRsslChannel->pingTimeout * 1000)
-					{
-						rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Channel ping timeout expired.");
-						if (_reactorHandleChannelDown(pReactorImpl, pReactorChannel, pError) != RSSL_RET_SUCCESS)
-						{
-							_reactorShutdown(pReactorImpl, pError);
-							_reactorSendShutdownEvent(pReactorImpl, pError);
-							return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
-						}
-					}
-					if (channelsToCheck > 0) --channelsToCheck;
-					--channelsWithData;
+					_reactorShutdown(pReactorImpl, pError);
+					_reactorSendShutdownEvent(pReactorImpl, pError);
+					return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
 				}
 			}
 
-			if (channelsToCheck < channelsWithData)
+			if (_reactorUpdateBusyPoll(pReactorImpl, busyPoll, dispatched, pError) != RSSL_RET_SUCCESS)
 			{
-				/* Some channels had more data to read, so return positive value. */
-				return (reactorUnlockInterface(pReactorImpl), 1);
+				_reactorShutdown(pReactorImpl, pError);
+				_reactorSendShutdownEvent(pReactorImpl, pError);
+				return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
 			}
-			else
-			{
-				/* We may have exhausted maxMessages before all channels were
-				 * checked for data. If any of them still have data
-				 * to read make sure we return a positive value. */
-				while (channelsToCheck > 0)
-				{
-					RsslQueueLink *pLink;
-					pLink = rsslQueueRemoveFirstLink(&pReactorImpl->activeChannels);
-					rsslQueueAddLinkToBack(&pReactorImpl->activeChannels, pLink);
-
-					pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, reactorQueueLink, pLink);
 
-					/* A channel has something to read if either:
-					 * - The last return from rsslRead() was greater than zero, indicating there were still bytes in RSSL's queue
-					 * - The file descriptor is set because there is data from the socket */
-					if (pReactorChannel->readRet > 0 || rsslNotifierEventIsReadable(pReactorChannel->pNotifierEvent))
-						return (reactorUnlockInterface(pReactorImpl), 1);
-
-					--channelsToCheck;
-				}
-				return (reactorUnlockInterface(pReactorImpl), 0);
-			}
+			/* If some channels still have data to read, return a positive value. */
+			return (reactorUnlockInterface(pReactorImpl), rsslQueueGetElementCount(&pReactorImpl->readyChannels) ? 1 : 0);
 		}
 		else
 		{
@@ -1028,7 +1263,8 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 				return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
 			}
 
-			if (rsslNotifierEventIsReadable(pReactorImpl->pQueueNotifierEvent))
+			if (busyPoll ? rsslReactorEventQueueGroupIsActive(&pReactorImpl->activeEventQueueGroup) 
+					: rsslNotifierEventIsReadable(pReactorImpl->pQueueNotifierEvent))
 			{
 
 				/* Dispatch from reactor queue */
@@ -1048,6 +1284,7 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 					else
 					{
 						/* Message was successfully processed. */
+						dispatched = RSSL_TRUE;
 						--maxMsgs;
 						if (ret == RSSL_RET_SUCCESS)
 							break;
@@ -1071,6 +1308,7 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 					else
 					{
 						/* Message was successfully processed. */
+						dispatched = RSSL_TRUE;
 						--maxMsgs;
 						if (ret == RSSL_RET_SUCCESS)
 							break;
@@ -1082,8 +1320,9 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 			channelsToCheck = 1;
 			/* A channel has something to read if either:
 			 * - The last return from rsslRead() was greater than zero, indicating there were still bytes in RSSL's queue
-			 * - The file descriptor is set because there is data from the socket */
-			if (pReactorChannel->readRet > 0 || rsslNotifierEventIsReadable(pReactorChannel->pNotifierEvent))
+			 * - The file descriptor is set because there is data from the socket 
+			 * When busy-polling, the channel is always read. */
+			if (pReactorChannel->readRet > 0 || busyPoll || rsslNotifierEventIsReadable(pReactorChannel->pNotifierEvent))
 			{
 				while (maxMsgs > 0 && channelsToCheck > 0)
 				{
@@ -1095,13 +1334,32 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 						_reactorSendShutdownEvent(pReactorImpl, pError);
 						return (reactorUnlockInterface(pReactorImpl), RSSL_RET_SUCCESS);
 					}
-					else if (pReactorChannel->readRet <= 0)
+					if (pReactorChannel->readRet != RSSL_RET_READ_WOULD_BLOCK)
+						dispatched = RSSL_TRUE;
+					if (pReactorChannel->readRet <= 0)
 					{
 						channelsToCheck = 0;
 						break;
 					}
 					if (maxMsgs > 0) --maxMsgs;
 				}
+
+				/* If there is more to read, make sure dispatching from all channels reads it too. */
+				if (pReactorChannel->readRet > 0 && pReactorChannel->reactorParentQueue == &pReactorImpl->activeChannels)
+					_reactorSetChannelReady(pReactorImpl, pReactorChannel);
+
+				if (busyPoll && !dispatched && pReactorChannel->reactorParentQueue == &pReactorImpl->activeChannels
+						&& (pReactorImpl->lastRecordedTimeMs - pReactorChannel->lastPingReadMs) > pReactorChannel->reactorChannel.pRsslChannel->pingTimeout * 1000)
+				{
+					/* Nothing was read; check the ping timeout here since the channel is never considered idle when busy-polling. */
+					rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Channel ping timeout expired.");
+					if (_reactorHandleChannelDown(pReactorImpl, pReactorChannel, pError) != RSSL_RET_SUCCESS)
+					{
+						_reactorShutdown(pReactorImpl, pError);
+						_reactorSendShutdownEvent(pReactorImpl, pError);
+						return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+					}
+				}
 			}
 			/* If not triggered to read, check if this channel has passed its ping timeout without sending either a ping or some data. */
 			else if ((pReactorImpl->lastRecordedTimeMs - pReactorChannel->lastPingReadMs) > pReactorChannel->reactorChannel.pRsslChannel->pingTimeout * 1000)
@@ -1118,6 +1376,13 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 			else
 				channelsToCheck = 0;
 
+			if (_reactorUpdateBusyPoll(pReactorImpl, busyPoll, dispatched, pError) != RSSL_RET_SUCCESS)
+			{
+				_reactorShutdown(pReactorImpl, pError);
+				_reactorSendShutdownEvent(pReactorImpl, pError);
+				return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+			}
+
 			return (reactorUnlockInterface(pReactorImpl), channelsToCheck);
 		}
 		
@@ -1131,7 +1396,7 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 RSSL_VA_API RsslRet rsslReactorSubmit(RsslReactor *pReactor, RsslReactorChannel *pChannel, RsslBuffer *buffer, RsslReactorSubmitOptions *pSubmitOptions, RsslErrorInfo *pError)
 {
 	RsslRet ret;
-	RsslReactorImpl *pReactorImpl = (RsslReactorImpl*)pReactor;
+	RsslReactorImpl *pReactorImpl = rsslReactorGetChannelShard(pReactor, pChannel);
 	RsslReactorChannelImpl *pReactorChannel = (RsslReactorChannelImpl*)pChannel;
 	RsslUInt32 dummyBytesWritten, dummyUncompBytesWritten;
 
@@ -1145,13 +1410,13 @@ RSSL_VA_API RsslRet rsslReactorSubmit(RsslReactor *pReactor, RsslReactorChannel
 	if (pReactorImpl->state != RSSL_REACTOR_ST_ACTIVE)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Reactor is shutting down.");
-		return (reactorUnlockInterface((RsslReactorImpl*)pReactor), RSSL_RET_FAILURE);
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
 	}
 
 	if (pReactorChannel->reactorParentQueue != &pReactorImpl->activeChannels)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Channel is not active.");
-		return (reactorUnlockInterface((RsslReactorImpl*)pReactor), RSSL_RET_FAILURE);
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
 	}
 
 
@@ -1159,7 +1424,7 @@ RSSL_VA_API RsslRet rsslReactorSubmit(RsslReactor *pReactor, RsslReactorChannel
 			&& pReactorChannel->channelRole.ommConsumerRole.watchlistOptions.enableWatchlist)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "rsslReactorSubmit may not be used when watchlist is enabled.");
-		return (reactorUnlockInterface((RsslReactorImpl*)pReactor), RSSL_RET_INVALID_ARGUMENT);
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
 	}
 	
 	/* Write message */
@@ -1179,6 +1444,7 @@ RSSL_VA_API RsslRet rsslReactorSubmit(RsslReactor *pReactor, RsslReactorChannel
 				/* rsslWrite has the message, but attempted to flush and failed.  This is okay, just need to keep flushing. */
 				ret = RSSL_RET_SUCCESS;
 				pReactorChannel->writeRet = 1;
+				++pReactorChannel->unflushedMsgs;
 				break;
 			case RSSL_RET_WRITE_CALL_AGAIN:
 				/* The message is a fragmented message and was only partially written because there were not enough output buffers in RSSL to send it.
@@ -1196,6 +1462,7 @@ RSSL_VA_API RsslRet rsslReactorSubmit(RsslReactor *pReactor, RsslReactorChannel
 	{
 		/* The message was written to RSSL but has not yet been fully written to the network.  Flushing is needed to complete sending. */
 		pReactorChannel->writeRet = ret;
+		++pReactorChannel->unflushedMsgs;
 		ret = RSSL_RET_SUCCESS;
 	}
 
@@ -1205,7 +1472,7 @@ RSSL_VA_API RsslRet rsslReactorSubmit(RsslReactor *pReactor, RsslReactorChannel
 		return (reactorUnlockInterface(pReactorImpl), ret);
 	}
 
-	return (reactorUnlockInterface((RsslReactorImpl*)pReactor), ret);
+	return (reactorUnlockInterface(pReactorImpl), ret);
 
 }
 
@@ -1230,7 +1497,7 @@ RsslUInt32 _reactorMsgEncodedSize(RsslMsg *pMsg)
 
 RSSL_VA_API RsslRet rsslReactorSubmitMsg(RsslReactor *pReactor, RsslReactorChannel *pChannel, RsslReactorSubmitMsgOptions *pOptions, RsslErrorInfo *pError)
 {
-	RsslReactorImpl *pReactorImpl = (RsslReactorImpl*)pReactor;
+	RsslReactorImpl *pReactorImpl = rsslReactorGetChannelShard(pReactor, pChannel);
 	RsslReactorChannelImpl *pReactorChannel = (RsslReactorChannelImpl*)pChannel;
 	RsslRet ret;
 
@@ -1245,7 +1512,7 @@ RSSL_VA_API RsslRet rsslReactorSubmitMsg(RsslReactor *pReactor, RsslReactorChann
 	if (pReactorImpl->state != RSSL_REACTOR_ST_ACTIVE)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Reactor is shutting down.");
-		return (reactorUnlockInterface((RsslReactorImpl*)pReactor), RSSL_RET_FAILURE);
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
 	}
 
 	if (pReactorChannel->pWatchlist)
@@ -1258,11 +1525,14 @@ RSSL_VA_API RsslRet rsslReactorSubmitMsg(RsslReactor *pReactor, RsslReactorChann
 		processOpts.pRdmMsg = pOptions->pRDMMsg;
 		processOpts.pServiceName = pOptions->pServiceName;
 		processOpts.pUserSpec = pOptions->requestMsgOptions.pUserSpec;
+		processOpts.critical = pOptions->requestMsgOptions.critical;
+		processOpts.conflateUpdates = pOptions->requestMsgOptions.conflateUpdates;
+		processOpts.conflationInterval = pOptions->requestMsgOptions.conflationInterval;
 		processOpts.majorVersion = pOptions->majorVersion;
 		processOpts.minorVersion = pOptions->minorVersion;
 
 		ret = _reactorSubmitWatchlistMsg(pReactorImpl, pReactorChannel, &processOpts, pError);
-		return (reactorUnlockInterface((RsslReactorImpl*)pReactor), ret);
+		return (reactorUnlockInterface(pReactorImpl), ret);
 
 	}
 	else
@@ -1274,13 +1544,13 @@ RSSL_VA_API RsslRet rsslReactorSubmitMsg(RsslReactor *pReactor, RsslReactorChann
 		if (pReactorChannel->reactorParentQueue != &pReactorImpl->activeChannels)
 		{
 			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Channel is not active.");
-			return (reactorUnlockInterface((RsslReactorImpl*)pReactor), RSSL_RET_FAILURE);
+			return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
 		}
 
 		if (pReactorChannel->pWriteCallAgainBuffer)
 		{
 			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_BUFFER_NO_BUFFERS, __FILE__, __LINE__, "Writing of fragmented buffer still in progress.");
-			return (reactorUnlockInterface((RsslReactorImpl*)pReactor), RSSL_RET_BUFFER_NO_BUFFERS);
+			return (reactorUnlockInterface(pReactorImpl), RSSL_RET_BUFFER_NO_BUFFERS);
 		}
 
 		if (pOptions->pRsslMsg)
@@ -1298,7 +1568,7 @@ RSSL_VA_API RsslRet rsslReactorSubmitMsg(RsslReactor *pReactor, RsslReactorChann
 								&pError->rsslError)))
 				{
 					rsslSetErrorInfoLocation(pError, __FILE__, __LINE__);
-					return (reactorUnlockInterface((RsslReactorImpl*)pReactor), pError->rsslError.rsslErrorId);
+					return (reactorUnlockInterface(pReactorImpl), pError->rsslError.rsslErrorId);
 				}
 
 				rsslClearEncodeIterator(&encodeIter);
@@ -1320,7 +1590,7 @@ RSSL_VA_API RsslRet rsslReactorSubmitMsg(RsslReactor *pReactor, RsslReactorChann
 					default:
 					{
 						rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, ret, __FILE__, __LINE__, "Message encoding failure.");
-						return (reactorUnlockInterface((RsslReactorImpl*)pReactor), ret);
+						return (reactorUnlockInterface(pReactorImpl), ret);
 					}
 				}
 
@@ -1328,20 +1598,20 @@ RSSL_VA_API RsslRet rsslReactorSubmitMsg(RsslReactor *pReactor, RsslReactorChann
 
 			pWriteBuffer->length = rsslGetEncodedBufferLength(&encodeIter);
 
-			ret = _reactorSubmit((RsslReactorImpl*)pReactor, pReactorChannel, 
+			ret = _reactorSubmit(pReactorImpl, pReactorChannel, 
 					pWriteBuffer, pError);
-			return (reactorUnlockInterface((RsslReactorImpl*)pReactor), ret);
+			return (reactorUnlockInterface(pReactorImpl), ret);
 
 		}
 		else if (pOptions->pRDMMsg)
 		{
 			ret = _reactorSendRDMMessage(pReactorImpl, pReactorChannel, pOptions->pRDMMsg, pError);
-			return (reactorUnlockInterface((RsslReactorImpl*)pReactor), ret);
+			return (reactorUnlockInterface(pReactorImpl), ret);
 		}
 		else
 		{
 			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "No message or buffer provided.");
-			return (reactorUnlockInterface((RsslReactorImpl*)pReactor), RSSL_RET_INVALID_ARGUMENT);
+			return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
 		}
 	}
 
@@ -1376,7 +1646,7 @@ static RsslRet _reactorSendRDMMessage(RsslReactorImpl *pReactorImpl, RsslReactor
 
 		if (pReactorChannel->pWatchlist->state & RSSLWL_STF_NEED_FLUSH) 
 		{
-			pReactorChannel->writeRet = 1;
+			_reactorTakeWatchlistWrites(pReactorChannel);
 			return _reactorSendFlushRequest(pReactorImpl, pReactorChannel, pError);
 		}
 
@@ -1532,7 +1802,7 @@ static RsslRet _reactorDispatchWatchlist(RsslReactorImpl *pReactorImpl, RsslReac
 
 		if (pReactorChannel->pWatchlist->state & RSSLWL_STF_NEED_FLUSH) 
 		{
-			pReactorChannel->writeRet = 1;
+			_reactorTakeWatchlistWrites(pReactorChannel);
 			return _reactorSendFlushRequest(pReactorImpl, pReactorChannel, pError);
 		}
 		else if (ret > RSSL_RET_SUCCESS && !pReactorChannel->wlDispatchEventQueued)
@@ -1566,7 +1836,7 @@ static RsslRet _reactorReadWatchlistMsg(RsslReactorImpl *pReactorImpl, RsslReact
 
 	if (pReactorChannel->pWatchlist->state & RSSLWL_STF_NEED_FLUSH) 
 	{
-		pReactorChannel->writeRet = 1;
+		_reactorTakeWatchlistWrites(pReactorChannel);
 		ret =  _reactorSendFlushRequest(pReactorImpl, pReactorChannel, pError);
 		if (ret < RSSL_RET_SUCCESS)
 			return ret;
@@ -1608,7 +1878,7 @@ static RsslRet _reactorSubmitWatchlistMsg(RsslReactorImpl *pReactorImpl, RsslRea
 
 	if (pReactorChannel->pWatchlist->state & RSSLWL_STF_NEED_FLUSH) 
 	{
-		pReactorChannel->writeRet = 1;
+		_reactorTakeWatchlistWrites(pReactorChannel);
 		ret =  _reactorSendFlushRequest(pReactorImpl, pReactorChannel, pError);
 		if (ret < RSSL_RET_SUCCESS)
 			return ret;
@@ -1633,9 +1903,70 @@ static RsslRet _reactorSubmitWatchlistMsg(RsslReactorImpl *pReactorImpl, RsslRea
 	return RSSL_RET_SUCCESS;
 }
 
+RSSL_VA_API RsslRet rsslReactorGetChannelFlushStats(RsslReactor *pReactor, RsslReactorChannel *pChannel, RsslReactorChannelFlushStats *pStats, RsslErrorInfo *pError)
+{
+	RsslReactorImpl *pReactorImpl = rsslReactorGetChannelShard(pReactor, pChannel);
+	RsslReactorChannelImpl *pReactorChannel;
+	RsslRet ret;
+
+	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
+		return ret;
+
+	pReactorChannel = (RsslReactorChannelImpl*)pChannel;
+
+	if (!pReactorChannel || !pStats || !rsslReactorChannelIsValid(pReactorImpl, pReactorChannel, pError))
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Invalid argument");
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
+	}
+
+	pStats->flushRequests = pReactorChannel->flushRequests;
+	pStats->highWaterMarkFlushes = pReactorChannel->highWaterMarkFlushes;
+	pStats->coalescedMsgs = pReactorChannel->coalescedMsgs;
+
+	/* Kept by the worker thread, so these may be slightly behind. */
+	pStats->flushCalls = *(volatile RsslUInt64*)&pReactorChannel->flushCalls;
+	pStats->deadlineFlushes = *(volatile RsslUInt64*)&pReactorChannel->deadlineFlushes;
+
+	return (reactorUnlockInterface(pReactorImpl), RSSL_RET_SUCCESS);
+}
+
+RSSL_VA_API RsslRet rsslReactorGetChannelRequestPacingStats(RsslReactor *pReactor, RsslReactorChannel *pChannel, RsslReactorChannelRequestPacingStats *pStats, RsslErrorInfo *pError)
+{
+	RsslReactorImpl *pReactorImpl = rsslReactorGetChannelShard(pReactor, pChannel);
+	RsslReactorChannelImpl *pReactorChannel;
+	RsslWatchlistPacingStats wlStats;
+	RsslRet ret;
+
+	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
+		return ret;
+
+	pReactorChannel = (RsslReactorChannelImpl*)pChannel;
+
+	if (!pReactorChannel || !pStats || !rsslReactorChannelIsValid(pReactorImpl, pReactorChannel, pError))
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Invalid argument");
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
+	}
+
+	rsslClearReactorChannelRequestPacingStats(pStats);
+
+	if (pReactorChannel->pWatchlist)
+	{
+		rsslWatchlistGetPacingStats(pReactorChannel->pWatchlist, &wlStats);
+		pStats->itemRequestRate = wlStats.itemRequestRate;
+		pStats->pendingRequests = wlStats.pendingRequests;
+		pStats->pendingCriticalRequests = wlStats.pendingCriticalRequests;
+		pStats->pacedRequestsSent = wlStats.pacedRequestsSent;
+		pStats->estimatedTimeRemaining = wlStats.estimatedTimeRemaining;
+	}
+
+	return (reactorUnlockInterface(pReactorImpl), RSSL_RET_SUCCESS);
+}
+
 RSSL_VA_API RsslRet rsslReactorCloseChannel(RsslReactor *pReactor, RsslReactorChannel *pChannel, RsslErrorInfo *pError)
 {
-	RsslReactorImpl *pReactorImpl = (RsslReactorImpl*)pReactor;
+	RsslReactorImpl *pReactorImpl = rsslReactorGetChannelShard(pReactor, pChannel);
 	RsslReactorChannelImpl *pReactorChannel;
 	RsslRet ret;
 
@@ -1670,6 +2001,9 @@ RSSL_VA_API RsslRet rsslReactorCloseChannel(RsslReactor *pReactor, RsslReactorCh
 
 		_reactorMoveChannel(&pReactorImpl->closingChannels, pReactorChannel);
 
+		/* The worker releases the channel's read buffers when it closes the channel. */
+		rsslReactorChannelClearReadBatch(pReactorChannel);
+
 		/* Send request to worker to close this channel */
 		rsslClearReactorChannelEventImpl(pEvent);
 		pEvent->channelEvent.channelEventType = (RsslReactorChannelEventType)RSSL_RCIMPL_CET_CLOSE_CHANNEL;
@@ -1720,7 +2054,7 @@ static RsslRet _reactorHandleTunnelManagerEvents(RsslReactorImpl *pReactorImpl,
 	/* If watchlist is on, messages may have gone through it so check if a flush is needed. */
 	if (pReactorChannel->pWatchlist && pReactorChannel->pWatchlist->state & RSSLWL_STF_NEED_FLUSH)
 	{
-		pReactorChannel->writeRet = 1;
+		_reactorTakeWatchlistWrites(pReactorChannel);
 		return _reactorSendFlushRequest(pReactorImpl, pReactorChannel, pError);
 	}
 
@@ -1772,6 +2106,8 @@ static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, Rss
 						case RSSL_RCIMPL_FET_FLUSH_DONE:
 							/* Worker thread has finished flushing for this channel. */
 							pReactorChannel->requestedFlush = RSSL_FALSE; /* Flushing is complete and no more is needed. */
+							pReactorChannel->flushNowRequested = RSSL_FALSE;
+							pReactorChannel->flushPendingMsgs = 0;
 
 							if (pReactorChannel->pWriteCallAgainBuffer)
 							{
@@ -1858,6 +2194,7 @@ static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, Rss
 
 							_reactorMoveChannel(&pReactorImpl->activeChannels, pReactorChannel);
 							pReactorChannel->lastPingReadMs = pReactorImpl->lastRecordedTimeMs;
+							_reactorArmPingReadTimer(pReactorImpl, pReactorChannel);
 
 							/* Notify application */
 							_reactorSetInCallback(pReactorImpl, RSSL_TRUE);
@@ -2054,7 +2391,7 @@ static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, Rss
 
 				if (pReactorChannel->pWatchlist->state & RSSLWL_STF_NEED_FLUSH)
 				{
-					pReactorChannel->writeRet = 1;
+					_reactorTakeWatchlistWrites(pReactorChannel);
 					return _reactorSendFlushRequest(pReactorImpl, pReactorChannel, pError);
 				}
 			}
@@ -2073,6 +2410,35 @@ static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, Rss
 	}
 }
 
+static RsslRet _reactorUpdateBusyPoll(RsslReactorImpl *pReactorImpl, RsslBool busyPoll, RsslBool dispatched, RsslErrorInfo *pError)
+{
+	if (!pReactorImpl->busyPollDispatch || pReactorImpl->busyPollIdleSpinLimit == 0)
+		return RSSL_RET_SUCCESS;
+
+	if (dispatched)
+	{
+		pReactorImpl->busyPollIdleSpinCount = 0;
+
+		/* Activity resumed while using the notifier; go back to busy-polling. */
+		if (!busyPoll && rsslReactorEventQueueGroupSetSignalEnabled(&pReactorImpl->activeEventQueueGroup, RSSL_FALSE) != RSSL_RET_SUCCESS)
+		{
+			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to reset event queue group signal.");
+			return RSSL_RET_FAILURE;
+		}
+	}
+	else if (busyPoll && ++pReactorImpl->busyPollIdleSpinCount == pReactorImpl->busyPollIdleSpinLimit)
+	{
+		/* Idle for too long; fall back to the notifier so the application can wait on the reactor's descriptor. */
+		if (rsslReactorEventQueueGroupSetSignalEnabled(&pReactorImpl->activeEventQueueGroup, RSSL_TRUE) != RSSL_RET_SUCCESS)
+		{
+			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to set event queue group signal.");
+			return RSSL_RET_FAILURE;
+		}
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
 static RsslRet _reactorEncodeRDMAsRsslMsg(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslRDMMsg *pRdmMsg, RsslMsg *pRsslMsg,
 		RsslErrorInfo *pErrorInfo)
 {
@@ -2926,6 +3292,53 @@ static RsslRet _reactorWatchlistMsgCallback(RsslWatchlist *pWatchlist, RsslWatch
 
 }
 
+/* Returns the next message read from the channel, in the same manner as rsslReadEx().
+ * Messages are read from the transport in batches with rsslReadMany(), so that the channel is
+ * locked once per batch rather than once per message. */
+static RsslBuffer *_reactorReadFromChannel(RsslReactorChannelImpl *pReactorChannel, RsslReadOutArgs *pReadOutArgs, RsslRet *pRet, RsslError *pError)
+{
+	if (pReactorChannel->readBatchIndex == pReactorChannel->readBatchCount)
+	{
+		if (pReactorChannel->readBatchRetPending)
+		{
+			/* Report the code that ended the previous batch. */
+			pReactorChannel->readBatchRetPending = RSSL_FALSE;
+			*pReadOutArgs = pReactorChannel->readBatchOutArgs;
+			*pRet = pReactorChannel->readBatchRet;
+			return NULL;
+		}
+
+		rsslClearReadOutArgs(&pReactorChannel->readBatchOutArgs);
+		pReactorChannel->readBatchIndex = 0;
+		pReactorChannel->readBatchCount = rsslReadMany(pReactorChannel->reactorChannel.pRsslChannel, pReactorChannel->readBatch,
+				RSSL_REACTOR_READ_BATCH_SIZE, &pReactorChannel->readBatchOutArgs, &pReactorChannel->readBatchRet, pError);
+
+		if (pReactorChannel->readBatchCount == 0)
+		{
+			*pReadOutArgs = pReactorChannel->readBatchOutArgs;
+			*pRet = pReactorChannel->readBatchRet;
+			return NULL;
+		}
+	}
+
+	*pReadOutArgs = pReactorChannel->readBatchOutArgs;
+
+	if (++pReactorChannel->readBatchIndex < pReactorChannel->readBatchCount)
+		*pRet = 1;
+	else if (pReactorChannel->readBatchRet == RSSL_RET_READ_WOULD_BLOCK)
+		*pRet = RSSL_RET_SUCCESS;
+	else if (pReactorChannel->readBatchRet < 0)
+	{
+		/* Dispatch the message first, then report the code on the next call. */
+		pReactorChannel->readBatchRetPending = RSSL_TRUE;
+		*pRet = 1;
+	}
+	else
+		*pRet = pReactorChannel->readBatchRet;
+
+	return &pReactorChannel->readBatch[pReactorChannel->readBatchIndex - 1];
+}
+
 static RsslRet _reactorDispatchFromChannel(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslErrorInfo *pError)
 {
 	RsslRet ret;
@@ -2933,12 +3346,9 @@ static RsslRet _reactorDispatchFromChannel(RsslReactorImpl *pReactorImpl, RsslRe
 	RsslChannel *pChannel = pReactorChannel->reactorChannel.pRsslChannel;
 	RsslReactorCallbackRet cret;
 
-	RsslReadInArgs	readInArgs;
 	RsslReadOutArgs	readOutArgs;
 
-	rsslClearReadInArgs(&readInArgs);
-	rsslClearReadOutArgs(&readOutArgs);
-	pMsgBuf = rsslReadEx(pChannel, &readInArgs, &readOutArgs, &ret, &pError->rsslError);
+	pMsgBuf = _reactorReadFromChannel(pReactorChannel, &readOutArgs, &ret, &pError->rsslError);
 	pReactorChannel->readRet = ret;
 
 	if (pMsgBuf)
@@ -3056,11 +3466,12 @@ static RsslRet _reactorDispatchFromChannel(RsslReactorImpl *pReactorImpl, RsslRe
 			case RSSL_RET_READ_WOULD_BLOCK:
 				/* Clear descriptor so that we will ignore this channel until the next notification call */
 				rsslNotifierEventClearNotifiedFlags(pReactorChannel->pNotifierEvent);
-				pReactorChannel->readRet = 0;
+				/* readRet is left as RSSL_RET_READ_WOULD_BLOCK, so that rsslReactorDispatch can tell nothing was read. */
 				return RSSL_RET_SUCCESS;
 			case RSSL_RET_READ_FD_CHANGE:
 				{
 					RsslReactorEventImpl rsslEvent;
+					RsslReactorChannelEventImpl *pWorkerEvent;
 
 					/* Descriptor changed, update notification. */
 					if (rsslNotifierUpdateEventFd(pReactorImpl->pNotifier, pReactorChannel->pNotifierEvent, (int)(pChannel->socketId)) < 0)
@@ -3080,6 +3491,15 @@ static RsslRet _reactorDispatchFromChannel(RsslReactorImpl *pReactorImpl, RsslRe
 					pReactorChannel->reactorChannel.socketId = pChannel->socketId;
 					pReactorChannel->reactorChannel.oldSocketId = pChannel->oldSocketId;
 
+					/* Have the worker watch the new descriptor. An epoll notifier does not report the old one as bad 
+					 * once it is closed, so the worker cannot rely on noticing the change itself. */
+					pWorkerEvent = (RsslReactorChannelEventImpl*)rsslReactorEventQueueGetFromPool(&pReactorImpl->reactorWorker.workerQueue);
+					rsslClearReactorChannelEventImpl(pWorkerEvent);
+					pWorkerEvent->channelEvent.channelEventType = (RsslReactorChannelEventType)RSSL_RCIMPL_CET_FD_CHANGE;
+					pWorkerEvent->channelEvent.pReactorChannel = (RsslReactorChannel*)pReactorChannel;
+					if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(&pReactorImpl->reactorWorker.workerQueue, (RsslReactorEventImpl*)pWorkerEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, pError))
+						return RSSL_RET_FAILURE;
+
 					/* Inform client of change */
 					rsslClearReactorChannelEventImpl(&rsslEvent.channelEventImpl);
 					rsslEvent.channelEventImpl.channelEvent.channelEventType = RSSL_RC_CET_FD_CHANGE;
@@ -47,6 +47,18 @@ static void _reactorWorkerCalculateNextTimeout(RsslReactorImpl *pReactorImpl, Rs
 
 static void _reactorWorkerMoveChannel(RsslQueue *pNewList, RsslReactorChannelImpl *pReactorChannel);
 
+/* Arms the timer on which an active channel checks whether it needs to send a ping. */
+static void _reactorWorkerArmPingSendTimer(RsslReactorWorker *pReactorWorker, RsslReactorChannelImpl *pReactorChannel);
+
+/* Arms the timer that expires at an active channel's nextExpireTime, or cancels it if nextExpireTime is unset. */
+static void _reactorWorkerArmExpireTimer(RsslReactorWorker *pReactorWorker, RsslReactorChannelImpl *pReactorChannel);
+
+/* Removes the channel's flush deadline, if it has one. */
+static void _reactorWorkerClearFlushDeadline(RsslReactorWorker *pReactorWorker, RsslReactorChannelImpl *pReactorChannel);
+
+/* Flushes the channels collected in the worker's flush batch and handles each result. */
+static RsslRet _reactorWorkerFlushBatch(RsslReactorImpl *pReactorImpl);
+
 /* Shutdown the worker due to some error. Sends a request to the reactor and waits for response, then shuts down. */
 void _reactorWorkerShutdown(RsslReactorImpl *pReactorImpl, RsslErrorInfo *pErrorInfo);
 
@@ -81,8 +93,11 @@ RsslRet _reactorWorkerStart(RsslReactorImpl *pReactorImpl, RsslCreateReactorOpti
 	rsslInitQueue(&pReactorImpl->reactorWorker.activeChannels);
 	rsslInitQueue(&pReactorImpl->reactorWorker.inactiveChannels);
 	rsslInitQueue(&pReactorImpl->reactorWorker.reconnectingChannels);
+	rsslInitQueue(&pReactorImpl->reactorWorker.flushDeadlineChannels);
 
-	pReactorImpl->reactorWorker.pNotifier = rsslCreateNotifier(1024);
+	wlTimerWheelInit(&pReactorImpl->reactorWorker.timerWheel, getCurrentTimeMs(pReactorImpl->ticksPerMsec));
+
+	pReactorImpl->reactorWorker.pNotifier = rsslCreateNotifierEx(1024, pReactorImpl->notifierType);
 	if (pReactorImpl->reactorWorker.pNotifier == NULL)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to initialize notifier.");
@@ -249,6 +264,10 @@ RsslRet _reactorWorkerProcessChannelUp(RsslReactorImpl *pReactorImpl, RsslReacto
 	_reactorWorkerMoveChannel(&pReactorWorker->activeChannels, pReactorChannel);
 	_reactorWorkerCalculateNextTimeout(pReactorImpl, (RsslUInt32)(pReactorChannel->reactorChannel.pRsslChannel->pingTimeout * 1000 * pingIntervalFactor));
 	pReactorChannel->lastPingSentMs = pReactorWorker->lastRecordedTimeMs;
+	_reactorWorkerArmPingSendTimer(pReactorWorker, pReactorChannel);
+
+	/* Start the channel's watchlist timer, if one was requested before the channel came up. */
+	_reactorWorkerArmExpireTimer(pReactorWorker, pReactorChannel);
 
 	/* Copy RsslChannel parameters */
 	pReactorChannel->reactorChannel.socketId = pReactorChannel->reactorChannel.pRsslChannel->socketId;
@@ -344,8 +363,50 @@ static void _reactorWorkerCalculateNextTimeout(RsslReactorImpl *pReactorImpl, Rs
 		pReactorWorker->sleepTimeMs = newTimeoutMicroSeconds;
 	}
 
+static void _reactorWorkerArmPingSendTimer(RsslReactorWorker *pReactorWorker, RsslReactorChannelImpl *pReactorChannel)
+{
+	/* A ping is needed once more than the ping interval has passed since the channel last sent anything. */
+	RsslInt64 timeoutMs = pReactorChannel->lastPingSentMs + (RsslInt64)(pReactorChannel->reactorChannel.pRsslChannel->pingTimeout * 1000 * pingIntervalFactor) + 1
+		- pReactorWorker->lastRecordedTimeMs;
+
+	wlTimerWheelArm(&pReactorWorker->timerWheel, &pReactorChannel->pingSendTimer, pReactorWorker->lastRecordedTimeMs, 
+			timeoutMs > 0 ? timeoutMs : 0);
+}
+
+static void _reactorWorkerArmExpireTimer(RsslReactorWorker *pReactorWorker, RsslReactorChannelImpl *pReactorChannel)
+{
+	RsslInt64 timeoutMs;
+
+	if (pReactorChannel->nextExpireTime == RCIMPL_TIMER_UNSET)
+	{
+		wlTimerWheelCancel(&pReactorWorker->timerWheel, &pReactorChannel->expireTimer);
+		return;
+	}
+
+	/* The timer has expired once the current time is past nextExpireTime. */
+	timeoutMs = pReactorChannel->nextExpireTime + 1 - pReactorWorker->lastRecordedTimeMs;
+	wlTimerWheelArm(&pReactorWorker->timerWheel, &pReactorChannel->expireTimer, pReactorWorker->lastRecordedTimeMs,
+			timeoutMs > 0 ? timeoutMs : 0);
+}
+
+static void _reactorWorkerClearFlushDeadline(RsslReactorWorker *pReactorWorker, RsslReactorChannelImpl *pReactorChannel)
+{
+	pReactorChannel->flushDeadlineUsec = RCIMPL_TIMER_UNSET;
+	if (rsslQueueLinkInAList(&pReactorChannel->flushDeadlineLink))
+		rsslQueueRemoveLink(&pReactorWorker->flushDeadlineChannels, &pReactorChannel->flushDeadlineLink);
+}
+
 void _reactorWorkerMoveChannel(RsslQueue *pNewList, RsslReactorChannelImpl *pReactorChannel)
 { 
+	RsslReactorWorker *pReactorWorker = &pReactorChannel->pParentReactor->reactorWorker;
+
+	if (pReactorChannel->workerParentList == &pReactorWorker->activeChannels)
+	{
+		/* Channel no longer sends pings or processes timers. */
+		wlTimerWheelCancel(&pReactorWorker->timerWheel, &pReactorChannel->pingSendTimer);
+		wlTimerWheelCancel(&pReactorWorker->timerWheel, &pReactorChannel->expireTimer);
+	}
+
 	if (pReactorChannel->workerParentList)
 	{
 		rsslQueueRemoveLink(pReactorChannel->workerParentList, &pReactorChannel->workerLink);
@@ -353,11 +414,69 @@ void _reactorWorkerMoveChannel(RsslQueue *pNewList, RsslReactorChannelImpl *pRea
 	}
 
 	pReactorChannel->workerParentList = pNewList; 
+	_reactorWorkerClearFlushDeadline(pReactorWorker, pReactorChannel);
 
 	if (pNewList)
 		rsslQueueAddLinkToBack(pNewList, &pReactorChannel->workerLink);
 }
 
+static RsslRet _reactorWorkerFlushBatch(RsslReactorImpl *pReactorImpl)
+{
+	RsslReactorWorker *pReactorWorker = &pReactorImpl->reactorWorker;
+	RsslReactorChannelImpl *pReactorChannel;
+	RsslUInt32 i, count = pReactorWorker->flushBatchCount;
+	RsslRet ret;
+
+	if (count == 0)
+		return RSSL_RET_SUCCESS;
+
+	pReactorWorker->flushBatchCount = 0;
+
+	for (i = 0; i < count; ++i)
+	{
+		pReactorChannel = pReactorWorker->flushBatch[i];
+		pReactorWorker->flushBatchChannels[i] = pReactorChannel->reactorChannel.pRsslChannel;
+		pReactorWorker->flushBatchErrors[i] = &pReactorChannel->channelWorkerCerr.rsslError;
+	}
+
+	/* Channels using io_uring have their writes submitted together. */
+	if ((ret = rsslFlushMany(pReactorWorker->flushBatchChannels, count, pReactorWorker->flushBatchResults, pReactorWorker->flushBatchErrors)) < RSSL_RET_SUCCESS)
+	{
+		rsslSetErrorInfo(&pReactorWorker->workerCerr, RSSL_EIC_FAILURE, ret, __FILE__, __LINE__, 
+				"Failed to flush channels.");
+		return RSSL_RET_FAILURE;
+	}
+
+	for (i = 0; i < count; ++i)
+	{
+		pReactorChannel = pReactorWorker->flushBatch[i];
+		ret = pReactorWorker->flushBatchResults[i];
+
+		++pReactorChannel->flushCalls;
+		pReactorChannel->lastPingSentMs = pReactorWorker->lastRecordedTimeMs;
+
+		if (ret < 0)
+		{
+			rsslSetErrorInfoLocation(&pReactorChannel->channelWorkerCerr, __FILE__, __LINE__);
+			if (_reactorWorkerHandleChannelFailure(pReactorImpl, pReactorChannel, &pReactorChannel->channelWorkerCerr) != RSSL_RET_SUCCESS)
+				return RSSL_RET_FAILURE;
+		}
+		else if (ret == 0)
+		{
+			/* Can stop flushing now */
+			if (rsslNotifierUnregisterWrite(pReactorWorker->pNotifier, pReactorChannel->pWorkerNotifierEvent) < 0)
+			{
+				rsslSetErrorInfo(&pReactorWorker->workerCerr, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+						"Failed to unregister write notification for flushing channel.");
+				return RSSL_RET_FAILURE;
+			}
+			_reactorWorkerSendFlushComplete(pReactorImpl, pReactorChannel);
+		}
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
 RSSL_THREAD_DECLARE(runReactorWorker, pArg)
 {
 	RsslReactorImpl *pReactorImpl = (RsslReactorImpl*)pArg;
@@ -371,8 +490,22 @@ RSSL_THREAD_DECLARE(runReactorWorker, pArg)
 		RsslRet ret;
 		RsslReactorChannelImpl *pReactorChannel;
 		RsslQueueLink *pLink;
+		RsslInt64 currentTimeUsec = 0;
+		RsslInt64 nextExpireTime;
+		WlTimer *pTimer;
+		long waitTimeUsec = (long)pReactorWorker->sleepTimeMs * 1000;
+
+		if ((pLink = rsslQueuePeekFront(&pReactorWorker->flushDeadlineChannels)))
+		{
+			/* Wake up in time to flush the channel whose flush delay passes first. */
+			RsslInt64 nextFlushDeadlineUsec = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, flushDeadlineLink, pLink)->flushDeadlineUsec;
 
-		ret = rsslNotifierWait(pReactorWorker->pNotifier, pReactorWorker->sleepTimeMs * 1000);
+			currentTimeUsec = getCurrentTimeUsec(pReactorImpl->ticksPerMsec);
+			if (nextFlushDeadlineUsec - currentTimeUsec < waitTimeUsec)
+				waitTimeUsec = (nextFlushDeadlineUsec > currentTimeUsec) ? (long)(nextFlushDeadlineUsec - currentTimeUsec) : 0;
+		}
+
+		ret = rsslNotifierWait(pReactorWorker->pNotifier, waitTimeUsec);
 
 		pReactorWorker->lastRecordedTimeMs = getCurrentTimeMs(pReactorImpl->ticksPerMsec);
 
@@ -388,6 +521,11 @@ RSSL_THREAD_DECLARE(runReactorWorker, pArg)
 				if (object == &pReactorWorker->workerQueue)
 				{
 					RsslReactorEventImpl *pEvent;
+
+					/* Events may change the state of channels waiting in the flush batch. */
+					if (_reactorWorkerFlushBatch(pReactorImpl) != RSSL_RET_SUCCESS)
+						return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
+
 					/* Message in event queue */
 					if ((pEvent = rsslReactorEventQueueGet(pEventQueue, &ret)))
 					{
@@ -473,6 +611,21 @@ RSSL_THREAD_DECLARE(runReactorWorker, pArg)
 												break;
 
 											}
+										case RSSL_RCIMPL_CET_FD_CHANGE:
+											{
+												/* Reactor thread received an FD_CHANGE return from rsslRead. Watch the new descriptor. */
+												if (pReactorChannel->workerParentList == &pReactorWorker->activeChannels 
+														&& pReactorChannel->reactorChannel.pRsslChannel != NULL)
+												{
+													if (rsslNotifierUpdateEventFd(pReactorWorker->pNotifier, pReactorChannel->pWorkerNotifierEvent, (int)pReactorChannel->reactorChannel.pRsslChannel->socketId) < 0)
+													{
+														rsslSetErrorInfo(&pReactorWorker->workerCerr, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+																"Failed to update file descriptor for channel.");
+														return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
+													}
+												}
+												break;
+											}
 										case RSSL_RCIMPL_CET_CLOSE_CHANNEL:
 											{
 												RsslReactorChannelEventImpl *pEvent = (RsslReactorChannelEventImpl*)rsslReactorEventQueueGetFromPool(&pReactorChannel->eventQueue);
@@ -535,9 +688,22 @@ RSSL_THREAD_DECLARE(runReactorWorker, pArg)
 									switch(pFlushEvent->flushEventType)
 									{
 										case RSSL_RCIMPL_FET_START_FLUSH:
+										case RSSL_RCIMPL_FET_FLUSH_NOW:
 											pReactorChannel = (RsslReactorChannelImpl*)pFlushEvent->pReactorChannel;
 											if (pReactorChannel->reactorChannel.pRsslChannel != NULL && pReactorChannel->reactorChannel.pRsslChannel->socketId != REACTOR_INVALID_SOCKET)
 											{
+												if (pFlushEvent->flushEventType == RSSL_RCIMPL_FET_START_FLUSH && pReactorImpl->flushDelayUsec)
+												{
+													/* Wait for more messages before flushing; the deadline is checked after processing events. */
+													if (pReactorChannel->flushDeadlineUsec == RCIMPL_TIMER_UNSET)
+													{
+														pReactorChannel->flushDeadlineUsec = getCurrentTimeUsec(pReactorImpl->ticksPerMsec) + pReactorImpl->flushDelayUsec;
+														rsslQueueAddLinkToBack(&pReactorWorker->flushDeadlineChannels, &pReactorChannel->flushDeadlineLink);
+													}
+													break;
+												}
+
+												_reactorWorkerClearFlushDeadline(pReactorWorker, pReactorChannel);
 												if (rsslNotifierRegisterWrite(pReactorWorker->pNotifier, pReactorChannel->pWorkerNotifierEvent) < 0)
 												{
 													rsslSetErrorInfo(&pReactorWorker->workerCerr, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
@@ -557,7 +723,12 @@ RSSL_THREAD_DECLARE(runReactorWorker, pArg)
 							case RSSL_RCIMPL_ET_TIMER:
 								{
 									RsslReactorTimerEvent *pTimerEvent = &pEvent->timerEvent;
-									((RsslReactorChannelImpl*)pTimerEvent->pReactorChannel)->nextExpireTime = pTimerEvent->expireTime;
+									pReactorChannel = (RsslReactorChannelImpl*)pTimerEvent->pReactorChannel;
+									pReactorChannel->nextExpireTime = pTimerEvent->expireTime;
+
+									/* Channels that are not active yet start the timer when they come up. */
+									if (pReactorChannel->workerParentList == &pReactorWorker->activeChannels)
+										_reactorWorkerArmExpireTimer(pReactorWorker, pReactorChannel);
 									break;
 								}
 
@@ -685,35 +856,21 @@ RSSL_THREAD_DECLARE(runReactorWorker, pArg)
 						if (pReactorChannel->reactorChannel.pRsslChannel->socketId != REACTOR_INVALID_SOCKET &&
 								rsslNotifierEventIsWritable(pNotifierEvent))
 						{
-							/* Flush */
-							ret = rsslFlush(pReactorChannel->reactorChannel.pRsslChannel, &pReactorChannel->channelWorkerCerr.rsslError);
-							pReactorChannel->lastPingSentMs = pReactorWorker->lastRecordedTimeMs;
-
-							if (ret < 0)
-							{
-								rsslSetErrorInfoLocation(&pReactorChannel->channelWorkerCerr, __FILE__, __LINE__);
-								if (_reactorWorkerHandleChannelFailure(pReactorImpl, pReactorChannel, &pReactorChannel->channelWorkerCerr) != RSSL_RET_SUCCESS)
-								{
-									return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
-								}
-							}
-							else if (ret == 0)
-							{
-								/* Can stop flushing now */
-								if (rsslNotifierUnregisterWrite(pReactorWorker->pNotifier, pReactorChannel->pWorkerNotifierEvent) < 0)
-								{
-									rsslSetErrorInfo(&pReactorWorker->workerCerr, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
-											"Failed to unregister write notification for flushing channel.");
-									return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
-								}
-								_reactorWorkerSendFlushComplete(pReactorImpl, pReactorChannel);
-							}
+							/* Flushed together with the other writable channels once this pass is done */
+							pReactorWorker->flushBatch[pReactorWorker->flushBatchCount++] = pReactorChannel;
+
+							if (pReactorWorker->flushBatchCount == RSSL_REACTOR_WORKER_FLUSH_BATCH
+									&& _reactorWorkerFlushBatch(pReactorImpl) != RSSL_RET_SUCCESS)
+								return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
 						}
 					}
 					
 				}
 
 			}
+
+			if (_reactorWorkerFlushBatch(pReactorImpl) != RSSL_RET_SUCCESS)
+				return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
 		}
 		else if (ret < 0)
 		{
@@ -745,6 +902,8 @@ RSSL_THREAD_DECLARE(runReactorWorker, pArg)
 		/* Ping/initialization/recovery timeout check */
 
 		pReactorWorker->sleepTimeMs = defaultSelectTimeoutMs;
+		if (pReactorImpl->flushDelayUsec)
+			currentTimeUsec = getCurrentTimeUsec(pReactorImpl->ticksPerMsec);
 
 		/* Check whether the initialization time period has passed. */
 		RSSL_QUEUE_FOR_EACH_LINK(&pReactorWorker->initializingChannels, pLink)
@@ -762,44 +921,71 @@ RSSL_THREAD_DECLARE(runReactorWorker, pArg)
 			}
 		}
 
-		RSSL_QUEUE_FOR_EACH_LINK(&pReactorWorker->activeChannels, pLink)
+		/* Handle the ping and watchlist timers whose time has come, rather than checking every active channel. */
+		while ((pTimer = wlTimerWheelPopExpired(&pReactorWorker->timerWheel, pReactorWorker->lastRecordedTimeMs)))
 		{
-			pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, workerLink, pLink);
-
-			/* Check if the elapsed time is greater than our ping-send interval. */
-			if ((pReactorWorker->lastRecordedTimeMs - pReactorChannel->lastPingSentMs) > pReactorChannel->reactorChannel.pRsslChannel->pingTimeout * 1000 * pingIntervalFactor )
+			switch(pTimer->timerType)
 			{
+				case RSSL_RCIMPL_TMT_PING_SEND:
+					pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, pingSendTimer, pTimer);
 
-				/* If so, send a ping. */
-				ret = rsslPing(pReactorChannel->reactorChannel.pRsslChannel, &pReactorChannel->channelWorkerCerr.rsslError);
-				if (ret < 0)
-				{
-					rsslSetErrorInfoLocation(&pReactorChannel->channelWorkerCerr, __FILE__, __LINE__);
-					if (!RSSL_ERROR_INFO_CHECK(_reactorWorkerHandleChannelFailure(pReactorImpl, pReactorChannel, &pReactorChannel->channelWorkerCerr) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, &pReactorWorker->workerCerr))
-						return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
-				}
-				else
-				{
-					pReactorChannel->lastPingSentMs = pReactorWorker->lastRecordedTimeMs;
-					_reactorWorkerCalculateNextTimeout(pReactorImpl, (RsslUInt32)(pReactorChannel->reactorChannel.pRsslChannel->pingTimeout * 1000 * pingIntervalFactor));
-				}
-			}
-			else
-			{
-				/* Otherwise, figure out when to wake up again. (Ping interval - (current time - time of last ping). */
-				_reactorWorkerCalculateNextTimeout(pReactorImpl, (RsslUInt32)(pReactorChannel->lastPingSentMs + (RsslInt64)(pReactorChannel->reactorChannel.pRsslChannel->pingTimeout * 1000 * pingIntervalFactor) - pReactorWorker->lastRecordedTimeMs));
-			}
+					/* Check if the elapsed time is greater than our ping-send interval. */
+					if ((pReactorWorker->lastRecordedTimeMs - pReactorChannel->lastPingSentMs) > pReactorChannel->reactorChannel.pRsslChannel->pingTimeout * 1000 * pingIntervalFactor )
+					{
+						/* If so, send a ping. */
+						ret = rsslPing(pReactorChannel->reactorChannel.pRsslChannel, &pReactorChannel->channelWorkerCerr.rsslError);
+						if (ret < 0)
+						{
+							rsslSetErrorInfoLocation(&pReactorChannel->channelWorkerCerr, __FILE__, __LINE__);
+							if (!RSSL_ERROR_INFO_CHECK(_reactorWorkerHandleChannelFailure(pReactorImpl, pReactorChannel, &pReactorChannel->channelWorkerCerr) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, &pReactorWorker->workerCerr))
+								return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
+							break;
+						}
 
-			/* Process any channels that are waiting for a timeout. */
-			if (pReactorChannel->nextExpireTime != RCIMPL_TIMER_UNSET)
-			{
-				if (pReactorChannel->nextExpireTime < pReactorWorker->lastRecordedTimeMs)
-				{
+						pReactorChannel->lastPingSentMs = pReactorWorker->lastRecordedTimeMs;
+					}
+
+					/* Otherwise the channel sent something since the timer was armed; wait for the rest of the interval. */
+					_reactorWorkerArmPingSendTimer(pReactorWorker, pReactorChannel);
+					break;
+
+				case RSSL_RCIMPL_TMT_EXPIRE:
 					/* Timer expired for this channel, send event back. */
+					pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, expireTimer, pTimer);
 					_reactorWorkerSendTimerExpired(pReactorImpl, pReactorChannel, pReactorWorker->lastRecordedTimeMs);
-				}
-				else
-					_reactorWorkerCalculateNextTimeout(pReactorImpl, (RsslUInt32)(pReactorChannel->nextExpireTime - pReactorWorker->lastRecordedTimeMs));
+					break;
+
+				default:
+					rsslSetErrorInfo(&pReactorWorker->workerCerr, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Unknown timer type %d", pTimer->timerType);
+					return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
+			}
+		}
+
+		/* Figure out when to wake up for the next timer. */
+		if ((nextExpireTime = wlTimerWheelGetNextExpireTime(&pReactorWorker->timerWheel)) != WL_TIME_UNSET)
+			_reactorWorkerCalculateNextTimeout(pReactorImpl, nextExpireTime > pReactorWorker->lastRecordedTimeMs ? (RsslUInt32)(nextExpireTime - pReactorWorker->lastRecordedTimeMs) : 0);
+
+		/* Start flushing any channels whose flush delay has passed. They are kept in order of deadline, so stop at the first that has
+		 * not passed. */
+		while ((pLink = rsslQueuePeekFront(&pReactorWorker->flushDeadlineChannels)))
+		{
+			pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, flushDeadlineLink, pLink);
+
+			if (pReactorChannel->flushDeadlineUsec > currentTimeUsec)
+				break;
+
+			_reactorWorkerClearFlushDeadline(pReactorWorker, pReactorChannel);
+
+			/* Only active channels are flushed this way; others lose their deadline when they become active. */
+			if (pReactorChannel->workerParentList != &pReactorWorker->activeChannels)
+				continue;
+
+			++pReactorChannel->deadlineFlushes;
+			if (rsslNotifierRegisterWrite(pReactorWorker->pNotifier, pReactorChannel->pWorkerNotifierEvent) < 0)
+			{
+				rsslSetErrorInfo(&pReactorWorker->workerCerr, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+						"Failed to register write notification for flushing channel.");
+				return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
 			}
 		}
 
@@ -12,6 +12,7 @@
 #include "rtr/rsslRDMMsg.h"
 #include "rtr/rsslEventSignal.h"
 #include "rtr/rsslThread.h"
+#include "rtr/rtratomic.h"
 
 #include <stdlib.h>
 
@@ -27,19 +28,54 @@
 extern "C" {
 #endif
 
-/* Event Queue */
+/* Event Queue
+ *
+ * Events are passed between the reactor and its worker thread through these queues. Both threads
+ * may put events into the same queue, but each queue is only read by one thread at a time.
+ *
+ * - The event queue itself is an intrusive multi-producer, single-consumer linked queue. Producers
+ *   add an event with a single atomic exchange of the tail and do not take any lock.
+ * - Free events are kept in a bounded multi-producer, multi-consumer ring. If the ring is empty a
+ *   new event is allocated, and if it is full a returned event is freed.
+ * - Each queue keeps an atomic flag indicating whether it is active. Only the producer that moves
+ *   a queue from inactive to active takes the parent group's lock to add it to the group, so the
+ *   group lock and its eventSignal are only touched when a queue goes from empty to non-empty,
+ *   rather than for every event. */
+
+/* Minimum number of free events each queue can keep in its pool. */
+#define RSSL_REACTOR_EVENT_POOL_MIN_CAPACITY 64
 
 typedef struct _RsslReactorEventQueueGroup RsslReactorEventQueueGroup;
 
+/* RsslReactorEventPoolCell
+ * Cell of the ring holding free events. */
+typedef struct
+{
+	rtr_atomic_val sequence;
+	RsslReactorEventImpl *pEvent;
+} RsslReactorEventPoolCell;
+
 /* RsslReactorEventQueue
  * Queue of RsslReactorEvents */
 typedef struct
 {
-	RsslQueue eventPool;
-	RsslQueue eventQueue;
-	RsslMutex eventPoolLock;
-	RsslMutex eventQueueLock;
+	/* Used by consumer */
+	RsslQueueLink *pHead;
 	RsslReactorEventImpl *pLastEvent;
+	RsslQueueLink stub;		/* Placeholder link; the queue is empty when it is both head and tail. */
+	char _pad0[64];
+
+	/* Used by producers */
+	void *pTail;
+	rtr_atomic_val activeState;	/* 1 if this queue is in (or being added to) its parent group. */
+	char _pad1[64];
+
+	/* Event pool */
+	RsslReactorEventPoolCell *poolCells;
+	rtr_atomic_val poolMask;
+	rtr_atomic_val poolPutPos;
+	char _pad2[64];
+	rtr_atomic_val poolGetPos;
 
 	RsslReactorEventQueueGroup *pParentGroup;
 	RsslQueueLink readyEventQueueLink;
@@ -54,8 +90,30 @@ struct _RsslReactorEventQueueGroup
 	RsslQueue readyEventQueueGroup;
 	RsslMutex lock;
 	RsslEventSignal eventSignal;
+	RsslBool signalEnabled;		/* If RSSL_FALSE, eventSignal is not triggered; the consumer polls rsslReactorEventQueueGroupIsActive() instead. */
 };
 
+/* Volatile accessors for fields shared between threads. */
+RTR_C_INLINE rtr_atomic_val _rsslReactorEventQueueReadVal(rtr_atomic_val *pVal)
+{
+	return *(volatile rtr_atomic_val*)pVal;
+}
+
+RTR_C_INLINE void _rsslReactorEventQueueWriteVal(rtr_atomic_val *pVal, rtr_atomic_val val)
+{
+	*(volatile rtr_atomic_val*)pVal = val;
+}
+
+RTR_C_INLINE RsslQueueLink *_rsslReactorEventQueueReadLink(RsslQueueLink **ppLink)
+{
+	return *(RsslQueueLink * volatile *)ppLink;
+}
+
+RTR_C_INLINE void _rsslReactorEventQueueWriteLink(RsslQueueLink **ppLink, RsslQueueLink *pLink)
+{
+	*(RsslQueueLink * volatile *)ppLink = pLink;
+}
+
 RTR_C_INLINE RsslRet rsslInitReactorEventQueueGroup(RsslReactorEventQueueGroup *pList)
 {
 	if (!rsslInitEventSignal(&pList->eventSignal))
@@ -64,6 +122,7 @@ RTR_C_INLINE RsslRet rsslInitReactorEventQueueGroup(RsslReactorEventQueueGroup *
 	RSSL_MUTEX_INIT(&pList->lock);
 
 	rsslInitQueue(&pList->readyEventQueueGroup);
+	pList->signalEnabled = RSSL_TRUE;
 
 	return RSSL_RET_SUCCESS;
 }
@@ -87,10 +146,63 @@ RTR_C_INLINE int rsslGetEventQueueGroupSignalFD(RsslReactorEventQueueGroup *pQue
 	return rsslGetEventSignalFD(&pQueueList->eventSignal);
 }
 
+/* rsslReactorEventQueueGroupIsActive
+ * Returns whether any queue in the group has events, without taking the lock or checking the eventSignal.
+ * A queue that has just been activated by another thread may not be seen yet. */
+RTR_C_INLINE RsslBool rsslReactorEventQueueGroupIsActive(RsslReactorEventQueueGroup *pQueueList)
+{
+	return *(volatile RsslUInt32*)&pQueueList->readyEventQueueGroup.count > 0;
+}
+
+/* rsslReactorEventQueueGroupSetSignalEnabled
+ * Sets whether the group triggers its eventSignal when it has active queues. When enabling, the signal is
+ * triggered if there are queues already active; when disabling it is reset. */
+RTR_C_INLINE RsslRet rsslReactorEventQueueGroupSetSignalEnabled(RsslReactorEventQueueGroup *pQueueList, RsslBool enabled)
+{
+	int ret = 0;
+
+	RSSL_MUTEX_LOCK(&pQueueList->lock);
+
+	if (pQueueList->signalEnabled != enabled)
+	{
+		pQueueList->signalEnabled = enabled;
+
+		if (rsslQueueGetElementCount(&pQueueList->readyEventQueueGroup) > 0)
+			ret = enabled ? rsslSetEventSignal(&pQueueList->eventSignal) : rsslResetEventSignal(&pQueueList->eventSignal);
+	}
+
+	RSSL_MUTEX_UNLOCK(&pQueueList->lock);
+
+	return ret < 0 ? RSSL_RET_FAILURE : RSSL_RET_SUCCESS;
+}
+
+/* Adds the event queue to its parent's event queue list if it is not already there.
+ * Triggers the event queue list's signal if appropriate. */
+RTR_C_INLINE RsslRet _rsslReactorEventQueueSetActive(RsslReactorEventQueue *pQueue)
+{
+	RSSL_MUTEX_LOCK(&pQueue->pParentGroup->lock);
+
+	if (pQueue->isInActiveEventQueueGroup) return (RSSL_MUTEX_UNLOCK(&pQueue->pParentGroup->lock), RSSL_RET_SUCCESS);
+
+	/* Add to parent list of active queues */
+	rsslQueueAddLinkToBack(&pQueue->pParentGroup->readyEventQueueGroup, &pQueue->readyEventQueueLink);
+	pQueue->isInActiveEventQueueGroup = RSSL_TRUE;
+
+	if (rsslQueueGetElementCount(&pQueue->pParentGroup->readyEventQueueGroup) == 1 && pQueue->pParentGroup->signalEnabled)
+	{
+		/* List was previously empty; Need to trigger queue list descriptor */
+		if (rsslSetEventSignal(&pQueue->pParentGroup->eventSignal) < 0)
+			return (RSSL_MUTEX_UNLOCK(&pQueue->pParentGroup->lock), RSSL_RET_FAILURE);
+	}
+
+	RSSL_MUTEX_UNLOCK(&pQueue->pParentGroup->lock);
+
+	return RSSL_RET_SUCCESS;
+}
 
 /* Removes the event queue from its parent's event queue list if appropriate.
  * Resets the event queue list's signal if appropriate. */
-/* Ownership of pQueue->eventQueueLock is assumed */
+/* Should only be called by the thread consuming from the queue. */
 RTR_C_INLINE RsslRet rsslReactorEventQueueSetInactive(RsslReactorEventQueue *pQueue)
 {
 	RsslUInt32 count;
@@ -99,12 +211,12 @@ RTR_C_INLINE RsslRet rsslReactorEventQueueSetInactive(RsslReactorEventQueue *pQu
 
 	if (!pQueue->isInActiveEventQueueGroup) return (RSSL_MUTEX_UNLOCK(&pQueue->pParentGroup->lock), RSSL_RET_SUCCESS);
 
-	/* Add to parent list of active queues */
+	/* Remove from parent list of active queues */
 	rsslQueueRemoveLink(&pQueue->pParentGroup->readyEventQueueGroup, &pQueue->readyEventQueueLink);
 	pQueue->isInActiveEventQueueGroup = RSSL_FALSE;
 
 	count = rsslQueueGetElementCount(&pQueue->pParentGroup->readyEventQueueGroup);
-	if (count == 0)
+	if (count == 0 && pQueue->pParentGroup->signalEnabled)
 	{
 		/* List is now empty; need to reset queue list descriptor */
 		int ret;
@@ -131,22 +243,154 @@ RTR_C_INLINE RsslRet rsslCleanupReactorEventQueueGroup(RsslReactorEventQueueGrou
 	return RSSL_RET_SUCCESS;
 }
 
+/* Adds a link to the back of the queue. May be called by any thread. */
+RTR_C_INLINE void _rsslReactorEventQueuePushLink(RsslReactorEventQueue *pQueue, RsslQueueLink *pLink)
+{
+	void *pPrevTail;
+
+	_rsslReactorEventQueueWriteLink(&pLink->next, NULL);
+
+	/* Swap in the new tail, then link the previous tail to it. Until the link is made the consumer
+	 * will see the queue as non-empty, but will not be able to get the event yet. */
+	do
+		pPrevTail = *(void * volatile *)&pQueue->pTail;
+	while (RTR_ATOMIC_COMPARE_AND_SWAPPTR(pQueue->pTail, pPrevTail, pLink) != pPrevTail);
+
+	_rsslReactorEventQueueWriteLink(&((RsslQueueLink*)pPrevTail)->next, pLink);
+}
+
+/* Removes a link from the front of the queue. Only called by the consumer. */
+RTR_C_INLINE RsslQueueLink *_rsslReactorEventQueuePopLink(RsslReactorEventQueue *pQueue)
+{
+	RsslQueueLink *pHead = pQueue->pHead;
+	RsslQueueLink *pNext = _rsslReactorEventQueueReadLink(&pHead->next);
+
+	if (pHead == &pQueue->stub)
+	{
+		/* Skip over the placeholder. */
+		if (pNext == NULL)
+			return NULL;
+
+		pQueue->pHead = pHead = pNext;
+		pNext = _rsslReactorEventQueueReadLink(&pHead->next);
+	}
+
+	if (pNext)
+	{
+		pQueue->pHead = pNext;
+		return pHead;
+	}
+
+	/* pHead is the last link. If a producer is in the middle of adding an event, wait for it to finish. */
+	if (*(void * volatile *)&pQueue->pTail != pHead)
+		return NULL;
+
+	/* Put the placeholder back so that pHead can be taken. */
+	_rsslReactorEventQueuePushLink(pQueue, &pQueue->stub);
+
+	pNext = _rsslReactorEventQueueReadLink(&pHead->next);
+	if (pNext)
+	{
+		pQueue->pHead = pNext;
+		return pHead;
+	}
+
+	return NULL;
+}
+
+/* Returns whether the queue has no events, including events still being added. Only called by the consumer. */
+RTR_C_INLINE RsslBool _rsslReactorEventQueueIsEmpty(RsslReactorEventQueue *pQueue)
+{
+	return (pQueue->pHead == &pQueue->stub && *(void * volatile *)&pQueue->pTail == (void*)&pQueue->stub);
+}
+
+/* Places an event in the pool. Returns RSSL_FALSE if the pool is full. */
+RTR_C_INLINE RsslBool _rsslReactorEventPoolPut(RsslReactorEventQueue *pQueue, RsslReactorEventImpl *pEvent)
+{
+	RsslReactorEventPoolCell *pCell;
+	rtr_atomic_val pos = _rsslReactorEventQueueReadVal(&pQueue->poolPutPos);
+
+	while (RSSL_TRUE)
+	{
+		rtr_atomic_val diff;
+
+		pCell = &pQueue->poolCells[pos & pQueue->poolMask];
+		diff = (rtr_atomic_val)((RsslUInt32)_rsslReactorEventQueueReadVal(&pCell->sequence) - (RsslUInt32)pos);
+
+		if (diff == 0)
+		{
+			if (RTR_ATOMIC_COMPARE_AND_SWAP(pQueue->poolPutPos, pos, (rtr_atomic_val)((RsslUInt32)pos + 1)) == pos)
+				break;
+			pos = _rsslReactorEventQueueReadVal(&pQueue->poolPutPos);
+		}
+		else if (diff < 0)
+			return RSSL_FALSE;
+		else
+			pos = _rsslReactorEventQueueReadVal(&pQueue->poolPutPos);
+	}
+
+	*(RsslReactorEventImpl * volatile *)&pCell->pEvent = pEvent;
+	_rsslReactorEventQueueWriteVal(&pCell->sequence, (rtr_atomic_val)((RsslUInt32)pos + 1));
+	return RSSL_TRUE;
+}
+
+/* Takes an event from the pool. Returns NULL if the pool is empty. */
+RTR_C_INLINE RsslReactorEventImpl *_rsslReactorEventPoolGet(RsslReactorEventQueue *pQueue)
+{
+	RsslReactorEventPoolCell *pCell;
+	RsslReactorEventImpl *pEvent;
+	rtr_atomic_val pos = _rsslReactorEventQueueReadVal(&pQueue->poolGetPos);
+
+	while (RSSL_TRUE)
+	{
+		rtr_atomic_val diff;
+
+		pCell = &pQueue->poolCells[pos & pQueue->poolMask];
+		diff = (rtr_atomic_val)((RsslUInt32)_rsslReactorEventQueueReadVal(&pCell->sequence) - ((RsslUInt32)pos + 1));
+
+		if (diff == 0)
+		{
+			if (RTR_ATOMIC_COMPARE_AND_SWAP(pQueue->poolGetPos, pos, (rtr_atomic_val)((RsslUInt32)pos + 1)) == pos)
+				break;
+			pos = _rsslReactorEventQueueReadVal(&pQueue->poolGetPos);
+		}
+		else if (diff < 0)
+			return NULL;
+		else
+			pos = _rsslReactorEventQueueReadVal(&pQueue->poolGetPos);
+	}
+
+	pEvent = *(RsslReactorEventImpl * volatile *)&pCell->pEvent;
+	_rsslReactorEventQueueWriteVal(&pCell->sequence, (rtr_atomic_val)((RsslUInt32)pos + (RsslUInt32)pQueue->poolMask + 1));
+	return pEvent;
+}
+
 /* rsslInitReactorEventQueue 
  * Initializes an RsslReactorEventQueue.
  */
 RTR_C_INLINE RsslRet rsslInitReactorEventQueue(RsslReactorEventQueue *pQueue, int poolSize, RsslReactorEventQueueGroup *pParentGroup)
 {
 	int i;
+	rtr_atomic_val poolCapacity;
 
 	if (!pParentGroup) return RSSL_RET_INVALID_ARGUMENT;
 
 	memset(pQueue, 0, sizeof(RsslReactorEventQueue));
 
-	RSSL_MUTEX_INIT(&pQueue->eventPoolLock);
-	RSSL_MUTEX_INIT(&pQueue->eventQueueLock);
+	pQueue->pHead = &pQueue->stub;
+	pQueue->pTail = &pQueue->stub;
 
-	rsslInitQueue(&pQueue->eventPool);
-	rsslInitQueue(&pQueue->eventQueue);
+	for (poolCapacity = RSSL_REACTOR_EVENT_POOL_MIN_CAPACITY; poolCapacity < poolSize; poolCapacity <<= 1);
+
+	if (!(pQueue->poolCells = (RsslReactorEventPoolCell*)malloc(poolCapacity * sizeof(RsslReactorEventPoolCell))))
+		return RSSL_RET_FAILURE;
+
+	for (i = 0; i < poolCapacity; ++i)
+	{
+		pQueue->poolCells[i].sequence = i;
+		pQueue->poolCells[i].pEvent = NULL;
+	}
+	pQueue->poolMask = poolCapacity - 1;
 
 	pQueue->pParentGroup = pParentGroup;
 
@@ -157,7 +401,7 @@ RTR_C_INLINE RsslRet rsslInitReactorEventQueue(RsslReactorEventQueue *pQueue, in
 		{
 			rsslClearReactorEventImpl(pNewEvent);
 			rsslInitQueueLink(&pNewEvent->base.eventQueueLink);
-			rsslQueueAddLinkToBack(&pQueue->eventPool, &pNewEvent->base.eventQueueLink);
+			_rsslReactorEventPoolPut(pQueue, pNewEvent);
 		}
 	}
 
@@ -171,17 +415,17 @@ RTR_C_INLINE RsslRet rsslCleanupReactorEventQueue(RsslReactorEventQueue *pQueue)
 	RsslQueueLink *pLink;
 	RsslReactorEventImpl *pEvent;
 
-	while ((pLink = rsslQueueRemoveFirstLink(&pQueue->eventQueue)))
+	if (!pQueue->poolCells)
+		return RSSL_RET_SUCCESS;
+
+	while ((pLink = _rsslReactorEventQueuePopLink(pQueue)))
 	{
 		pEvent = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorEventImpl, base.eventQueueLink, pLink);
 		free(pEvent);
 	}
 
-	while ((pLink = rsslQueueRemoveFirstLink(&pQueue->eventPool)))
-	{
-		pEvent = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorEventImpl, base.eventQueueLink, pLink);
+	while ((pEvent = _rsslReactorEventPoolGet(pQueue)))
 		free(pEvent);
-	}
 
 	if (pQueue->pLastEvent)
 	{
@@ -189,8 +433,8 @@ RTR_C_INLINE RsslRet rsslCleanupReactorEventQueue(RsslReactorEventQueue *pQueue)
 		pQueue->pLastEvent = 0;
 	}
 
-	RSSL_MUTEX_DESTROY(&pQueue->eventPoolLock);
-	RSSL_MUTEX_DESTROY(&pQueue->eventQueueLock);
+	free(pQueue->poolCells);
+	pQueue->poolCells = NULL;
 
 	return RSSL_RET_SUCCESS;
 }
@@ -198,12 +442,8 @@ RTR_C_INLINE RsslRet rsslCleanupReactorEventQueue(RsslReactorEventQueue *pQueue)
 RTR_C_INLINE RsslReactorEventImpl *rsslReactorEventQueueGetFromPool(RsslReactorEventQueue *pQueue)
 {
 	RsslReactorEventImpl *pEvent;
-	RsslQueueLink *pLink;
 
-	RSSL_MUTEX_LOCK(&pQueue->eventPoolLock);
-	if ( (pLink = rsslQueueRemoveFirstLink(&pQueue->eventPool)))
-		pEvent = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorEventImpl, base.eventQueueLink, pLink);
-	else
+	if (!(pEvent = _rsslReactorEventPoolGet(pQueue)))
 	{
 		pEvent = (RsslReactorEventImpl*)malloc(sizeof(RsslReactorEventImpl));
 		if (pEvent)
@@ -212,7 +452,6 @@ RTR_C_INLINE RsslReactorEventImpl *rsslReactorEventQueueGetFromPool(RsslReactorE
 			rsslInitQueueLink(&pEvent->base.eventQueueLink);
 		}
 	}
-	RSSL_MUTEX_UNLOCK(&pQueue->eventPoolLock);
 
 	return pEvent;
 }
@@ -221,126 +460,73 @@ RTR_C_INLINE RsslReactorEventImpl *rsslReactorEventQueueGetFromPool(RsslReactorE
 /* This should not be run if the event has alredy been placed into an event queue. */
 RTR_C_INLINE void rsslReactorEventQueueReturnToPool(RsslReactorEventImpl *pEvent, RsslReactorEventQueue *pQueue)
 {
-	RSSL_MUTEX_LOCK(&pQueue->eventPoolLock);
-	rsslQueueAddLinkToBack(&pQueue->eventPool, &pEvent->base.eventQueueLink);
-	RSSL_MUTEX_UNLOCK(&pQueue->eventPoolLock);
+	if (!_rsslReactorEventPoolPut(pQueue, pEvent))
+		free(pEvent);
 }
 
 RTR_C_INLINE RsslRet rsslReactorEventQueuePut(RsslReactorEventQueue *pQueue, RsslReactorEventImpl *pEvent)
 {
-	RsslUInt32 count;
-
-	RSSL_MUTEX_LOCK(&pQueue->eventQueueLock);
-
-	rsslQueueAddLinkToBack(&pQueue->eventQueue, &pEvent->base.eventQueueLink);
-
-	count = rsslQueueGetElementCount(&pQueue->eventQueue);
-	if (count == 1)
-	{
-		/* May need to trigger parent EventQueueGroup */
-		RsslUInt32 count;
+	_rsslReactorEventQueuePushLink(pQueue, &pEvent->base.eventQueueLink);
 
-		RSSL_MUTEX_LOCK(&pQueue->pParentGroup->lock);
-
-		if (pQueue->isInActiveEventQueueGroup) return (RSSL_MUTEX_UNLOCK(&pQueue->pParentGroup->lock), RSSL_RET_SUCCESS);
-
-		/* Add to parent list of active queues */
-		rsslQueueAddLinkToBack(&pQueue->pParentGroup->readyEventQueueGroup, &pQueue->readyEventQueueLink);
-		pQueue->isInActiveEventQueueGroup = RSSL_TRUE;
-
-		count = rsslQueueGetElementCount(&pQueue->pParentGroup->readyEventQueueGroup);
-		if (count == 1)
-		{
-			/* List was previously empty; Need to trigger queue list descriptor */
-			int ret;
-
-			ret = rsslSetEventSignal(&pQueue->pParentGroup->eventSignal); /* Read pointer of event */
-
-			if (ret < 0)
-			{
-				RSSL_MUTEX_UNLOCK(&pQueue->pParentGroup->lock);
-				RSSL_MUTEX_UNLOCK(&pQueue->eventQueueLock);
-				return RSSL_RET_FAILURE;
-			}
-
-		}
-
-		RSSL_MUTEX_UNLOCK(&pQueue->pParentGroup->lock);
-	}
-
-	RSSL_MUTEX_UNLOCK(&pQueue->eventQueueLock);
+	/* If the queue is already active, the consumer will see this event (if the consumer is deactivating
+	 * the queue, it checks the queue again after clearing the flag). Otherwise, activate it. */
+	if (_rsslReactorEventQueueReadVal(&pQueue->activeState) == 0
+			&& RTR_ATOMIC_COMPARE_AND_SWAP(pQueue->activeState, 0, 1) == 0)
+		return _rsslReactorEventQueueSetActive(pQueue);
 
 	return RSSL_RET_SUCCESS;
 }
 
+/* Gets the next event from the queue. The event is valid until the next call to this function for the queue.
+ * On success, pRet is set to 1 if the queue may have more events, or 0 if it is empty. */
 RTR_C_INLINE RsslReactorEventImpl* rsslReactorEventQueueGet(RsslReactorEventQueue *pQueue, RsslRet *pRet)
 {
-	RsslRet count;
 	RsslReactorEventImpl *pEvent;
 	RsslQueueLink *pLink;
 
 	if (pQueue->pLastEvent)
 	{
 		/* Return previous event to pool */
-
-		RSSL_MUTEX_LOCK(&pQueue->eventPoolLock);
-		rsslQueueAddLinkToBack(&pQueue->eventPool, &pQueue->pLastEvent->base.eventQueueLink);
-		RSSL_MUTEX_UNLOCK(&pQueue->eventPoolLock);
-
+		rsslReactorEventQueueReturnToPool(pQueue->pLastEvent, pQueue);
 		pQueue->pLastEvent = 0;
 	}
 
-	RSSL_MUTEX_LOCK(&pQueue->eventQueueLock);
-
-	count = rsslQueueGetElementCount(&pQueue->eventQueue);
+	if ((pLink = _rsslReactorEventQueuePopLink(pQueue)))
+		pEvent = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorEventImpl, base.eventQueueLink, pLink);
+	else
+		pEvent = NULL;
 
-	if(count)
+	if (_rsslReactorEventQueueIsEmpty(pQueue))
 	{
-		pLink = rsslQueueRemoveFirstLink(&pQueue->eventQueue);
-		pEvent = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorEventImpl, base.eventQueueLink, pLink);
-		if (count == 1)
+		/* Queue is empty; remove it from the parent EventQueueGroup. */
+		if (rsslReactorEventQueueSetInactive(pQueue) != RSSL_RET_SUCCESS)
 		{
-			/* May need to reset parent EventQueueGroup. */
+			pQueue->pLastEvent = pEvent;
+			*pRet = RSSL_RET_FAILURE;
+			return NULL;
+		}
 
-			RSSL_MUTEX_LOCK(&pQueue->pParentGroup->lock);
+		RTR_ATOMIC_SET(pQueue->activeState, 0);
 
-			if (pQueue->isInActiveEventQueueGroup) 
+		/* A producer may have added an event before the flag was cleared without activating the queue.
+		 * If so, activate it again. */
+		if (!_rsslReactorEventQueueIsEmpty(pQueue) && RTR_ATOMIC_COMPARE_AND_SWAP(pQueue->activeState, 0, 1) == 0)
+		{
+			if (_rsslReactorEventQueueSetActive(pQueue) != RSSL_RET_SUCCESS)
 			{
-				RsslUInt32 parentQueueCount;
-
-				/* Remove from parent list of active queues */
-				rsslQueueRemoveLink(&pQueue->pParentGroup->readyEventQueueGroup, &pQueue->readyEventQueueLink);
-				pQueue->isInActiveEventQueueGroup = RSSL_FALSE;
-
-				parentQueueCount = rsslQueueGetElementCount(&pQueue->pParentGroup->readyEventQueueGroup);
-				if (parentQueueCount == 0)
-				{
-					/* List is now empty; need to reset queue list descriptor */
-					int ret;
-					ret = rsslResetEventSignal(&pQueue->pParentGroup->eventSignal); /* Read pointer of event */
-
-					if (ret < 0)
-					{
-						RSSL_MUTEX_UNLOCK(&pQueue->pParentGroup->lock);
-						RSSL_MUTEX_UNLOCK(&pQueue->eventQueueLock);
-						*pRet = RSSL_RET_FAILURE;
-						return NULL;
-					}
-				}
+				pQueue->pLastEvent = pEvent;
+				*pRet = RSSL_RET_FAILURE;
+				return NULL;
 			}
-
-			RSSL_MUTEX_UNLOCK(&pQueue->pParentGroup->lock);
+			*pRet = 1;
 		}
-		--count;
+		else
+			*pRet = 0;
 	}
 	else
-		pEvent = NULL;
-
-	RSSL_MUTEX_UNLOCK(&pQueue->eventQueueLock);
-
+		*pRet = 1;
 
 	pQueue->pLastEvent = pEvent;
-	*pRet = count;
 	return pEvent;
 }
 
@@ -37,14 +37,16 @@ typedef enum
 	RSSL_RCIMPL_CET_CLOSE_CHANNEL = -2,
 	RSSL_RCIMPL_CET_CLOSE_CHANNEL_ACK = -3,
 	RSSL_RCIMPL_CET_DISPATCH_WL = -4,
-	RSSL_RCIMPL_CET_DISPATCH_TUNNEL_STREAM = -5
+	RSSL_RCIMPL_CET_DISPATCH_TUNNEL_STREAM = -5,
+	RSSL_RCIMPL_CET_FD_CHANGE = -6				/* Channel's descriptor changed; the worker should watch the new one. */
 } RsslReactorChannelEventImplType;
 
 typedef enum
 {
 	RSSL_RCIMPL_FET_INIT = 0,
 	RSSL_RCIMPL_FET_START_FLUSH = -1,
-	RSSL_RCIMPL_FET_FLUSH_DONE = -2
+	RSSL_RCIMPL_FET_FLUSH_DONE = -2,
+	RSSL_RCIMPL_FET_FLUSH_NOW = -3		/* Flush a channel without waiting for its flush delay(a flush high-water mark was reached) */
 } RsslReactorFlushEventType;
 
 typedef struct
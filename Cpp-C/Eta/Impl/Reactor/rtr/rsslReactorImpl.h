@@ -11,6 +11,7 @@
 #include "rtr/rsslNotifier.h"
 #include "rtr/rsslReactor.h"
 #include "rtr/rsslWatchlist.h"
+#include "rtr/wlTimerWheel.h"
 #include "rtr/rsslReactorEventQueue.h"
 #include "rtr/rsslRDMMsg.h"
 #include "rtr/rsslErrorInfo.h"
@@ -45,6 +46,17 @@ typedef enum
 	RSSL_RC_CHST_RECONNECTING = 6
 } RsslReactorChannelSetupState;
 
+/* Maximum number of messages the reactor reads from a channel with one rsslReadMany() call. */
+#define RSSL_REACTOR_READ_BATCH_SIZE 32
+
+/* Identifies a channel timer in the reactor's or worker's timing wheel. */
+typedef enum
+{
+	RSSL_RCIMPL_TMT_PING_READ	= 1,	/* Ping timeout of an active channel (reactor, pingReadTimer) */
+	RSSL_RCIMPL_TMT_PING_SEND	= 2,	/* Ping interval of an active channel (worker, pingSendTimer) */
+	RSSL_RCIMPL_TMT_EXPIRE		= 3		/* Watchlist timer of an active channel (worker, expireTimer) */
+} RsslReactorChannelTimerType;
+
 /* RsslReactorChannelImpl 
  * - Handles a channel associated with the RsslReactor */
 typedef struct 
@@ -58,12 +70,26 @@ typedef struct
 	/* Reactor side only */
 	RsslQueueLink reactorQueueLink;
 	RsslQueue *reactorParentQueue;
+	RsslQueueLink readyLink;		/* Link for RsslReactorImpl.readyChannels */
 	RsslReactorEventQueue eventQueue;
 	RsslInt64 lastPingReadMs;
+	WlTimer pingReadTimer;			/* Expires when the channel may have passed its ping timeout */
 	RsslNotifierEvent *pNotifierEvent;
 	RsslRet readRet;				/* Last return code from rsslRead on this channel. Helps determine whether data can still be read from this channel. */
+	RsslBuffer readBatch[RSSL_REACTOR_READ_BATCH_SIZE];	/* Messages returned by the last rsslReadMany() call */
+	RsslUInt32 readBatchCount;		/* Number of messages in readBatch */
+	RsslUInt32 readBatchIndex;		/* Next message in readBatch to dispatch */
+	RsslRet readBatchRet;			/* Return code of the last rsslReadMany() call */
+	RsslBool readBatchRetPending;	/* readBatchRet is a code that must still be handled once the batch is dispatched */
+	RsslReadOutArgs readBatchOutArgs;	/* Output arguments of the last rsslReadMany() call */
 	RsslRet writeRet;				/* Last return from rsslWrite() for this channel. Helps determine whether we should request a flush. */
 	RsslBool requestedFlush;		/* Indicates whether flushing is signaled for this channel */
+	RsslBool flushNowRequested;		/* Indicates whether the worker was told to flush immediately, instead of after the flush delay */
+	RsslUInt32 flushPendingMsgs;	/* Messages waiting for the requested flush to complete(used for the message high-water mark) */
+	RsslUInt32 unflushedMsgs;		/* Messages written that need flushing, not yet counted by a flush request */
+	RsslUInt64 flushRequests;		/* Flush statistics kept by the reactor(see RsslReactorChannelFlushStats) */
+	RsslUInt64 highWaterMarkFlushes;
+	RsslUInt64 coalescedMsgs;
 	RsslWatchlist *pWatchlist;
 	RsslBool	wlDispatchEventQueued;
 	RsslBool	tunnelDispatchEventQueued;
@@ -86,6 +112,12 @@ typedef struct
 	RsslInt64 lastRequestedExpireTime;
 	RsslInt64 nextExpireTime;
 	RsslNotifierEvent *pWorkerNotifierEvent;
+	RsslInt64 flushDeadlineUsec;	/* Time at which the worker must start flushing this channel, if flushing is delayed */
+	RsslQueueLink flushDeadlineLink;	/* Link for RsslReactorWorker.flushDeadlineChannels */
+	WlTimer pingSendTimer;			/* Expires when the channel may need to send a ping */
+	WlTimer expireTimer;			/* Expires at nextExpireTime */
+	RsslUInt64 flushCalls;			/* Flush statistics kept by the worker(see RsslReactorChannelFlushStats) */
+	RsslUInt64 deadlineFlushes;
 
 	/* Reconnection logic */
 	RsslInt32 reconnectMinDelay;
@@ -107,6 +139,10 @@ RTR_C_INLINE void rsslClearReactorChannelImpl(RsslReactorImpl *pReactorImpl, Rss
 	pInfo->pParentReactor = pReactorImpl;
 	pInfo->nextExpireTime = RCIMPL_TIMER_UNSET;
 	pInfo->lastRequestedExpireTime = RCIMPL_TIMER_UNSET;
+	pInfo->flushDeadlineUsec = RCIMPL_TIMER_UNSET;
+	wlTimerInit(&pInfo->pingReadTimer, RSSL_RCIMPL_TMT_PING_READ);
+	wlTimerInit(&pInfo->pingSendTimer, RSSL_RCIMPL_TMT_PING_SEND);
+	wlTimerInit(&pInfo->expireTimer, RSSL_RCIMPL_TMT_EXPIRE);
 }
 
 RTR_C_INLINE RsslRet _rsslChannelCopyConnectionList(RsslReactorChannelImpl *pReactorChannel, RsslReactorConnectOptions *pOpts)
@@ -186,13 +222,25 @@ RTR_C_INLINE RsslRet _rsslChannelFreeConnectionList(RsslReactorChannelImpl *pRea
 
 }
 
+/* Discard any messages read from the channel that have not been dispatched yet. */
+RTR_C_INLINE void rsslReactorChannelClearReadBatch(RsslReactorChannelImpl *pReactorChannel)
+{
+	pReactorChannel->readBatchCount = 0;
+	pReactorChannel->readBatchIndex = 0;
+	pReactorChannel->readBatchRetPending = RSSL_FALSE;
+}
+
 /* Reset reactor channel state in response to channel failure. */
 RTR_C_INLINE void rsslResetReactorChannelState(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel)
 {
 	pReactorChannel->requestedFlush = 0;
+	pReactorChannel->flushNowRequested = 0;
+	pReactorChannel->flushPendingMsgs = 0;
+	pReactorChannel->unflushedMsgs = 0;
 	pReactorChannel->channelSetupState = RSSL_RC_CHST_INIT;
 	pReactorChannel->lastPingReadMs = 0;
 	pReactorChannel->readRet = 0;
+	rsslReactorChannelClearReadBatch(pReactorChannel);
 	pReactorChannel->writeRet = 0;
 	pReactorChannel->pWriteCallAgainBuffer = 0;
 }
@@ -209,6 +257,12 @@ RTR_C_INLINE void rsslResetReactorChannel(RsslReactorImpl *pReactorImpl, RsslRea
 	pReactorChannel->workerParentList = 0;
 	pReactorChannel->lastReconnectAttemptMs = 0;
 	pReactorChannel->reconnectAttemptCount = 0;
+	pReactorChannel->flushDeadlineUsec = RCIMPL_TIMER_UNSET;
+	pReactorChannel->flushRequests = 0;
+	pReactorChannel->highWaterMarkFlushes = 0;
+	pReactorChannel->coalescedMsgs = 0;
+	pReactorChannel->flushCalls = 0;
+	pReactorChannel->deadlineFlushes = 0;
 
 	pReactorChannel->connectionListCount = 0;
 	pReactorChannel->connectionListIter = 0;
@@ -235,6 +289,9 @@ RsslRet reactorLockInterface(RsslReactorImpl *pReactorImpl, RsslBool allowedInCa
 /* Unlocks reactor */
 RsslRet reactorUnlockInterface(RsslReactorImpl *pReactorImpl);
 
+/* Most writable channels the worker flushes with one rsslFlushMany() call */
+#define RSSL_REACTOR_WORKER_FLUSH_BATCH 64
+
 /* RsslReactorWorker
  * The reactorWorker handles when to send pings and flushing.
  * Primary responsiblities include:
@@ -258,9 +315,18 @@ typedef struct
 	RsslThreadId thread;
 	RsslReactorEventQueue workerQueue;
 	RsslUInt32 sleepTimeMs; /* Time to sleep when not flushing; should be equivalent to 1/3 of smallest ping timeout. */
+	WlTimerWheel timerWheel;			/* Ping and watchlist timers of active channels */
+	RsslQueue flushDeadlineChannels;	/* Channels waiting for their flush deadline. The flush delay is the same for every channel, so they are in order of deadline. */
 
 	RsslErrorInfo workerCerr;
 	RsslReactorEventQueueGroup activeEventQueueGroup;
+
+	/* Channels found writable in one notification pass, flushed together with rsslFlushMany() */
+	RsslReactorChannelImpl *flushBatch[RSSL_REACTOR_WORKER_FLUSH_BATCH];
+	RsslChannel *flushBatchChannels[RSSL_REACTOR_WORKER_FLUSH_BATCH];
+	RsslError *flushBatchErrors[RSSL_REACTOR_WORKER_FLUSH_BATCH];
+	RsslRet flushBatchResults[RSSL_REACTOR_WORKER_FLUSH_BATCH];
+	RsslUInt32 flushBatchCount;
 } RsslReactorWorker;
 
 typedef enum
@@ -287,6 +353,7 @@ struct _RsslReactorImpl
 	RsslQueue channelPool;				/* Pool of available channel structures */
 	RsslQueue initializingChannels;	/* Channels waiting for worker to initialize */
 	RsslQueue activeChannels;			/* Channels that are active */
+	RsslQueue readyChannels;			/* Active channels that may have something to read */
 	RsslQueue inactiveChannels;			/* Channels that have failed in some way */
 	RsslQueue closingChannels;			/* Waiting for close from worker */
 	RsslQueue reconnectingChannels;		/* Channels that have been closed, but are currently reconnecting */
@@ -301,6 +368,7 @@ struct _RsslReactorImpl
 	RsslBuffer memoryBuffer;
 
 	RsslInt64 lastRecordedTimeMs;
+	WlTimerWheel pingTimerWheel;		/* Ping timeouts of active channels */
 
 	RsslInt32 channelCount;			/* Total number of channels in use. */
 
@@ -315,6 +383,20 @@ struct _RsslReactorImpl
 	RsslReactorState state;
 
 	RsslInt64 ticksPerMsec;
+
+	RsslNotifierType notifierType;	/* Notification mechanism used by the reactor and worker notifiers */
+
+	RsslBool busyPollDispatch;				/* Dispatch reads channels and checks queues directly instead of using the notifier */
+	RsslUInt32 busyPollIdleSpinLimit;		/* Idle dispatch calls before falling back to the notifier (0 for no limit) */
+	RsslUInt32 busyPollIdleSpinCount;		/* Consecutive dispatch calls that found nothing to process */
+
+	RsslReactorImpl **pShards;				/* If sharded, all shards of the reactor; the first is the reactor itself. */
+	RsslUInt32 shardCount;					/* Number of shards in pShards */
+	RsslReactorImpl *pShardParent;			/* If this reactor is a shard(other than the first), the sharded reactor it belongs to. */
+
+	RsslUInt32 flushDelayUsec;				/* Time the worker may wait before flushing a channel(0 to flush immediately) */
+	RsslUInt32 flushHighWaterMarkBytes;		/* Queued bytes at which a channel is flushed without waiting(0 for no limit) */
+	RsslUInt32 flushHighWaterMarkMsgs;		/* Submitted messages at which a channel is flushed without waiting(0 for no limit) */
 };
 
 RTR_C_INLINE void rsslClearReactorImpl(RsslReactorImpl *pReactorImpl)
@@ -322,6 +404,20 @@ RTR_C_INLINE void rsslClearReactorImpl(RsslReactorImpl *pReactorImpl)
 	memset(pReactorImpl, 0, sizeof(RsslReactorImpl));
 }
 
+/* Returns the reactor that handles the given channel. For a sharded reactor this is the shard that owns the channel. */
+RTR_C_INLINE RsslReactorImpl *rsslReactorGetChannelShard(RsslReactor *pReactor, RsslReactorChannel *pChannel)
+{
+	RsslReactorImpl *pReactorImpl = (RsslReactorImpl*)pReactor;
+
+	/* The shard count is kept by the first shard, so read it there when given another shard. */
+	RsslReactorImpl *pShardedReactor = pReactorImpl->pShardParent ? pReactorImpl->pShardParent : pReactorImpl;
+
+	if (pShardedReactor->shardCount > 1 && pChannel != NULL)
+		return ((RsslReactorChannelImpl*)pChannel)->pParentReactor;
+
+	return pReactorImpl;
+}
+
 /* Setup and start the worker thread (Should be called from rsslCreateReactor) */
 RsslRet _reactorWorkerStart(RsslReactorImpl *pReactorImpl, RsslCreateReactorOptions *pReactorOptions, RsslErrorInfo *pError);
 
@@ -0,0 +1,580 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright Thomson Reuters 2018. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "rtr/ripcuring.h"
+
+#ifdef RIPC_IO_URING
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+
+/* Size of each thread's ring; this bounds how many channels' writes go in one io_uring_enter() call.
+ * Writes beyond it are performed one at a time. */
+#define RIPC_URING_ENTRIES 64
+
+/* States of an operation submitted on a ring */
+#define RIPC_URING_OP_IDLE		0
+#define RIPC_URING_OP_QUEUED	1	/* SQE is on the ring, result not known yet */
+#define RIPC_URING_OP_DONE		2	/* CQE received, result not collected yet */
+
+typedef struct
+{
+	int						state;		/* RIPC_URING_OP_* */
+	int						result;		/* CQE result: bytes transferred or -errno */
+} ripcUringOp;
+
+/* One ring per thread, shared by all channels the thread reads or flushes. */
+typedef struct
+{
+	int						ringFd;		/* io_uring instance */
+	unsigned				entries;	/* Number of SQ entries */
+	unsigned				queued;		/* SQEs added since the last io_uring_enter() */
+	unsigned				inFlight;	/* SQEs submitted whose CQE has not been reaped */
+	int						batching;	/* Set between ipcUringBatchBegin() and ipcUringBatchEnd() */
+	int						batchWrites;	/* Writes queued since ipcUringBatchBegin() */
+	ripcUringOp				syncOp;		/* Operation performed by ipcUringSubmitAndWait() */
+
+	unsigned				*sqHead;
+	unsigned				*sqTail;
+	unsigned				*sqMask;
+	unsigned				*sqArray;
+	struct io_uring_sqe		*sqes;
+
+	unsigned				*cqHead;
+	unsigned				*cqTail;
+	unsigned				*cqMask;
+	struct io_uring_cqe		*cqes;
+
+	void					*sqRing;
+	size_t					sqRingSize;
+	void					*cqRing;	/* Same as sqRing when the kernel maps both rings together */
+	size_t					cqRingSize;
+	size_t					sqesSize;
+} ripcUringRing;
+
+/* Per-channel state */
+typedef struct
+{
+	RsslSocket				fd;			/* Connected socket */
+
+	/* Write queued during a batch.  The vector is copied because the caller's is gone by the time
+	 * the SQE is submitted, and it is kept so the caller's retry can be checked against it. */
+	ripcUringOp				writeOp;
+	struct msghdr			writeMsg;
+	ripcIovType				writeIov[RIPC_MAXIOVLEN];
+} ripcUringInfo;
+
+/* Both are set once by ipcUringInitialize() while the transport is initialized, and only read afterwards. */
+static int ipcUringAvailable = 0;
+static pthread_key_t ipcUringRingKey;
+
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter) && defined(__NR_io_uring_register)
+
+static int ipcUringSetup(unsigned entries, struct io_uring_params *params)
+{
+	return (int)syscall(__NR_io_uring_setup, entries, params);
+}
+
+static int ipcUringEnter(int ringFd, unsigned toSubmit, unsigned minComplete, unsigned flags)
+{
+	return (int)syscall(__NR_io_uring_enter, ringFd, toSubmit, minComplete, flags, NULL, 0);
+}
+
+static int ipcUringRegister(int ringFd, unsigned opcode, void *arg, unsigned nrArgs)
+{
+	return (int)syscall(__NR_io_uring_register, ringFd, opcode, arg, nrArgs);
+}
+
+static void ipcUringReleaseRing(void *ringPtr)
+{
+	ripcUringRing *ring = (ripcUringRing*)ringPtr;
+
+	if (ring->sqes)
+		munmap(ring->sqes, ring->sqesSize);
+	if (ring->cqRing && ring->cqRing != ring->sqRing)
+		munmap(ring->cqRing, ring->cqRingSize);
+	if (ring->sqRing)
+		munmap(ring->sqRing, ring->sqRingSize);
+	if (ring->ringFd >= 0)
+		close(ring->ringFd);
+	free(ring);
+}
+
+/* Checks that the kernel supports the operations this backend submits (IORING_OP_RECV needs 5.6). */
+static int ipcUringProbe(int ringFd)
+{
+	struct io_uring_probe *probe;
+	size_t probeSize = sizeof(struct io_uring_probe) + IORING_OP_LAST * sizeof(struct io_uring_probe_op);
+	int supported = 0;
+
+	if ((probe = (struct io_uring_probe*)calloc(1, probeSize)) == NULL)
+		return 0;
+
+	if (ipcUringRegister(ringFd, IORING_REGISTER_PROBE, probe, IORING_OP_LAST) == 0
+			&& probe->last_op >= IORING_OP_RECV
+			&& (probe->ops[IORING_OP_RECV].flags & IO_URING_OP_SUPPORTED)
+			&& (probe->ops[IORING_OP_SENDMSG].flags & IO_URING_OP_SUPPORTED))
+		supported = 1;
+
+	free(probe);
+	return supported;
+}
+
+static ripcUringRing *ipcUringNewRing()
+{
+	ripcUringRing *ring;
+	struct io_uring_params params;
+
+	if ((ring = (ripcUringRing*)calloc(1, sizeof(ripcUringRing))) == NULL)
+		return NULL;
+
+	memset(&params, 0, sizeof(params));
+	params.flags = IORING_SETUP_CLAMP;
+
+	if ((ring->ringFd = ipcUringSetup(RIPC_URING_ENTRIES, &params)) < 0)
+	{
+		free(ring);
+		return NULL;
+	}
+
+	ring->entries = params.sq_entries;
+	ring->sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+	ring->cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+	ring->sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+
+	if (params.features & IORING_FEAT_SINGLE_MMAP)
+	{
+		if (ring->cqRingSize > ring->sqRingSize)
+			ring->sqRingSize = ring->cqRingSize;
+		ring->cqRingSize = ring->sqRingSize;
+	}
+
+	if ((ring->sqRing = mmap(NULL, ring->sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+			ring->ringFd, IORING_OFF_SQ_RING)) == MAP_FAILED)
+	{
+		ring->sqRing = NULL;
+		ipcUringReleaseRing(ring);
+		return NULL;
+	}
+
+	if (params.features & IORING_FEAT_SINGLE_MMAP)
+		ring->cqRing = ring->sqRing;
+	else if ((ring->cqRing = mmap(NULL, ring->cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+			ring->ringFd, IORING_OFF_CQ_RING)) == MAP_FAILED)
+	{
+		ring->cqRing = NULL;
+		ipcUringReleaseRing(ring);
+		return NULL;
+	}
+
+	if ((ring->sqes = (struct io_uring_sqe*)mmap(NULL, ring->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+			ring->ringFd, IORING_OFF_SQES)) == MAP_FAILED)
+	{
+		ring->sqes = NULL;
+		ipcUringReleaseRing(ring);
+		return NULL;
+	}
+
+	ring->sqHead = (unsigned*)((char*)ring->sqRing + params.sq_off.head);
+	ring->sqTail = (unsigned*)((char*)ring->sqRing + params.sq_off.tail);
+	ring->sqMask = (unsigned*)((char*)ring->sqRing + params.sq_off.ring_mask);
+	ring->sqArray = (unsigned*)((char*)ring->sqRing + params.sq_off.array);
+
+	ring->cqHead = (unsigned*)((char*)ring->cqRing + params.cq_off.head);
+	ring->cqTail = (unsigned*)((char*)ring->cqRing + params.cq_off.tail);
+	ring->cqMask = (unsigned*)((char*)ring->cqRing + params.cq_off.ring_mask);
+	ring->cqes = (struct io_uring_cqe*)((char*)ring->cqRing + params.cq_off.cqes);
+
+	return ring;
+}
+
+void ipcUringInitialize()
+{
+	ripcUringRing *ring;
+
+	if (ipcUringAvailable)
+		return;
+
+	/* Not built into the kernel, disabled by policy, or too old for the operations used here. */
+	if ((ring = ipcUringNewRing()) == NULL)
+		return;
+
+	if (ipcUringProbe(ring->ringFd) && pthread_key_create(&ipcUringRingKey, ipcUringReleaseRing) == 0)
+		ipcUringAvailable = 1;
+
+	ipcUringReleaseRing(ring);
+}
+
+/* Returns the calling thread's ring, creating it on first use.  Returns NULL if it cannot be created,
+ * e.g. because the locked memory limit is reached; the caller then uses plain socket calls. */
+static ripcUringRing *ipcUringThreadRing()
+{
+	ripcUringRing *ring = (ripcUringRing*)pthread_getspecific(ipcUringRingKey);
+
+	if (ring == NULL && (ring = ipcUringNewRing()) != NULL)
+	{
+		if (pthread_setspecific(ipcUringRingKey, ring) != 0)
+		{
+			ipcUringReleaseRing(ring);
+			return NULL;
+		}
+	}
+
+	return ring;
+}
+
+/* Adds an SQE to the ring without submitting it.  Returns 0, or -1 if the ring has no room. */
+static int ipcUringQueue(ripcUringRing *ring, const struct io_uring_sqe *sqe, ripcUringOp *op)
+{
+	unsigned tail = *ring->sqTail;
+	unsigned index = tail & *ring->sqMask;
+
+	/* Also bounded by in-flight operations, so completions never outnumber the CQ ring. */
+	if (ring->queued + ring->inFlight >= ring->entries)
+		return -1;
+
+	ring->sqes[index] = *sqe;
+	ring->sqes[index].user_data = (uintptr_t)op;
+	ring->sqArray[index] = index;
+	__atomic_store_n(ring->sqTail, tail + 1, __ATOMIC_RELEASE);
+
+	op->state = RIPC_URING_OP_QUEUED;
+	++ring->queued;
+
+	return 0;
+}
+
+/* Records every available completion in the operation it belongs to. */
+static void ipcUringReap(ripcUringRing *ring)
+{
+	unsigned head = *ring->cqHead;
+	unsigned tail = __atomic_load_n(ring->cqTail, __ATOMIC_ACQUIRE);
+	struct io_uring_cqe *cqe;
+	ripcUringOp *op;
+
+	while (head != tail)
+	{
+		cqe = &ring->cqes[head & *ring->cqMask];
+		op = (ripcUringOp*)(uintptr_t)cqe->user_data;
+		op->result = cqe->res;
+		op->state = RIPC_URING_OP_DONE;
+		--ring->inFlight;
+		++head;
+	}
+
+	__atomic_store_n(ring->cqHead, head, __ATOMIC_RELEASE);
+}
+
+/* Submits everything queued and waits until at least minComplete operations are done.
+ * The sockets are non-blocking and every operation is flagged MSG_DONTWAIT, so the wait only
+ * covers the time to perform the I/O.  Returns 0, or -errno.
+ * If the kernel refuses the submission, the operations that were not consumed are taken back off
+ * the ring and completed with the error, so none of them can be submitted later. */
+static int ipcUringSubmit(ripcUringRing *ring, unsigned minComplete)
+{
+	int submitted;
+	int err;
+	unsigned tail, pos;
+	ripcUringOp *op;
+
+	submitted = ipcUringEnter(ring->ringFd, ring->queued, minComplete, minComplete ? IORING_ENTER_GETEVENTS : 0);
+
+	if (submitted < 0)
+	{
+		if ((err = errno) != EINTR)
+		{
+			tail = *ring->sqTail;
+			for (pos = tail - ring->queued; pos != tail; ++pos)
+			{
+				op = (ripcUringOp*)(uintptr_t)ring->sqes[ring->sqArray[pos & *ring->sqMask]].user_data;
+				op->result = -err;
+				op->state = RIPC_URING_OP_DONE;
+			}
+			__atomic_store_n(ring->sqTail, tail - ring->queued, __ATOMIC_RELEASE);
+			ring->queued = 0;
+			ipcUringReap(ring);
+			return -err;
+		}
+		/* Interrupted by a signal; nothing was consumed. */
+		submitted = 0;
+	}
+
+	ring->queued -= (unsigned)submitted;
+	ring->inFlight += (unsigned)submitted;
+
+	ipcUringReap(ring);
+	return 0;
+}
+
+/* Performs a single operation and waits for its result. */
+static int ipcUringSubmitAndWait(ripcUringRing *ring, const struct io_uring_sqe *sqe)
+{
+	ripcUringOp *op = &ring->syncOp;
+	int ret;
+
+	/* A previous call gave up on an operation the kernel had already taken; let it finish first. */
+	while (op->state == RIPC_URING_OP_QUEUED)
+	{
+		if ((ret = ipcUringSubmit(ring, 1)) < 0)
+			return ret;
+	}
+
+	while (ipcUringQueue(ring, sqe, op) < 0)
+	{
+		/* Ring is full; let the outstanding operations finish first. */
+		if ((ret = ipcUringSubmit(ring, ring->inFlight ? 1 : 0)) < 0)
+			return ret;
+	}
+
+	while (op->state != RIPC_URING_OP_DONE)
+	{
+		if ((ret = ipcUringSubmit(ring, 1)) < 0 && op->state != RIPC_URING_OP_DONE)
+			return ret;
+	}
+
+	op->state = RIPC_URING_OP_IDLE;
+	return op->result;
+}
+
+void *ipcUringNewConn(RsslSocket fd)
+{
+	ripcUringInfo *uring;
+
+	if (!ipcUringAvailable)
+		return NULL;
+
+	if ((uring = (ripcUringInfo*)calloc(1, sizeof(ripcUringInfo))) == NULL)
+		return NULL;
+
+	uring->fd = fd;
+	uring->writeOp.state = RIPC_URING_OP_IDLE;
+
+	return uring;
+}
+
+int ipcUringRead(void *transport, char *buf, int max_len, ripcRWFlags flags, RsslError *error)
+{
+	ripcUringInfo *uring = (ripcUringInfo*)transport;
+	ripcUringRing *ring = ipcUringThreadRing();
+	struct io_uring_sqe sqe;
+	int res;
+
+	if (ring != NULL)
+	{
+		memset(&sqe, 0, sizeof(sqe));
+		sqe.opcode = IORING_OP_RECV;
+		sqe.fd = (int)uring->fd;
+		sqe.addr = (uintptr_t)buf;
+		sqe.len = (unsigned)max_len;
+		sqe.msg_flags = MSG_DONTWAIT;
+
+		res = ipcUringSubmitAndWait(ring, &sqe);
+	}
+	else
+		res = ((res = (int)recv(uring->fd, buf, max_len, MSG_DONTWAIT)) < 0) ? -errno : res;
+
+	/* Unlike ipcRead(), a short read is returned immediately rather than spending another
+	 * call to discover the socket is empty; the socket descriptor will signal again if more arrives. */
+	if (res > 0)
+		return res;
+
+	error->text[0] = '\0';
+
+	if (res == 0)
+		return (max_len > 0) ? -2 : 0;
+
+	if (res == -EAGAIN || res == -EINTR)
+		return 0;
+
+	errno = -res;
+	return -1;
+}
+
+/* Returns 1 if the vector matches the one the batched write was queued with. */
+static int ipcUringSameIov(ripcUringInfo *uring, ripcIovType *iov, int iovcnt)
+{
+	int i;
+
+	if ((size_t)iovcnt != uring->writeMsg.msg_iovlen)
+		return 0;
+
+	for (i = 0; i < iovcnt; ++i)
+	{
+		if (RIPC_IOV_GETBUF(&iov[i]) != RIPC_IOV_GETBUF(&uring->writeIov[i])
+				|| RIPC_IOV_GETLEN(&iov[i]) != RIPC_IOV_GETLEN(&uring->writeIov[i]))
+			return 0;
+	}
+
+	return 1;
+}
+
+int ipcUringWriteV(void *transport, ripcIovType *iov, int iovcnt, int outLen, ripcRWFlags flags, RsslError *error)
+{
+	ripcUringInfo *uring = (ripcUringInfo*)transport;
+	ripcUringRing *ring;
+	struct io_uring_sqe sqe;
+	struct msghdr msg;
+	int res;
+
+	if (uring->writeOp.state == RIPC_URING_OP_DONE)
+	{
+		/* The batched write has completed; this is the caller writing the same vector again. */
+		uring->writeOp.state = RIPC_URING_OP_IDLE;
+
+		if (!ipcUringSameIov(uring, iov, iovcnt))
+		{
+			/* The data was sent, but the caller can no longer account for it. */
+			error->text[0] = '\0';
+			errno = EIO;
+			return -1;
+		}
+
+		res = uring->writeOp.result;
+	}
+	else if (uring->writeOp.state == RIPC_URING_OP_QUEUED)
+	{
+		/* The batched write has not been submitted yet; nothing more can be written until it is. */
+		return 0;
+	}
+	else
+	{
+		memset(&msg, 0, sizeof(msg));
+		msg.msg_iov = iov;
+		msg.msg_iovlen = iovcnt;
+
+		memset(&sqe, 0, sizeof(sqe));
+		sqe.opcode = IORING_OP_SENDMSG;
+		sqe.fd = (int)uring->fd;
+		sqe.len = 1;
+		sqe.msg_flags = MSG_DONTWAIT;
+
+		if ((ring = ipcUringThreadRing()) == NULL)
+			res = ((res = (int)sendmsg(uring->fd, &msg, MSG_DONTWAIT)) < 0) ? -errno : res;
+		else if (ring->batching && iovcnt <= RIPC_MAXIOVLEN)
+		{
+			/* Queue it for ipcUringBatchEnd(); for now nothing has been written. */
+			memcpy(uring->writeIov, iov, iovcnt * sizeof(ripcIovType));
+			memcpy(&uring->writeMsg, &msg, sizeof(msg));
+			uring->writeMsg.msg_iov = uring->writeIov;
+			sqe.addr = (uintptr_t)&uring->writeMsg;
+
+			if (ipcUringQueue(ring, &sqe, &uring->writeOp) == 0)
+			{
+				++ring->batchWrites;
+				return 0;
+			}
+
+			sqe.addr = (uintptr_t)&msg;
+			res = ipcUringSubmitAndWait(ring, &sqe);
+		}
+		else
+		{
+			sqe.addr = (uintptr_t)&msg;
+			res = ipcUringSubmitAndWait(ring, &sqe);
+		}
+	}
+
+	if (res > 0)
+		return res;
+
+	if (res == -EAGAIN || res == -EINTR)
+		return 0;
+
+	error->text[0] = '\0';
+
+	if (res == 0)
+		return -2;
+
+	errno = -res;
+	return -1;
+}
+
+int ipcUringWrite(void *transport, char *buf, int outLen, ripcRWFlags flags, RsslError *error)
+{
+	ripcIovType iov;
+
+	RIPC_IOV_SETBUF(&iov, buf);
+	RIPC_IOV_SETLEN(&iov, outLen);
+
+	return ipcUringWriteV(transport, &iov, 1, outLen, flags, error);
+}
+
+void ipcUringBatchBegin()
+{
+	ripcUringRing *ring;
+
+	if (ipcUringAvailable && (ring = ipcUringThreadRing()) != NULL)
+	{
+		ring->batching = 1;
+		ring->batchWrites = 0;
+	}
+}
+
+int ipcUringBatchEnd()
+{
+	ripcUringRing *ring;
+
+	if (!ipcUringAvailable || (ring = (ripcUringRing*)pthread_getspecific(ipcUringRingKey)) == NULL || !ring->batching)
+		return 0;
+
+	ring->batching = 0;
+
+	/* One call submits every channel's write and waits for all of them.  On failure, the writes
+	 * that were not submitted have been completed with the error by ipcUringSubmit(). */
+	while (ring->queued + ring->inFlight > 0)
+	{
+		if (ipcUringSubmit(ring, ring->queued + ring->inFlight) < 0 && ring->queued + ring->inFlight > 0)
+		{
+			/* Still wait for what the kernel already has, since it refers to channel memory. */
+			if (ipcUringSubmit(ring, ring->inFlight) < 0)
+				break;
+		}
+	}
+
+	return ring->batchWrites;
+}
+
+int ipcUringWriteReady(void *transport)
+{
+	return ((ripcUringInfo*)transport)->writeOp.state == RIPC_URING_OP_DONE;
+}
+
+int ipcUringShutdown(void *transport)
+{
+	ripcUringInfo *uring = (ripcUringInfo*)transport;
+
+	close(uring->fd);
+	free(uring);
+
+	return(1);
+}
+
+#else
+
+/* The C library headers do not define the io_uring syscalls; always use the socket functions. */
+void ipcUringInitialize() { }
+void *ipcUringNewConn(RsslSocket fd) { return NULL; }
+int ipcUringRead(void *transport, char *buf, int max_len, ripcRWFlags flags, RsslError *error) { return -1; }
+int ipcUringWrite(void *transport, char *buf, int outLen, ripcRWFlags flags, RsslError *error) { return -1; }
+int ipcUringWriteV(void *transport, ripcIovType *iov, int iovcnt, int outLen, ripcRWFlags flags, RsslError *error) { return -1; }
+int ipcUringShutdown(void *transport) { return 1; }
+void ipcUringBatchBegin() { }
+int ipcUringBatchEnd() { return 0; }
+int ipcUringWriteReady(void *transport) { return 0; }
+
+#endif
+
+#endif
@@ -156,7 +156,7 @@ RTR_C_ALWAYS_INLINE rsslChannelImpl *_rsslCreateChannel()
 	(void) RSSL_MUTEX_INIT_ESDK( &chnl->traceMutex );
 
 	// Allocate hash table for handling fragmentation
-	rsslHashTableInit(&(chnl->assemblyBuffers), 65535, UInt32_key_hash, checkFragID, RSSL_TRUE, &rsslErrorInfo);
+	rsslHashTableInit(&(chnl->assemblyBuffers), 16, UInt32_key_hash, checkFragID, &rsslErrorInfo);
 	
 	rsslInitQueue(&(chnl->activeBufferList));
 	rsslInitQueue(&(chnl->freeBufferList));
@@ -266,12 +266,20 @@ RTR_C_ALWAYS_INLINE void _rsslReleaseActiveBuffers(rsslChannelImpl *chnl)
 	return;
 }
 
+/* frees an rsslAssemblyBuffer removed from a channel's assemblyBuffers */
+static void _rsslFreeAssemblyBuffer(RsslHashLink *pHashLink)
+{
+	rsslAssemblyBuffer *rsslAssemblyBuf = RSSL_HASH_LINK_TO_OBJECT(rsslAssemblyBuffer, link1, pHashLink);
+
+	if (rsslAssemblyBuf->buffer.data)
+		_rsslFree(rsslAssemblyBuf->buffer.data);
+
+	_rsslFree(rsslAssemblyBuf);
+}
+
 /* releases channel to freeList */
 void RTR_FASTCALL _rsslReleaseChannel(rsslChannelImpl *chnl)
 {
-	rsslAssemblyBuffer *rsslAssemblyBuf=0;
-	RsslQueueLink *pLink;
-
 	/* if we own the component version, free it */
 	if ((chnl->ownCompVer == RSSL_TRUE) && (chnl->componentVer.componentVersion.length) && (chnl->componentVer.componentVersion.data))
 	{
@@ -293,28 +301,7 @@ void RTR_FASTCALL _rsslReleaseChannel(rsslChannelImpl *chnl)
 	}
 
 	// Ensure that there is no rsslAssemblyBuffer left in chnl->assemblyBuffers
-	if (chnl->assemblyBuffers.elementCount > 0)
-	{
-		RsslUInt32 index;
-		for (index = 0; index < chnl->assemblyBuffers.queueCount; index++)
-		{
-			RSSL_QUEUE_FOR_EACH_LINK(&chnl->assemblyBuffers.queueList[index], pLink)
-			{
-				rsslAssemblyBuf = RSSL_QUEUE_LINK_TO_OBJECT(rsslAssemblyBuffer, link1, pLink);
-
-				if (rsslAssemblyBuf->buffer.data)
-				{
-					_rsslFree(rsslAssemblyBuf->buffer.data);
-					rsslAssemblyBuf->buffer.data = 0;
-				}
-
-				rsslHashTableRemoveLink(&chnl->assemblyBuffers, &rsslAssemblyBuf->link1);
-
-				_rsslFree(rsslAssemblyBuf);
-				rsslAssemblyBuf = 0;
-			}
-		}
-	}
+	rsslHashTableRemoveAllLinks(&chnl->assemblyBuffers, _rsslFreeAssemblyBuffer);
 
 	_rsslCleanChan(chnl);	
 	mutexFuncs.staticMutexLock();
@@ -1622,6 +1609,80 @@ RSSL_API RsslBuffer* rsslReadEx(RsslChannel *chnl, RsslReadInArgs *readInArgs, R
 	return retBuf;
 }
 
+/* Read several messages from socket */
+RSSL_API RsslUInt32 rsslReadMany(RsslChannel *chnl, RsslBuffer *pBuffers, RsslUInt32 bufferCount, RsslReadOutArgs *readOutArgs, RsslRet *readRet, RsslError *error)
+{
+	rsslChannelImpl *rsslChnlImpl=0;
+	RsslReadInArgs readInArgs = RSSL_INIT_READ_IN_ARGS;
+	RsslBuffer *retBuf;
+
+	if (rtrUnlikely(!initialized))
+	{
+		_rsslSetError(error, chnl, RSSL_RET_INIT_NOT_INITIALIZED, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslReadMany() Error: 0001 RSSL not initialized.\n", __FILE__, __LINE__);
+		*readRet = RSSL_RET_INIT_NOT_INITIALIZED;
+		return 0;
+	}
+
+	if (rtrUnlikely(RSSL_NULL_PTR(chnl, "rsslReadMany", "chnl", error)))
+	{
+		*readRet = RSSL_RET_FAILURE;
+		return 0;
+	}
+
+	if (rtrUnlikely(RSSL_NULL_PTR(readRet, "rsslReadMany", "readRet", error)))
+		return 0;
+
+	if (rtrUnlikely(RSSL_NULL_PTR(pBuffers, "rsslReadMany", "pBuffers", error)))
+	{
+		*readRet = RSSL_RET_FAILURE;
+		return 0;
+	}
+
+	if(rtrUnlikely(RSSL_NULL_PTR(readOutArgs, "rsslReadMany", "readOutArgs", error)))
+	{
+		*readRet = RSSL_RET_FAILURE;
+		return 0;
+	}
+
+	if (rtrUnlikely(bufferCount == 0))
+	{
+		*readRet = RSSL_RET_FAILURE;
+		_rsslSetError(error, chnl, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslReadMany() Error: 0002 bufferCount must be greater than zero.\n", __FILE__, __LINE__);
+		return 0;
+	}
+
+	if (rtrUnlikely(chnl->state != RSSL_CH_STATE_ACTIVE))
+	{
+		*readRet = RSSL_RET_FAILURE;
+		_rsslSetError(error, chnl, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslReadMany() Error: 0007 Only Channels in RSSL_CH_STATE_ACTIVE state can get read.\n", __FILE__, __LINE__);
+		return 0;
+	}
+
+	rsslChnlImpl = (rsslChannelImpl*)chnl;
+
+	/* Tracing is done per message by rsslReadEx, and transports without batch support 
+	 * can only hand out one buffer at a time, so fall back to a single read. */
+	if (rtrUnlikely(rsslChnlImpl->channelFuncs->channelReadMany == NULL
+				|| (rsslChnlImpl->traceOptionsInfo.traceOptions.traceFlags & (RSSL_TRACE_TO_FILE_ENABLE | RSSL_TRACE_TO_STDOUT))))
+	{
+		readOutArgs->bytesRead = 0;
+		readOutArgs->uncompressedBytesRead = 0;
+
+		if ((retBuf = rsslReadEx(chnl, &readInArgs, readOutArgs, readRet, error)) == NULL)
+			return 0;
+
+		pBuffers[0] = *retBuf;
+		return 1;
+	}
+
+	readOutArgs->readOutFlags = RSSL_READ_OUT_NO_FLAGS;
+
+	return (*(rsslChnlImpl->channelFuncs->channelReadMany))(rsslChnlImpl, pBuffers, bufferCount, readOutArgs, readRet, error);
+}
+
 /* Write */
 RsslRet rsslWrite(RsslChannel *chnl, RsslBuffer *buffer, RsslWritePriorities rsslPriority, RsslUInt8 writeFlags, RsslUInt32 *bytesWritten, RsslUInt32 *uncompressedBytesWritten, RsslError *error)
 {
@@ -1831,6 +1892,194 @@ RsslRet rsslWriteEx(RsslChannel *chnl, RsslBuffer *buffer, RsslWriteInArgs *writ
 	}
 }
 
+/* Checks a buffer passed to rsslWriteMany and applies its priority, as rsslWriteEx does */
+static RsslRet _rsslPrepareWriteManyBuffer(RsslChannel *chnl, RsslBuffer *buffer, RsslWritePriorities rsslPriority, RsslError *error)
+{
+	rsslChannelImpl *rsslChnlImpl = (rsslChannelImpl*)chnl;
+	rsslBufferImpl *rsslBufImpl = (rsslBufferImpl*)buffer;
+
+	if (rtrUnlikely(RSSL_NULL_PTR(buffer, "rsslWriteMany", "buffer", error)))
+		return RSSL_RET_FAILURE;
+
+	/* valid cases are a buffer with length was passed in, or it is a packed buffer and
+	   a 0 length buffer is passed in - this signifys that nothing is written into the last portion of the buffer */
+	if (rtrUnlikely((buffer->length == 0) && (rsslBufImpl->packingOffset == 0)))
+	{
+		_rsslSetError(error, chnl, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslWriteMany() Error: 0009 Buffer of length zero cannot be written\n", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+
+	/* make sure the integrity checks out */
+	if (rtrUnlikely(rsslBufImpl->integrity != 69))
+	{
+		/* the data has overwritten memory */
+		_rsslSetError(error, chnl, RSSL_RET_BUFFER_TOO_SMALL, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslWriteMany() Error: 0008 Data has overflowed the allocated buffer length or RSSL is not owner.\n", __FILE__, __LINE__);
+		return RSSL_RET_BUFFER_TOO_SMALL;
+	}
+
+	if (rtrUnlikely(rsslBufImpl->RsslChannel != rsslChnlImpl))
+	{
+		_rsslSetError(error, chnl, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslWriteMany() Error: 0018 Channel is not owner of buffer.\n", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+
+	/* a fragmented buffer keeps the priority it was first written with */
+	if (rsslBufImpl->priority < 0)
+	{
+		if (rtrUnlikely((rsslPriority < RSSL_HIGH_PRIORITY) || (rsslPriority > RSSL_LOW_PRIORITY)))
+			rsslBufImpl->priority = RSSL_MEDIUM_PRIORITY;
+		else
+			rsslBufImpl->priority = rsslPriority;
+	}
+
+	/* do debugging if wanted */
+	if (rtrUnlikely((rsslChnlImpl->debugFlags & RSSL_DEBUG_RSSL_DUMP_OUT) && (buffer->length > 0)))
+		(*(rsslDumpOutFunc))((char*)__FUNCTION__, buffer->data, buffer->length, chnl->socketId);
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* Write several buffers, then flush them together */
+RSSL_API RsslUInt32 rsslWriteMany(RsslChannel *chnl, RsslBuffer **pBuffers, RsslWritePriorities *pPriorities, RsslUInt32 bufferCount, RsslWriteInArgs *writeInArgs, RsslWriteOutArgs *writeOutArgs, RsslRet *pResults, RsslRet *writeRet, RsslError *error)
+{
+	rsslChannelImpl *rsslChnlImpl;
+	RsslWriteInArgs bufferInArgs;
+	RsslWriteOutArgs bufferOutArgs;
+	RsslUInt32 bufferIndex;
+	RsslUInt32 validCount;
+	RsslRet ret = RSSL_RET_SUCCESS;
+
+	if (rtrUnlikely(RSSL_NULL_PTR(writeRet, "rsslWriteMany", "writeRet", error)))
+		return 0;
+
+	if (rtrUnlikely(RSSL_NULL_PTR(pBuffers, "rsslWriteMany", "pBuffers", error)
+				|| RSSL_NULL_PTR(writeInArgs, "rsslWriteMany", "writeInArgs", error)
+				|| RSSL_NULL_PTR(writeOutArgs, "rsslWriteMany", "writeOutArgs", error)))
+	{
+		*writeRet = RSSL_RET_FAILURE;
+		return 0;
+	}
+
+	writeOutArgs->bytesWritten = 0;
+	writeOutArgs->uncompressedBytesWritten = 0;
+	writeOutArgs->writeOutFlags = RSSL_WRITE_OUT_NO_FLAGS;
+
+	/* Queue each buffer without passing it directly to the socket; everything queued is
+	 * flushed once, which can send all of it with a single vectored write. */
+	bufferInArgs = *writeInArgs;
+	bufferInArgs.writeInFlags &= ~RSSL_WRITE_DIRECT_SOCKET_WRITE;
+
+	if (bufferCount == 0)
+	{
+		*writeRet = RSSL_RET_SUCCESS;
+		return 0;
+	}
+
+	if (rtrUnlikely(!initialized))
+	{
+		_rsslSetError(error, chnl, RSSL_RET_INIT_NOT_INITIALIZED, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslWriteMany() Error: 0001 RSSL not initialized.\n", __FILE__, __LINE__);
+		*writeRet = RSSL_RET_INIT_NOT_INITIALIZED;
+		return 0;
+	}
+
+	if (rtrUnlikely(RSSL_NULL_PTR(chnl, "rsslWriteMany", "chnl", error)))
+	{
+		*writeRet = RSSL_RET_FAILURE;
+		return 0;
+	}
+
+	if (rtrUnlikely(chnl->state != RSSL_CH_STATE_ACTIVE))
+	{
+		_rsslSetError(error, chnl, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslWriteMany() Error: 0007 Only Channels in RSSL_CH_STATE_ACTIVE state can write.\n", __FILE__, __LINE__);
+		*writeRet = RSSL_RET_FAILURE;
+		return 0;
+	}
+
+	rsslChnlImpl = (rsslChannelImpl*)chnl;
+
+	/* Transports that support it queue every buffer under one lock and flush them with
+	 * one gathered write.  Tracing is done per message, so it uses the loop below. */
+	if (rtrLikely(rsslChnlImpl->channelFuncs->channelWriteMany != NULL
+				&& !(rsslChnlImpl->traceOptionsInfo.traceOptions.traceFlags & (RSSL_TRACE_TO_FILE_ENABLE | RSSL_TRACE_TO_STDOUT))))
+	{
+		RsslError prepareError;
+		RsslUInt32 writtenCount;
+
+		/* Only the buffers before the first invalid one are written. */
+		for (validCount = 0; validCount < bufferCount; ++validCount)
+		{
+			ret = _rsslPrepareWriteManyBuffer(chnl, pBuffers[validCount], pPriorities ? pPriorities[validCount] : writeInArgs->rsslPriority, &prepareError);
+			if (ret < RSSL_RET_SUCCESS)
+				break;
+		}
+
+		writtenCount = 0;
+		*writeRet = RSSL_RET_SUCCESS;
+
+		if (validCount > 0)
+			writtenCount = (*(rsslChnlImpl->channelFuncs->channelWriteMany))(rsslChnlImpl, pBuffers, validCount, &bufferInArgs, writeOutArgs, pResults, writeRet, error);
+
+		if (validCount < bufferCount && writtenCount == validCount && chnl->state == RSSL_CH_STATE_ACTIVE)
+		{
+			if (pResults)
+				pResults[validCount] = ret;
+			*writeRet = ret;
+			*error = prepareError;
+		}
+
+		return writtenCount;
+	}
+
+	for (bufferIndex = 0; bufferIndex < bufferCount; ++bufferIndex)
+	{
+		if (pPriorities)
+			bufferInArgs.rsslPriority = pPriorities[bufferIndex];
+
+		rsslClearWriteOutArgs(&bufferOutArgs);
+		ret = rsslWriteEx(chnl, pBuffers[bufferIndex], &bufferInArgs, &bufferOutArgs, error);
+
+		if (pResults)
+			pResults[bufferIndex] = ret;
+
+		/* RSSL_RET_WRITE_FLUSH_FAILED still means the buffer was written. */
+		if (ret < RSSL_RET_SUCCESS && ret != RSSL_RET_WRITE_FLUSH_FAILED)
+			break;
+
+		writeOutArgs->bytesWritten += bufferOutArgs.bytesWritten;
+		writeOutArgs->uncompressedBytesWritten += bufferOutArgs.uncompressedBytesWritten;
+
+		if (chnl->state != RSSL_CH_STATE_ACTIVE)
+		{
+			++bufferIndex;
+			break;
+		}
+	}
+
+	*writeRet = ret;
+
+	if (bufferIndex > 0 && chnl->state == RSSL_CH_STATE_ACTIVE)
+	{
+		RsslError flushError;
+		RsslRet flushRet = rsslFlush(chnl, &flushError);
+
+		/* Report the flush result only if writing did not fail, so that the error from
+		 * the buffer that stopped the batch is not overwritten. */
+		if (*writeRet >= RSSL_RET_SUCCESS || *writeRet == RSSL_RET_WRITE_FLUSH_FAILED)
+		{
+			*writeRet = flushRet;
+			if (flushRet < RSSL_RET_SUCCESS)
+				*error = flushError;
+		}
+	}
+
+	return bufferIndex;
+}
+
 /* Flush socket */
 RSSL_API RsslRet rsslFlush(RsslChannel *chnl, RsslError *error)
 {
@@ -1864,6 +2113,61 @@ RSSL_API RsslRet rsslFlush(RsslChannel *chnl, RsslError *error)
 	return ret;
 }
 
+/* Flush several channels */
+RSSL_API RsslRet rsslFlushMany(RsslChannel **pChannels, RsslUInt32 channelCount, RsslRet *pResults, RsslError **pErrors)
+{
+	rsslChannelImpl *batch[RSSL_MAX_FLUSH_MANY];
+	RsslRet batchResults[RSSL_MAX_FLUSH_MANY];
+	RsslError *batchErrors[RSSL_MAX_FLUSH_MANY];
+	RsslUInt32 batchIndex[RSSL_MAX_FLUSH_MANY];
+	RsslUInt32 batchCount = 0;
+	RsslUInt32 i, j;
+	rsslChannelImpl *rsslChnlImpl = 0;
+
+	if (!initialized)
+		return RSSL_RET_INIT_NOT_INITIALIZED;
+
+	if (channelCount > 0 && (pChannels == NULL || pResults == NULL || pErrors == NULL))
+		return RSSL_RET_INVALID_ARGUMENT;
+
+	for (i = 0; i < channelCount; ++i)
+	{
+		rsslChnlImpl = (rsslChannelImpl*)pChannels[i];
+
+		/* Channels the transport cannot batch are flushed individually, which also reports any errors. */
+		if (rsslChnlImpl == NULL || rsslChnlImpl->Channel.state != RSSL_CH_STATE_ACTIVE
+				|| rsslChnlImpl->channelFuncs->channelFlushMany == NULL
+				|| (rsslChnlImpl->traceOptionsInfo.traceOptions.traceFlags & (RSSL_TRACE_TO_FILE_ENABLE | RSSL_TRACE_TO_STDOUT)))
+		{
+			pResults[i] = rsslFlush(pChannels[i], pErrors[i]);
+			continue;
+		}
+
+		/* A batch holds channels of one transport. */
+		if (batchCount == RSSL_MAX_FLUSH_MANY || (batchCount > 0 && batch[0]->channelFuncs != rsslChnlImpl->channelFuncs))
+		{
+			(*(batch[0]->channelFuncs->channelFlushMany))(batch, batchCount, batchResults, batchErrors);
+			for (j = 0; j < batchCount; ++j)
+				pResults[batchIndex[j]] = batchResults[j];
+			batchCount = 0;
+		}
+
+		batch[batchCount] = rsslChnlImpl;
+		batchErrors[batchCount] = pErrors[i];
+		batchIndex[batchCount] = i;
+		++batchCount;
+	}
+
+	if (batchCount > 0)
+	{
+		(*(batch[0]->channelFuncs->channelFlushMany))(batch, batchCount, batchResults, batchErrors);
+		for (j = 0; j < batchCount; ++j)
+			pResults[batchIndex[j]] = batchResults[j];
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
 /* sends ping or heartbeat */
 RSSL_API RsslRet rsslPing(RsslChannel *chnl, RsslError *error)
 {
@@ -1344,9 +1344,12 @@ RsslRet rsslSeqMcastSetChannelFunctions()
 	funcs.channelPackBuffer = rsslSeqMcastPackBuffer;
 	funcs.channelPing = rsslSeqMcastPing;
 	funcs.channelRead = rsslSeqMcastRead;
+	funcs.channelReadMany = NULL;
 	funcs.channelReconnect = rsslSeqMcastReconnect;
 	funcs.channelReleaseBuffer = rsslSeqMcastReleaseBuffer;
 	funcs.channelWrite = rsslSeqMcastWrite;
+	funcs.channelWriteMany = NULL;
+	funcs.channelFlushMany = NULL;
 	funcs.initChannel = rsslSeqMcastInitChannel;
 	
 	return(rsslSetTransportChannelFunc(RSSL_SEQ_MCAST_TRANSPORT,&funcs));
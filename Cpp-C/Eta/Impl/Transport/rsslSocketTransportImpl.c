@@ -14,6 +14,7 @@
 #include "rtr/rsslErrors.h"
 #include "rtr/ripcflip.h"
 #include "rtr/ripcutils.h"
+#include "rtr/ripcuring.h"
 #include "rtr/rtratomic.h"
 #include "rtr/rsslQueue.h"
 #include "lz4.h"
@@ -144,6 +145,11 @@ static ripcTransportFuncs   transFuncs[RIPC_MAX_TRANSPORTS];
 
 static ripcTransportFuncs 	encryptedSSLTransFuncs[RIPC_MAX_SSL_PROTOCOLS];
 
+#ifdef RIPC_IO_URING
+/* Socket functions with reads and writes submitted through io_uring; see ripcuring.h */
+static ripcTransportFuncs	uringTransFuncs;
+#endif
+
 static ripcSSLFuncs		SSLTransFuncs;
 
 static RsslUInt16		numInitCalls = 0;
@@ -1661,7 +1667,8 @@ RsslInt32 ipcIntWrtHeader(RsslSocketChannel *rsslSocketChannel, RsslError *error
 }
 
 
-RsslRet ipcWriteSession(RsslSocketChannel *rsslSocketChannel, rsslBufferImpl *rsslBufferImpl, RsslInt32 wFlags, RsslInt32 *bytesWritten, 
+/* Frames and queues one buffer; the caller must hold the session mutex. */
+static RsslRet ipcIntWriteSession(RsslSocketChannel *rsslSocketChannel, rsslBufferImpl *rsslBufferImpl, RsslInt32 wFlags, RsslInt32 *bytesWritten, 
 	RsslInt32 *uncompBytesWritten, RsslInt32 forceFlush, RsslError *error)
 {
 	RsslRet			retval = RSSL_RET_SUCCESS;
@@ -1687,19 +1694,11 @@ RsslRet ipcWriteSession(RsslSocketChannel *rsslSocketChannel, rsslBufferImpl *rs
 	RsslUInt32		fragId = rsslBufferImpl->fragId;
 	RsslQueueLink	*pLink = 0;
 
-	if (IPC_NULL_PTR(rsslSocketChannel, "ipcWriteSession", "rsslSocketChannel", error))
-		return RSSL_RET_FAILURE;
-
 #ifdef IPC_DEBUG
 	if (rtrUnlikely(readdebug))
-		printf("ipcWriteSession() called\n");
+		printf("ipcIntWriteSession() called\n");
 #endif
 
-#ifdef MUTEX_DEBUG
-	printf("LOCK rsslSocketChannel -- ipcWriteSession (start)\n");
-#endif
-	IPC_MUTEX_LOCK(rsslSocketChannel);
-
 	if (rsslSocketChannel->workState & RIPC_INT_SHTDOWN_PEND)
 	{
 		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
@@ -1707,11 +1706,6 @@ RsslRet ipcWriteSession(RsslSocketChannel *rsslSocketChannel, rsslBufferImpl *rs
 			"<%s:%d> Error: 1003 ipcIntWrtSess() failed due to channel shutting down.\n",
 			__FILE__, __LINE__);
 
-#ifdef MUTEX_DEBUG
-		printf("UNLOCK rsslSocketChannel ipcWriteSession (end)\n");
-#endif
-		IPC_MUTEX_UNLOCK(rsslSocketChannel);
-
 		return RSSL_RET_FAILURE;
 	}
 
@@ -1722,11 +1716,6 @@ RsslRet ipcWriteSession(RsslSocketChannel *rsslSocketChannel, rsslBufferImpl *rs
                         "<%s:%d> Error: 1007 ipcIntWrtSess() failed due the buffer has been released.\n",
                         __FILE__, __LINE__);
 
-#ifdef MUTEX_DEBUG
-                printf("UNLOCK rsslSocketChannel ipcWriteSession (end)\n");
-#endif
-                IPC_MUTEX_UNLOCK(rsslSocketChannel);
-
                 return RSSL_RET_FAILURE;
         }
 
@@ -2694,6 +2683,24 @@ RsslRet ipcWriteSession(RsslSocketChannel *rsslSocketChannel, rsslBufferImpl *rs
 		}
 	}
 
+	return(retval);
+}
+
+RsslRet ipcWriteSession(RsslSocketChannel *rsslSocketChannel, rsslBufferImpl *rsslBufferImpl, RsslInt32 wFlags, RsslInt32 *bytesWritten, 
+	RsslInt32 *uncompBytesWritten, RsslInt32 forceFlush, RsslError *error)
+{
+	RsslRet			retval;
+
+	if (IPC_NULL_PTR(rsslSocketChannel, "ipcWriteSession", "rsslSocketChannel", error))
+		return RSSL_RET_FAILURE;
+
+#ifdef MUTEX_DEBUG
+	printf("LOCK rsslSocketChannel -- ipcWriteSession (start)\n");
+#endif
+	IPC_MUTEX_LOCK(rsslSocketChannel);
+
+	retval = ipcIntWriteSession(rsslSocketChannel, rsslBufferImpl, wFlags, bytesWritten, uncompBytesWritten, forceFlush, error);
+
 #ifdef MUTEX_DEBUG
 	printf("UNLOCK rsslSocketChannel ipcWriteSession (end)\n");
 #endif
@@ -8064,6 +8071,7 @@ static RsslSocketChannel *ipcClientChannel(rsslServerImpl* serverImpl, RsslError
 
 	rsslSocketChannel->blocking = (rsslServerSocketChannel->session_blocking ? 1 : 0);
 	rsslSocketChannel->tcp_nodelay = (rsslServerSocketChannel->tcp_nodelay ? 1 : 0);
+	rsslSocketChannel->ioUring = (rsslServerSocketChannel->ioUring ? 1 : 0);
 	rsslSocketChannel->maxMsgSize = rsslServerSocketChannel->maxMsgSize;
 	rsslSocketChannel->maxUserMsgSize = rsslServerSocketChannel->maxUserMsgSize;
 	rsslSocketChannel->srvrcomp = rsslServerSocketChannel->compressionSupported;
@@ -8338,6 +8346,27 @@ RsslRet rsslSocketReconnect(rsslChannelImpl *rsslChnlImpl, RsslError *error)
 		return RSSL_RET_SUCCESS;
 }
 
+#ifdef RIPC_IO_URING
+/* Moves an active, non-blocking socket channel that requested io_uring onto the io_uring transport functions.
+ * The handshake always runs on the regular socket functions.  If io_uring cannot be set up, the channel
+ * is left as it is.  Must be called with the channel mutex held. */
+static void ipcUringAttach(RsslSocketChannel *rsslSocketChannel)
+{
+	void *uringInfo;
+
+	if (!rsslSocketChannel->ioUring || rsslSocketChannel->blocking
+			|| rsslSocketChannel->connType != RSSL_CONN_TYPE_SOCKET
+			|| rsslSocketChannel->transportFuncs != &transFuncs[RSSL_CONN_TYPE_SOCKET])
+		return;
+
+	if ((uringInfo = ipcUringNewConn(rsslSocketChannel->stream)) == NULL)
+		return;
+
+	rsslSocketChannel->transportInfo = uringInfo;
+	rsslSocketChannel->transportFuncs = &uringTransFuncs;
+}
+#endif
+
 /* rssl Socket InitChannel function */
 RsslRet rsslSocketInitChannel(rsslChannelImpl* rsslChnlImpl, RsslInProgInfo *inProg, RsslError *error)
 {
@@ -8457,6 +8486,10 @@ RsslRet rsslSocketInitChannel(rsslChannelImpl* rsslChnlImpl, RsslInProgInfo *inP
 
 			/* set shared key */
 			rsslChnlImpl->shared_key = rsslSocketChannel->shared_key;
+
+#ifdef RIPC_IO_URING
+			ipcUringAttach(rsslSocketChannel);
+#endif
 #ifdef MUTEX_DEBUG
 	printf("UNLOCK rsslSocketChannel -- rsslSocketInitChannel\n");
 #endif
@@ -8529,8 +8562,9 @@ RsslRet rsslSocketCloseChannel(rsslChannelImpl* rsslChnlImpl, RsslError *error)
 	return retVal;
 }
 
-/* rssl Socket Read */
-RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnlImpl, RsslReadOutArgs *readOutArgs, RsslRet *readRet, RsslError *error)
+/* Reads one message from the socket channel. The caller must hold the channel mutex
+ * (when channel locking is enabled) and has already validated the socket channel. */
+static RsslBuffer* _rsslSocketReadLocked(rsslChannelImpl* rsslChnlImpl, RsslSocketChannel *rsslSocketChannel, RsslReadOutArgs *readOutArgs, RsslRet *readRet, RsslError *error)
 {
 	rtr_msgb_t     *ripcBuffer = 0;
 	RsslRet        ipcReadRet;
@@ -8542,23 +8576,6 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnl
 	RsslInt32      inBytes = 0;
 	RsslInt32      uncompInBytes = 0;
 	rsslAssemblyBuffer *rsslAssemblyBuf = 0;
-	RsslSocketChannel  *rsslSocketChannel = (RsslSocketChannel*)rsslChnlImpl->transportInfo;
-
-	if (IPC_NULL_PTR(rsslSocketChannel, "rsslSocketRead", "rsslSocketChannel", error))
-		return NULL;
-
-	if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
-	{
-#ifdef MUTEX_DEBUG
-	  printf("LOCK rsslChnlImpl->chanMutex -- rsslSocketRead\n");
-#endif
-
-	  if (RSSL_MUTEX_LOCK(&rsslChnlImpl->chanMutex))
-	  {
-		*readRet = RSSL_RET_READ_IN_PROGRESS;
-		return NULL;
-	  }
-	}
 
 	/* if this channel has a returnBuffer - clean it */
 	if (rsslChnlImpl->returnBuffer.length)
@@ -8609,14 +8626,6 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnl
 			ripcMoreData = 1;
 		}
 
-		if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
-		{
-#ifdef MUTEX_DEBUG
-		  printf("UNLOCK rsslChnlImpl->chanMutex -- rsslSocketRead\n");
-#endif
-		  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
-		}
-
 		*readRet = ripcMoreData;
 
 		if ((rsslChnlImpl->debugFlags & RSSL_DEBUG_RSSL_DUMP_IN) && (rsslChnlImpl->returnBuffer.length))
@@ -8725,14 +8734,6 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnl
 			if (!rsslAssemblyBuf || !rsslAssemblyBuf->buffer.data)
 			{
 				/* error */
-				if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
-				{
-#ifdef MUTEX_DEBUG
-				  printf("UNLOCK rsslChnlImpl->chanMutex -- rsslSocketRead\n");
-#endif
-				  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
-				}
-				
 				if (rsslAssemblyBuf)
 					_rsslFree(rsslAssemblyBuf);
 
@@ -8801,7 +8802,16 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnl
 				/* if we are fragmenting, we have nothing to return in this case so we need to return NULL */
 				returnNull = 2;
 
-				rsslHashTableInsertLink(&(rsslChnlImpl->assemblyBuffers), &(rsslAssemblyBuf->link1), rsslAssemblyBuf, &hashSum);
+				if (rsslHashTableInsertLink(&(rsslChnlImpl->assemblyBuffers), &(rsslAssemblyBuf->link1), rsslAssemblyBuf, &hashSum) != RSSL_RET_SUCCESS)
+				{
+					_rsslFree(rsslAssemblyBuf->buffer.data);
+					_rsslFree(rsslAssemblyBuf);
+
+					_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_FAILURE, 0);
+					snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> Error: 1001 rsslSocketRead() Cannot allocate memory to track fragmented message.\n", __FILE__, __LINE__);
+					*readRet = RSSL_RET_FAILURE;
+					return NULL;
+				}
 
 				if (memoryDebug)
 					printf("inserting into assemblyBuffers hash\n");
@@ -8823,6 +8833,7 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnl
 					*readRet = ripcMoreData;
 				else
 					*readRet = RSSL_RET_READ_PING;
+				/* nothing to unlock here; the caller releases the channel mutex on every return */
 				return NULL;
 			}
 
@@ -8836,14 +8847,6 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnl
 			if (!rsslHashLink || !rsslAssemblyBuf->buffer.data)
 			{
 				/* error */
-				if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
-				{
-#ifdef MUTEX_DEBUG
-				  printf("UNLOCK rsslChnlImpl->chanMutex -- rsslSocketRead\n");
-#endif
-				  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
-				}
-				
 				if (rsslAssemblyBuf)
 					_rsslFree(rsslAssemblyBuf);
 
@@ -8883,14 +8886,6 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnl
 				returnNull = 2;
 		}
 
-		if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
-		{
-#ifdef MUTEX_DEBUG
-		  printf("UNLOCK rsslChnlImpl->chanMutex -- rsslSocketRead\n");
-#endif
-		  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
-		}
-
 		if (ripcMoreData)
 		{
 			*readRet = ripcMoreData;
@@ -8943,13 +8938,6 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnl
 			
 				error->channel = &rsslChnlImpl->Channel;
 
-				if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
-				{
-#ifdef MUTEX_DEBUG
-				  printf("UNLOCK rsslChnlImpl->chanMutex -- rsslSocketRead\n");
-#endif
-				  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
-				}
 				*readRet = ipcReadRet;
 				return NULL;
 
@@ -8957,13 +8945,6 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnl
 				rsslChnlImpl->Channel.oldSocketId = (RsslSocket)rsslSocketChannel->oldStream;
 				rsslChnlImpl->Channel.socketId = (RsslSocket)rsslSocketChannel->stream;
 
-				if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
-				{
-#ifdef MUTEX_DEBUG
-				  printf("UNLOCK rsslChnlImpl->chanMutex -- rsslSocketRead\n");
-#endif
-				  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
-				}
 				*readRet = ipcReadRet;
 				return NULL;
 		
@@ -8976,13 +8957,6 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnl
 					readOutArgs->uncompressedBytesRead = uncompInBytes;
 				}
 
-				if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
-				{
-#ifdef MUTEX_DEBUG
-				  printf("UNLOCK rsslChnlImpl->chanMutex -- rsslSocketRead\n");
-#endif
-				  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
-				}
 				*readRet = 1;
 				return NULL;
 		
@@ -8993,30 +8967,204 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnl
 					readOutArgs->uncompressedBytesRead += uncompInBytes;
 				}
 
-				if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
-				{
-#ifdef MUTEX_DEBUG
-				  printf("UNLOCK rsslChnlImpl->chanMutex -- rsslSocketRead\n");
-#endif
-				  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
-				}
 				*readRet = ipcReadRet;
 				return NULL;
 		
 			default: /* should never get here */
-				if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
-				{
-#ifdef MUTEX_DEBUG
-				  printf("UNLOCK rsslChnlImpl->chanMutex -- rsslSocketRead");
-#endif
-				  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
-				}
 				*readRet = RSSL_RET_FAILURE;
 				return NULL;
 		}
 	}
 }
 
+/* rssl Socket Read */
+RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnlImpl, RsslReadOutArgs *readOutArgs, RsslRet *readRet, RsslError *error)
+{
+	RsslBuffer *retBuf;
+	RsslSocketChannel  *rsslSocketChannel = (RsslSocketChannel*)rsslChnlImpl->transportInfo;
+
+	if (IPC_NULL_PTR(rsslSocketChannel, "rsslSocketRead", "rsslSocketChannel", error))
+		return NULL;
+
+	if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+	{
+#ifdef MUTEX_DEBUG
+	  printf("LOCK rsslChnlImpl->chanMutex -- rsslSocketRead\n");
+#endif
+
+	  if (RSSL_MUTEX_LOCK(&rsslChnlImpl->chanMutex))
+	  {
+		*readRet = RSSL_RET_READ_IN_PROGRESS;
+		return NULL;
+	  }
+	}
+
+	retBuf = _rsslSocketReadLocked(rsslChnlImpl, rsslSocketChannel, readOutArgs, readRet, error);
+
+	if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+	{
+#ifdef MUTEX_DEBUG
+	  printf("UNLOCK rsslChnlImpl->chanMutex -- rsslSocketRead\n");
+#endif
+	  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
+	}
+
+	return retBuf;
+}
+
+/* rssl Socket Read Many */
+RSSL_RSSL_SOCKET_IMPL_FAST(RsslUInt32) rsslSocketReadMany(rsslChannelImpl* rsslChnlImpl, RsslBuffer *pBuffers, RsslUInt32 bufferCount, RsslReadOutArgs *readOutArgs, RsslRet *readRet, RsslError *error)
+{
+	RsslBuffer		*retBuf;
+	RsslReadOutArgs	msgOutArgs;
+	RsslUInt32		bufferIndex = 0;
+	RsslBool		inputBufferInUse = RSSL_FALSE;
+	RsslSocketChannel  *rsslSocketChannel = (RsslSocketChannel*)rsslChnlImpl->transportInfo;
+
+	if (IPC_NULL_PTR(rsslSocketChannel, "rsslSocketReadMany", "rsslSocketChannel", error))
+	{
+		*readRet = RSSL_RET_FAILURE;
+		return 0;
+	}
+
+	if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+	{
+#ifdef MUTEX_DEBUG
+	  printf("LOCK rsslChnlImpl->chanMutex -- rsslSocketReadMany\n");
+#endif
+
+	  if (RSSL_MUTEX_LOCK(&rsslChnlImpl->chanMutex))
+	  {
+		*readRet = RSSL_RET_READ_IN_PROGRESS;
+		return 0;
+	  }
+	}
+
+	readOutArgs->bytesRead = 0;
+	readOutArgs->uncompressedBytesRead = 0;
+
+	while (bufferIndex < bufferCount)
+	{
+		msgOutArgs.bytesRead = 0;
+		msgOutArgs.uncompressedBytesRead = 0;
+
+		retBuf = _rsslSocketReadLocked(rsslChnlImpl, rsslSocketChannel, &msgOutArgs, readRet, error);
+
+		readOutArgs->bytesRead += msgOutArgs.bytesRead;
+		readOutArgs->uncompressedBytesRead += msgOutArgs.uncompressedBytesRead;
+
+		if (retBuf != NULL)
+		{
+			pBuffers[bufferIndex++] = *retBuf;
+
+			if (retBuf->data >= rsslSocketChannel->inputBuffer->buffer
+					&& retBuf->data < rsslSocketChannel->inputBuffer->buffer + rsslSocketChannel->inputBuffer->maxLength)
+				inputBufferInUse = RSSL_TRUE;
+			else if (rsslChnlImpl->returnBufferOwner || !rsslChnlImpl->packedBuffer)
+			{
+				/* Reassembled fragments are freed and decompressed messages are overwritten
+				 * by the next read, so this buffer must be the last one handed out. */
+				break;
+			}
+		}
+
+		if (*readRet <= 0)
+			break;
+
+		/* Once the input buffer is fully consumed, the next read reuses it from the start. */
+		if (inputBufferInUse && rsslSocketChannel->inputBuffer->length == 0)
+			break;
+	}
+
+	if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+	{
+#ifdef MUTEX_DEBUG
+	  printf("UNLOCK rsslChnlImpl->chanMutex -- rsslSocketReadMany\n");
+#endif
+	  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
+	}
+
+	return bufferIndex;
+}
+
+/* Sets the length of a non-fragmented buffer's transport message, finishing the last packed message if needed. */
+static void _rsslSocketSetWriteLength(rsslBufferImpl *rsslBufImpl, rtr_msgb_t *ripcBuffer)
+{
+	/* packed case */
+	if (rsslBufImpl->packingOffset > 0)
+	{
+		RsslUInt16 bufLength;
+
+		/* if the length is zero, then there is no message at the end. */
+		/* We can take out the space we allocated for its length */
+		if (rsslBufImpl->buffer.length == 0)
+		{
+			rsslBufImpl->packingOffset -= 2;
+		}
+		else
+		{
+			bufLength = rsslBufImpl->buffer.length;
+			rwfPut16((ripcBuffer->buffer + rsslBufImpl->packingOffset - 2), bufLength);	/* fill in the length of the last message */
+			rsslBufImpl->packingOffset += rsslBufImpl->buffer.length;					/* advance the packing offset to include this last message */
+		}
+		ripcBuffer->length = rsslBufImpl->packingOffset;		/* the packing offset is the entire length of everything in the buffer we want to send */
+	}
+	else
+	{
+		/* standard case - buffer is within size bounds */
+		/* make sure rssl buffer matches ripcbuffer size */
+		ripcBuffer->length = rsslBufImpl->buffer.length;
+	}
+
+	ripcBuffer->priority = rsslBufImpl->priority;
+}
+
+/* Moves a written buffer from the active list to the free buffer list.  The caller must hold the channel mutex. */
+static void _rsslSocketFreeWrittenBuffer(rsslChannelImpl *rsslChnlImpl, rsslBufferImpl *rsslBufImpl)
+{
+	if (rsslQueueLinkInAList(&(rsslBufImpl->link1)))
+	{
+		rsslQueueRemoveLink(&(rsslChnlImpl->activeBufferList), &(rsslBufImpl->link1));
+		if (memoryDebug)
+			printf("removing from activeBufferList\n");
+	}
+
+	_rsslCleanBuffer(rsslBufImpl);
+	if (memoryDebug)
+		printf("adding to freeBufferList\n");
+
+	rsslInitQueueLink(&(rsslBufImpl->link1));
+	rsslQueueAddLinkToBack(&(rsslChnlImpl->freeBufferList), &(rsslBufImpl->link1));
+}
+
+/* Releases a run of written buffers under a single channel mutex acquisition. */
+static void _rsslSocketFreeWrittenBuffers(rsslChannelImpl *rsslChnlImpl, RsslBuffer **pBuffers, RsslUInt32 bufferCount)
+{
+	RsslUInt32 bufferIndex;
+
+	if (bufferCount == 0)
+		return;
+
+	if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+	{
+#ifdef MUTEX_DEBUG
+	  printf("LOCK rsslChnlImpl->chanMutex -- rsslSocketWriteMany\n");
+#endif
+	  (void) RSSL_MUTEX_LOCK(&rsslChnlImpl->chanMutex);
+	}
+
+	for (bufferIndex = 0; bufferIndex < bufferCount; ++bufferIndex)
+		_rsslSocketFreeWrittenBuffer(rsslChnlImpl, (rsslBufferImpl*)pBuffers[bufferIndex]);
+
+	if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+	{
+#ifdef MUTEX_DEBUG
+	  printf("UNLOCK rsslChnlImpl->chanMutex -- rsslSocketWriteMany\n");
+#endif
+	  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
+	}
+}
+
 /* rssl Socket Write */
 RSSL_RSSL_SOCKET_IMPL_FAST(RsslRet) rsslSocketWrite(rsslChannelImpl *rsslChnlImpl, rsslBufferImpl *rsslBufImpl, RsslWriteInArgs *writeInArgs, 
 	RsslWriteOutArgs *writeOutArgs, RsslError *error)
@@ -9038,34 +9186,7 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslRet) rsslSocketWrite(rsslChannelImpl *rsslChnlImp
 	if ((*ripcBuffer) && (!(rsslBufImpl->fragmentationFlag)) && (rsslBufImpl->writeCursor == 0))
 	{
 		/* no fragmentation */
-
-		/* packed case */
-		if (rsslBufImpl->packingOffset > 0)
-		{
-			RsslUInt16 bufLength;
-
-			/* if the length is zero, then there is no message at the end. */
-			/* We can take out the space we allocated for its length */
-			if (rsslBufImpl->buffer.length == 0)
-			{
-				rsslBufImpl->packingOffset -= 2;
-			}
-			else
-			{
-				bufLength = rsslBufImpl->buffer.length;
-				rwfPut16(((*ripcBuffer)->buffer + rsslBufImpl->packingOffset - 2), bufLength);	/* fill in the length of the last message */
-				rsslBufImpl->packingOffset += rsslBufImpl->buffer.length;						/* advance the packing offset to include this last message */
-			}
-			(*ripcBuffer)->length = rsslBufImpl->packingOffset;		/* the packing offset is the entire length of everything in the buffer we want to send */
-		}
-		else
-		{
-			/* standard case - buffer is within size bounds */
-			/* make sure rssl buffer matches ripcbuffer size */
-			(*ripcBuffer)->length = rsslBufImpl->buffer.length;
-		}
-
-		(*ripcBuffer)->priority = rsslBufImpl->priority;
+		_rsslSocketSetWriteLength(rsslBufImpl, *ripcBuffer);
 		
 		retVal = ipcWriteSession(rsslSocketChannel, rsslBufImpl, writeFlags, (RsslInt32*)&outBytes, (RsslInt32*)&uncompOutBytes, (writeFlags & RSSL_WRITE_DIRECT_SOCKET_WRITE) != 0, error);
 
@@ -9243,28 +9364,6 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslRet) rsslSocketWrite(rsslChannelImpl *rsslChnlImp
 	{
 		/* if its a successful write ripc should have freed its buffer so we
 			should follow suit and free the RsslBuffer here */
-		/* first remove it from the list */
-		if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
-		{
-#ifdef MUTEX_DEBUG
-		  printf("LOCK rsslChnlImpl->chanMutex -- rsslSocketWrite\n");
-#endif
-		  (void) RSSL_MUTEX_LOCK(&rsslChnlImpl->chanMutex);
-		}
-		if (rsslQueueLinkInAList(&(rsslBufImpl->link1)))
-		{
-			rsslQueueRemoveLink(&(rsslChnlImpl->activeBufferList), &(rsslBufImpl->link1));
-			if (memoryDebug)
-				printf("removing from activeBufferList\n");
-		}
-		if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
-		{
-#ifdef MUTEX_DEBUG
-		  printf("UNLOCK rsslChnlImpl->chanMutex -- rsslSocketWrite\n");
-#endif
-		  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
-		}
-	
 		if (rsslBufImpl->writeCursor > 0)
 		{
 			/* if we get here, the message has been written fully so reset writeCursor and fragId */
@@ -9277,11 +9376,7 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslRet) rsslSocketWrite(rsslChannelImpl *rsslChnlImp
 			(*ripcBuffer)->priority = rsslBufImpl->priority;
 		}
 
-		/* now add to free buffer list */
-		_rsslCleanBuffer(rsslBufImpl);
-		if (memoryDebug)
-			printf("adding to freeBufferList\n");
-
+		/* move it from the active list to the free buffer list, under one lock */
 		if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
 		{
 #ifdef MUTEX_DEBUG
@@ -9289,8 +9384,7 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslRet) rsslSocketWrite(rsslChannelImpl *rsslChnlImp
 #endif
 		  (void) RSSL_MUTEX_LOCK(&rsslChnlImpl->chanMutex);
 		}
-		rsslInitQueueLink(&(rsslBufImpl->link1));
-		rsslQueueAddLinkToBack(&(rsslChnlImpl->freeBufferList), &(rsslBufImpl->link1));
+		_rsslSocketFreeWrittenBuffer(rsslChnlImpl, rsslBufImpl);
 		if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
 		{
 #ifdef MUTEX_DEBUG
@@ -9308,6 +9402,128 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslRet) rsslSocketWrite(rsslChannelImpl *rsslChnlImp
 	}
 }
 
+/* rssl Socket Write Many */
+RSSL_RSSL_SOCKET_IMPL_FAST(RsslUInt32) rsslSocketWriteMany(rsslChannelImpl *rsslChnlImpl, RsslBuffer **pBuffers, RsslUInt32 bufferCount, RsslWriteInArgs *writeInArgs,
+	RsslWriteOutArgs *writeOutArgs, RsslRet *pResults, RsslRet *writeRet, RsslError *error)
+{
+	RsslRet retVal = RSSL_RET_SUCCESS;
+	RsslUInt32 bufferIndex;
+	RsslUInt32 runStart = 0;
+	RsslInt32 outBytes;
+	RsslInt32 uncompOutBytes;
+	RsslWriteInArgs fragInArgs;
+	RsslWriteOutArgs fragOutArgs;
+	RsslUInt32 writeFlags = writeInArgs->writeInFlags & ~RSSL_WRITE_DIRECT_SOCKET_WRITE;
+	RsslSocketChannel *rsslSocketChannel = (RsslSocketChannel*)rsslChnlImpl->transportInfo;
+
+	if (IPC_NULL_PTR(rsslSocketChannel, "rsslSocketWriteMany", "rsslSocketChannel", error))
+	{
+		*writeRet = RSSL_RET_FAILURE;
+		return 0;
+	}
+
+	fragInArgs = *writeInArgs;
+	fragInArgs.writeInFlags = writeFlags;
+
+#ifdef MUTEX_DEBUG
+	printf("LOCK rsslSocketChannel -- rsslSocketWriteMany (start)\n");
+#endif
+	IPC_MUTEX_LOCK(rsslSocketChannel);
+
+	for (bufferIndex = 0; bufferIndex < bufferCount; ++bufferIndex)
+	{
+		rsslBufferImpl *rsslBufImpl = (rsslBufferImpl*)pBuffers[bufferIndex];
+		rtr_msgb_t *ripcBuffer = (rtr_msgb_t*)rsslBufImpl->bufferInfo;
+
+		outBytes = 0;
+		uncompOutBytes = 0;
+
+		if (ripcBuffer && !rsslBufImpl->fragmentationFlag && rsslBufImpl->writeCursor == 0)
+		{
+			/* Frame the message and append it to its priority queue; nothing is sent until the flush below. */
+			_rsslSocketSetWriteLength(rsslBufImpl, ripcBuffer);
+			retVal = ipcIntWriteSession(rsslSocketChannel, rsslBufImpl, writeFlags, &outBytes, &uncompOutBytes, 0, error);
+
+			if (retVal == RSSL_RET_FAILURE)
+			{
+				/* if write fails we should close socket; this buffer is not freed */
+				rsslChnlImpl->Channel.state = RSSL_CH_STATE_CLOSED;
+				error->channel = &rsslChnlImpl->Channel;
+			}
+		}
+		else
+		{
+			/* Fragmented messages need the channel mutex for their fragment ID and may flush to get
+			 * more buffers, so they go through rsslSocketWrite, which also releases the buffer. 
+			 * Release the run queued before this one first so the buffers stay in order. */
+#ifdef MUTEX_DEBUG
+			printf("UNLOCK rsslSocketChannel -- rsslSocketWriteMany (before rsslSocketWrite)\n");
+#endif
+			IPC_MUTEX_UNLOCK(rsslSocketChannel);
+
+			_rsslSocketFreeWrittenBuffers(rsslChnlImpl, pBuffers + runStart, bufferIndex - runStart);
+			runStart = bufferIndex;
+
+			rsslClearWriteOutArgs(&fragOutArgs);
+			retVal = rsslSocketWrite(rsslChnlImpl, rsslBufImpl, &fragInArgs, &fragOutArgs, error);
+			outBytes = (RsslInt32)fragOutArgs.bytesWritten;
+			uncompOutBytes = (RsslInt32)fragOutArgs.uncompressedBytesWritten;
+
+			if (retVal >= RSSL_RET_SUCCESS || retVal == RSSL_RET_WRITE_FLUSH_FAILED)
+				runStart = bufferIndex + 1;
+
+#ifdef MUTEX_DEBUG
+			printf("LOCK rsslSocketChannel -- rsslSocketWriteMany (after rsslSocketWrite)\n");
+#endif
+			IPC_MUTEX_LOCK(rsslSocketChannel);
+		}
+
+		if (pResults)
+			pResults[bufferIndex] = retVal;
+
+		/* RSSL_RET_WRITE_FLUSH_FAILED still means the buffer was written. */
+		if (retVal < RSSL_RET_SUCCESS && retVal != RSSL_RET_WRITE_FLUSH_FAILED)
+			break;
+
+		writeOutArgs->bytesWritten += (RsslUInt32)outBytes;
+		writeOutArgs->uncompressedBytesWritten += (RsslUInt32)uncompOutBytes;
+
+		if (rsslChnlImpl->Channel.state != RSSL_CH_STATE_ACTIVE)
+		{
+			++bufferIndex;
+			break;
+		}
+	}
+
+	*writeRet = retVal;
+
+	/* Send everything queued with one flush; report it only if writing did not fail,
+	 * so that the error from the buffer that stopped the batch is not overwritten. */
+	if (bufferIndex > 0 && rsslChnlImpl->Channel.state == RSSL_CH_STATE_ACTIVE
+			&& (retVal >= RSSL_RET_SUCCESS || retVal == RSSL_RET_WRITE_FLUSH_FAILED))
+	{
+		*writeRet = ipcFlushSession(rsslSocketChannel, error);
+
+		if (*writeRet < RSSL_RET_SUCCESS)
+		{
+			/* if this fails, close socket */
+			rsslChnlImpl->Channel.state = RSSL_CH_STATE_CLOSED;
+			error->channel = &rsslChnlImpl->Channel;
+		}
+	}
+
+#ifdef MUTEX_DEBUG
+	printf("UNLOCK rsslSocketChannel -- rsslSocketWriteMany (end)\n");
+#endif
+	IPC_MUTEX_UNLOCK(rsslSocketChannel);
+
+	/* The buffers that stopped the batch, if any, are not released. */
+	if (runStart < bufferIndex)
+		_rsslSocketFreeWrittenBuffers(rsslChnlImpl, pBuffers + runStart, bufferIndex - runStart);
+
+	return bufferIndex;
+}
+
 /* rssl Socket GetBuffer */
 RSSL_RSSL_SOCKET_IMPL_FAST(rsslBufferImpl*) rsslSocketGetBuffer(rsslChannelImpl *rsslChnlImpl, RsslUInt32 size, RsslBool packedBuffer, RsslError *error)
 {
@@ -9543,6 +9759,100 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslRet) rsslSocketFlush(rsslChannelImpl *rsslChnlImp
 	return retVal;
 }
 
+/* rssl Socket FlushMany
+ * Channels on io_uring queue their writes on this thread's ring during the first pass, and all of
+ * them are submitted with one io_uring_enter() call; a second pass then collects each result.
+ * Other channels are flushed in the first pass as usual.  The session mutexes are held throughout,
+ * since the queued writes refer to the channels' output buffers; they are taken in address order. */
+RSSL_RSSL_SOCKET_IMPL_FAST(void) rsslSocketFlushMany(rsslChannelImpl **rsslChnlImpls, RsslUInt32 channelCount, RsslRet *pResults, RsslError **pErrors)
+{
+	RsslSocketChannel	*rsslSocketChannel;
+	RsslUInt32			order[RSSL_MAX_FLUSH_MANY];
+	RsslInt32			savedOutList[RSSL_MAX_FLUSH_MANY];
+	RsslUInt32			i, j, tmp;
+
+	if (channelCount > RSSL_MAX_FLUSH_MANY)
+		channelCount = RSSL_MAX_FLUSH_MANY;
+
+	/* sort by mutex so that concurrent callers lock in the same order */
+	for (i = 0; i < channelCount; ++i)
+	{
+		order[i] = i;
+		for (j = i; j > 0 && ((RsslSocketChannel*)rsslChnlImpls[order[j - 1]]->transportInfo)->mutex
+				> ((RsslSocketChannel*)rsslChnlImpls[order[j]]->transportInfo)->mutex; --j)
+		{
+			tmp = order[j]; order[j] = order[j - 1]; order[j - 1] = tmp;
+		}
+	}
+
+	for (i = 0; i < channelCount; ++i)
+	{
+		rsslSocketChannel = (RsslSocketChannel*)rsslChnlImpls[order[i]]->transportInfo;
+
+		/* the same channel may be listed more than once */
+		if (i > 0 && rsslSocketChannel->mutex && rsslSocketChannel->mutex == ((RsslSocketChannel*)rsslChnlImpls[order[i - 1]]->transportInfo)->mutex)
+			continue;
+
+#ifdef MUTEX_DEBUG
+		printf("LOCK rsslSocketChannel -- rsslSocketFlushMany (start)\n");
+#endif
+		IPC_MUTEX_LOCK(rsslSocketChannel);
+	}
+
+#ifdef RIPC_IO_URING
+	ipcUringBatchBegin();
+#endif
+
+	for (i = 0; i < channelCount; ++i)
+	{
+		rsslSocketChannel = (RsslSocketChannel*)rsslChnlImpls[i]->transportInfo;
+		savedOutList[i] = rsslSocketChannel->currentOutList;
+		pResults[i] = ipcFlushSession(rsslSocketChannel, pErrors[i]);
+	}
+
+#ifdef RIPC_IO_URING
+	if (ipcUringBatchEnd() > 0)
+	{
+		for (i = 0; i < channelCount; ++i)
+		{
+			rsslSocketChannel = (RsslSocketChannel*)rsslChnlImpls[i]->transportInfo;
+
+			if (pResults[i] < RSSL_RET_SUCCESS || rsslSocketChannel->transportFuncs != &uringTransFuncs
+					|| !ipcUringWriteReady(rsslSocketChannel->transportInfo))
+				continue;
+
+			/* rebuild the same write vector and account for what was written */
+			rsslSocketChannel->currentOutList = savedOutList[i];
+			pResults[i] = ipcFlushSession(rsslSocketChannel, pErrors[i]);
+		}
+	}
+#endif
+
+	for (i = channelCount; i > 0; --i)
+	{
+		rsslSocketChannel = (RsslSocketChannel*)rsslChnlImpls[order[i - 1]]->transportInfo;
+
+		if (i > 1 && rsslSocketChannel->mutex && rsslSocketChannel->mutex == ((RsslSocketChannel*)rsslChnlImpls[order[i - 2]]->transportInfo)->mutex)
+			continue;
+
+#ifdef MUTEX_DEBUG
+		printf("UNLOCK rsslSocketChannel -- rsslSocketFlushMany (end)\n");
+#endif
+		IPC_MUTEX_UNLOCK(rsslSocketChannel);
+	}
+
+	for (i = 0; i < channelCount; ++i)
+	{
+		if (pResults[i] < RSSL_RET_SUCCESS)
+		{
+			/* if this fails, close socket */
+			rsslChnlImpls[i]->Channel.state = RSSL_CH_STATE_CLOSED;
+
+			pErrors[i]->channel = &rsslChnlImpls[i]->Channel;
+		}
+	}
+}
+
 /* rssl Socket Ping */
 RSSL_RSSL_SOCKET_IMPL_FAST(RsslRet) rsslSocketPing(rsslChannelImpl *rsslChnlImpl, RsslError *error)
 {
@@ -9927,6 +10237,10 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslRet) rsslSocketSrvrIoctl(rsslServerImpl *rsslSrvr
 			}
 		}
 		break;
+		case RSSL_IO_URING:
+			/* applies to channels accepted from now on */
+			rsslServerSocketChannel->ioUring = (iValue ? 1 : 0);
+		break;
 		default:
 		{
 			/* error */
@@ -10264,6 +10578,15 @@ printf("UNLOCK rsslSocketChannel -- rsslSocketIoctl\n");
 		}
 		break;
 
+	case RSSL_IO_URING:
+		rsslSocketChannel->ioUring = (iValue ? 1 : 0);
+#ifdef RIPC_IO_URING
+		/* otherwise this happens when the channel becomes active */
+		if (rsslChnlImpl->Channel.state == RSSL_CH_STATE_ACTIVE)
+			ipcUringAttach(rsslSocketChannel);
+#endif
+		break;
+
 	default:
 		_rsslSetError(error, (RsslChannel*)(&rsslChnlImpl->Channel), RSSL_RET_FAILURE, 0);
 		snprintf(error->text, MAX_RSSL_ERROR_TEXT,
@@ -10483,6 +10806,15 @@ RsslInt32 ipcInitialize(RsslInt32 numServers, RsslInt32 numClients, RsslInitiali
 
 		ipcSetSockFuncs();
 
+#ifdef RIPC_IO_URING
+		ipcUringInitialize();
+		uringTransFuncs = transFuncs[RSSL_CONN_TYPE_SOCKET];
+		uringTransFuncs.shutdownTransport = ipcUringShutdown;
+		uringTransFuncs.readTransport = ipcUringRead;
+		uringTransFuncs.writeTransport = ipcUringWrite;
+		uringTransFuncs.writeVTransport = ipcUringWriteV;
+#endif
+
 		for (i = 0; i <= RSSL_COMP_MAX_TYPE; i++)
 		{
 			compressFuncs[i].compressInit = 0;
@@ -10853,9 +11185,12 @@ RsslRet rsslSocketSetChannelFunctions()
 	funcs.channelPackBuffer = rsslSocketPackBuffer;
 	funcs.channelPing = rsslSocketPing;
 	funcs.channelRead = rsslSocketRead;
+	funcs.channelReadMany = rsslSocketReadMany;
 	funcs.channelReconnect = rsslSocketReconnect;
 	funcs.channelReleaseBuffer = rsslSocketReleaseBuffer;
 	funcs.channelWrite = rsslSocketWrite;
+	funcs.channelWriteMany = rsslSocketWriteMany;
+	funcs.channelFlushMany = rsslSocketFlushMany;
 	funcs.initChannel = rsslSocketInitChannel;
 	
 	return(rsslSetTransportChannelFunc(RSSL_SOCKET_TRANSPORT,&funcs));
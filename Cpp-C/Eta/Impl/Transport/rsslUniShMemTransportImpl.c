@@ -979,9 +979,12 @@ RsslRet rsslUniShMemSetChannelFunctions()
 	funcs.channelPackBuffer = rsslUniShMemPackBuffer;
 	funcs.channelPing = rsslUniShMemPing;
 	funcs.channelRead = rsslUniShMemRead;
+	funcs.channelReadMany = NULL;
 	funcs.channelReconnect = rsslUniShMemReconnect;
 	funcs.channelReleaseBuffer = rsslUniShMemReleaseBuffer;
 	funcs.channelWrite = rsslUniShMemWrite;
+	funcs.channelWriteMany = NULL;
+	funcs.channelFlushMany = NULL;
 	funcs.initChannel = rsslUniShMemInitChannel;
 	
 	return(rsslSetTransportChannelFunc(RSSL_UNIDIRECTION_SHMEM_TRANSPORT,&funcs));
@@ -0,0 +1,71 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright Thomson Reuters 2018. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#ifndef __ripcuring_h
+#define __ripcuring_h
+
+/* io_uring backend for RSSL_CONN_TYPE_SOCKET channels.
+ * A channel that requests it with the RSSL_IO_URING ioctl is switched over to these
+ * functions once it is active.  Reads and writes are then submitted as SQEs instead of
+ * calling recv()/writev() directly.  Each thread has one ring, shared by every channel
+ * it services, so a reactor worker owns a single ring for all of its channels.
+ * Between ipcUringBatchBegin() and ipcUringBatchEnd(), writes are queued on the
+ * thread's ring and submitted together with one io_uring_enter() call.
+ * Channel readiness is still reported on the socket descriptor, so applications
+ * (and the reactor) do not need to change how they wait for I/O. */
+
+#include "rtr/ripcutils.h"
+
+#if defined(Linux) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define RIPC_IO_URING
+#endif
+#endif
+
+#ifdef RIPC_IO_URING
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Checks whether the kernel supports the io_uring operations this backend uses.
+ * Called once while the transport is initialized; the result does not change afterwards. */
+void ipcUringInitialize();
+
+/* Creates io_uring state for a connected, non-blocking socket.
+ * Returns the new transport information, or NULL if io_uring is unavailable
+ * (e.g. the kernel does not support it or it is disabled), in which case the
+ * caller keeps using the regular socket functions. */
+void *ipcUringNewConn(RsslSocket fd);
+
+/* Transport functions operating on the value returned by ipcUringNewConn(). */
+int ipcUringRead(void *transport, char *buf, int max_len, ripcRWFlags flags, RsslError *error);
+int ipcUringWrite(void *transport, char *buf, int outLen, ripcRWFlags flags, RsslError *error);
+int ipcUringWriteV(void *transport, ripcIovType *iov, int iovcnt, int outLen, ripcRWFlags flags, RsslError *error);
+int ipcUringShutdown(void *transport);
+
+/* Starts queueing writes on the calling thread's ring.  A queued write reports that nothing
+ * was written; once ipcUringBatchEnd() has run, the caller must write the same vector again
+ * to collect the result. */
+void ipcUringBatchBegin();
+
+/* Submits the queued writes with one io_uring_enter() call and waits for them to complete.
+ * Returns the number of writes queued since ipcUringBatchBegin(); each of them is then ready
+ * to be collected (see ipcUringWriteReady()). */
+int ipcUringBatchEnd();
+
+/* Returns 1 if a batched write on this transport completed and has not been collected yet. */
+int ipcUringWriteReady(void *transport);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif
+
+#endif
@@ -50,6 +50,9 @@ extern unsigned char memoryDebug;
 /* number of pool buffers */
 #define RSSL_POOL_SIZE 1048576  
 
+/* Most channels passed to one channelFlushMany call */
+#define RSSL_MAX_FLUSH_MANY 64
+
 
 /* rssl flag settings */
 #define CLIENT_TO_SERVER 0x1
@@ -218,10 +221,16 @@ typedef struct RsslTransChannelFuncs {
 	RsslRet   (*channelClose)( rsslChannelImpl* rsslChnlImpl, RsslError *error );
 	/* Reads from the transport, returns buffer  */
 	RsslBuffer*  (RTR_FASTCALL *channelRead)( rsslChannelImpl* rsslChnlImpl, RsslReadOutArgs *readOutArgs, RsslRet *readRet, RsslError *error );
+	/* Reads several messages from the transport in one call, returns number of buffers filled.  May be NULL if the transport does not support it. */
+	RsslUInt32  (RTR_FASTCALL *channelReadMany)( rsslChannelImpl* rsslChnlImpl, RsslBuffer *pBuffers, RsslUInt32 bufferCount, RsslReadOutArgs *readOutArgs, RsslRet *readRet, RsslError *error );
 	/* Writes to the transport */
 	RsslRet     (RTR_FASTCALL *channelWrite)( rsslChannelImpl *rsslChnlImpl, rsslBufferImpl *rsslBufImpl, RsslWriteInArgs *writeInArgs, RsslWriteOutArgs *writeOutArgs, RsslError *error );
+	/* Queues several validated buffers and flushes them once, returns number of buffers written.  May be NULL if the transport does not support it. */
+	RsslUInt32  (RTR_FASTCALL *channelWriteMany)( rsslChannelImpl *rsslChnlImpl, RsslBuffer **pBuffers, RsslUInt32 bufferCount, RsslWriteInArgs *writeInArgs, RsslWriteOutArgs *writeOutArgs, RsslRet *pResults, RsslRet *writeRet, RsslError *error );
 	/* Flush data written to transport */
 	RsslRet   (RTR_FASTCALL *channelFlush)( rsslChannelImpl *rsslChnlImpl, RsslError *error );					
+	/* Flushes up to RSSL_MAX_FLUSH_MANY active channels of this transport together, storing each channel's flush result.  May be NULL if the transport does not support it. */
+	void      (RTR_FASTCALL *channelFlushMany)( rsslChannelImpl **rsslChnlImpls, RsslUInt32 channelCount, RsslRet *pResults, RsslError **pErrors );
 	/* Gets buffer used for writing to transport */
 	rsslBufferImpl*  (RTR_FASTCALL *channelGetBuffer)( rsslChannelImpl *rsslChnlImpl, RsslUInt32 size, RsslBool packedBuffer, RsslError *error );
 	/* Releases buffer used for failed write or unused buffer to transport */
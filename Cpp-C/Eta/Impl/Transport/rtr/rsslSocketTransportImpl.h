@@ -287,6 +287,7 @@ typedef struct {
 	RsslBool	server_blocking;	/* Perform server blocking operations */
 	RsslBool	session_blocking;	/* Perform session blocking operations */
 	RsslBool	tcp_nodelay;		/* Disable Nagle Algorithm */
+	RsslBool	ioUring;			/* Use io_uring for accepted channels, where supported */
 	RsslInt32	connType;			/* Controls the connection type */
 	RsslUInt32	rsslFlags;			/* this flag keeps track of client to server and server to client ping*/
 	RsslUInt8	pingTimeout; 		/* ping timeout */
@@ -326,6 +327,7 @@ RTR_C_INLINE void rsslClearRsslServerSocketChannel(RsslServerSocketChannel *rssl
 	rsslServerSocketChannel->server_blocking = 0;
 	rsslServerSocketChannel->session_blocking = 0;
 	rsslServerSocketChannel->tcp_nodelay = 0;
+	rsslServerSocketChannel->ioUring = 0;
 	rsslServerSocketChannel->connType = 0;
 	rsslServerSocketChannel->rsslFlags = 0;
 	rsslServerSocketChannel->pingTimeout = 0;
@@ -354,6 +356,7 @@ typedef struct
 	char				*proxyPort;			/* proxy port number */
 	RsslBool			blocking : 1;		/* Perform blocking operations */
 	RsslBool			tcp_nodelay : 1;	/* Disable Nagle Algorithm */
+	RsslBool			ioUring : 1;		/* Use io_uring for socket I/O once active, where supported */
 	RsslUInt32			compression;		/* Use compression defined by server, otherwise none */
 	RsslUInt32			numConnections;		/* Number of concurrent connections for an extended line connection */
 	RsslUInt32			numGuarOutputBufs;	/* Number of guaranteed output buffers */
@@ -474,6 +477,7 @@ RTR_C_INLINE void ripcClearRsslSocketChannel(RsslSocketChannel *rsslSocketChanne
 
 	rsslSocketChannel->mutex = 0;
 	rsslSocketChannel->blocking = 0;
+	rsslSocketChannel->ioUring = 0;
 	rsslSocketChannel->mountNak = 0;
 	rsslSocketChannel->inDecompress = 0;
 	rsslSocketChannel->outCompression = (RsslCompTypes)0;
@@ -667,12 +671,21 @@ RsslRet rsslSocketCloseChannel(rsslChannelImpl* rsslChnlImpl, RsslError *error);
 /* Contains code necessary to read from a socket connection (client or server side) */
 RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnlImpl, RsslReadOutArgs *readOutArgs, RsslRet *readRet, RsslError *error);
 
+/* Reads up to bufferCount messages from a socket connection under a single channel lock (client or server side) */
+RSSL_RSSL_SOCKET_IMPL_FAST(RsslUInt32) rsslSocketReadMany(rsslChannelImpl* rsslChnlImpl, RsslBuffer *pBuffers, RsslUInt32 bufferCount, RsslReadOutArgs *readOutArgs, RsslRet *readRet, RsslError *error);
+
 /* Contains code necessary to write/queue data going to a socket connection (client or server side) */
 RSSL_RSSL_SOCKET_IMPL_FAST(RsslRet) rsslSocketWrite(rsslChannelImpl *rsslChnlImpl, rsslBufferImpl *rsslBufImpl, RsslWriteInArgs *writeInArgs, RsslWriteOutArgs *writeOutArgs, RsslError *error);
 
+/* Queues several buffers on a socket connection and flushes them with one gathered write (client or server side) */
+RSSL_RSSL_SOCKET_IMPL_FAST(RsslUInt32) rsslSocketWriteMany(rsslChannelImpl *rsslChnlImpl, RsslBuffer **pBuffers, RsslUInt32 bufferCount, RsslWriteInArgs *writeInArgs, RsslWriteOutArgs *writeOutArgs, RsslRet *pResults, RsslRet *writeRet, RsslError *error);
+
 /* Contains code necessary to flush queued data to socket connection (client or server side) */
 RSSL_RSSL_SOCKET_IMPL_FAST(RsslRet) rsslSocketFlush(rsslChannelImpl *rsslChnlImpl, RsslError *error);
 
+/* Flushes several socket connections, submitting their io_uring writes together (client or server side) */
+RSSL_RSSL_SOCKET_IMPL_FAST(void) rsslSocketFlushMany(rsslChannelImpl **rsslChnlImpls, RsslUInt32 channelCount, RsslRet *pResults, RsslError **pErrors);
+
 /* Contains code necessary to obtain a buffer to put data in for writing to socket connection (client or server side) */
 RSSL_RSSL_SOCKET_IMPL_FAST(rsslBufferImpl*) rsslSocketGetBuffer(rsslChannelImpl *rsslChnlImpl, RsslUInt32 size, RsslBool packedBuffer, RsslError *error);
 
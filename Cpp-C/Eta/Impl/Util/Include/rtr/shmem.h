@@ -149,10 +149,16 @@ typedef struct
 
 
 int rtrShmSegCreate( rtrShmSeg *seg, const char *key, size_t size, char *errBuff );
+/* Same as rtrShmSegCreate, but the segment is not locked into memory. Used for large, read-mostly segments. */
+int rtrShmSegCreatePageable( rtrShmSeg *seg, const char *key, size_t size, char *errBuff );
 void rtrShmSegDestroy( rtrShmSeg *seg );
 char* rtrShmBytesReserve( rtrShmSeg *seg, size_t size );
+/* Removes the name of a segment so no new attachments can be made. Existing mappings remain valid. */
+void rtrShmSegUnlink( const char *key );
 
 int rtrShmSegAttach( rtrShmSeg *seg, const char *key, char *errBuff );
+/* Attaches read-only, preferably at the given address (0 lets the system choose). Pages are not prefaulted. */
+int rtrShmSegAttachReadOnly( rtrShmSeg *seg, const char *key, void *address, char *errBuff );
 void rtrShmSegDetach( rtrShmSeg *seg );
 char* rtrShmBytesAttach( char **loc, size_t size );
 
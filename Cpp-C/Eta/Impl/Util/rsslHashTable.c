@@ -27,26 +27,75 @@ RSSL_API RsslBool rsslHashU32Compare(void *pKey1, void *pKey2)
 /* U64 */
 
 RSSL_API RsslUInt32 rsslHashU64Sum(void *pKey)
-{ return (RsslUInt32)(*((RsslUInt64*)pKey)); }
+{
+	RsslUInt64 key = *((RsslUInt64*)pKey);
+	return (RsslUInt32)(key ^ (key >> 32));
+}
 
 RSSL_API RsslBool rsslHashU64Compare(void *pKey1, void *pKey2)
 { return (*(RsslUInt64*)pKey1) == (*(RsslUInt64*)pKey2); }
 
 /* RsslBuffer */
 
+#define RSSL_HASH_PRIME64_1 0x9E3779B185EBCA87ULL
+#define RSSL_HASH_PRIME64_2 0xC2B2AE3D27D4EB4FULL
+#define RSSL_HASH_PRIME64_3 0x165667B19E3779F9ULL
+
+#define RSSL_HASH_ROTL64(__x, __r) (((__x) << (__r)) | ((__x) >> (64 - (__r))))
+
+/* Mixes one 8-byte word into the hash. */
+#define RSSL_HASH_ROUND64(__hash, __word) \
+	do { \
+		(__hash) ^= (__word) * RSSL_HASH_PRIME64_2; \
+		(__hash) = RSSL_HASH_ROTL64((__hash), 31) * RSSL_HASH_PRIME64_1; \
+	} while (0)
+
+/* Hashes the buffer a word (8 bytes) at a time, in two independent lanes so consecutive multiplies 
+ * can overlap, rather than a byte at a time. Item names that share long prefixes (such as RICs) 
+ * still differ throughout the result. */
 RSSL_API RsslUInt32 rsslHashBufferSum(void *pKey)
 {
-	RsslUInt32 i;
-	RsslUInt32 hashSum = 0;
 	RsslBuffer *pBuffer = (RsslBuffer*)pKey;
+	const unsigned char *pData = (const unsigned char*)pBuffer->data;
+	RsslUInt32 length = pBuffer->length;
+	RsslUInt64 hash1 = RSSL_HASH_PRIME64_3 + length;
+	RsslUInt64 hash2 = RSSL_HASH_PRIME64_1;
+	RsslUInt64 word1, word2;
+
+	while (length >= 16)
+	{
+		memcpy(&word1, pData, 8);
+		memcpy(&word2, pData + 8, 8);
+		RSSL_HASH_ROUND64(hash1, word1);
+		RSSL_HASH_ROUND64(hash2, word2);
+		pData += 16;
+		length -= 16;
+	}
+
+	if (length >= 8)
+	{
+		memcpy(&word1, pData, 8);
+		RSSL_HASH_ROUND64(hash1, word1);
+		pData += 8;
+		length -= 8;
+	}
 
-	for(i = 0; i < pBuffer->length; ++i)
+	if (length > 0)
 	{
-		hashSum = (hashSum << 4) + (RsslUInt32)pBuffer->data[i];
-		hashSum ^= (hashSum >> 12);
+		word2 = 0;
+		memcpy(&word2, pData, length);
+		RSSL_HASH_ROUND64(hash2, word2);
 	}
 
-	return hashSum;
+	/* Combine the lanes and finish mixing, so every input bit can affect the low 32 bits. */
+	hash1 ^= RSSL_HASH_ROTL64(hash2, 27);
+	hash1 ^= hash1 >> 33;
+	hash1 *= RSSL_HASH_PRIME64_2;
+	hash1 ^= hash1 >> 29;
+	hash1 *= RSSL_HASH_PRIME64_3;
+	hash1 ^= hash1 >> 32;
+
+	return (RsslUInt32)hash1;
 }
 
 RSSL_API RsslBool rsslHashBufferCompare(void *pKey1, void *pKey2)
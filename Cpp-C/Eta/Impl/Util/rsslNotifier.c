@@ -10,12 +10,14 @@
 #include <stdlib.h>
 
 /* On windows, select is used for notification.
- * Otherwise poll is used. */
+ * Otherwise poll is used, unless epoll is requested via rsslCreateNotifierEx() on a platform that supports it. */
 #if defined(WIN32)
 #define FD_SETSIZE 6400
 #include <winsock2.h>
 #else
 #include <poll.h>
+#include <errno.h>
+#include <unistd.h>
 #endif
 
 typedef struct
@@ -26,11 +28,17 @@ typedef struct
 	void *_object;
 
 #ifndef WIN32
-	int _pollFdIndex; /* Array index of the pollfd associated with this event */
+	int _pollFdIndex; /* Array index of the pollfd associated with this event (also its index in the notifier's event array) */
 #else
 	SOCKET _fd;
 #endif
 
+#ifdef RSSL_NOTIFIER_EPOLL
+	int _epollFd; /* Descriptor registered with epoll for this event */
+	unsigned int _epollMask; /* EPOLL* flags currently registered for this event */
+	int _notifiedIndex; /* Index in notifiedEvents while notified, otherwise -1 */
+#endif
+
 } RsslNotifierEventImpl;
 
 typedef struct
@@ -46,6 +54,14 @@ typedef struct
 	fd_set _writeFds; /* Write fd_set */
 	fd_set _exceptFds; /* Except fd_set */
 #endif
+#ifdef RSSL_NOTIFIER_EPOLL
+	RsslNotifierType _notifierType; /* Mechanism used by this notifier */
+	int _epollFd; /* epoll instance; only used when _notifierType is RSSL_NT_EPOLL */
+	struct epoll_event *_epollEvents; /* Array of events returned by epoll_wait() */
+	char *_notifiedValid; /* Per-slot flag for notifiedEvents; cleared when the event in that slot is removed from the notifier */
+	RsslNotifierEventImpl **_badFdEvents; /* Events whose descriptor was found to be invalid; reported on the next wait */
+	int _badFdEventCount;
+#endif
 } RsslNotifierImpl;
 
 RSSL_API RsslNotifierEvent *rsslCreateNotifierEvent()
@@ -65,11 +81,207 @@ RSSL_API void *rsslNotifierEventGetObject(RsslNotifierEvent *pEvent)
 }
 
 
+#ifdef RSSL_NOTIFIER_EPOLL
+/* Grows the epoll-specific arrays along with the rest of the notifier's arrays. */
+static int _notifierEpollResize(RsslNotifierImpl *pNotifierImpl, int maxEvents)
+{
+	struct epoll_event *epollEvents;
+	char *notifiedValid;
+	RsslNotifierEventImpl **badFdEvents;
+
+	if ((epollEvents = (struct epoll_event*)realloc(pNotifierImpl->_epollEvents, maxEvents * sizeof(struct epoll_event))) == NULL)
+		return -1;
+	pNotifierImpl->_epollEvents = epollEvents;
+
+	if ((notifiedValid = (char*)realloc(pNotifierImpl->_notifiedValid, maxEvents * sizeof(char))) == NULL)
+		return -1;
+	pNotifierImpl->_notifiedValid = notifiedValid;
+
+	if ((badFdEvents = (RsslNotifierEventImpl**)realloc(pNotifierImpl->_badFdEvents, maxEvents * sizeof(RsslNotifierEventImpl*))) == NULL)
+		return -1;
+	pNotifierImpl->_badFdEvents = badFdEvents;
+
+	return 0;
+}
+
+/* Queues an event to be reported with RSSL_NESF_BAD_FD on the next wait. This is the epoll equivalent of POLLNVAL, since
+ * epoll silently drops closed descriptors instead of reporting them. */
+static void _notifierEpollQueueBadFd(RsslNotifierImpl *pNotifierImpl, RsslNotifierEventImpl *pNotifierEventImpl)
+{
+	int i;
+
+	for (i = 0; i < pNotifierImpl->_badFdEventCount; ++i)
+		if (pNotifierImpl->_badFdEvents[i] == pNotifierEventImpl)
+			return;
+
+	pNotifierImpl->_badFdEvents[pNotifierImpl->_badFdEventCount++] = pNotifierEventImpl;
+}
+
+/* Removes an event from the queue of events with invalid descriptors. */
+static void _notifierEpollUnqueueBadFd(RsslNotifierImpl *pNotifierImpl, RsslNotifierEventImpl *pNotifierEventImpl)
+{
+	int i;
+
+	for (i = 0; i < pNotifierImpl->_badFdEventCount; ++i)
+	{
+		if (pNotifierImpl->_badFdEvents[i] == pNotifierEventImpl)
+		{
+			pNotifierImpl->_badFdEvents[i] = pNotifierImpl->_badFdEvents[--pNotifierImpl->_badFdEventCount];
+			return;
+		}
+	}
+}
+
+/* Applies an epoll_ctl() operation for the event's descriptor and its current mask. 
+ * Negative descriptors are ignored (as poll() does). A descriptor that turns out to be closed is reported as RSSL_NESF_BAD_FD 
+ * on the next wait instead of failing the call. */
+static int _notifierEpollCtl(RsslNotifierImpl *pNotifierImpl, RsslNotifierEventImpl *pNotifierEventImpl, int op)
+{
+	struct epoll_event epollEvent;
+
+	if (pNotifierEventImpl->_epollFd < 0)
+		return 0;
+
+	memset(&epollEvent, 0, sizeof(epollEvent));
+	epollEvent.events = pNotifierEventImpl->_epollMask;
+	epollEvent.data.ptr = pNotifierEventImpl;
+
+	if (epoll_ctl(pNotifierImpl->_epollFd, op, pNotifierEventImpl->_epollFd, &epollEvent) == 0)
+		return 0;
+
+	switch(errno)
+	{
+		case EBADF:
+		case ENOENT:
+			_notifierEpollQueueBadFd(pNotifierImpl, pNotifierEventImpl);
+			return 0;
+		case EEXIST:
+			if (op == EPOLL_CTL_ADD)
+				return epoll_ctl(pNotifierImpl->_epollFd, EPOLL_CTL_MOD, pNotifierEventImpl->_epollFd, &epollEvent);
+			return -1;
+		default:
+			return -1;
+	}
+}
+
+/* Sets or clears flags in the event's epoll mask, updating the registration only if the mask actually changed. */
+static int _notifierEpollSetMask(RsslNotifierImpl *pNotifierImpl, RsslNotifierEventImpl *pNotifierEventImpl, unsigned int mask)
+{
+	if (pNotifierEventImpl->_epollMask == mask)
+		return 0;
+
+	pNotifierEventImpl->_epollMask = mask;
+	return _notifierEpollCtl(pNotifierImpl, pNotifierEventImpl, EPOLL_CTL_MOD);
+}
+
+/* Forgets any notification for an event that is leaving the notifier, so that the next wait does not touch it. */
+static void _notifierEpollDetachEvent(RsslNotifierImpl *pNotifierImpl, RsslNotifierEventImpl *pNotifierEventImpl)
+{
+	if (pNotifierEventImpl->_notifiedIndex >= 0)
+	{
+		pNotifierImpl->_notifiedValid[pNotifierEventImpl->_notifiedIndex] = 0;
+		pNotifierEventImpl->_notifiedIndex = -1;
+	}
+
+	_notifierEpollUnqueueBadFd(pNotifierImpl, pNotifierEventImpl);
+}
+
+static int _notifierEpollWait(RsslNotifierImpl *pNotifierImpl, long timeoutUsec)
+{
+	int i;
+	int ret;
+
+	/* Only the events notified by the previous wait can have flags set, so only those need to be cleared. */
+	for (i = 0; i < pNotifierImpl->base.notifiedEventCount; ++i)
+	{
+		if (pNotifierImpl->_notifiedValid[i])
+		{
+			RsslNotifierEventImpl *pNotifierEventImpl = (RsslNotifierEventImpl*)pNotifierImpl->base.notifiedEvents[i];
+			pNotifierEventImpl->base.notifiedFlags = 0;
+			pNotifierEventImpl->_notifiedIndex = -1;
+		}
+	}
+	pNotifierImpl->base.notifiedEventCount = 0;
+
+	/* Report any descriptors found to be invalid since the last wait. Don't block if there are any. */
+	for (i = 0; i < pNotifierImpl->_badFdEventCount; ++i)
+	{
+		RsslNotifierEventImpl *pNotifierEventImpl = pNotifierImpl->_badFdEvents[i];
+		pNotifierEventImpl->base.notifiedFlags = RSSL_NESF_BAD_FD;
+		pNotifierEventImpl->_notifiedIndex = pNotifierImpl->base.notifiedEventCount;
+		pNotifierImpl->_notifiedValid[pNotifierImpl->base.notifiedEventCount] = 1;
+		pNotifierImpl->base.notifiedEvents[pNotifierImpl->base.notifiedEventCount++] = &pNotifierEventImpl->base;
+	}
+	if (pNotifierImpl->_badFdEventCount > 0)
+		timeoutUsec = 0;
+	pNotifierImpl->_badFdEventCount = 0;
+
+	if (pNotifierImpl->base.notifiedEventCount == pNotifierImpl->_maxEvents)
+		return pNotifierImpl->base.notifiedEventCount;
+
+	ret = epoll_wait(pNotifierImpl->_epollFd, pNotifierImpl->_epollEvents, 
+			pNotifierImpl->_maxEvents - pNotifierImpl->base.notifiedEventCount, (int)(timeoutUsec/1000));
+	if (ret < 0)
+		return (pNotifierImpl->base.notifiedEventCount > 0 && errno == EINTR) ? pNotifierImpl->base.notifiedEventCount : ret;
+
+	for (i = 0; i < ret; ++i)
+	{
+		RsslNotifierEventImpl *pNotifierEventImpl = (RsslNotifierEventImpl*)pNotifierImpl->_epollEvents[i].data.ptr;
+		unsigned int revents = pNotifierImpl->_epollEvents[i].events;
+		int notifiedFlags = 0;
+
+		/* Errors and hangups are reported as readable, so that the read surfaces them. Otherwise a level-triggered set 
+		 * keeps returning the descriptor without it ever being serviced. */
+		if (revents & (EPOLLIN | EPOLLPRI | EPOLLERR | EPOLLHUP))
+			notifiedFlags |= RSSL_NESF_READ;
+
+		if (revents & EPOLLOUT)
+			notifiedFlags |= RSSL_NESF_WRITE;
+
+		if (!notifiedFlags)
+			continue;
+
+		if (pNotifierEventImpl->_notifiedIndex >= 0)
+		{
+			/* Already reported as a bad descriptor. */
+			pNotifierEventImpl->base.notifiedFlags |= notifiedFlags;
+			continue;
+		}
+
+		pNotifierEventImpl->base.notifiedFlags = notifiedFlags;
+		pNotifierEventImpl->_notifiedIndex = pNotifierImpl->base.notifiedEventCount;
+		pNotifierImpl->_notifiedValid[pNotifierImpl->base.notifiedEventCount] = 1;
+		pNotifierImpl->base.notifiedEvents[pNotifierImpl->base.notifiedEventCount++] = &pNotifierEventImpl->base;
+	}
+
+	return pNotifierImpl->base.notifiedEventCount;
+}
+#endif
+
 RSSL_API RsslNotifier *rsslCreateNotifier(int maxEventsHint)
+{
+	return rsslCreateNotifierEx(maxEventsHint, RSSL_NT_DEFAULT);
+}
+
+RSSL_API RsslNotifier *rsslCreateNotifierEx(int maxEventsHint, RsslNotifierType notifierType)
 {
 	RsslNotifierImpl *pNotifierImpl = (RsslNotifierImpl*)malloc(sizeof(RsslNotifierImpl));
 	memset(pNotifierImpl, 0, sizeof(RsslNotifierImpl));
 
+#ifdef RSSL_NOTIFIER_EPOLL
+	pNotifierImpl->_epollFd = -1;
+	if (notifierType == RSSL_NT_EPOLL)
+	{
+		pNotifierImpl->_notifierType = RSSL_NT_EPOLL;
+		if ((pNotifierImpl->_epollFd = epoll_create(maxEventsHint)) < 0
+				|| _notifierEpollResize(pNotifierImpl, maxEventsHint) < 0)
+		{
+			rsslDestroyNotifier(&pNotifierImpl->base);
+			return NULL;
+		}
+	}
+#endif
+
 	pNotifierImpl->_maxEvents = maxEventsHint;
 	pNotifierImpl->_events = (RsslNotifierEventImpl**)malloc(maxEventsHint * sizeof(RsslNotifierEventImpl**));
 	if (pNotifierImpl->_events == NULL)
@@ -111,6 +323,14 @@ RSSL_API void rsslDestroyNotifier(RsslNotifier *pNotifier)
 	pNotifierImpl->_pollFds = NULL;
 #endif
 
+#ifdef RSSL_NOTIFIER_EPOLL
+	if (pNotifierImpl->_epollFd >= 0)
+		close(pNotifierImpl->_epollFd);
+	free(pNotifierImpl->_epollEvents);
+	free(pNotifierImpl->_notifiedValid);
+	free(pNotifierImpl->_badFdEvents);
+#endif
+
 	free(pNotifierImpl);
 }
 
@@ -147,6 +367,11 @@ RSSL_API int rsslNotifierAddEvent(RsslNotifier *pNotifier, RsslNotifierEvent *pE
 			return -1;
 #endif
 
+#ifdef RSSL_NOTIFIER_EPOLL
+		if (pNotifierImpl->_notifierType == RSSL_NT_EPOLL && _notifierEpollResize(pNotifierImpl, pNotifierImpl->_maxEvents * 2) < 0)
+			return -1;
+#endif
+
 		pNotifierImpl->_maxEvents *= 2;
 		pNotifierImpl->_events = events;
 		pNotifierImpl->base.notifiedEvents = notifiedEvents;
@@ -165,6 +390,18 @@ RSSL_API int rsslNotifierAddEvent(RsslNotifier *pNotifier, RsslNotifierEvent *pE
 
 	pNotifierEventImpl->_object = object;
 
+#ifdef RSSL_NOTIFIER_EPOLL
+	if (pNotifierImpl->_notifierType == RSSL_NT_EPOLL)
+	{
+		pNotifierEventImpl->base.notifiedFlags = 0;
+		pNotifierEventImpl->_notifiedIndex = -1;
+		pNotifierEventImpl->_epollFd = (int)fd;
+		pNotifierEventImpl->_epollMask = 0;
+		if (_notifierEpollCtl(pNotifierImpl, pNotifierEventImpl, EPOLL_CTL_ADD) < 0)
+			return -1;
+	}
+#endif
+
 	pNotifierImpl->_events[pNotifierImpl->_eventCount] = pNotifierEventImpl;
 	++pNotifierImpl->_eventCount;
 	return 0;
@@ -178,6 +415,24 @@ RSSL_API int rsslNotifierUpdateEventFd(RsslNotifier *pNotifier, RsslNotifierEven
 
 	pNotifierEventImpl->_registeredFlags = 0;
 
+#ifdef RSSL_NOTIFIER_EPOLL
+	if (pNotifierImpl->_notifierType == RSSL_NT_EPOLL)
+	{
+		if (pNotifierEventImpl->_pollFdIndex >= pNotifierImpl->_eventCount 
+				|| pNotifierImpl->_events[pNotifierEventImpl->_pollFdIndex] != pNotifierEventImpl)
+			return -1; /* Not found. */
+
+		/* The old descriptor should already be closed, which removes it from the epoll set; remove it explicitly in case it isn't. */
+		_notifierEpollUnqueueBadFd(pNotifierImpl, pNotifierEventImpl);
+		if (pNotifierEventImpl->_epollFd >= 0)
+			epoll_ctl(pNotifierImpl->_epollFd, EPOLL_CTL_DEL, pNotifierEventImpl->_epollFd, NULL);
+
+		pNotifierImpl->_pollFds[pNotifierEventImpl->_pollFdIndex].fd = fd;
+		pNotifierEventImpl->_epollFd = (int)fd;
+		return _notifierEpollCtl(pNotifierImpl, pNotifierEventImpl, EPOLL_CTL_ADD);
+	}
+#endif
+
 	for (i = 0; i < pNotifierImpl->_eventCount; ++i)
 	{
 		if (pNotifierImpl->_events[i] == pNotifierEventImpl)
@@ -204,6 +459,32 @@ RSSL_API int rsslNotifierRemoveEvent(RsslNotifier *pNotifier, RsslNotifierEvent
 
 	pNotifierEventImpl->_registeredFlags = 0;
 
+#ifdef RSSL_NOTIFIER_EPOLL
+	if (pNotifierImpl->_notifierType == RSSL_NT_EPOLL)
+	{
+		int index = pNotifierEventImpl->_pollFdIndex;
+
+		if (index >= pNotifierImpl->_eventCount || pNotifierImpl->_events[index] != pNotifierEventImpl)
+			return 0; /* Not associated with this notifier. */
+
+		_notifierEpollDetachEvent(pNotifierImpl, pNotifierEventImpl);
+		if (pNotifierEventImpl->_epollFd >= 0)
+			epoll_ctl(pNotifierImpl->_epollFd, EPOLL_CTL_DEL, pNotifierEventImpl->_epollFd, NULL);
+		pNotifierEventImpl->_epollMask = 0;
+
+		/* Swap in last event; the event's index is used directly, so no search is needed. */
+		if (index != pNotifierImpl->_eventCount - 1)
+		{
+			pNotifierImpl->_events[pNotifierImpl->_eventCount - 1]->_pollFdIndex = index;
+			pNotifierImpl->_pollFds[index] = pNotifierImpl->_pollFds[pNotifierImpl->_eventCount - 1];
+			pNotifierImpl->_events[index] = pNotifierImpl->_events[pNotifierImpl->_eventCount - 1];
+		}
+
+		--pNotifierImpl->_eventCount;
+		return 0;
+	}
+#endif
+
 	for (i = 0; i < pNotifierImpl->_eventCount; ++i)
 	{
 		if (pNotifierImpl->_events[i] == pNotifierEventImpl)
@@ -235,6 +516,10 @@ RSSL_API int rsslNotifierRegisterRead(RsslNotifier *pNotifier, RsslNotifierEvent
 	pNotifierEventImpl->_registeredFlags |= RSSL_NESF_READ;
 #ifndef WIN32
 	pNotifierImpl->_pollFds[pNotifierEventImpl->_pollFdIndex].events |= POLLIN | POLLPRI;
+#endif
+#ifdef RSSL_NOTIFIER_EPOLL
+	if (pNotifierImpl->_notifierType == RSSL_NT_EPOLL)
+		return _notifierEpollSetMask(pNotifierImpl, pNotifierEventImpl, pNotifierEventImpl->_epollMask | EPOLLIN | EPOLLPRI);
 #endif
 	return 0;
 }
@@ -246,6 +531,10 @@ RSSL_API int rsslNotifierUnregisterRead(RsslNotifier *pNotifier, RsslNotifierEve
 	pNotifierEventImpl->_registeredFlags &= ~RSSL_NESF_READ;
 #ifndef WIN32
 	pNotifierImpl->_pollFds[pNotifierEventImpl->_pollFdIndex].events &= ~(POLLIN | POLLPRI);
+#endif
+#ifdef RSSL_NOTIFIER_EPOLL
+	if (pNotifierImpl->_notifierType == RSSL_NT_EPOLL)
+		return _notifierEpollSetMask(pNotifierImpl, pNotifierEventImpl, pNotifierEventImpl->_epollMask & ~(EPOLLIN | EPOLLPRI));
 #endif
 	return 0;
 }
@@ -258,6 +547,10 @@ RSSL_API int rsslNotifierRegisterWrite(RsslNotifier *pNotifier, RsslNotifierEven
 	pNotifierEventImpl->_registeredFlags |= RSSL_NESF_WRITE;
 #ifndef WIN32
 	pNotifierImpl->_pollFds[pNotifierEventImpl->_pollFdIndex].events |= POLLOUT;
+#endif
+#ifdef RSSL_NOTIFIER_EPOLL
+	if (pNotifierImpl->_notifierType == RSSL_NT_EPOLL)
+		return _notifierEpollSetMask(pNotifierImpl, pNotifierEventImpl, pNotifierEventImpl->_epollMask | EPOLLOUT);
 #endif
 	return 0;
 }
@@ -269,6 +562,10 @@ RSSL_API int rsslNotifierUnregisterWrite(RsslNotifier *pNotifier, RsslNotifierEv
 	pNotifierEventImpl->_registeredFlags &= ~RSSL_NESF_WRITE;
 #ifndef WIN32
 	pNotifierImpl->_pollFds[pNotifierEventImpl->_pollFdIndex].events &= ~POLLOUT;
+#endif
+#ifdef RSSL_NOTIFIER_EPOLL
+	if (pNotifierImpl->_notifierType == RSSL_NT_EPOLL)
+		return _notifierEpollSetMask(pNotifierImpl, pNotifierEventImpl, pNotifierEventImpl->_epollMask & ~EPOLLOUT);
 #endif
 	return 0;
 }
@@ -279,6 +576,11 @@ RSSL_API int rsslNotifierWait(RsslNotifier *pNotifier, long timeoutUsec)
 	int i;
 	int ret;
 
+#ifdef RSSL_NOTIFIER_EPOLL
+	if (pNotifierImpl->_notifierType == RSSL_NT_EPOLL)
+		return _notifierEpollWait(pNotifierImpl, timeoutUsec);
+#endif
+
 #ifndef WIN32
 	pNotifierImpl->base.notifiedEventCount = 0;
 	ret = poll(pNotifierImpl->_pollFds, pNotifierImpl->_eventCount, timeoutUsec/1000);
@@ -123,6 +123,10 @@ rtrNamedSem *_rtrShmMutexOpenInt( int isEvent/* is event or mutex? */, int isOwn
 }
 #endif
 
+#ifndef _WIN32
+static int _rtrShmSegCreate( rtrShmSeg *seg, const char * key, size_t size, int lockPages, char *errBuff );
+#endif
+
 int rtrShmSegCreate( rtrShmSeg *seg, const char * key, size_t size, char *errBuff )
 #ifdef _WIN32
 {
@@ -195,6 +199,11 @@ int rtrShmSegCreate( rtrShmSeg *seg, const char * key, size_t size, char *errBuf
 	return 1;
 };
 #else
+{
+	return _rtrShmSegCreate(seg, key, size, 1, errBuff);
+}
+
+static int _rtrShmSegCreate( rtrShmSeg *seg, const char * key, size_t size, int lockPages, char *errBuff )
 {
 	char memMapName[__MY_MAX_ADDR];
 	int tempLen;
@@ -240,7 +249,7 @@ int rtrShmSegCreate( rtrShmSeg *seg, const char * key, size_t size, char *errBuf
 
 	/* Lock the segment. It is critical that the shared memory segments don't get paged */
 	/* You don't typically get shared memory locking privileges by default on our Solaris boxes, so this will fail there. */
-	if (mlock(seg->base, size) != 0) 
+	if (lockPages && mlock(seg->base, size) != 0) 
 	{ 
 		snprintf(errBuff,__ERROR_LEN, "rtrShmSegCreate() mlock() Failed (errno = %d, mapName = %s, size = %zu)", errno, memMapName, size);
 		rtrShmSegDestroy(seg); 
@@ -271,6 +280,35 @@ int rtrShmSegCreate( rtrShmSeg *seg, const char * key, size_t size, char *errBuf
 }
 #endif
 
+int rtrShmSegCreatePageable( rtrShmSeg *seg, const char * key, size_t size, char *errBuff )
+#ifdef _WIN32
+{
+	/* Pagefile-backed mappings are never locked on Windows. */
+	return rtrShmSegCreate(seg, key, size, errBuff);
+}
+#else
+{
+	return _rtrShmSegCreate(seg, key, size, 0, errBuff);
+}
+#endif
+
+void rtrShmSegUnlink( const char *key )
+#ifdef _WIN32
+{
+	/* Named mappings disappear with their last handle on Windows. */
+}
+#else
+{
+	char memMapName[__MY_MAX_ADDR];
+
+	if (strlen(key) > RTR_SHM_SEG_KEY_MAX_LEN)
+		return;
+
+	snprintf(memMapName, __MY_MAX_ADDR, RTR_SHM_SEG_NAME, key );
+	shm_unlink(memMapName);
+}
+#endif
+
 void rtrShmSegDestroy( rtrShmSeg *seg )
 #ifdef _WIN32
 {
@@ -444,6 +482,110 @@ int rtrShmSegAttach( rtrShmSeg *seg, const char *key, char *errBuff )
 }
 #endif
 
+int rtrShmSegAttachReadOnly( rtrShmSeg *seg, const char *key, void *address, char *errBuff )
+#ifdef _WIN32
+{
+	char memMapName[__MY_MAX_ADDR];
+
+	seg->shMemSeg = 0;
+	seg->base = 0;
+	seg->hdr = 0;
+
+	if (strlen(key) > (__MY_MAX_ADDR - 6))
+	{
+		snprintf(errBuff,__ERROR_LEN, "rtrShmSegAttachReadOnly() Illegal shared memory key length %zu (key = %s)", strlen(key), key);
+		return -1;
+	}
+
+	snprintf(memMapName, __MY_MAX_ADDR, "%s_mem", key);
+
+	seg->shMemSeg = OpenFileMapping(FILE_MAP_READ, FALSE, (LPCSTR)memMapName);
+	if ((seg->shMemSeg == NULL) || (seg->shMemSeg == INVALID_HANDLE_VALUE))
+	{
+		snprintf(errBuff,__ERROR_LEN, "rtrShmSegAttachReadOnly() OpenFileMapping() Failed(errno = %d)", GetLastError());
+		seg->shMemSeg = 0;
+		return -1;
+	}
+
+	/* The address is only a hint; fall back to wherever the system places the view. */
+	seg->base = (char*)MapViewOfFileEx(seg->shMemSeg, FILE_MAP_READ, 0, 0, 0, address);
+	if (seg->base == NULL && address != NULL)
+		seg->base = (char*)MapViewOfFileEx(seg->shMemSeg, FILE_MAP_READ, 0, 0, 0, NULL);
+	if (seg->base == NULL)
+	{
+		snprintf(errBuff,__ERROR_LEN, "rtrShmSegAttachReadOnly() MapViewOfFileEx() Failed(errno = %d)", GetLastError());
+		rtrShmSegDetach(seg);
+		return -1;
+	}
+
+	seg->hdr = (rtrShmHdr*)seg->base;
+
+	if (seg->hdr->magic != RTR_SHM_MAGIC)
+	{
+		snprintf(errBuff,__ERROR_LEN, "rtrShmSegAttachReadOnly() Illegal Shared Memory Magic 0x%x",seg->hdr->magic);
+		rtrShmSegDetach(seg);
+		return -1;
+	}
+
+	return 1;
+};
+#else
+{
+	char memMapName[__MY_MAX_ADDR];
+	struct stat mStat;
+
+	seg->shMemSeg = 0;
+	seg->base = 0;
+	seg->hdr = 0;
+
+	if (strlen(key) > RTR_SHM_SEG_KEY_MAX_LEN)
+	{
+		snprintf(errBuff,__ERROR_LEN, "rtrShmSegAttachReadOnly() Illegal shared memory key length %zu %s",strlen(key), key);
+		return -1;
+	}
+
+	snprintf(memMapName, __MY_MAX_ADDR, RTR_SHM_SEG_NAME, key );
+
+	seg->shMemSeg = shm_open(memMapName, O_RDONLY, 0);
+	if (seg->shMemSeg == -1) 
+	{ 
+		snprintf(errBuff,__ERROR_LEN, "rtrShmSegAttachReadOnly() Errno(%d) from shm_open with \'%s\'", errno, memMapName);
+		seg->shMemSeg = 0;
+		return -1; 
+	}
+
+	if (fstat(seg->shMemSeg, &mStat) == -1 || (size_t)mStat.st_size < sizeof(rtrShmHdr)) 
+	{ 
+		snprintf(errBuff,__ERROR_LEN, "rtrShmSegAttachReadOnly() Errno(%d) from fstat with \'%s\'", errno, memMapName);
+		rtrShmSegDetach(seg);
+		return -1; 
+	}
+
+	/* The address is only a hint; the kernel places the mapping elsewhere if the range is in use. */
+	seg->base = mmap(address, mStat.st_size, PROT_READ, MAP_SHARED, seg->shMemSeg, 0);
+	if (seg->base == MAP_FAILED) 
+	{ 
+		snprintf(errBuff,__ERROR_LEN, "rtrShmSegAttachReadOnly() Errno(%d) from mmap with \'%s\'", errno, memMapName);
+		seg->base = 0;
+		rtrShmSegDetach(seg);
+		return -1; 
+	}
+
+	seg->hdr = (rtrShmHdr*)seg->base;
+
+	if (seg->hdr->magic != RTR_SHM_MAGIC || seg->hdr->totalLen != (size_t)mStat.st_size)
+	{
+		snprintf(errBuff,__ERROR_LEN, "rtrShmSegAttachReadOnly() Illegal Shared Memory Magic 0x%lx\n",seg->hdr->magic);
+		munmap(seg->base, mStat.st_size);
+		seg->base = 0;
+		rtrShmSegDetach(seg);
+		return -1;
+	}
+
+	return 1;
+}
+#endif
+
 void rtrShmSegDetach( rtrShmSeg *seg )
 #ifdef _WIN32
 {
@@ -326,6 +326,70 @@ RSSL_API RsslDictionaryEntry *rsslDictionaryGetEntryByFieldName(RsslDataDictiona
  */
 RSSL_API RsslRet rsslDictionaryEntryGetEnumValueByDisplayString(const RsslDictionaryEntry *pEntry, const RsslBuffer *pEnumDisplay, RsslEnum *pEnumValue, RsslBuffer *errorText);
 
+/**
+ * @brief Writes a compiled image of a data dictionary to a file, for use with rsslMapDataDictionary.
+ * The image contains all fields, enumerated type tables and tags present in the dictionary. It can only be mapped on platforms with the same byte order and pointer size.
+ * The file is written under a temporary name and then renamed, so processes that have a previous image mapped are not affected.
+ * @param dictionary The dictionary to compile, typically loaded with rsslLoadFieldDictionary and rsslLoadEnumTypeDictionary.
+ * @param filename Name of the image file to write.
+ * @param errorText Buffer to hold error text if compilation fails.
+ * @return RSSL_RET_SUCCESS if the image was written, RSSL_RET_FAILURE otherwise.
+ * @see rsslMapDataDictionary
+ */
+RSSL_API RsslRet rsslCompileDataDictionary(RsslDataDictionary *dictionary, const char *filename, RsslBuffer *errorText);
+
+/**
+ * @brief Initializes a data dictionary from an image written by rsslCompileDataDictionary.
+ * The image is memory-mapped read-only rather than parsed, so this takes little time regardless of the size of the dictionary. When the image can be
+ * mapped at the address it was compiled for, its pages are shared with all other processes that map the same file; otherwise a private copy of the image is relocated.
+ * The dictionary cannot be modified: rsslLoadFieldDictionary, rsslLoadEnumTypeDictionary, rsslDecodeFieldDictionary, rsslDecodeEnumTypeDictionary and rsslLinkDataDictionary
+ * will fail on it. Call rsslDeleteDataDictionary to unmap it.
+ * @param filename Name of the image file.
+ * @param dictionary The dictionary to initialize. It must not already be initialized.
+ * @param errorText Buffer to hold error text if mapping fails.
+ * @return RSSL_RET_SUCCESS if the dictionary was mapped, RSSL_RET_FAILURE otherwise.
+ * @see rsslCompileDataDictionary
+ */
+RSSL_API RsslRet rsslMapDataDictionary(const char *filename, RsslDataDictionary *dictionary, RsslBuffer *errorText);
+
+/**
+ * @brief Publishes a data dictionary in shared memory, so that other processes on this host can use it with rsslAttachSharedDataDictionary instead of loading or downloading it.
+ * The shared dictionary is identified by the given name together with the dictionary's infoField_Version and infoEnum_DT_Version tags. If it is already published, this does nothing.
+ * The shared memory remains after this process exits, until rsslRemoveSharedDataDictionary is called (on Windows, it remains while this process or any process attached to it is running).
+ * @param dictionary The dictionary to publish.
+ * @param name Name of the shared dictionary, e.g. the name of the service the dictionary came from.
+ * @param errorText Buffer to hold error text if publishing fails.
+ * @return RSSL_RET_SUCCESS if the dictionary is published, RSSL_RET_FAILURE otherwise.
+ * @see rsslAttachSharedDataDictionary, rsslRemoveSharedDataDictionary
+ */
+RSSL_API RsslRet rsslPublishSharedDataDictionary(RsslDataDictionary *dictionary, const char *name, RsslBuffer *errorText);
+
+/**
+ * @brief Initializes a data dictionary from one published with rsslPublishSharedDataDictionary.
+ * The shared memory is attached read-only, so all processes attached to the same dictionary share one copy of it. If the shared memory cannot be attached at its 
+ * preferred address, a private copy is made instead. As with rsslMapDataDictionary, the dictionary cannot be modified. Call rsslDeleteDataDictionary to detach it.
+ * @param name Name the dictionary was published with.
+ * @param fieldVersion Expected infoField_Version of the dictionary.
+ * @param enumVersion Expected infoEnum_DT_Version of the dictionary.
+ * @param dictionary The dictionary to initialize. It must not already be initialized.
+ * @param errorText Buffer to hold error text if attaching fails.
+ * @return RSSL_RET_SUCCESS if the dictionary was attached, RSSL_RET_FAILURE if no such dictionary is published or it could not be attached.
+ * @see rsslPublishSharedDataDictionary
+ */
+RSSL_API RsslRet rsslAttachSharedDataDictionary(const char *name, const RsslBuffer *fieldVersion, const RsslBuffer *enumVersion, 
+		RsslDataDictionary *dictionary, RsslBuffer *errorText);
+
+/**
+ * @brief Removes a dictionary published with rsslPublishSharedDataDictionary. Processes that are attached to it are not affected, but no new processes can attach.
+ * @param name Name the dictionary was published with.
+ * @param fieldVersion infoField_Version of the dictionary.
+ * @param enumVersion infoEnum_DT_Version of the dictionary.
+ * @param errorText Buffer to hold error text if the name is invalid.
+ * @return RSSL_RET_SUCCESS, or RSSL_RET_FAILURE if the name is invalid.
+ * @see rsslPublishSharedDataDictionary
+ */
+RSSL_API RsslRet rsslRemoveSharedDataDictionary(const char *name, const RsslBuffer *fieldVersion, const RsslBuffer *enumVersion, RsslBuffer *errorText);
+
 /*
  * @brief For internal use only. Matches fields of two dictionaries, then reuses the allocated RsslDictionaryEntry objects of the old dictionary.
  * The two dictionaries will share their RsslDictionaryEntry objects and the respective RsslEnumTypeTable objects.
@@ -141,6 +141,140 @@ RTR_C_INLINE void rsslClearFieldEntry(RsslFieldEntry *pField)
 	pField->encData.length = 0;
 }
 
+/**
+ * @brief Number of hash slots in an RsslFieldListIndex. Must be a power of two.
+ * @see RsslFieldListIndex
+ */
+#define RSSL_FIELD_LIST_INDEX_SLOTS 512
+
+/**
+ * @brief One entry of an RsslFieldListIndex.
+ * @see RsslFieldListIndex
+ */
+typedef struct {
+	RsslFieldEntry		fieldEntry;	/*!< @brief The entry, as it would be returned from rsslDecodeFieldEntry(). */
+	RsslUInt32			_nextEntry;	/*!< @brief Internal use only. */
+} RsslFieldListIndexEntry;
+
+/**
+ * @brief Index of the entries in an RsslFieldList, allowing entries to be found by field identifier without decoding the entries before them.
+ *
+ * The application provides the storage for the indexed entries in RsslFieldListIndex::entries. The index must be cleared with rsslClearFieldListIndex() or RSSL_INIT_FIELD_LIST_INDEX before its first use; it may then be rebuilt for each RsslFieldList.
+ *
+ * @see RSSL_INIT_FIELD_LIST_INDEX, rsslClearFieldListIndex, rsslDecodeFieldListIndex, rsslDecodeFieldEntryById
+ */
+typedef struct {
+	RsslFieldListIndexEntry	*entries;		/*!< @brief Storage for the indexed entries. */
+	RsslUInt32				maxEntries;		/*!< @brief Number of entries available in RsslFieldListIndex::entries. */
+	RsslUInt32				entryCount;		/*!< @brief Number of entries in the index, set by rsslDecodeFieldListIndex(). */
+	RsslInt32				_decodingLevel;	/*!< @brief Internal use only. */
+	RsslBuffer				_encEntries;	/*!< @brief Internal use only. */
+	RsslUInt32				_slots[RSSL_FIELD_LIST_INDEX_SLOTS]; /*!< @brief Internal use only. */
+} RsslFieldListIndex;
+
+/**
+ * @brief RsslFieldListIndex static initializer
+ * @see RsslFieldListIndex, rsslClearFieldListIndex
+ */
+#define RSSL_INIT_FIELD_LIST_INDEX { 0, 0, 0, 0, RSSL_INIT_BUFFER, { 0 } }
+
+/**
+ * @brief Clears an RsslFieldListIndex
+ * @see RsslFieldListIndex, RSSL_INIT_FIELD_LIST_INDEX
+ */
+RTR_C_INLINE void rsslClearFieldListIndex(RsslFieldListIndex *pIndex)
+{
+	memset(pIndex, 0, sizeof(RsslFieldListIndex));
+}
+
+/**
+ * @brief One field of an RsslFieldListTemplate.
+ * @see RsslFieldListTemplate
+ */
+typedef struct {
+	RsslFieldId			fieldId;	/*!< @brief The field identifier. */
+	RsslUInt8			dataType;	/*!< @brief The primitive type of the field's value. */
+	RsslUInt8			_maxLength;	/*!< @brief Internal use only. */
+} RsslFieldListTemplateEntry;
+
+/**
+ * @brief Fixed layout of an RsslFieldList, used to encode field lists that always contain the same fields with the same types.
+ *
+ * The header of the RsslFieldList and the size needed by each field are worked out once, when the template is built.  Encoding with rsslEncodeFieldListTemplateInit() then makes a single buffer size check and writes each value with the encoder for its type, without the per-entry checks and type dispatch of rsslEncodeFieldEntry().<BR>
+ *
+ * The application provides the storage for the fields in RsslFieldListTemplate::entries.  Build the template with rsslInitFieldListTemplate(), then rsslAddFieldListTemplateEntry() or rsslAddFieldListTemplateSetDef().  To build from a dictionary, add each RsslDictionaryEntry::fid with its RsslDictionaryEntry::rwfType.
+ *
+ * @see RSSL_INIT_FIELD_LIST_TEMPLATE, rsslClearFieldListTemplate, rsslInitFieldListTemplate, rsslEncodeFieldListTemplateInit
+ */
+typedef struct {
+	RsslFieldListTemplateEntry	*entries;		/*!< @brief Storage for the fields of the template. */
+	RsslUInt16					maxEntries;		/*!< @brief Number of entries available in RsslFieldListTemplate::entries. */
+	RsslUInt16					count;			/*!< @brief Number of fields in the template. */
+	RsslUInt32					_fixedLength;	/*!< @brief Internal use only. */
+	RsslUInt16					_variableCount;	/*!< @brief Internal use only. */
+	RsslUInt8					_headerLength;	/*!< @brief Internal use only. */
+	char						_header[8];		/*!< @brief Internal use only. */
+	RsslFieldList				_fieldList;		/*!< @brief Internal use only. */
+} RsslFieldListTemplate;
+
+/**
+ * @brief RsslFieldListTemplate static initializer
+ * @see RsslFieldListTemplate, rsslClearFieldListTemplate
+ */
+#define RSSL_INIT_FIELD_LIST_TEMPLATE { 0, 0, 0, 0, 0, 0, { 0 }, RSSL_INIT_FIELD_LIST }
+
+/**
+ * @brief Clears an RsslFieldListTemplate
+ * @see RsslFieldListTemplate, RSSL_INIT_FIELD_LIST_TEMPLATE
+ */
+RTR_C_INLINE void rsslClearFieldListTemplate(RsslFieldListTemplate *pTemplate)
+{
+	memset(pTemplate, 0, sizeof(RsslFieldListTemplate));
+}
+
+/**
+ * @brief Location of one standard entry in an encoded RsslFieldList.
+ * @see RsslFieldListPatchMap
+ */
+typedef struct {
+	RsslFieldId			fieldId;		/*!< @brief The field identifier of the entry. */
+	RsslUInt16			_length;		/*!< @brief Internal use only. */
+	RsslUInt32			_position;		/*!< @brief Internal use only. */
+	RsslUInt8			_prefixLength;	/*!< @brief Internal use only. */
+} RsslFieldListPatchEntry;
+
+/**
+ * @brief Map of the entries in an encoded RsslFieldList, allowing their values to be replaced without encoding the message again.
+ *
+ * The map is built once from the encoded message with rsslDecodeFieldListPatchMap().  rsslPatchFieldListEntry() then overwrites the value of an entry in place.  Values of most fixed-size types (e.g. an RsslUInt, RsslReal or RsslDate that encodes to the same length) are simply copied over the old value; when the length changes, the rest of the buffer is moved to fit.<BR>
+ *
+ * The application provides the storage for the entries in RsslFieldListPatchMap::entries.
+ *
+ * @see RSSL_INIT_FIELD_LIST_PATCH_MAP, rsslClearFieldListPatchMap, rsslDecodeFieldListPatchMap, rsslPatchFieldListEntry
+ */
+typedef struct {
+	RsslFieldListPatchEntry	*entries;		/*!< @brief Storage for the entries of the map. */
+	RsslUInt32				maxEntries;		/*!< @brief Number of entries available in RsslFieldListPatchMap::entries. */
+	RsslUInt32				entryCount;		/*!< @brief Number of entries in the map, set by rsslDecodeFieldListPatchMap(). */
+	RsslUInt32				_nextEntry;		/*!< @brief Internal use only. */
+	RsslBool				_canResize;		/*!< @brief Internal use only. */
+} RsslFieldListPatchMap;
+
+/**
+ * @brief RsslFieldListPatchMap static initializer
+ * @see RsslFieldListPatchMap, rsslClearFieldListPatchMap
+ */
+#define RSSL_INIT_FIELD_LIST_PATCH_MAP { 0, 0, 0, 0, 0 }
+
+/**
+ * @brief Clears an RsslFieldListPatchMap
+ * @see RsslFieldListPatchMap, RSSL_INIT_FIELD_LIST_PATCH_MAP
+ */
+RTR_C_INLINE void rsslClearFieldListPatchMap(RsslFieldListPatchMap *pMap)
+{
+	memset(pMap, 0, sizeof(RsslFieldListPatchMap));
+}
+
 /**
  *	@}
  */
@@ -250,6 +384,94 @@ RSSL_API RsslRet rsslEncodeFieldEntryComplete(
 							RsslEncodeIterator	*pIter,
 							RsslBool			success );
 
+/**
+ * @brief Starts building an RsslFieldListTemplate
+ *
+ * Removes any fields from the template and sets the RsslFieldList header it will encode.  Only ::RSSL_FLF_HAS_FIELD_LIST_INFO is taken from RsslFieldList::flags; the encoded RsslFieldList always contains standard data.
+ *
+ * @param pTemplate Template to build.  RsslFieldListTemplate::entries and RsslFieldListTemplate::maxEntries must be set.
+ * @param pFieldList RsslFieldList providing RsslFieldList::flags, RsslFieldList::dictionaryId and RsslFieldList::fieldListNum.
+ * @see RsslFieldListTemplate, rsslAddFieldListTemplateEntry, rsslAddFieldListTemplateSetDef
+ * @return ::RSSL_RET_SUCCESS, or ::RSSL_RET_INVALID_ARGUMENT if the RsslFieldList has set data or its dictionaryId is out of range.
+ */
+RSSL_API RsslRet rsslInitFieldListTemplate(
+							RsslFieldListTemplate	*pTemplate,
+							const RsslFieldList		*pFieldList );
+
+/**
+ * @brief Adds a field to an RsslFieldListTemplate
+ *
+ * @param pTemplate Template being built
+ * @param fieldId The field identifier
+ * @param dataType Type of the field's value.  Primitive types other than ::RSSL_DT_STATE and ::RSSL_DT_ARRAY are supported.  Set-defined types such as ::RSSL_DT_REAL_8RB are added as their primitive type.
+ * @see RsslFieldListTemplate, rsslInitFieldListTemplate
+ * @return ::RSSL_RET_SUCCESS, ::RSSL_RET_BUFFER_TOO_SMALL if RsslFieldListTemplate::entries is full, or ::RSSL_RET_UNSUPPORTED_DATA_TYPE.
+ */
+RSSL_API RsslRet rsslAddFieldListTemplateEntry(
+							RsslFieldListTemplate	*pTemplate,
+							RsslFieldId				fieldId,
+							RsslDataType			dataType );
+
+/**
+ * @brief Adds the fields of an RsslFieldSetDef to an RsslFieldListTemplate
+ *
+ * The fields are encoded as standard entries, so the set definition is not needed to decode them.
+ *
+ * @param pTemplate Template being built
+ * @param pSetDef Set definition whose entries are added, in order
+ * @see RsslFieldListTemplate, rsslAddFieldListTemplateEntry
+ * @return ::RSSL_RET_SUCCESS, ::RSSL_RET_BUFFER_TOO_SMALL if RsslFieldListTemplate::entries is full, or ::RSSL_RET_UNSUPPORTED_DATA_TYPE.
+ */
+RSSL_API RsslRet rsslAddFieldListTemplateSetDef(
+							RsslFieldListTemplate	*pTemplate,
+							const RsslFieldSetDef	*pSetDef );
+
+/**
+ * @brief Begins encoding an RsslFieldList from a template, encoding all of the template's fields
+ *
+ * Typical use:<BR>
+ *  1. Call rsslEncodeFieldListTemplateInit()<BR>
+ *  2. Optionally, encode additional entries with rsslEncodeFieldEntry() or rsslEncodeFieldEntryInit()..rsslEncodeFieldEntryComplete()<BR>
+ *  3. Call rsslEncodeFieldListComplete()<BR>
+ *
+ * The result is the same as encoding each field with rsslEncodeFieldEntry().  If this call fails, call rsslEncodeFieldListComplete() with success set to RSSL_FALSE.
+ *
+ * @param pIter	Pointer to the encode iterator.
+ * @param pTemplate Template to encode
+ * @param pValues Array of RsslFieldListTemplate::count pointers to the field values, in template order.  Each points to the primitive type of its field, e.g. an RsslReal or an RsslBuffer.  A NULL pointer encodes the field as blank.
+ * @see RsslFieldListTemplate, rsslEncodeFieldListComplete
+ * @return Returns an RsslRet to provide success or failure information
+ */
+RSSL_API RsslRet rsslEncodeFieldListTemplateInit(
+							RsslEncodeIterator			*pIter,
+							const RsslFieldListTemplate	*pTemplate,
+							const void * const			*pValues );
+
+/**
+ * @brief Replaces the value of an entry in an already-encoded RsslFieldList
+ *
+ * Typical use, e.g. to publish updates from a pre-encoded RsslUpdateMsg:<BR>
+ *  1. Encode the message once with all of the fields it will carry<BR>
+ *  2. Decode it with rsslDecodeMsg() and rsslDecodeFieldList(), then build a map of it with rsslDecodeFieldListPatchMap()<BR>
+ *  3. For each update, call rsslPatchFieldListEntry() for each changed field, and send a copy of the buffer<BR>
+ *
+ * If the new value encodes to the same length as the old one, it is copied over the old value.  Otherwise the data after the entry is moved, RsslBuffer::length is adjusted, and the positions of the following entries in the map are updated.  This is only possible when the RsslFieldList is the last content of the buffer, such as the payload of a message; otherwise ::RSSL_RET_FAILURE is returned and the message must be encoded again.
+ *
+ * @param pBuffer Buffer containing the encoded message that the map was built from.  RsslBuffer::length is the length of the encoded message.
+ * @param maxLength Space available at RsslBuffer::data, limiting how far the message can grow.
+ * @param pMap Map built by rsslDecodeFieldListPatchMap()
+ * @param pField Identifies the entry to replace by RsslFieldEntry::fieldId, and gives the type of the new value in RsslFieldEntry::dataType.  Primitive types other than ::RSSL_DT_STATE and ::RSSL_DT_ARRAY are supported.
+ * @param pData Pointer to the new value, e.g. an RsslReal or an RsslBuffer.  NULL replaces the value with blank.
+ * @see RsslFieldListPatchMap, rsslDecodeFieldListPatchMap
+ * @return ::RSSL_RET_SUCCESS, ::RSSL_RET_INVALID_ARGUMENT if the map has no entry with the field identifier, ::RSSL_RET_BUFFER_TOO_SMALL if the message would grow beyond maxLength, or another error describing why the value could not be encoded.
+ */
+RSSL_API RsslRet rsslPatchFieldListEntry(
+							RsslBuffer				*pBuffer,
+							RsslUInt32				maxLength,
+							RsslFieldListPatchMap	*pMap,
+							const RsslFieldEntry	*pField,
+							const void				*pData );
+
 
 /** 
  * @}
@@ -299,7 +521,60 @@ RSSL_API RsslRet rsslDecodeFieldList(
 RSSL_API RsslRet rsslDecodeFieldEntry(
 							RsslDecodeIterator	*pIter,
 							RsslFieldEntry		*pField );
-				 
+
+/**
+ * @brief Scans the entries of the RsslFieldList being decoded and builds an index of them by RsslFieldEntry::fieldId.
+ *
+ * The entry headers are scanned once; entries can then be found in constant time with rsslDecodeFieldEntryById(). This does not change the position of rsslDecodeFieldEntry(), so both may be used on the same RsslFieldList.
+ *
+ * Typical use:<BR>
+ *  1. Call rsslDecodeFieldList()<BR>
+ *  2. Call rsslDecodeFieldListIndex()<BR>
+ *  3. Call rsslDecodeFieldEntryById() for each wanted field, followed by the decoder for its type.<BR>
+ *
+ * @note If RsslFieldList::encSetData is present but could not be decoded (rsslDecodeFieldList() returned ::RSSL_RET_SET_SKIPPED), only the standard entries are indexed.
+ *
+ * @param pIter Decode iterator that has decoded the RsslFieldList with rsslDecodeFieldList()
+ * @param pIndex Index to populate.  If RsslFieldListIndex::entries is too small for the RsslFieldList, ::RSSL_RET_BUFFER_TOO_SMALL is returned and RsslFieldListIndex::entryCount is set to the number of entries needed.
+ * @see rsslDecodeFieldEntryById, RsslFieldListIndex
+ * @return Returns an RsslRet to provide success or failure information
+ */
+RSSL_API RsslRet rsslDecodeFieldListIndex(
+							RsslDecodeIterator	*pIter,
+							RsslFieldListIndex	*pIndex );
+
+/**
+ * @brief Finds the first RsslFieldEntry with the given field identifier in an index built by rsslDecodeFieldListIndex().
+ *
+ * On success, the iterator is positioned on the entry exactly as if rsslDecodeFieldEntry() had returned it, so its content can be decoded in the same way.  The iterator must still be decoding the same RsslFieldList that was indexed.
+ *
+ * @param pIter Decode iterator used with rsslDecodeFieldListIndex()
+ * @param pIndex Index built by rsslDecodeFieldListIndex()
+ * @param fieldId Field identifier to find
+ * @param pField RsslFieldEntry to populate
+ * @see rsslDecodeFieldListIndex, RsslFieldListIndex
+ * @return ::RSSL_RET_SUCCESS if found, ::RSSL_RET_END_OF_CONTAINER if no entry has the field identifier, ::RSSL_RET_INVALID_ARGUMENT if the iterator is not decoding the indexed RsslFieldList (the field list is identified by its decoding level and the location and length of its encoded entries).
+ */
+RSSL_API RsslRet rsslDecodeFieldEntryById(
+							RsslDecodeIterator	*pIter,
+							RsslFieldListIndex	*pIndex,
+							RsslFieldId			fieldId,
+							RsslFieldEntry		*pField );
+
+/**
+ * @brief Records the location of each standard entry of the RsslFieldList being decoded, for use with rsslPatchFieldListEntry().
+ *
+ * Positions are recorded relative to the start of the buffer set on the iterator with rsslSetDecodeIteratorBuffer(), so the map may be used with that buffer or with any copy of it.  This does not change the position of rsslDecodeFieldEntry().  Set-defined entries are not included.
+ *
+ * @param pIter Decode iterator that has decoded the RsslFieldList with rsslDecodeFieldList()
+ * @param pMap Map to populate
+ * @see rsslPatchFieldListEntry, RsslFieldListPatchMap
+ * @return ::RSSL_RET_SUCCESS, or ::RSSL_RET_BUFFER_TOO_SMALL if RsslFieldListPatchMap::entries is too small for the RsslFieldList.
+ */
+RSSL_API RsslRet rsslDecodeFieldListPatchMap(
+							RsslDecodeIterator		*pIter,
+							RsslFieldListPatchMap	*pMap );
+
 
 /**
  * @}
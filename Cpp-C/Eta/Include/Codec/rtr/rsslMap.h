@@ -16,6 +16,7 @@ extern "C" {
 
 #include "rtr/rsslDataTypeEnums.h"
 #include "rtr/rsslIterators.h"
+#include "rtr/rsslSetData.h"
 
 /**
  * @addtogroup MStruct 
@@ -407,6 +408,71 @@ RSSL_API RsslRet rsslDecodeMapEntry(
 							RsslMapEntry		*pMapEntry,
 							void				*pKeyData );
 
+/**
+ * @brief One column of an RsslMapFieldListColumns: a field whose value is decoded from the RsslFieldList of every RsslMapEntry
+ *
+ * The value decoded from row n is stored at index n of RsslMapFieldListColumn::values, which must be an array of the C type for RsslMapFieldListColumn::dataType:
+ * RsslInt, RsslUInt, RsslFloat, RsslDouble, RsslReal, RsslDate, RsslTime, RsslDateTime, RsslEnum, or RsslBuffer for the buffer and string types.  Buffers point into the decoded message.
+ * @see rsslDecodeMapFieldListColumns, RsslMapFieldListColumns
+ */
+typedef struct
+{
+	RsslFieldId		fieldId;	/*!< @brief Field to decode into this column. */
+	RsslDataType	dataType;	/*!< @brief Type the field is decoded as. */
+	void			*values;	/*!< @brief Caller-provided array of RsslMapFieldListColumns::maxRows values.  Rows that do not carry the field are left unchanged. */
+	RsslUInt8		*present;	/*!< @brief Caller-provided array of RsslMapFieldListColumns::maxRows flags.  Set to RSSL_TRUE for rows that carry a non-blank value for the field, RSSL_FALSE otherwise. */
+} RsslMapFieldListColumn;
+
+/**
+ * @brief Struct-of-arrays output of rsslDecodeMapFieldListColumns(), one row per RsslMapEntry
+ * @see rsslDecodeMapFieldListColumns, RsslMapFieldListColumn, RSSL_INIT_MAP_FIELD_LIST_COLUMNS, rsslClearMapFieldListColumns
+ */
+typedef struct
+{
+	RsslUInt32				maxRows;		/*!< @brief Number of rows the caller-provided arrays can hold. */
+	RsslUInt32				rowCount;		/*!< @brief Number of rows decoded by the last call to rsslDecodeMapFieldListColumns(). */
+	RsslUInt8				*actions;		/*!< @brief Caller-provided array of maxRows RsslMapEntry::action values. */
+	RsslBuffer				*encKeys;		/*!< @brief Optional caller-provided array of maxRows encoded keys. */
+	void					*keys;			/*!< @brief Optional caller-provided array of maxRows keys, decoded as RsslMap::keyPrimitiveType using the C types listed for RsslMapFieldListColumn. */
+	RsslMapFieldListColumn	*columns;		/*!< @brief Fields to decode from each entry. */
+	RsslUInt32				columnCount;	/*!< @brief Number of columns. */
+} RsslMapFieldListColumns;
+
+/**
+ * @brief RsslMapFieldListColumns static initializer
+ * @see RsslMapFieldListColumns, rsslClearMapFieldListColumns
+ */
+#define RSSL_INIT_MAP_FIELD_LIST_COLUMNS { 0, 0, 0, 0, 0, 0, 0 }
+
+/**
+ * @brief Clears an RsslMapFieldListColumns
+ * @see RsslMapFieldListColumns, RSSL_INIT_MAP_FIELD_LIST_COLUMNS
+ */
+RTR_C_INLINE void rsslClearMapFieldListColumns( RsslMapFieldListColumns *pColumns )
+{
+	memset(pColumns, 0, sizeof(RsslMapFieldListColumns));
+}
+
+/**
+ * @brief Decodes the remaining entries of an RsslMap of field lists into columns, one row per entry
+ *
+ * Each entry is decoded as rsslDecodeMapEntry() and rsslDecodeFieldList() would.  Fields named by a column are decoded into it, and other fields are skipped without being decoded.  This suits full order book refreshes, where one call replaces thousands of per-entry calls.
+ *
+ * Typical use:<BR>
+ *  1. Call rsslDecodeMap(), and decode the set definitions and summary data if present<BR>
+ *  2. Call rsslDecodeMapFieldListColumns() and process RsslMapFieldListColumns::rowCount rows, until it returns ::RSSL_RET_SUCCESS<BR>
+ *
+ * @param pIter Decode iterator that has decoded the RsslMap with rsslDecodeMap()
+ * @param pLocalSetDb Set definitions for the entries' field lists, or NULL
+ * @param pColumns Columns to populate
+ * @see RsslMapFieldListColumns, RsslMapFieldListColumn, rsslDecodeMap
+ * @return ::RSSL_RET_SUCCESS once the last entry has been decoded, ::RSSL_RET_BUFFER_TOO_SMALL if maxRows rows were decoded and more entries remain, ::RSSL_RET_INVALID_ARGUMENT if the RsslMap does not contain field lists, RsslMapFieldListColumns::maxRows is 0 or a column type is not supported, or another failure code.
+ */
+RSSL_API RsslRet rsslDecodeMapFieldListColumns(
+							RsslDecodeIterator		*pIter,
+							RsslLocalFieldSetDefDb	*pLocalSetDb,
+							RsslMapFieldListColumns	*pColumns );
+
 /**
  * @}
  */
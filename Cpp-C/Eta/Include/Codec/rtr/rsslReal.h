@@ -253,6 +253,27 @@ RSSL_API RsslRet rsslFloatToReal(RsslReal * oReal, RsslFloat * iValue, RsslUInt8
  */
 RSSL_API RsslRet rsslRealToDouble(RsslDouble * oValue, RsslReal * iReal);
 
+/**
+ * @brief Convert an array of RsslReal to doubles
+ * Produces the same results as calling rsslRealToDouble on each RsslReal, but is faster for large arrays. Where supported by the processor, the conversion uses SIMD instructions.
+ * @param oValues Array of count doubles to convert into. Blank RsslReals and RsslReals with invalid hints are converted to NaN.
+ * @param iReals Array of count RsslReals to convert
+ * @param count Number of values to convert
+ * @return Returns ::RSSL_RET_SUCCESS if all values were converted; ::RSSL_RET_FAILURE if any RsslReal had an invalid hint value
+ */
+RSSL_API RsslRet rsslRealsToDoubles(RsslDouble * oValues, const RsslReal * iReals, RsslUInt32 count);
+
+/**
+ * @brief Convert an array of doubles to RsslReals, all with the same hint
+ * Produces the same results as calling rsslDoubleToReal on each double, but is faster for large arrays. Where supported by the processor, the conversion uses SIMD instructions.
+ * @param oReals Array of count RsslReals to populate
+ * @param iValues Array of count doubles to convert. Infinite and NaN values are converted to the corresponding \ref RsslRealHints value.
+ * @param iHint \ref RsslRealHints enumeration hint value to use for converting the doubles; must be an exponent or fraction hint
+ * @param count Number of values to convert
+ * @return Returns ::RSSL_RET_SUCCESS if successful conversion occurs; ::RSSL_RET_FAILURE if the hint value is invalid
+ */
+RSSL_API RsslRet rsslDoublesToReals(RsslReal * oReals, const RsslDouble * iValues, RsslUInt8 iHint, RsslUInt32 count);
+
 /**
  * @brief Convert numeric string to double
  * @param oValue double to convert into
@@ -91,6 +91,48 @@ RTR_C_INLINE void rsslClearU16Buffer(RsslU16Buffer *pBuffer)
 	pBuffer->data = 0;
 }
 
+/**
+ *	@}
+ */
+
+/**
+ *	@addtogroup RsslRmtesUTF8StreamStruct
+ *	@{
+ */	
+
+/**
+ *	@brief RsslRmtesUTF8Stream structure
+ *
+ *	Keeps the UTF8 conversion of an RsslRmtesCacheBuffer current as partial
+ *	updates are applied to it.  The application provides the output memory in
+ *	utf8.data and its size in allocatedLength; utf8.length is set to the length of
+ *	the converted string.<BR>
+ *
+ *	Only the part of the string affected by an update is converted again, so the
+ *	cache must only be modified through rsslRMTESApplyToUTF8Stream while the stream
+ *	is in use.  Clear the stream when it is attached to a different cache.
+ *
+ *	@see rsslClearRmtesUTF8Stream, rsslRMTESApplyToUTF8Stream
+ */
+typedef struct {
+	RsslBuffer		utf8;				/*!< @brief UTF8 string.  data points to application memory; length is the converted length. */
+	RsslUInt32		allocatedLength;	/*!< @brief Total allocated length of utf8.data. */
+	RsslUInt32		asciiLength;		/*!< @brief Internal use only.  Length of the leading part of the string that needs no conversion. */
+} RsslRmtesUTF8Stream;
+
+/**
+ *	@brief Clears an RsslRmtesUTF8Stream structure
+ *
+ *	@param pStream Pointer to RsslRmtesUTF8Stream to clear
+ */
+RTR_C_INLINE void rsslClearRmtesUTF8Stream(RsslRmtesUTF8Stream *pStream)
+{
+	pStream->utf8.length = 0;
+	pStream->utf8.data = 0;
+	pStream->allocatedLength = 0;
+	pStream->asciiLength = 0;
+}
+
 /**
  *	@}
  */
@@ -137,6 +179,29 @@ RSSL_API RsslRet rsslRMTESApplyToCache(RsslBuffer *inBuffer, RsslRmtesCacheBuffe
  */
 RSSL_API RsslRet rsslRMTESToUTF8(RsslRmtesCacheBuffer *pRmtesBuffer, RsslBuffer *charBuffer);
 
+/**
+ *	@brief Applies the buffer to cache and updates the cache's UTF8 conversion
+ *
+ *	Equivalent to calling rsslRMTESApplyToCache followed by rsslRMTESToUTF8, except that
+ *	the leading plain ASCII part of the string that the update did not touch is neither
+ *	copied nor converted again.<BR>
+ *
+ *	Typical use:<BR>
+ *	1.  Allocate memory for the cache buffer and the unicode string, and clear the RsslRmtesUTF8Stream.<BR>
+ *	2.  Set the stream's utf8.data and allocatedLength to the unicode string memory.<BR>
+ *	3.  After decoding each payload buffer, call rsslRMTESApplyToUTF8Stream.  The stream's utf8 member holds the converted string.<BR>
+ *
+ *	@param inBuffer Input rsslBuffer that contains RMTES data
+ *	@param cacheBuf Cache buffer, this is populated after the function is complete
+ *	@param pStream UTF8 stream for this cache buffer
+ *	@return RsslRet code indicating success or failure:<BR>
+ *			::RSSL_RET_SUCCESS if the operation completes<BR>
+ *			::RSSL_RET_INVALID_ARGUMENT if the input buffer has not been allocated<BR>
+ *			::RSSL_RET_BUFFER_TOO_SMALL if the cache buffer or the unicode string is too small<BR>
+ *			::RSSL_RET_FAILURE if the operation is unable to complete due to invalid data<BR>
+ */
+RSSL_API RsslRet rsslRMTESApplyToUTF8Stream(RsslBuffer *inBuffer, RsslRmtesCacheBuffer *cacheBuf, RsslRmtesUTF8Stream *pStream);
+
 /**
  *	@brief Converts the given cache to UCS2 Unicode
  *
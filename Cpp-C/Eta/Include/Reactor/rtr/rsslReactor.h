@@ -110,6 +110,9 @@ typedef struct
 	RsslUInt32						maxOutstandingPosts;	/*!< Sets the maximum number of post acknowledgements that may be oustanding for the channel. */
 	RsslUInt32						postAckTimeout;			/*!< Time a stream will wait for acknowledgement of a post message, in milliseconds. */
 	RsslUInt32						requestTimeout;			/*!< Time a requested stream will wait for a response from the provider, in milliseconds. */
+	RsslBool						filterFanoutByView;		/*!< When enabled, refreshes and updates delivered to a request with a field ID view contain only the fields in that view, rather than every field requested on the item. */
+	RsslUInt32						itemRequestRate;		/*!< Maximum number of item requests per second the watchlist sends, such as when recovering items after a reconnect. Login and directory requests are not limited, and items requested with RsslReactorRequestMsgOptions.critical (and dictionary requests) are sent ahead of other items. Set to 0 for no limit (the default). */
+	RsslUInt32						requestBatchSize;		/*!< Maximum number of item requests the watchlist combines into a single batch request, when the provider supports batch requests. Requests for the same service, domain, QoS and priority that are waiting to be sent are combined; each item keeps its own stream. Items with views, private streams, or requests carrying a payload or extended header are sent individually. Set to 0 or 1 to send each request individually (the default). */
 } RsslConsumerWatchlistOptions;
 
 /**
@@ -144,6 +147,9 @@ RTR_C_INLINE void rsslClearOMMConsumerRole(RsslReactorOMMConsumerRole *pRole)
 	pRole->watchlistOptions.maxOutstandingPosts = 100000;
 	pRole->watchlistOptions.postAckTimeout = 15000;
 	pRole->watchlistOptions.requestTimeout = 15000;
+	pRole->watchlistOptions.filterFanoutByView = RSSL_FALSE;
+	pRole->watchlistOptions.itemRequestRate = 0;
+	pRole->watchlistOptions.requestBatchSize = 0;
 }
 
 /**
@@ -216,6 +222,17 @@ RTR_C_INLINE void rsslClearReactorChannelRole(RsslReactorChannelRole *pRole)
 }
 
 
+/**
+ * @brief Enumerated types indicating the mechanism the RsslReactor uses to wait for notification on its channels' descriptors.
+ * @see RsslCreateReactorOptions
+ */
+typedef enum
+{
+	RSSL_RC_NT_DEFAULT	= 0,	/*!< (0) Use the platform default mechanism (poll() on Unix, select() on Windows). */
+	RSSL_RC_NT_EPOLL	= 1		/*!< (1) Use epoll(). Only descriptors that are ready are reported on each wakeup, so notification cost
+								 * follows channel activity rather than the number of channels. Available on Linux; other platforms use the default. */
+} RsslReactorNotifierType;
+
 /**
  * @brief Configuraion options for creating an RsslReactor.
  * @see rsslCreateReactor
@@ -224,6 +241,24 @@ typedef struct {
 	RsslInt32	dispatchDecodeMemoryBufferSize;	/*!< Size of the memory buffer(in bytes) that the RsslReactor will use when decoding RsslRDMMsgs to pass to callback functions. */
 	void		*userSpecPtr; 					/*!< user-specified pointer which will be set on the Reactor. */
 	int			port;							/*!< @deprecated DEPRECATED: This parameter no longer has any effect. It was a port used for creating the eventFd descriptor on the RsslReactor. It was never used on Linux or Solaris platforms. */
+	RsslReactorNotifierType	notifierType;		/*!< Mechanism used by the RsslReactor and its worker thread to wait for notification on channel descriptors. See RsslReactorNotifierType. */
+	RsslBool	busyPollDispatch;				/*!< If RSSL_TRUE, rsslReactorDispatch reads its active channels directly and checks its event queues through shared memory, without
+												 * waiting on its notifier or signaling the RsslReactor's eventFd. This avoids system calls when the application calls rsslReactorDispatch 
+												 * in a loop on a dedicated thread, at the cost of keeping that thread busy. */
+	RsslUInt32	busyPollIdleSpinLimit;			/*!< When busyPollDispatch is enabled, the number of consecutive rsslReactorDispatch calls that find nothing to process before 
+												 * the RsslReactor falls back to its notifier and signals its eventFd again, so that the application may wait on the descriptors.
+												 * Busy-polling resumes once there is activity. If 0, the RsslReactor never falls back and the application should not wait on the eventFd. */
+	RsslUInt32	shardCount;						/*!< Number of shards to split the RsslReactor's channels across. Each shard has its own lock, notifier, event queue and worker thread, 
+												 * and is dispatched separately, so that channels may be processed by several application threads. The created RsslReactor is shard 0; 
+												 * the others are retrieved with rsslReactorGetShard. New channels from rsslReactorConnect and rsslReactorAccept are assigned to the shard 
+												 * with the fewest channels. If 0 or 1, the RsslReactor is not sharded. */
+	RsslUInt32	flushDelayUsec;					/*!< Maximum time, in microseconds, that the RsslReactor's worker thread may hold messages written with rsslReactorSubmit before flushing
+												 * them, so that messages submitted in a burst are flushed together. A channel is flushed as soon as either of its flush high-water marks 
+												 * is reached, or once this delay passes. If 0, each channel is flushed as soon as it has data to send. */
+	RsslUInt32	flushHighWaterMarkBytes;		/*!< When flushDelayUsec is set, the number of bytes queued for writing on a channel at which it is flushed immediately. If 0, 
+												 * no byte limit applies. */
+	RsslUInt32	flushHighWaterMarkMsgs;			/*!< When flushDelayUsec is set, the number of messages submitted to a channel since it was last flushed at which it is flushed immediately. 
+												 * If 0, no message limit applies. */
 } RsslCreateReactorOptions;
 
 /**
@@ -235,6 +270,13 @@ RTR_C_INLINE void rsslClearCreateReactorOptions(RsslCreateReactorOptions *pReact
 	memset(pReactorOpts, 0, sizeof(RsslCreateReactorOptions));
 	pReactorOpts->dispatchDecodeMemoryBufferSize = 65536;
 	pReactorOpts->port = 55000;
+	pReactorOpts->notifierType = RSSL_RC_NT_DEFAULT;
+	pReactorOpts->busyPollDispatch = RSSL_FALSE;
+	pReactorOpts->busyPollIdleSpinLimit = 10000;
+	pReactorOpts->shardCount = 1;
+	pReactorOpts->flushDelayUsec = 0;
+	pReactorOpts->flushHighWaterMarkBytes = 0;
+	pReactorOpts->flushHighWaterMarkMsgs = 0;
 }
 
 /**
@@ -256,6 +298,19 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
  */
 RSSL_VA_API RsslRet rsslDestroyReactor(RsslReactor *pReactor, RsslErrorInfo *pError);
 
+/**
+ * @brief Returns a shard of an RsslReactor created with RsslCreateReactorOptions.shardCount greater than 1.
+ * Each shard is an RsslReactor with its own eventFd, and should be dispatched with rsslReactorDispatch, typically from its own thread. 
+ * Callbacks for a channel receive the shard that owns it. Channels may still be submitted to or closed through the sharded RsslReactor itself.
+ * Shards are destroyed along with the sharded RsslReactor and must not be destroyed individually.
+ * @param pReactor The sharded RsslReactor.
+ * @param shardIndex Index of the shard, from 0 to RsslCreateReactorOptions.shardCount - 1. Shard 0 is pReactor itself.
+ * @param pError Error structure to be populated in the event of an error.
+ * @return Pointer to the shard. If the pointer is NULL, the index was not valid.
+ * @see RsslCreateReactorOptions, rsslReactorDispatch
+ */
+RSSL_VA_API RsslReactor *rsslReactorGetShard(RsslReactor *pReactor, RsslUInt32 shardIndex, RsslErrorInfo *pError);
+
 typedef struct
 {
 	RsslConnectOptions	rsslConnectOptions;		/*!< Options for creating the connection. */
@@ -355,13 +410,39 @@ RSSL_VA_API RsslRet rsslReactorAccept(RsslReactor *pReactor, RsslServer *pServer
  */
 RSSL_VA_API RsslRet rsslReactorCloseChannel(RsslReactor *pReactor, RsslReactorChannel *pChannel, RsslErrorInfo *pError);
 
+/**
+ * @brief Returns flushing statistics for a channel.
+ * @param pReactor The reactor that handles the channel.
+ * @param pChannel The channel to get statistics for.
+ * @param pStats RsslReactorChannelFlushStats structure to be populated.
+ * @param pError Error structure to be populated in the event of failure.
+ * @return RSSL_RET_SUCCESS, if successful.
+ * @return RsslRet failure codes, if an error occurred.
+ * @see RsslReactor, RsslReactorChannel, RsslReactorChannelFlushStats, RsslErrorInfo
+ */
+RSSL_VA_API RsslRet rsslReactorGetChannelFlushStats(RsslReactor *pReactor, RsslReactorChannel *pChannel, RsslReactorChannelFlushStats *pStats, RsslErrorInfo *pError);
+
+/**
+ * @brief Returns the progress of item requests waiting to be sent on a channel under RsslConsumerWatchlistOptions.itemRequestRate.
+ * If the channel does not have a watchlist, all statistics are zero.
+ * @param pReactor The reactor that handles the channel.
+ * @param pChannel The channel to get statistics for.
+ * @param pStats RsslReactorChannelRequestPacingStats structure to be populated.
+ * @param pError Error structure to be populated in the event of failure.
+ * @return RSSL_RET_SUCCESS, if successful.
+ * @return RsslRet failure codes, if an error occurred.
+ * @see RsslReactor, RsslReactorChannel, RsslReactorChannelRequestPacingStats, RsslErrorInfo
+ */
+RSSL_VA_API RsslRet rsslReactorGetChannelRequestPacingStats(RsslReactor *pReactor, RsslReactorChannel *pChannel, RsslReactorChannelRequestPacingStats *pStats, RsslErrorInfo *pError);
+
 /**
  * @brief Options for dispatching from an RsslReactor.
  * @see rsslReactorDispatch
  */
 typedef struct
 {
-	RsslReactorChannel	*pReactorChannel;	/*!< If specified, only events and messages for this channel with be processed. If not specified, messages and events for all channels will be processed. */
+	RsslReactorChannel	*pReactorChannel;	/*!< If specified, only events and messages for this channel with be processed. If not specified, messages and events for all channels will be processed. 
+											 * For a sharded RsslReactor, only the channels of the shard passed to rsslReactorDispatch are processed, unless a channel is specified. */
 	RsslUInt32			maxMessages;		/*!< The maximum number of events or messages to process for this call to rsslReactorDispatch(). */
 } RsslReactorDispatchOptions;
 
@@ -434,6 +515,9 @@ RSSL_VA_API RsslRet rsslReactorSubmit(RsslReactor *pReactor, RsslReactorChannel
 typedef struct
 {
 	void		*pUserSpec;			/*!< User-specified pointer to return as the application receives events related to this request. */
+	RsslBool	critical;			/*!< Marks the item as critical. When item requests are limited by RsslConsumerWatchlistOptions.itemRequestRate, requests for critical items are sent ahead of other items. */
+	RsslBool	conflateUpdates;	/*!< Conflates updates for this request. Field list updates are merged into a single pending update, where each field replaces any earlier value of the same field, and the merged update is delivered after conflationInterval. Other messages are delivered as they arrive, after any pending update, so a refresh is delivered after the update that was pending when it arrived. Intended for applications that cannot keep up with fast-updating items. */
+	RsslUInt32	conflationInterval;	/*!< When conflateUpdates is set, time in milliseconds for which updates are merged before the merged update is delivered. If 0, the merged update is delivered on the next dispatch. Changing it on a reissue restarts the interval of any pending update. */
 } RsslReactorRequestMsgOptions;
 
 typedef struct
@@ -48,6 +48,51 @@ typedef struct
 	RsslChannelInfo	rsslChannelInfo;	/*!< RsslChannel information. */
 } RsslReactorChannelInfo;
 
+/**
+ * @brief Flushing statistics returned by the rsslReactorGetChannelFlushStats() call.
+ * Counts are kept from the time the channel is added to the RsslReactor.
+ * @see rsslReactorGetChannelFlushStats, RsslCreateReactorOptions
+ */
+typedef struct
+{
+	RsslUInt64	flushRequests;			/*!< Number of times the RsslReactor requested that its worker thread flush the channel. */
+	RsslUInt64	flushCalls;				/*!< Number of times the worker thread called rsslFlush on the channel. */
+	RsslUInt64	highWaterMarkFlushes;	/*!< Number of flushes started because a flush high-water mark was reached. */
+	RsslUInt64	deadlineFlushes;		/*!< Number of flushes started because RsslCreateReactorOptions.flushDelayUsec passed. */
+	RsslUInt64	coalescedMsgs;			/*!< Number of submitted messages that were added to an already-pending flush instead of requesting a new one. */
+} RsslReactorChannelFlushStats;
+
+/**
+ * @brief Clears an RsslReactorChannelFlushStats object.
+ * @see RsslReactorChannelFlushStats
+ */
+RTR_C_INLINE void rsslClearReactorChannelFlushStats(RsslReactorChannelFlushStats *pStats)
+{
+	memset(pStats, 0, sizeof(RsslReactorChannelFlushStats));
+}
+
+/**
+ * @brief Item request pacing statistics returned by the rsslReactorGetChannelRequestPacingStats() call.
+ * @see rsslReactorGetChannelRequestPacingStats, RsslConsumerWatchlistOptions
+ */
+typedef struct
+{
+	RsslUInt32	itemRequestRate;			/*!< Maximum item requests per second, per RsslConsumerWatchlistOptions.itemRequestRate. 0 if requests are not limited. */
+	RsslUInt32	pendingRequests;			/*!< Number of item requests waiting to be sent, including critical ones. */
+	RsslUInt32	pendingCriticalRequests;	/*!< Number of waiting item requests that are for critical items. */
+	RsslUInt64	pacedRequestsSent;			/*!< Number of item requests sent under the limit since the channel was added to the RsslReactor. */
+	RsslUInt64	estimatedTimeRemaining;		/*!< Estimated time until all waiting item requests are sent, in milliseconds. */
+} RsslReactorChannelRequestPacingStats;
+
+/**
+ * @brief Clears an RsslReactorChannelRequestPacingStats object.
+ * @see RsslReactorChannelRequestPacingStats
+ */
+RTR_C_INLINE void rsslClearReactorChannelRequestPacingStats(RsslReactorChannelRequestPacingStats *pStats)
+{
+	memset(pStats, 0, sizeof(RsslReactorChannelRequestPacingStats));
+}
+
 /**
  * @brief Returns information about the RsslReactorChannel
  * @param pReactorChannel The channel to get information from.
@@ -82,7 +82,8 @@ typedef enum {
 										 /*!< (12) Reserved */
 										 /*!< (13) Reserved */
 	RSSL_REGISTER_HASH_ID			= 14, /*!< (14) Channel: Used with ::RSSL_CONN_TYPE_RELIABLE_MCAST connections. Registers a hash so that a filtering-enabled channel allows it. */
-	RSSL_UNREGISTER_HASH_ID			= 15 /*!< (15) Channel: Used with ::RSSL_CONN_TYPE_RELIABLE_MCAST connections. Unregisters a hash so that a filtering-enabled channel no longer allows it. */
+	RSSL_UNREGISTER_HASH_ID			= 15, /*!< (15) Channel: Used with ::RSSL_CONN_TYPE_RELIABLE_MCAST connections. Unregisters a hash so that a filtering-enabled channel no longer allows it. */
+	RSSL_IO_URING					= 16 /*!< (16) Channel and Server: Used with non-blocking ::RSSL_CONN_TYPE_SOCKET connections on Linux. Takes a pointer to a nonzero RsslUInt32 to submit the channel's socket reads and writes through an io_uring instance once it is active; on a server, applies to channels accepted afterwards. If the kernel does not support io_uring, the channel silently keeps using regular socket calls. */
 } RsslIoctlCodes;
 
 /**
@@ -1193,6 +1194,36 @@ RSSL_API RsslBuffer* rsslReadEx(	RsslChannel *chnl,
 											RsslRet *readRet,
 											RsslError *error);
 
+/**
+ * @brief Reads several messages on a given channel in one call
+ *
+ * Typical use:<BR>
+ * rsslReadMany is called with an array of bufferCount RsslBuffer structures and
+ * fills them, in order, with messages read from the channels socketId, returning the number 
+ * of buffers filled.  This takes the channel lock once for the whole batch instead of once per
+ * message.  The returned buffers are only good until the next time rsslRead, rsslReadEx or 
+ * rsslReadMany is called on the channel.  Fewer than bufferCount buffers may be returned even 
+ * if more data is available, as a batch ends with any message whose memory would be reused by the 
+ * next read (e.g. compressed or fragmented messages).  readRet is assigned as for rsslReadEx, 
+ * describing the state after the last read performed; a positive value indicates more data to read.  
+ * The bytesRead and uncompressedBytesRead of readOutArgs are totals for the batch.
+ *
+ * @param chnl RSSL Channel to read from
+ * @param pBuffers Array of at least bufferCount buffers to populate
+ * @param bufferCount Maximum number of messages to read
+ * @param RsslReadOutArgs various output values from the read
+ * @param readRet RsslRet value or RsslReturnCodes value which is the return value of the last read
+ * @param error RSSL Error, to be populated in event of an error
+ * @return Number of buffers populated in pBuffers
+ * @see RsslReturnCodes
+ */
+RSSL_API RsslUInt32 rsslReadMany(	RsslChannel *chnl,
+											RsslBuffer *pBuffers,
+											RsslUInt32 bufferCount,
+											RsslReadOutArgs *readOutArgs,
+											RsslRet *readRet,
+											RsslError *error);
+
 /**
  *	@}
  */
@@ -1411,6 +1442,41 @@ RSSL_API RsslRet rsslWriteEx(RsslChannel *chnl,
 									 RsslWriteOutArgs *writeOutArgs,
 									 RsslError	*error);
 
+/**
+ * @brief Writes several buffers on a given channel and flushes them together
+ *
+ * Typical use:<BR>
+ * rsslWriteMany is called with an array of populated buffers, e.g. a burst of updates
+ * to publish.  Each buffer is written in order as with rsslWriteEx, except that it is 
+ * queued rather than passed directly to the socket.  The socket transport queues the whole 
+ * batch under a single channel lock and then flushes it once, so that it can be sent with 
+ * one vectored write; other transports write each buffer and then flush once.  Writing stops 
+ * at the first buffer that fails; that buffer and any after it are not released and remain 
+ * owned by the application.  Buffers that were written are released automatically, as with 
+ * rsslWriteEx.
+ *
+ * @param chnl RSSL Channel to write to
+ * @param pBuffers Array of bufferCount buffers to write
+ * @param pPriorities Optional array of bufferCount priorities, one per buffer.  If NULL, writeInArgs->rsslPriority is used for every buffer.
+ * @param bufferCount Number of buffers to write
+ * @param writeInArgs input arguments applied to every buffer (RsslWriteInArgs)
+ * @param writeOutArgs bytesWritten and uncompressedBytesWritten are totals for the written buffers
+ * @param pResults Optional array of bufferCount results.  Each written or failed buffer receives its rsslWriteEx return value; entries after a failed buffer are not modified.
+ * @param writeRet The return code of the failed buffer if writing stopped early, otherwise the return of the final flush (the number of bytes still pending flush, or a RsslReturnCodes value)
+ * @param error RSSL Error, to be populated in event of an error
+ * @return Number of buffers written (and released)
+ * @see RsslReturnCodes, RsslWriteFlags, rsslWriteEx, rsslFlush
+ */
+RSSL_API RsslUInt32 rsslWriteMany(RsslChannel *chnl,
+									 RsslBuffer **pBuffers,
+									 RsslWritePriorities *pPriorities,
+									 RsslUInt32 bufferCount,
+									 RsslWriteInArgs *writeInArgs,
+									 RsslWriteOutArgs *writeOutArgs,
+									 RsslRet *pResults,
+									 RsslRet *writeRet,
+									 RsslError	*error);
+
 
 /**
  * @brief Flushes data waiting to be written on a given channel
@@ -1427,6 +1493,26 @@ RSSL_API RsslRet rsslWriteEx(RsslChannel *chnl,
 RSSL_API RsslRet rsslFlush(RsslChannel *chnl,
 									  RsslError *error);
 
+/**
+ * @brief Flushes data waiting to be written on several channels
+ *
+ * Typical use:<BR>
+ * rsslFlushMany is called by an application servicing many channels, with every channel 
+ * that has data to flush.  The result for each channel is the same as calling rsslFlush on it.  
+ * Socket channels that enabled ::RSSL_IO_URING and are flushed from the same thread have their 
+ * writes submitted to the kernel together, rather than one system call per channel.
+ *
+ * @param pChannels Array of channelCount channels to flush
+ * @param channelCount Number of channels in pChannels
+ * @param pResults Array of channelCount results, populated with each channel's rsslFlush return value
+ * @param pErrors Array of channelCount RSSL Errors, each populated in event of an error on that channel
+ * @return RsslRet RSSL_RET_SUCCESS, or a failure code if the arguments are invalid; per-channel results are in pResults
+ */
+RSSL_API RsslRet rsslFlushMany(RsslChannel **pChannels,
+									  RsslUInt32 channelCount,
+									  RsslRet *pResults,
+									  RsslError **pErrors);
+
 /**
  * @brief Sends a heartbeat message
  *
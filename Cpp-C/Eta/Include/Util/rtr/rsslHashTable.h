@@ -1,11 +1,18 @@
 /*
  * This source code is provided under the Apache 2.0 license and is provided
- * AS IS with no warranty or guarantee of fit for purpose.  See the project's 
- * LICENSE.md for details. 
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
  * Copyright Thomson Reuters 2015. All rights reserved.
 */
 
-/* Implements a basic hash table using the RsslQueue. */
+/* Implements an open-addressing hash table of RsslHashLinks.
+ * Links are stored in a power-of-two array of slots using linear probing with Robin Hood
+ * insertion, so lookups scan a short, contiguous run of slots and can stop as soon as they
+ * pass the point where the key would have been placed. Removal shifts the following slots
+ * back instead of leaving tombstones.
+ * The table grows as elements are added. When it does, the previous slots are kept and
+ * moved into the new slots a few at a time by later inserts and removes, so that no single
+ * call has to rehash the whole table. */
 
 #ifndef RSSL_HASH_TABLE_H
 #define RSSL_HASH_TABLE_H
@@ -16,6 +23,7 @@
 #include "rtr/rsslDataUtils.h"
 #include "rtr/rsslErrorInfo.h"
 #include <stdlib.h>
+#include <string.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -31,7 +39,6 @@ typedef RsslBool RsslHashCompareFunction(void*, void*);
 /* Hash Table Link structure. */
 typedef struct
 {
-	RsslQueueLink	queueLink;
 	void			*pKey;
 	RsslUInt32		hashSum;
 } RsslHashLink;
@@ -41,30 +48,43 @@ RTR_C_INLINE void rsslHashLinkInit(RsslHashLink *pLink)
 {
 	pLink->hashSum = 0;
 	pLink->pKey = NULL;
-	rsslInitQueueLink(&pLink->queueLink);
 }
 
+/* Hash Table slot. The hash sum is kept alongside the link so that probing does not need to read the link. */
+typedef struct
+{
+	RsslHashLink	*pLink;		/* Link in this slot, or NULL if the slot is empty. */
+	RsslUInt32		hashSum;
+} RsslHashSlot;
+
 /* Hash Table structure. */
 typedef struct {
-	RsslUInt32				queueCount;
-	RsslUInt32				elementCount;
-	RsslUInt32				thresholdCapacity;
-	RsslBool				dynamicSize;
-	RsslQueue				*queueList;
+	RsslUInt32				slotCount;			/* Number of slots (a power of two) */
+	RsslUInt32				slotShift;			/* Shift that maps a mixed hash sum to a slot */
+	RsslUInt32				elementCount;		/* Number of links in the table, including those not yet moved from oldSlots */
+	RsslUInt32				thresholdCapacity;	/* Element count at which the table grows */
+	RsslHashSlot			*slots;
+
+	RsslHashSlot			*oldSlots;			/* While the table is growing, the previous slots. */
+	RsslUInt32				oldSlotCount;
+	RsslUInt32				oldSlotShift;
+	RsslUInt32				oldSlotIndex;		/* Next slot in oldSlots to move */
+
 	RsslHashSumFunction		*keyHashFunction;
 	RsslHashCompareFunction	*keyCompareFunction;
 } RsslHashTable;
 
-/* Initializes a hash table. */
-RTR_C_INLINE RsslRet rsslHashTableInit(RsslHashTable *pTable, RsslUInt32 queueCount, 
+/* Initializes a hash table. The table starts with room for about initialCount elements and grows as needed. */
+RTR_C_INLINE RsslRet rsslHashTableInit(RsslHashTable *pTable, RsslUInt32 initialCount,
 		RsslHashSumFunction *keyHashFunction, RsslHashCompareFunction *keyCompareFunction,
-		RsslBool dynamicSize, RsslErrorInfo *pErrorInfo);
+		RsslErrorInfo *pErrorInfo);
 
 /* Cleans up a hash table. */
 RTR_C_INLINE RsslRet rsslHashTableCleanup(RsslHashTable *pTable);
 
-/* Add an element to the hash table. */
-RTR_C_INLINE void rsslHashTableInsertLink(RsslHashTable *pTable, RsslHashLink *pLink, 
+/* Add an element to the hash table. Returns RSSL_RET_FAILURE, without adding the element,
+ * if the table needed to grow and could not. */
+RTR_C_INLINE RsslRet rsslHashTableInsertLink(RsslHashTable *pTable, RsslHashLink *pLink,
 		void *pKey, RsslUInt32 *pSum);
 
 /* Remove an element from a hash table. */
@@ -73,6 +93,13 @@ RTR_C_INLINE void rsslHashTableRemoveLink(RsslHashTable *pTable, RsslHashLink *p
 /* Find an element in the hash table that matches the given key. */
 RTR_C_INLINE RsslHashLink *rsslHashTableFind(RsslHashTable *pTable, void *pKey, RsslUInt32 *pSum);
 
+/* Function called on each element removed by rsslHashTableRemoveAllLinks. */
+typedef void RsslHashLinkFunction(RsslHashLink*);
+
+/* Removes every element from the hash table in one pass over its slots, calling linkFunction on each
+ * after it is removed (the function may free the element). */
+RTR_C_INLINE void rsslHashTableRemoveAllLinks(RsslHashTable *pTable, RsslHashLinkFunction *linkFunction);
+
 /* Objects that are part of hash tables include the RsslHashLink as part of their structure.
  * This convenience macro can be used to cast from a RsslHashLink into the full object. */
 #define RSSL_HASH_LINK_TO_OBJECT(__objectType, __link, __pLink) ((__objectType*)((char*)__pLink - offsetof(__objectType, __link)))
@@ -95,43 +122,155 @@ RSSL_API RsslBool rsslHashBufferCompare(void *pKey1, void *pKey2);
 
 #define LOAD_FACTOR 0.75
 
-#define RSSL_HASH_LINK_FROM_QUEUE_LINK(__pLink) ((RsslHashLink*)__pLink)
+/* Smallest number of slots in a table. */
+#define RSSL_HASH_TABLE_MIN_SLOTS 8
 
-RTR_C_INLINE RsslRet rsslHashTableInit(RsslHashTable *pTable, RsslUInt32 queueCount, 
-		RsslHashSumFunction *keyHashFunction, RsslHashCompareFunction *keyCompareFunction,
-		RsslBool dynamicSize, RsslErrorInfo *pErrorInfo)
+/* Number of old slots moved into the new slots by each insert or remove while the table is growing.
+ * This must be at least 2, so that all old slots are moved before the table needs to grow again. */
+#define RSSL_HASH_TABLE_RESIZE_STEP 8
+
+/* Marks a slot in oldSlots whose link was moved or removed. Old slots are never shifted, so that
+ * slots are not missed by the move, and so links leaving them are replaced with this instead. */
+#define RSSL_HASH_SLOT_REMOVED(__pTable) ((RsslHashLink*)(__pTable))
+
+/* Maps a hash sum to its preferred slot. The sum is mixed first(Fibonacci hashing), since many hash sum
+ * functions (e.g. rsslHashU32Sum) simply return the key. */
+#define RSSL_HASH_SLOT_INDEX(__hashSum, __shift) ((RsslUInt32)((RsslUInt32)(__hashSum) * 0x9E3779B1U) >> (__shift))
+
+RTR_C_INLINE RsslHashSlot *_rsslHashSlotsAlloc(RsslUInt32 slotCount)
 {
-	RsslUInt64 queueListSize = queueCount * sizeof(RsslQueue);
-	RsslUInt32 i;
+	RsslUInt64 slotListSize = (RsslUInt64)slotCount * sizeof(RsslHashSlot);
 
+	if (slotListSize > (size_t)-1) /* overflow */
+		return NULL;
 
-	if (queueListSize > (size_t)-1) /* overflow */
+	return (RsslHashSlot*)calloc(1, (size_t)slotListSize);
+}
+
+/* Adds a link to a set of slots. The slots must have at least one empty slot.
+ * Each link moves past links that are closer to their own preferred slot, which keeps probe lengths even. */
+RTR_C_INLINE void _rsslHashSlotsInsert(RsslHashSlot *slots, RsslUInt32 slotCount, RsslUInt32 slotShift,
+		RsslHashLink *pLink, RsslUInt32 hashSum)
+{
+	RsslUInt32 mask = slotCount - 1;
+	RsslUInt32 index = RSSL_HASH_SLOT_INDEX(hashSum, slotShift);
+	RsslUInt32 distance = 0;
+	RsslHashSlot entry;
+
+	entry.pLink = pLink;
+	entry.hashSum = hashSum;
+
+	while (slots[index].pLink != NULL)
 	{
-		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
-				"Hash table queue size too large.");
-		return RSSL_RET_FAILURE;
+		RsslUInt32 slotDistance = (index - RSSL_HASH_SLOT_INDEX(slots[index].hashSum, slotShift)) & mask;
+
+		if (slotDistance < distance)
+		{
+			RsslHashSlot displaced = slots[index];
+			slots[index] = entry;
+			entry = displaced;
+			distance = slotDistance;
+		}
+
+		index = (index + 1) & mask;
+		++distance;
+	}
+
+	slots[index] = entry;
+}
+
+/* Finds the slot holding a link that matches the key (or, if pKey is NULL, the slot holding pLink).
+ * Returns the slot index, or slotCount if not found. Slots marked with RSSL_HASH_SLOT_REMOVED are skipped. */
+RTR_C_INLINE RsslUInt32 _rsslHashSlotsFind(RsslHashTable *pTable, RsslHashSlot *slots, RsslUInt32 slotCount, RsslUInt32 slotShift,
+		void *pKey, RsslHashLink *pLink, RsslUInt32 hashSum)
+{
+	RsslUInt32 mask = slotCount - 1;
+	RsslUInt32 index = RSSL_HASH_SLOT_INDEX(hashSum, slotShift);
+	RsslUInt32 distance = 0;
+
+	while (slots[index].pLink != NULL)
+	{
+		/* Links are ordered by their distance from their preferred slot, so once a link is closer
+		 * than we are, the link we want is not here. */
+		if (((index - RSSL_HASH_SLOT_INDEX(slots[index].hashSum, slotShift)) & mask) < distance)
+			return slotCount;
+
+		if (slots[index].hashSum == hashSum && slots[index].pLink != RSSL_HASH_SLOT_REMOVED(pTable))
+		{
+			if (pKey ? pTable->keyCompareFunction(pKey, slots[index].pLink->pKey) : slots[index].pLink == pLink)
+				return index;
+		}
+
+		index = (index + 1) & mask;
+		++distance;
 	}
 
+	return slotCount;
+}
+
+/* Moves some of the old slots into the current slots, if the table is growing. */
+RTR_C_INLINE void _rsslHashTableMoveOldSlots(RsslHashTable *pTable, RsslUInt32 count)
+{
+	while (pTable->oldSlots != NULL && count > 0)
+	{
+		RsslHashSlot *pOldSlot;
+
+		if (pTable->oldSlotIndex == pTable->oldSlotCount)
+		{
+			free(pTable->oldSlots);
+			pTable->oldSlots = NULL;
+			pTable->oldSlotCount = 0;
+			return;
+		}
+
+		pOldSlot = &pTable->oldSlots[pTable->oldSlotIndex++];
+		if (pOldSlot->pLink != NULL && pOldSlot->pLink != RSSL_HASH_SLOT_REMOVED(pTable))
+		{
+			_rsslHashSlotsInsert(pTable->slots, pTable->slotCount, pTable->slotShift, pOldSlot->pLink, pOldSlot->hashSum);
+			pOldSlot->pLink = RSSL_HASH_SLOT_REMOVED(pTable);
+		}
+
+		--count;
+	}
+}
+
+RTR_C_INLINE RsslUInt32 _rsslHashTableSlotShift(RsslUInt32 slotCount)
+{
+	RsslUInt32 shift = 32;
+
+	while (slotCount > 1)
+	{
+		slotCount >>= 1;
+		--shift;
+	}
+
+	return shift;
+}
+
+RTR_C_INLINE RsslRet rsslHashTableInit(RsslHashTable *pTable, RsslUInt32 initialCount,
+		RsslHashSumFunction *keyHashFunction, RsslHashCompareFunction *keyCompareFunction,
+		RsslErrorInfo *pErrorInfo)
+{
+	RsslUInt32 slotCount = RSSL_HASH_TABLE_MIN_SLOTS;
+
 	memset(pTable, 0, sizeof(RsslHashTable));
 
-	pTable->queueCount = queueCount;
-	pTable->elementCount = 0;
-	pTable->thresholdCapacity = (RsslUInt32)((double)queueCount * LOAD_FACTOR);
-	pTable->dynamicSize = dynamicSize;
+	while ((double)slotCount * LOAD_FACTOR < (double)initialCount && slotCount < 0x80000000U)
+		slotCount <<= 1;
 
-	pTable->queueList = (RsslQueue*)malloc((size_t)queueListSize);
+	pTable->slots = _rsslHashSlotsAlloc(slotCount);
 
-	if (!pTable->queueList)
+	if (!pTable->slots)
 	{
-		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
 				"Memory allocation failure.");
 		return RSSL_RET_FAILURE;
 	}
 
-	for (i = 0; i < queueCount; ++i)
-	{
-		rsslInitQueue(&pTable->queueList[i]);
-	}
+	pTable->slotCount = slotCount;
+	pTable->slotShift = _rsslHashTableSlotShift(slotCount);
+	pTable->elementCount = 0;
+	pTable->thresholdCapacity = (RsslUInt32)((double)slotCount * LOAD_FACTOR);
 
 	pTable->keyHashFunction = keyHashFunction;
 	pTable->keyCompareFunction = keyCompareFunction;
@@ -141,112 +280,145 @@ RTR_C_INLINE RsslRet rsslHashTableInit(RsslHashTable *pTable, RsslUInt32 queueCo
 
 RTR_C_INLINE RsslRet rsslHashTableCleanup(RsslHashTable *pTable)
 {
-	free(pTable->queueList);
-	pTable->queueList = NULL;
+	free(pTable->slots);
+	pTable->slots = NULL;
+	free(pTable->oldSlots);
+	pTable->oldSlots = NULL;
 	return RSSL_RET_SUCCESS;
 }
 
+/* Starts growing the table. The current slots become the old slots, which are moved into the new slots
+ * by subsequent inserts and removes. */
 RTR_C_INLINE RsslRet rsslHashTableResize(RsslHashTable *pTable)
 {
-	RsslUInt32 newQueueCount = pTable->queueCount * 2 + 1;
-        RsslUInt64 queueListSize = newQueueCount * sizeof(RsslQueue);
-	RsslQueue* rsslOldQueue = (RsslQueue*)pTable->queueList;
-        RsslUInt32 i;
-
-	/* calculate new treshold */
-        pTable->thresholdCapacity = (RsslUInt32)((double)newQueueCount * LOAD_FACTOR);
-
-        if (queueListSize > (size_t)-1) /* overflow */
-                return RSSL_RET_FAILURE;
-
-	/* allocate new table */	
-	pTable->queueList = (RsslQueue*)malloc((size_t)queueListSize);
-
-        if (!pTable->queueList)
-                return RSSL_RET_FAILURE;
-
-	/* initialize queue list */
-        for (i = 0; i < newQueueCount; ++i)
-        {
-                rsslInitQueue(&pTable->queueList[i]);
-        }
-
-	/* iterate through old hash table to move all the items */
-        for (i = 0; i < pTable->queueCount; ++i)
-        {
-		RsslQueueLink* pQueueLink = rsslQueueRemoveFirstLink(&rsslOldQueue[i]);
-		while (pQueueLink)
-		{
-			RsslQueue* pQueue;
-			RsslHashLink *pHashLink = RSSL_HASH_LINK_FROM_QUEUE_LINK(pQueueLink);
-			RsslUInt32 queueListLocation;
+	RsslUInt32 newSlotCount = pTable->slotCount * 2;
+	RsslHashSlot *newSlots;
 
-			/* figure out a new position */
-		        queueListLocation =  pHashLink->hashSum % newQueueCount;
-		        pQueue = &pTable->queueList[queueListLocation];
+	if (newSlotCount == 0) /* overflow */
+		return RSSL_RET_FAILURE;
 
-			/* add the link to new queue */
-		        rsslQueueAddLinkToBack(pQueue, &pHashLink->queueLink);
+	/* Finish any previous resize first. */
+	_rsslHashTableMoveOldSlots(pTable, pTable->oldSlotCount + 1);
 
-			/* go to next link */
-			pQueueLink = rsslQueueRemoveFirstLink(&rsslOldQueue[i]);
-		}
-        }
+	if (!(newSlots = _rsslHashSlotsAlloc(newSlotCount)))
+		return RSSL_RET_FAILURE;
+
+	pTable->oldSlots = pTable->slots;
+	pTable->oldSlotCount = pTable->slotCount;
+	pTable->oldSlotShift = pTable->slotShift;
+	pTable->oldSlotIndex = 0;
 
-	/* update new size */
-	pTable->queueCount = newQueueCount;
-		
-	/* free old table */
-	free(rsslOldQueue);
+	pTable->slots = newSlots;
+	pTable->slotCount = newSlotCount;
+	pTable->slotShift = _rsslHashTableSlotShift(newSlotCount);
+	pTable->thresholdCapacity = (RsslUInt32)((double)newSlotCount * LOAD_FACTOR);
 
 	return RSSL_RET_SUCCESS;
 }
 
-RTR_C_INLINE void rsslHashTableInsertLink(RsslHashTable *pTable, RsslHashLink *pLink, 
+RTR_C_INLINE RsslRet rsslHashTableInsertLink(RsslHashTable *pTable, RsslHashLink *pLink,
 		void *pKey, RsslUInt32 *pSum)
 {
-	RsslUInt32 queueListLocation;
-	RsslQueue *pQueue;
-
 	pLink->hashSum = (pSum ? *pSum : pTable->keyHashFunction(pKey));
 	pLink->pKey = pKey;
 
-	queueListLocation =  pLink->hashSum % pTable->queueCount;
-	pQueue = &pTable->queueList[queueListLocation];
+	/* Inserting needs an empty slot, which is only guaranteed below the load factor. */
+	if (pTable->elementCount >= pTable->thresholdCapacity && rsslHashTableResize(pTable) != RSSL_RET_SUCCESS)
+		return RSSL_RET_FAILURE;
 
-	rsslQueueAddLinkToBack(pQueue, &pLink->queueLink);
+	_rsslHashTableMoveOldSlots(pTable, RSSL_HASH_TABLE_RESIZE_STEP);
 
+	_rsslHashSlotsInsert(pTable->slots, pTable->slotCount, pTable->slotShift, pLink, pLink->hashSum);
 	pTable->elementCount++;
-
-	if (pTable->dynamicSize && pTable->elementCount > pTable->thresholdCapacity)
-		rsslHashTableResize(pTable);
+	return RSSL_RET_SUCCESS;
 }
 
-
-
 RTR_C_INLINE void rsslHashTableRemoveLink(RsslHashTable *pTable, RsslHashLink *pLink)
 {
-	RsslUInt32 queueListLocation = pLink->hashSum % pTable->queueCount;
-	rsslQueueRemoveLink(&pTable->queueList[queueListLocation], &pLink->queueLink);
+	RsslUInt32 mask = pTable->slotCount - 1;
+	RsslUInt32 index = _rsslHashSlotsFind(pTable, pTable->slots, pTable->slotCount, pTable->slotShift,
+			NULL, pLink, pLink->hashSum);
+
+	if (index != pTable->slotCount)
+	{
+		/* Shift back the links that follow, until reaching an empty slot or a link that is in its preferred slot. */
+		RsslUInt32 next = (index + 1) & mask;
+
+		while (pTable->slots[next].pLink != NULL
+				&& RSSL_HASH_SLOT_INDEX(pTable->slots[next].hashSum, pTable->slotShift) != next)
+		{
+			pTable->slots[index] = pTable->slots[next];
+			index = next;
+			next = (next + 1) & mask;
+		}
+
+		pTable->slots[index].pLink = NULL;
+	}
+	else if (pTable->oldSlots != NULL)
+	{
+		/* Link has not been moved yet. */
+		index = _rsslHashSlotsFind(pTable, pTable->oldSlots, pTable->oldSlotCount, pTable->oldSlotShift,
+				NULL, pLink, pLink->hashSum);
+		if (index == pTable->oldSlotCount)
+			return;
+
+		pTable->oldSlots[index].pLink = RSSL_HASH_SLOT_REMOVED(pTable);
+	}
+	else
+		return;
+
 	pTable->elementCount--;
+	_rsslHashTableMoveOldSlots(pTable, RSSL_HASH_TABLE_RESIZE_STEP);
 }
 
 RTR_C_INLINE RsslHashLink *rsslHashTableFind(RsslHashTable *pTable, void *pKey, RsslUInt32 *pSum)
 {
-	RsslUInt32 queueListLocation = (pSum ? *pSum : pTable->keyHashFunction(pKey)) 
-		% pTable->queueCount;
-	RsslQueue *pQueue = &pTable->queueList[queueListLocation];
-	RsslQueueLink *pLink;
+	RsslUInt32 hashSum = (pSum ? *pSum : pTable->keyHashFunction(pKey));
+	RsslUInt32 index;
+
+	/* Links in the old slots were added before any in the new slots, so check them first. */
+	if (pTable->oldSlots != NULL)
+	{
+		index = _rsslHashSlotsFind(pTable, pTable->oldSlots, pTable->oldSlotCount, pTable->oldSlotShift,
+				pKey, NULL, hashSum);
+		if (index != pTable->oldSlotCount)
+			return pTable->oldSlots[index].pLink;
+	}
+
+	index = _rsslHashSlotsFind(pTable, pTable->slots, pTable->slotCount, pTable->slotShift,
+			pKey, NULL, hashSum);
+	return (index != pTable->slotCount) ? pTable->slots[index].pLink : NULL;
+}
+
+RTR_C_INLINE void rsslHashTableRemoveAllLinks(RsslHashTable *pTable, RsslHashLinkFunction *linkFunction)
+{
+	RsslUInt32 index;
+	RsslHashLink *pLink;
+
+	if (pTable->oldSlots != NULL)
+	{
+		for (index = pTable->oldSlotIndex; index < pTable->oldSlotCount; ++index)
+		{
+			pLink = pTable->oldSlots[index].pLink;
+			if (pLink != NULL && pLink != RSSL_HASH_SLOT_REMOVED(pTable))
+				linkFunction(pLink);
+		}
+
+		free(pTable->oldSlots);
+		pTable->oldSlots = NULL;
+		pTable->oldSlotCount = 0;
+	}
 
-	for(pLink = rsslQueuePeekFront(pQueue); pLink; pLink = rsslQueuePeekNext(pQueue, pLink))
+	for (index = 0; index < pTable->slotCount; ++index)
 	{
-		RsslHashLink *pHashLink = RSSL_HASH_LINK_FROM_QUEUE_LINK(pLink);
-		
-		if (pTable->keyCompareFunction(pKey, pHashLink->pKey))
-			return pHashLink;
+		if ((pLink = pTable->slots[index].pLink) != NULL)
+		{
+			pTable->slots[index].pLink = NULL;
+			linkFunction(pLink);
+		}
 	}
 
-	return NULL;
+	pTable->elementCount = 0;
 }
 
 
@@ -12,6 +12,7 @@
   * 
   * Overview of usage:
   * - rsslCreateNotifier creates an RsslNotifier that can wait on file descriptors.
+  *     rsslCreateNotifierEx does the same, but lets the caller select the notification mechanism (see RsslNotifierType).
   * - rsslCreateNotifierEvent creates an RsslNotifierEvent, associated with a file descriptor.
   * - rsslNotifierAddEvent adds the RsslNotifierEvent to the RsslNotifier.
   * - rsslNotifierRegisterRead/rsslNotifierRegisterWrite enable read/write notification for the RsslNotifierEvent.
@@ -67,7 +68,8 @@ RTR_C_INLINE int rsslNotifierEventIsWritable(RsslNotifierEvent *pEvent)
 
 /* Indicates whether the event's file descriptor may be invalid.  The event may need its associated FD to be updated.
  *   Note: When the notifier uses select for notification, this will be set on every descriptor when
- *   it sees the EBADF error. When the notifier uses poll, it will be set only on appropriate events. */
+ *   it sees the EBADF error. When the notifier uses poll, it will be set only on appropriate events. When the notifier
+ *   uses epoll, it will be set when the descriptor is found to be closed while changing its registration. */
 RTR_C_INLINE int rsslNotifierEventIsFdBad(RsslNotifierEvent *pEvent)
 {
 	return pEvent->notifiedFlags & RSSL_NESF_BAD_FD;
@@ -88,6 +90,14 @@ RSSL_API void rsslDestroyNotifierEvent(RsslNotifierEvent *pEvent);
 /* Returns the object associated with this event. */
 RSSL_API void *rsslNotifierEventGetObject(RsslNotifierEvent *pEvent);
 
+/* Mechanisms an RsslNotifier can use to wait for notification. */
+typedef enum
+{
+	RSSL_NT_DEFAULT = 0,	/* Platform default: poll() on Unix, select() on Windows. The cost of each wait grows with the number of associated events. */
+	RSSL_NT_EPOLL = 1		/* Level-triggered epoll() (Linux only; other platforms use the default). Each wait returns only the events that were triggered,
+							 * so its cost grows with the number of ready files rather than the number of associated events. */
+} RsslNotifierType;
+
 /* Used to wait for notification.
  * Triggers on any of the RsslNotifierEvents associated with it. */
 typedef struct
@@ -100,6 +110,11 @@ typedef struct
  * - maxEventsHint: The likely max number of associated events. Setting appropriately may improve performance. */
 RSSL_API RsslNotifier *rsslCreateNotifier(int maxEventsHint);
 
+/* Initializes an RsslNotifier that uses the specified notification mechanism.
+ * - maxEventsHint: The likely max number of associated events. Setting appropriately may improve performance.
+ * - notifierType: The notification mechanism to use. See RsslNotifierType. */
+RSSL_API RsslNotifier *rsslCreateNotifierEx(int maxEventsHint, RsslNotifierType notifierType);
+
 /* Cleans up resources associated with an RsslNotifier. */
 RSSL_API void rsslDestroyNotifier(RsslNotifier *pNotifier);
 
@@ -67,6 +67,7 @@ RsslMutex pipeLock;
 bool testComplete;
 bool failTest;
 bool shutdownTest;
+bool useIoUring;		/* Enables RSSL_IO_URING on the server from startupServer and on ClientChannel's channel */
 
 #define MAX_MSG_WRITE_COUNT 100000
 #define MAX_THREADS 20
@@ -310,6 +311,12 @@ public:
 			failTest = true;
 			ASSERT_TRUE(false) << "rsslConnect failed with error text: " << err.text;
 		}
+
+		if (useIoUring)
+		{
+			RsslUInt32 enable = 1;
+			ASSERT_EQ(RSSL_RET_SUCCESS, rsslIoctl(pClientChnl, RSSL_IO_URING, &enable, &err)) << "rsslIoctl failed with error text: " << err.text;
+		}
 		if (blocking == RSSL_FALSE)
 		{
 			/* Hard looping on rsslInitChannel */
@@ -793,6 +800,12 @@ RsslServer* startupServer(RsslBool blocking)
 
 	if(server == NULL)
 		std::cout << "Could not start rsslServer.  Error text: " << err.text << std::endl;
+	else if (useIoUring)
+	{
+		RsslUInt32 enable = 1;
+		if (rsslServerIoctl(server, RSSL_IO_URING, &enable, &err) != RSSL_RET_SUCCESS)
+			std::cout << "Could not enable io_uring.  Error text: " << err.text << std::endl;
+	}
 
 	return server;
 
@@ -1079,6 +1092,7 @@ protected:
 	virtual void SetUp()
 	{
 		shutdownTest = false;
+		useIoUring = false;
 		failTest = false;
 		server = NULL;
 		serverChannel = NULL;
@@ -1191,6 +1205,302 @@ TEST_F(AllLockTests, NonBlockingTwoWayClientServer)
 
 }
 
+/*	Test writes a sequence of numbered messages from the client, then reads them on the server 
+	with rsslReadMany and verifies that all of them arrive in order and that they are returned 
+	more than one at a time. */
+TEST_F(AllLockTests, NonBlockingReadMany)
+{
+	const int msgCount = 1000;
+	RsslBuffer readBufs[16];
+	RsslReadOutArgs readOutArgs;
+	RsslWriteInArgs writeInArgs;
+	RsslWriteOutArgs writeOutArgs;
+	RsslBuffer* writeBuf;
+	RsslRet ret;
+	RsslUInt32 i, bufCount, maxBufCount = 0;
+	char expected[32];
+	int writeCount, readMsgCount = 0;
+	fd_set readfds;
+	struct timeval selectTime;
+
+	startupServerAndConections(RSSL_FALSE);
+
+	rsslClearWriteInArgs(&writeInArgs);
+
+	for (writeCount = 0; writeCount < msgCount; ++writeCount)
+	{
+		while ((writeBuf = rsslGetBuffer(clientChannel, 32, RSSL_FALSE, &err)) == NULL)
+			ASSERT_GE(rsslFlush(clientChannel, &err), RSSL_RET_SUCCESS) << "Flush failed.  Error: " << err.text;
+
+		writeBuf->length = snprintf(writeBuf->data, 32, "ReadMany%d", writeCount);
+		ASSERT_GE(rsslWriteEx(clientChannel, writeBuf, &writeInArgs, &writeOutArgs, &err), RSSL_RET_SUCCESS) << "Write failed.  Error: " << err.text;
+
+		while ((ret = rsslFlush(clientChannel, &err)) > RSSL_RET_SUCCESS);
+		ASSERT_EQ(ret, RSSL_RET_SUCCESS) << "Flush failed.  Error: " << err.text;
+	}
+
+	while (readMsgCount < msgCount)
+	{
+		FD_ZERO(&readfds);
+		FD_SET(serverChannel->socketId, &readfds);
+		selectTime.tv_sec = 5L;
+		selectTime.tv_usec = 0;
+		ASSERT_GT(select(FD_SETSIZE, &readfds, NULL, NULL, &selectTime), 0) << "Timed out waiting for messages.";
+
+		do
+		{
+			rsslClearReadOutArgs(&readOutArgs);
+			bufCount = rsslReadMany(serverChannel, readBufs, 16, &readOutArgs, &ret, &err);
+			ASSERT_LE(bufCount, 16u);
+
+			if (bufCount > maxBufCount)
+				maxBufCount = bufCount;
+
+			for (i = 0; i < bufCount; ++i, ++readMsgCount)
+			{
+				snprintf(expected, sizeof(expected), "ReadMany%d", readMsgCount);
+				ASSERT_EQ(strlen(expected), readBufs[i].length);
+				ASSERT_EQ(0, memcmp(expected, readBufs[i].data, readBufs[i].length));
+			}
+
+			ASSERT_TRUE(ret >= RSSL_RET_SUCCESS || ret == RSSL_RET_READ_WOULD_BLOCK || ret == RSSL_RET_READ_PING)
+				<< "rsslReadMany failed. Return code:" << ret << " Error info: " << err.text;
+		} while (ret > RSSL_RET_SUCCESS);
+	}
+
+	ASSERT_EQ(msgCount, readMsgCount);
+	ASSERT_GT(maxBufCount, 1u);
+
+	rsslCloseChannel(serverChannel, &err);
+	rsslCloseChannel(clientChannel, &err);
+}
+
+/*	Test writes numbered messages from the client in batches with rsslWriteMany, then reads them
+	on the server and verifies that all of them arrive in order.  One message in each batch is
+	larger than the maximum message size, so batches mix fragmented and queued buffers. */
+TEST_F(AllLockTests, NonBlockingWriteMany)
+{
+	const int msgCount = 1000;
+	const RsslUInt32 batchSize = 10;
+	RsslBuffer* writeBufs[10];
+	RsslWritePriorities priorities[10];
+	RsslRet results[10];
+	RsslWriteInArgs writeInArgs;
+	RsslWriteOutArgs writeOutArgs;
+	RsslBuffer* readBuf;
+	RsslRet ret;
+	RsslUInt32 i;
+	RsslUInt32 bufSize;
+	char expected[32];
+	int writeCount = 0, readMsgCount = 0;
+	const RsslUInt32 largeMsgSize = 20000;
+	fd_set readfds;
+	struct timeval selectTime;
+
+	startupServerAndConections(RSSL_FALSE);
+
+	rsslClearWriteInArgs(&writeInArgs);
+
+	while (writeCount < msgCount)
+	{
+		for (i = 0; i < batchSize; ++i)
+		{
+			bufSize = (i == batchSize / 2) ? largeMsgSize : 32;
+			while ((writeBufs[i] = rsslGetBuffer(clientChannel, bufSize, RSSL_FALSE, &err)) == NULL)
+				ASSERT_GE(rsslFlush(clientChannel, &err), RSSL_RET_SUCCESS) << "Flush failed.  Error: " << err.text;
+
+			writeBufs[i]->length = snprintf(writeBufs[i]->data, 32, "WriteMany%d", writeCount + (int)i);
+			if (bufSize == largeMsgSize)
+			{
+				memset(writeBufs[i]->data + writeBufs[i]->length, 'x', largeMsgSize - writeBufs[i]->length);
+				writeBufs[i]->length = largeMsgSize;
+			}
+			priorities[i] = RSSL_HIGH_PRIORITY;
+		}
+
+		ASSERT_EQ(batchSize, rsslWriteMany(clientChannel, writeBufs, priorities, batchSize, &writeInArgs, &writeOutArgs, results, &ret, &err))
+			<< "rsslWriteMany failed.  Error: " << err.text;
+		ASSERT_GT(writeOutArgs.bytesWritten, 0u);
+		for (i = 0; i < batchSize; ++i)
+			ASSERT_GE(results[i], RSSL_RET_SUCCESS);
+
+		while (ret > RSSL_RET_SUCCESS)
+			ret = rsslFlush(clientChannel, &err);
+		ASSERT_EQ(ret, RSSL_RET_SUCCESS) << "Flush failed.  Error: " << err.text;
+
+		writeCount += batchSize;
+	}
+
+	while (readMsgCount < msgCount)
+	{
+		FD_ZERO(&readfds);
+		FD_SET(serverChannel->socketId, &readfds);
+		selectTime.tv_sec = 5L;
+		selectTime.tv_usec = 0;
+		ASSERT_GT(select(FD_SETSIZE, &readfds, NULL, NULL, &selectTime), 0) << "Timed out waiting for messages.";
+
+		do
+		{
+			if ((readBuf = rsslRead(serverChannel, &ret, &err)) != NULL)
+			{
+				snprintf(expected, sizeof(expected), "WriteMany%d", readMsgCount);
+				if (readMsgCount++ % batchSize == batchSize / 2)
+					ASSERT_EQ(largeMsgSize, readBuf->length);
+				else
+					ASSERT_EQ(strlen(expected), readBuf->length);
+				ASSERT_EQ(0, memcmp(expected, readBuf->data, strlen(expected)));
+			}
+
+			ASSERT_TRUE(ret >= RSSL_RET_SUCCESS || ret == RSSL_RET_READ_WOULD_BLOCK || ret == RSSL_RET_READ_PING)
+				<< "rsslRead failed. Return code:" << ret << " Error info: " << err.text;
+		} while (ret > RSSL_RET_SUCCESS);
+	}
+
+	ASSERT_EQ(msgCount, readMsgCount);
+
+	/* every written buffer was released; the transport may keep one partly used buffer for later messages */
+	ASSERT_LE(rsslBufferUsage(clientChannel, &err), 1);
+
+	rsslCloseChannel(serverChannel, &err);
+	rsslCloseChannel(clientChannel, &err);
+}
+
+/*	Same as NonBlockingTwoWayClientServer, with both channels requesting the io_uring backend.
+	Where io_uring is unavailable the channels fall back to regular socket calls, so the test
+	passes either way. */
+TEST_F(AllLockTests, NonBlockingTwoWayClientServerIoUring)
+{
+	RsslThreadId serverReadThread, serverWriteThread, clientReadThread, clientWriteThread;
+	ReadChannel serverReadOpts, clientReadOpts;
+	WriteChannel serverWriteOpts, clientWriteOpts;
+	int readCount;
+
+	useIoUring = true;
+	startupServerAndConections(RSSL_FALSE);
+
+	serverReadOpts.pThreadId = &serverReadThread;
+	serverReadOpts.pChnl = serverChannel;
+	serverReadOpts.readCount = &msgsRead;
+	serverReadOpts.lock = &readLock;
+	serverWriteOpts.pThreadId = &serverWriteThread;
+	serverWriteOpts.pChnl = serverChannel;
+
+	clientReadOpts.pThreadId = &clientReadThread;
+	clientReadOpts.pChnl = clientChannel;
+	clientReadOpts.readCount = &msgsRead;
+	clientReadOpts.lock = &readLock;
+	clientWriteOpts.pThreadId = &clientWriteThread;
+	clientWriteOpts.pChnl = clientChannel;
+
+	RSSL_THREAD_START(&serverReadThread, nonBlockingReadThread, (void*)&serverReadOpts);
+	RSSL_THREAD_START(&serverWriteThread, nonBlockingWriteThread, (void*)&serverWriteOpts);
+
+	RSSL_THREAD_START(&clientReadThread, nonBlockingReadThread, (void*)&clientReadOpts);
+	RSSL_THREAD_START(&clientWriteThread, nonBlockingWriteThread, (void*)&clientWriteOpts);
+	do
+	{
+		time_sleep(500);
+		RSSL_MUTEX_LOCK(&readLock);
+		readCount = msgsRead;
+		RSSL_MUTEX_UNLOCK(&readLock);
+	} while (readCount < (MAX_MSG_WRITE_COUNT * 2) && !failTest);
+
+	ASSERT_FALSE(failTest) << "Test Failed!";
+
+	shutdownTest = true;
+
+	RSSL_THREAD_JOIN(clientWriteThread);
+	RSSL_THREAD_JOIN(serverWriteThread);
+	RSSL_THREAD_JOIN(clientReadThread);
+	RSSL_THREAD_JOIN(serverReadThread);
+
+	rsslCloseChannel(serverChannel, &err);
+	rsslCloseChannel(clientChannel, &err);
+}
+
+/*	Writes messages on both ends of a connection using io_uring and flushes them together with
+	rsslFlushMany, then checks that each end receives its messages in order.  Where io_uring is
+	unavailable the channels are flushed with regular socket calls. */
+TEST_F(AllLockTests, NonBlockingFlushManyIoUring)
+{
+	const int msgCount = 500;
+	RsslChannel* channels[2];
+	RsslError errors[2];
+	RsslError* pErrors[2] = { &errors[0], &errors[1] };
+	RsslRet results[2];
+	RsslWriteInArgs writeInArgs;
+	RsslWriteOutArgs writeOutArgs;
+	RsslBuffer* writeBuf;
+	RsslBuffer* readBuf;
+	RsslRet ret;
+	char expected[32];
+	int i, j, readMsgCount[2] = { 0, 0 };
+	fd_set readfds;
+	struct timeval selectTime;
+
+	useIoUring = true;
+	startupServerAndConections(RSSL_FALSE);
+
+	channels[0] = clientChannel;
+	channels[1] = serverChannel;
+
+	rsslClearWriteInArgs(&writeInArgs);
+
+	for (i = 0; i < msgCount; ++i)
+	{
+		for (j = 0; j < 2; ++j)
+		{
+			while ((writeBuf = rsslGetBuffer(channels[j], 32, RSSL_FALSE, &err)) == NULL)
+				ASSERT_GE(rsslFlush(channels[j], &err), RSSL_RET_SUCCESS) << "Flush failed.  Error: " << err.text;
+
+			writeBuf->length = snprintf(writeBuf->data, 32, "FlushMany%d", i);
+			rsslClearWriteOutArgs(&writeOutArgs);
+			ret = rsslWriteEx(channels[j], writeBuf, &writeInArgs, &writeOutArgs, &err);
+			ASSERT_GE(ret, RSSL_RET_SUCCESS) << "rsslWriteEx failed.  Error: " << err.text;
+		}
+
+		/* flush both channels at once every few messages, until nothing is pending */
+		if (i % 10 == 9 || i == msgCount - 1)
+		{
+			do
+			{
+				ASSERT_EQ(RSSL_RET_SUCCESS, rsslFlushMany(channels, 2, results, pErrors));
+				ASSERT_GE(results[0], RSSL_RET_SUCCESS) << "Client flush failed.  Error: " << errors[0].text;
+				ASSERT_GE(results[1], RSSL_RET_SUCCESS) << "Server flush failed.  Error: " << errors[1].text;
+			} while (results[0] > RSSL_RET_SUCCESS || results[1] > RSSL_RET_SUCCESS);
+		}
+	}
+
+	/* the server channel reads what the client wrote, and vice versa */
+	for (j = 0; j < 2; ++j)
+	{
+		while (readMsgCount[j] < msgCount)
+		{
+			FD_ZERO(&readfds);
+			FD_SET(channels[1 - j]->socketId, &readfds);
+			selectTime.tv_sec = 5L;
+			selectTime.tv_usec = 0;
+			ASSERT_GT(select(FD_SETSIZE, &readfds, NULL, NULL, &selectTime), 0) << "Timed out waiting for messages.";
+
+			do
+			{
+				if ((readBuf = rsslRead(channels[1 - j], &ret, &err)) != NULL)
+				{
+					snprintf(expected, sizeof(expected), "FlushMany%d", readMsgCount[j]++);
+					ASSERT_EQ(strlen(expected), readBuf->length);
+					ASSERT_EQ(0, memcmp(expected, readBuf->data, strlen(expected)));
+				}
+
+				ASSERT_TRUE(ret >= RSSL_RET_SUCCESS || ret == RSSL_RET_READ_WOULD_BLOCK || ret == RSSL_RET_READ_PING)
+					<< "rsslRead failed. Return code:" << ret << " Error info: " << err.text;
+			} while (ret > RSSL_RET_SUCCESS);
+		}
+	}
+
+	rsslCloseChannel(serverChannel, &err);
+	rsslCloseChannel(clientChannel, &err);
+}
+
 /*	Test kicks off one writer and one reader thread for the client and server each. Also 
 	starts a thread for pinging both the client and server connections.  Once
 	the writer threads have each written their full data, sets the shutdown boolean and
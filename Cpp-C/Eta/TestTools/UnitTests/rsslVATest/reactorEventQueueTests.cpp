@@ -0,0 +1,447 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright Thomson Reuters 2018. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+/* Tests for the queues used to pass events between the reactor and its worker thread. */
+
+#include "rtr/rsslReactor.h"
+#include "rtr/rsslReactorEventQueue.h"
+#include "rtr/rsslThread.h"
+#include "gtest/gtest.h"
+#include "getTime.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <vector>
+
+#ifdef WIN32
+#include <windows.h>
+#define EVENT_QUEUE_PERF_YIELD() SwitchToThread()
+#else
+#include <sched.h>
+#define EVENT_QUEUE_PERF_YIELD() sched_yield()
+#endif
+
+static void reactorEventQueueTest_OrderAndPool();
+static void reactorEventQueueTest_MultipleProducers();
+static void reactorEventQueueTest_Performance();
+
+TEST(ReactorEventQueueTest, OrderAndPool)
+{
+	reactorEventQueueTest_OrderAndPool();
+}
+
+TEST(ReactorEventQueueTest, MultipleProducers)
+{
+	reactorEventQueueTest_MultipleProducers();
+}
+
+/* Compares the event queue against a mutex-guarded queue like the one it replaced.
+ * Run with --gtest_also_run_disabled_tests --gtest_filter=*ReactorEventQueueTest*Performance*. */
+TEST(ReactorEventQueueTest, DISABLED_Performance)
+{
+	reactorEventQueueTest_Performance();
+}
+
+static void reactorEventQueueTest_OrderAndPool()
+{
+	RsslReactorEventQueueGroup group;
+	RsslReactorEventQueue queue1, queue2;
+	RsslReactorEventImpl *pEvent;
+	RsslInt64 i;
+	RsslRet ret;
+	const RsslInt64 eventCount = 3 * RSSL_REACTOR_EVENT_POOL_MIN_CAPACITY;
+
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslInitReactorEventQueueGroup(&group));
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslInitReactorEventQueue(&queue1, 5, &group));
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslInitReactorEventQueue(&queue2, 5, &group));
+
+	/* Empty queue. */
+	ASSERT_TRUE(rsslReactorEventQueueGet(&queue1, &ret) == NULL);
+	ASSERT_EQ(0, ret);
+	ASSERT_TRUE(rsslReactorEventQueueGroupShift(&group) == NULL);
+
+	/* Put more events than the pool holds; they should come back in order. */
+	for (i = 0; i < eventCount; ++i)
+	{
+		ASSERT_TRUE((pEvent = rsslReactorEventQueueGetFromPool(&queue1)) != NULL);
+		rsslInitTimerEvent(&pEvent->timerEvent);
+		pEvent->timerEvent.expireTime = i;
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslReactorEventQueuePut(&queue1, pEvent));
+	}
+
+	ASSERT_TRUE(queue1.isInActiveEventQueueGroup);
+	ASSERT_EQ(1, rsslQueueGetElementCount(&group.readyEventQueueGroup));
+
+	/* Second queue joins the group. */
+	ASSERT_TRUE((pEvent = rsslReactorEventQueueGetFromPool(&queue2)) != NULL);
+	rsslInitTimerEvent(&pEvent->timerEvent);
+	pEvent->timerEvent.expireTime = -1;
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslReactorEventQueuePut(&queue2, pEvent));
+	ASSERT_EQ(2, rsslQueueGetElementCount(&group.readyEventQueueGroup));
+
+	ASSERT_TRUE(rsslReactorEventQueueGroupShift(&group) == &queue1);
+	ASSERT_TRUE(rsslReactorEventQueueGroupShift(&group) == &queue2);
+
+	for (i = 0; i < eventCount; ++i)
+	{
+		ASSERT_TRUE((pEvent = rsslReactorEventQueueGet(&queue1, &ret)) != NULL);
+		ASSERT_EQ(RSSL_RCIMPL_ET_TIMER, pEvent->base.eventType);
+		ASSERT_EQ(i, pEvent->timerEvent.expireTime);
+		ASSERT_EQ(i < eventCount - 1 ? 1 : 0, ret);
+	}
+
+	/* First queue is drained and leaves the group. */
+	ASSERT_FALSE(queue1.isInActiveEventQueueGroup);
+	ASSERT_EQ(1, rsslQueueGetElementCount(&group.readyEventQueueGroup));
+	ASSERT_TRUE(rsslReactorEventQueueGet(&queue1, &ret) == NULL);
+	ASSERT_EQ(0, ret);
+
+	ASSERT_TRUE((pEvent = rsslReactorEventQueueGet(&queue2, &ret)) != NULL);
+	ASSERT_EQ(-1, pEvent->timerEvent.expireTime);
+	ASSERT_EQ(0, ret);
+	ASSERT_EQ(0, rsslQueueGetElementCount(&group.readyEventQueueGroup));
+	ASSERT_TRUE(rsslReactorEventQueueGroupShift(&group) == NULL);
+
+	/* Events taken from the pool but not put are returned to it. */
+	ASSERT_TRUE((pEvent = rsslReactorEventQueueGetFromPool(&queue1)) != NULL);
+	rsslReactorEventQueueReturnToPool(pEvent, &queue1);
+
+	/* Queue can be reused after being drained. */
+	ASSERT_TRUE((pEvent = rsslReactorEventQueueGetFromPool(&queue1)) != NULL);
+	rsslInitTimerEvent(&pEvent->timerEvent);
+	pEvent->timerEvent.expireTime = eventCount;
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslReactorEventQueuePut(&queue1, pEvent));
+	ASSERT_TRUE(queue1.isInActiveEventQueueGroup);
+
+	/* Cleanup frees events that are still queued. */
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslCleanupReactorEventQueue(&queue1));
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslCleanupReactorEventQueue(&queue2));
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslCleanupReactorEventQueueGroup(&group));
+}
+
+typedef struct
+{
+	RsslReactorEventQueue *pQueue;
+	RsslInt64 producerId;
+	RsslInt64 eventCount;
+} EventQueueProducer;
+
+static const RsslInt64 EVENT_QUEUE_PRODUCER_SHIFT = 32;
+
+static RSSL_THREAD_DECLARE(reactorEventQueueTest_producerThread, pArg)
+{
+	EventQueueProducer *pProducer = (EventQueueProducer*)pArg;
+	RsslInt64 i;
+
+	for (i = 0; i < pProducer->eventCount; ++i)
+	{
+		RsslReactorEventImpl *pEvent;
+
+		while ((pEvent = rsslReactorEventQueueGetFromPool(pProducer->pQueue)) == NULL);
+		rsslInitTimerEvent(&pEvent->timerEvent);
+		pEvent->timerEvent.expireTime = (pProducer->producerId << EVENT_QUEUE_PRODUCER_SHIFT) | i;
+		if (rsslReactorEventQueuePut(pProducer->pQueue, pEvent) != RSSL_RET_SUCCESS)
+			break;
+	}
+
+	return RSSL_THREAD_RETURN();
+}
+
+static void reactorEventQueueTest_MultipleProducers()
+{
+	RsslReactorEventQueueGroup group;
+	RsslReactorEventQueue queue;
+	EventQueueProducer producers[3];
+	RsslThreadId threadIds[3];
+	RsslInt64 nextExpected[3];
+	RsslInt64 received = 0;
+	const RsslInt64 eventsPerProducer = 100000;
+	int i;
+
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslInitReactorEventQueueGroup(&group));
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslInitReactorEventQueue(&queue, 10, &group));
+
+	for (i = 0; i < 3; ++i)
+	{
+		producers[i].pQueue = &queue;
+		producers[i].producerId = i;
+		producers[i].eventCount = eventsPerProducer;
+		nextExpected[i] = 0;
+		RSSL_THREAD_START(&threadIds[i], reactorEventQueueTest_producerThread, &producers[i]);
+	}
+
+	/* Each producer's events should arrive in the order they were put. */
+	while (received < 3 * eventsPerProducer)
+	{
+		RsslRet ret;
+		RsslReactorEventImpl *pEvent;
+		RsslInt64 producerId, sequence;
+
+		if ((pEvent = rsslReactorEventQueueGet(&queue, &ret)) == NULL)
+		{
+			ASSERT_GE(ret, RSSL_RET_SUCCESS);
+			continue;
+		}
+
+		producerId = pEvent->timerEvent.expireTime >> EVENT_QUEUE_PRODUCER_SHIFT;
+		sequence = pEvent->timerEvent.expireTime & (((RsslInt64)1 << EVENT_QUEUE_PRODUCER_SHIFT) - 1);
+		ASSERT_TRUE(producerId >= 0 && producerId < 3);
+		ASSERT_EQ(nextExpected[producerId], sequence);
+		++nextExpected[producerId];
+		++received;
+	}
+
+	for (i = 0; i < 3; ++i)
+		RSSL_THREAD_JOIN(threadIds[i]);
+
+	/* Queue should be empty and no longer in the group. */
+	{
+		RsslRet ret;
+		ASSERT_TRUE(rsslReactorEventQueueGet(&queue, &ret) == NULL);
+		ASSERT_EQ(0, ret);
+		ASSERT_FALSE(queue.isInActiveEventQueueGroup);
+		ASSERT_EQ(0, rsslQueueGetElementCount(&group.readyEventQueueGroup));
+	}
+
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslCleanupReactorEventQueue(&queue));
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslCleanupReactorEventQueueGroup(&group));
+}
+
+/* Mutex-guarded event queue, as used by the reactor before the lock-free queue. Used as the
+ * baseline for the performance comparison. */
+typedef struct
+{
+	RsslQueue eventPool;
+	RsslQueue eventQueue;
+	RsslMutex eventPoolLock;
+	RsslMutex eventQueueLock;
+	RsslReactorEventImpl *pLastEvent;
+	RsslReactorEventQueueGroup *pParentGroup;
+	RsslQueueLink readyEventQueueLink;
+	RsslBool isInActiveEventQueueGroup;
+} MutexEventQueue;
+
+static void mutexEventQueueInit(MutexEventQueue *pQueue, RsslReactorEventQueueGroup *pParentGroup)
+{
+	memset(pQueue, 0, sizeof(MutexEventQueue));
+	RSSL_MUTEX_INIT(&pQueue->eventPoolLock);
+	RSSL_MUTEX_INIT(&pQueue->eventQueueLock);
+	rsslInitQueue(&pQueue->eventPool);
+	rsslInitQueue(&pQueue->eventQueue);
+	pQueue->pParentGroup = pParentGroup;
+}
+
+static void mutexEventQueueCleanup(MutexEventQueue *pQueue)
+{
+	RsslQueueLink *pLink;
+
+	while ((pLink = rsslQueueRemoveFirstLink(&pQueue->eventQueue)))
+		free(RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorEventImpl, base.eventQueueLink, pLink));
+	while ((pLink = rsslQueueRemoveFirstLink(&pQueue->eventPool)))
+		free(RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorEventImpl, base.eventQueueLink, pLink));
+	if (pQueue->pLastEvent)
+		free(pQueue->pLastEvent);
+
+	RSSL_MUTEX_DESTROY(&pQueue->eventPoolLock);
+	RSSL_MUTEX_DESTROY(&pQueue->eventQueueLock);
+}
+
+static RsslReactorEventImpl *mutexEventQueueGetFromPool(MutexEventQueue *pQueue)
+{
+	RsslReactorEventImpl *pEvent;
+	RsslQueueLink *pLink;
+
+	RSSL_MUTEX_LOCK(&pQueue->eventPoolLock);
+	if ((pLink = rsslQueueRemoveFirstLink(&pQueue->eventPool)))
+		pEvent = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorEventImpl, base.eventQueueLink, pLink);
+	else if ((pEvent = (RsslReactorEventImpl*)malloc(sizeof(RsslReactorEventImpl))))
+	{
+		rsslClearReactorEventImpl(pEvent);
+		rsslInitQueueLink(&pEvent->base.eventQueueLink);
+	}
+	RSSL_MUTEX_UNLOCK(&pQueue->eventPoolLock);
+
+	return pEvent;
+}
+
+static void mutexEventQueuePut(MutexEventQueue *pQueue, RsslReactorEventImpl *pEvent)
+{
+	RSSL_MUTEX_LOCK(&pQueue->eventQueueLock);
+	rsslQueueAddLinkToBack(&pQueue->eventQueue, &pEvent->base.eventQueueLink);
+
+	if (rsslQueueGetElementCount(&pQueue->eventQueue) == 1)
+	{
+		RSSL_MUTEX_LOCK(&pQueue->pParentGroup->lock);
+		if (!pQueue->isInActiveEventQueueGroup)
+		{
+			rsslQueueAddLinkToBack(&pQueue->pParentGroup->readyEventQueueGroup, &pQueue->readyEventQueueLink);
+			pQueue->isInActiveEventQueueGroup = RSSL_TRUE;
+			if (rsslQueueGetElementCount(&pQueue->pParentGroup->readyEventQueueGroup) == 1)
+				rsslSetEventSignal(&pQueue->pParentGroup->eventSignal);
+		}
+		RSSL_MUTEX_UNLOCK(&pQueue->pParentGroup->lock);
+	}
+
+	RSSL_MUTEX_UNLOCK(&pQueue->eventQueueLock);
+}
+
+static RsslReactorEventImpl *mutexEventQueueGet(MutexEventQueue *pQueue)
+{
+	RsslReactorEventImpl *pEvent = NULL;
+	RsslQueueLink *pLink;
+
+	if (pQueue->pLastEvent)
+	{
+		RSSL_MUTEX_LOCK(&pQueue->eventPoolLock);
+		rsslQueueAddLinkToBack(&pQueue->eventPool, &pQueue->pLastEvent->base.eventQueueLink);
+		RSSL_MUTEX_UNLOCK(&pQueue->eventPoolLock);
+		pQueue->pLastEvent = NULL;
+	}
+
+	RSSL_MUTEX_LOCK(&pQueue->eventQueueLock);
+	if ((pLink = rsslQueueRemoveFirstLink(&pQueue->eventQueue)))
+	{
+		pEvent = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorEventImpl, base.eventQueueLink, pLink);
+		if (rsslQueueGetElementCount(&pQueue->eventQueue) == 0)
+		{
+			RSSL_MUTEX_LOCK(&pQueue->pParentGroup->lock);
+			if (pQueue->isInActiveEventQueueGroup)
+			{
+				rsslQueueRemoveLink(&pQueue->pParentGroup->readyEventQueueGroup, &pQueue->readyEventQueueLink);
+				pQueue->isInActiveEventQueueGroup = RSSL_FALSE;
+				if (rsslQueueGetElementCount(&pQueue->pParentGroup->readyEventQueueGroup) == 0)
+					rsslResetEventSignal(&pQueue->pParentGroup->eventSignal);
+			}
+			RSSL_MUTEX_UNLOCK(&pQueue->pParentGroup->lock);
+		}
+	}
+	RSSL_MUTEX_UNLOCK(&pQueue->eventQueueLock);
+
+	pQueue->pLastEvent = pEvent;
+	return pEvent;
+}
+
+typedef struct
+{
+	RsslBool useMutexQueue;
+	RsslReactorEventQueue *pQueue;
+	MutexEventQueue *pMutexQueue;
+	RsslInt64 eventCount;
+	RsslInt64 maxInFlight;			/* Producer waits while this many events are unread. */
+	volatile RsslInt64 received;	/* Updated by the consumer. */
+} EventQueuePerfProducer;
+
+static RSSL_THREAD_DECLARE(reactorEventQueueTest_perfProducerThread, pArg)
+{
+	EventQueuePerfProducer *pProducer = (EventQueuePerfProducer*)pArg;
+	RsslInt64 i;
+
+	for (i = 0; i < pProducer->eventCount; ++i)
+	{
+		RsslReactorEventImpl *pEvent;
+
+		while (i - pProducer->received >= pProducer->maxInFlight)
+			EVENT_QUEUE_PERF_YIELD();
+
+		if (pProducer->useMutexQueue)
+		{
+			while ((pEvent = mutexEventQueueGetFromPool(pProducer->pMutexQueue)) == NULL);
+			pEvent->timerEvent.expireTime = (RsslInt64)getTimeNano();
+			mutexEventQueuePut(pProducer->pMutexQueue, pEvent);
+		}
+		else
+		{
+			while ((pEvent = rsslReactorEventQueueGetFromPool(pProducer->pQueue)) == NULL);
+			pEvent->timerEvent.expireTime = (RsslInt64)getTimeNano();
+			rsslReactorEventQueuePut(pProducer->pQueue, pEvent);
+		}
+	}
+
+	return RSSL_THREAD_RETURN();
+}
+
+static void reactorEventQueueTest_runPerf(RsslBool useMutexQueue, RsslInt64 eventCount, RsslInt64 maxInFlight)
+{
+	RsslReactorEventQueueGroup group;
+	RsslReactorEventQueue queue;
+	MutexEventQueue mutexQueue;
+	EventQueuePerfProducer producer;
+	RsslThreadId threadId;
+	std::vector<TimeValue> latencies;
+	TimeValue startTime, endTime;
+
+	latencies.reserve((size_t)eventCount);
+
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslInitReactorEventQueueGroup(&group));
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslInitReactorEventQueue(&queue, 10, &group));
+	mutexEventQueueInit(&mutexQueue, &group);
+
+	producer.useMutexQueue = useMutexQueue;
+	producer.pQueue = &queue;
+	producer.pMutexQueue = &mutexQueue;
+	producer.eventCount = eventCount;
+	producer.maxInFlight = maxInFlight;
+	producer.received = 0;
+
+	startTime = getTimeNano();
+	RSSL_THREAD_START(&threadId, reactorEventQueueTest_perfProducerThread, &producer);
+
+	while (producer.received < eventCount)
+	{
+		RsslReactorEventImpl *pEvent;
+		RsslRet ret;
+
+		if (useMutexQueue)
+			pEvent = mutexEventQueueGet(&mutexQueue);
+		else
+			pEvent = rsslReactorEventQueueGet(&queue, &ret);
+
+		if (pEvent)
+		{
+			latencies.push_back(getTimeNano() - (TimeValue)pEvent->timerEvent.expireTime);
+			++producer.received;
+		}
+		else
+			EVENT_QUEUE_PERF_YIELD();
+	}
+
+	endTime = getTimeNano();
+	RSSL_THREAD_JOIN(threadId);
+
+	std::sort(latencies.begin(), latencies.end());
+	printf("  %-10s %5lld in flight: %10.0f events/sec, latency p50 %6llu ns, p99 %6llu ns, p99.9 %6llu ns\n",
+			useMutexQueue ? "mutex" : "lock-free", (long long)maxInFlight,
+			(double)eventCount * 1000000000.0 / (double)(endTime - startTime),
+			(unsigned long long)latencies[latencies.size() / 2],
+			(unsigned long long)latencies[latencies.size() * 99 / 100],
+			(unsigned long long)latencies[latencies.size() * 999 / 1000]);
+
+	mutexEventQueueCleanup(&mutexQueue);
+	rsslCleanupReactorEventQueue(&queue);
+	rsslCleanupReactorEventQueueGroup(&group);
+}
+
+static void reactorEventQueueTest_Performance()
+{
+	const RsslInt64 eventCount = 500000;
+	int run;
+
+	/* Small in-flight limits show hand-off latency, larger ones show throughput. */
+	printf("Event queue hand-off, one producer and one consumer thread, %lld events per run:\n", (long long)eventCount);
+
+	for (run = 0; run < 3; ++run)
+	{
+		reactorEventQueueTest_runPerf(RSSL_TRUE, eventCount, 1);
+		reactorEventQueueTest_runPerf(RSSL_FALSE, eventCount, 1);
+		reactorEventQueueTest_runPerf(RSSL_TRUE, eventCount, 64);
+		reactorEventQueueTest_runPerf(RSSL_FALSE, eventCount, 64);
+		reactorEventQueueTest_runPerf(RSSL_TRUE, eventCount, 1024);
+		reactorEventQueueTest_runPerf(RSSL_FALSE, eventCount, 1024);
+	}
+}
@@ -181,38 +181,118 @@ static void reactorUnitTests_ReconnectAttemptLimit();
 
 static void reactorUtilTest_ConnectDeepCopy();
 
+#ifdef Linux
+static void reactorUnitTests_EpollNotifier();
+#endif
+static void reactorUnitTests_BusyPollDispatch();
+static void reactorUnitTests_ShardedReactor();
+static void reactorUnitTests_FlushDelay();
+
+static void reactorTestSetUpWithOptions(RsslCreateReactorOptions *pReactorOpts)
+{
+	RsslError rsslError;
+	RsslBuffer errorText = { 255, (char*)alloca(255) };
+	rsslInitialize(RSSL_LOCK_GLOBAL_AND_CHANNEL, &rsslError);
+
+	rsslClearBindOpts(&bindOpts);
+	bindOpts.serviceName = const_cast<char*>("14009");
+	ASSERT_TRUE((pServer = rsslBind(&bindOpts, &rsslErrorInfo.rsslError)));
+
+	rsslClearDataDictionary(&dataDictionary);
+	createFileFromString("tmp_dictionary.txt", enumDictionaryText, sizeof(enumDictionaryText));
+	ASSERT_TRUE(rsslLoadEnumTypeDictionary("tmp_dictionary.txt", &dataDictionary, &errorText) == RSSL_RET_SUCCESS);
+
+	createFileFromString("tmp_dictionary.txt", fieldDictionaryText, sizeof(fieldDictionaryText));
+	ASSERT_TRUE(rsslLoadFieldDictionary("tmp_dictionary.txt", &dataDictionary, &errorText) == RSSL_RET_SUCCESS);
+
+	deleteFile("tmp_dictionary.txt");
+
+	mOpts = *pReactorOpts;
+	initReactors(&mOpts, RSSL_FALSE);
+}
+
+static void reactorTestSetUp(RsslReactorNotifierType notifierType, RsslBool busyPollDispatch)
+{
+	RsslCreateReactorOptions reactorOpts;
+
+	rsslClearCreateReactorOptions(&reactorOpts);
+	reactorOpts.notifierType = notifierType;
+	reactorOpts.busyPollDispatch = busyPollDispatch;
+	reactorTestSetUpWithOptions(&reactorOpts);
+}
+
+static void reactorTestTearDown()
+{
+	cleanupReactors(RSSL_FALSE);
+
+	ASSERT_TRUE(rsslCloseServer(pServer, &rsslErrorInfo.rsslError) == RSSL_RET_SUCCESS);
+	rsslDeleteDataDictionary(&dataDictionary);
+	rsslUninitialize();
+}
+
 class ReactorUtilTest : public ::testing::Test {
 public:
 
 	static void SetUpTestCase()
 	{
-		RsslError rsslError;
-		RsslBuffer errorText = { 255, (char*)alloca(255) };
-		rsslInitialize(RSSL_LOCK_GLOBAL_AND_CHANNEL, &rsslError);
+		reactorTestSetUp(RSSL_RC_NT_DEFAULT, RSSL_FALSE);
+	}
+
+	static void TearDownTestCase()
+	{
+		reactorTestTearDown();
+	}
+};
 
-		rsslClearBindOpts(&bindOpts);
-		bindOpts.serviceName = const_cast<char*>("14009");
-		ASSERT_TRUE((pServer = rsslBind(&bindOpts, &rsslErrorInfo.rsslError)));
+#ifdef Linux
+/* Runs a subset of the reactor tests with reactors that use epoll for notification. */
+class ReactorEpollTest : public ::testing::Test {
+public:
 
-		rsslClearDataDictionary(&dataDictionary);
-		createFileFromString("tmp_dictionary.txt", enumDictionaryText, sizeof(enumDictionaryText));
-		ASSERT_TRUE(rsslLoadEnumTypeDictionary("tmp_dictionary.txt", &dataDictionary, &errorText) == RSSL_RET_SUCCESS);
+	static void SetUpTestCase()
+	{
+		reactorTestSetUp(RSSL_RC_NT_EPOLL, RSSL_FALSE);
+	}
 
-		createFileFromString("tmp_dictionary.txt", fieldDictionaryText, sizeof(fieldDictionaryText));
-		ASSERT_TRUE(rsslLoadFieldDictionary("tmp_dictionary.txt", &dataDictionary, &errorText) == RSSL_RET_SUCCESS);
+	static void TearDownTestCase()
+	{
+		reactorTestTearDown();
+	}
+};
+#endif
 
-		deleteFile("tmp_dictionary.txt");
+/* Runs tests with reactors that busy-poll in rsslReactorDispatch. */
+class ReactorBusyPollTest : public ::testing::Test {
+public:
 
-		initReactors(&mOpts, RSSL_FALSE);
+	static void SetUpTestCase()
+	{
+		reactorTestSetUp(RSSL_RC_NT_DEFAULT, RSSL_TRUE);
 	}
 
 	static void TearDownTestCase()
 	{
-		cleanupReactors(RSSL_FALSE);
+		reactorTestTearDown();
+	}
+};
+
+/* Runs tests with reactors that delay flushing. */
+class ReactorFlushDelayTest : public ::testing::Test {
+public:
 
-		ASSERT_TRUE(rsslCloseServer(pServer, &rsslErrorInfo.rsslError) == RSSL_RET_SUCCESS);
-		rsslDeleteDataDictionary(&dataDictionary);
-		rsslUninitialize();
+	static void SetUpTestCase()
+	{
+		RsslCreateReactorOptions reactorOpts;
+
+		rsslClearCreateReactorOptions(&reactorOpts);
+		reactorOpts.flushDelayUsec = 500000;
+		reactorOpts.flushHighWaterMarkMsgs = 3;
+		reactorTestSetUpWithOptions(&reactorOpts);
+	}
+
+	static void TearDownTestCase()
+	{
+		reactorTestTearDown();
 	}
 };
 
@@ -276,12 +356,55 @@ TEST_F(ReactorUtilTest, ReconnectAttemptLimit)
 {
 	reactorUnitTests_ReconnectAttemptLimit();
 }
+
+TEST_F(ReactorUtilTest, ShardedReactor)
+{
+	reactorUnitTests_ShardedReactor();
+}
 #ifdef COMPILE_64BITS
 TEST_F(ReactorUtilTest, ManyConnections)
 {
 	reactorUnitTests_ManyConnections();
 }
 #endif
+
+#ifdef Linux
+TEST_F(ReactorEpollTest, EpollNotifier)
+{
+	reactorUnitTests_EpollNotifier();
+}
+
+TEST_F(ReactorEpollTest, MultiThreadDispatch)
+{
+	reactorUnitTests_MultiThreadDispatch();
+}
+
+TEST_F(ReactorEpollTest, DisconnectFromCallbacks)
+{
+	reactorUnitTests_DisconnectFromCallbacks();
+}
+
+TEST_F(ReactorEpollTest, InitializationAndPingTimeout)
+{
+	reactorUnitTests_InitializationAndPingTimeout();
+}
+
+TEST_F(ReactorEpollTest, AutoMsgs)
+{
+	reactorUnitTests_AutoMsgs();
+}
+#endif
+
+TEST_F(ReactorBusyPollTest, BusyPollDispatch)
+{
+	reactorUnitTests_BusyPollDispatch();
+}
+
+TEST_F(ReactorFlushDelayTest, FlushDelay)
+{
+	reactorUnitTests_FlushDelay();
+}
+
 static void copyMutRDMMsg(MutMsg *pMutMsg, RsslRDMMsg *pRDMMsg, RsslReactorChannel *pReactorChannel)
 {
 	pMutMsg->memoryBuffer.data = pMutMsg->memoryBlock;
@@ -372,6 +495,32 @@ static RsslRet dispatchEvent(MyReactor *pMyReactor, RsslUInt32 timeoutMsec)
 	return dispatchEvents(pMyReactor, timeoutMsec, 1);
 }
 
+/* Call rsslReactorDispatch in a loop, without waiting for notification, until an event is received 
+ * or the timeout expires. Used with reactors that busy-poll.
+ * Returns RSSL_RET_READ_WOULD_BLOCK if no event was received. */
+static RsslRet busyPollEvent(MyReactor *pMyReactor, RsslUInt32 timeoutMsec)
+{
+	RsslErrorInfo rsslErrorInfo;
+	RsslReactorDispatchOptions dispatchOpts;
+	TimeValue endTimeMs = getTimeMilli() + timeoutMsec;
+	RsslRet ret;
+
+	clearMutMsg(&pMyReactor->mutMsg);
+	rsslClearReactorDispatchOptions(&dispatchOpts);
+	dispatchOpts.maxMessages = 1;
+
+	do
+	{
+		if ((ret = rsslReactorDispatch(pMyReactor->pReactor, &dispatchOpts, &rsslErrorInfo)) < RSSL_RET_SUCCESS)
+			return ret;
+
+		if (pMyReactor->mutMsg.mutMsgType != MUT_MSG_NONE)
+			return ret;
+	} while (getTimeMilli() < endTimeMs);
+
+	return RSSL_RET_READ_WOULD_BLOCK;
+}
+
 static void removeConnection(MyReactor *pMyReactor, RsslReactorChannel *pReactorChannel)
 {
 	if (pMyReactor->pNotifier != NULL)
@@ -734,15 +883,14 @@ static void initReactors(RsslCreateReactorOptions *pOpts, RsslBool sameReactor)
 	RsslErrorInfo rsslErrorInfo;
 	clearMyReactor(pConsMon);
 	clearMyReactor(pProvMon);
-	rsslClearCreateReactorOptions(&mOpts);
-	mOpts.userSpecPtr = pConsMon;
+	pOpts->userSpecPtr = pConsMon;
 	ASSERT_TRUE(pConsMon->pReactor = rsslCreateReactor(pOpts, &rsslErrorInfo));
 
 	if (sameReactor)
 		pProvMon->pReactor = pConsMon->pReactor;
 	else
 	{
-		mOpts.userSpecPtr = &myReactors[1];
+		pOpts->userSpecPtr = &myReactors[1];
 		ASSERT_TRUE(pProvMon->pReactor = rsslCreateReactor(pOpts, &rsslErrorInfo));
 	}
 
@@ -2845,3 +2993,350 @@ void reactorUtilTest_ConnectDeepCopy()
 	
 	rsslFreeConnectOpts(&outOpts);
 }
+
+#ifdef Linux
+static void reactorUnitTests_EpollNotifier()
+{
+	/* Test that an epoll notifier reports only the events whose descriptors are ready, and that flags
+	 * from the previous wait are cleared. */
+	RsslNotifier *pNotifier;
+	RsslNotifierEvent *pEvents[3];
+	int pipeFds[3][2];
+	char byte = 0;
+	int i;
+
+	ASSERT_TRUE((pNotifier = rsslCreateNotifierEx(2, RSSL_NT_EPOLL)) != NULL);
+
+	for (i = 0; i < 3; ++i)
+	{
+		ASSERT_TRUE(pipe(pipeFds[i]) == 0);
+		ASSERT_TRUE((pEvents[i] = rsslCreateNotifierEvent()) != NULL);
+		ASSERT_TRUE(rsslNotifierAddEvent(pNotifier, pEvents[i], pipeFds[i][0], &pipeFds[i]) == 0); /* Third add grows the notifier. */
+		ASSERT_TRUE(rsslNotifierRegisterRead(pNotifier, pEvents[i]) == 0);
+	}
+
+	/* Nothing ready. */
+	ASSERT_TRUE(rsslNotifierWait(pNotifier, 0) == 0);
+	ASSERT_TRUE(pNotifier->notifiedEventCount == 0);
+
+	/* One descriptor ready. */
+	ASSERT_TRUE(write(pipeFds[1][1], &byte, 1) == 1);
+	ASSERT_TRUE(rsslNotifierWait(pNotifier, 100000) == 1);
+	ASSERT_TRUE(pNotifier->notifiedEventCount == 1);
+	ASSERT_TRUE(pNotifier->notifiedEvents[0] == pEvents[1]);
+	ASSERT_TRUE(rsslNotifierEventGetObject(pEvents[1]) == &pipeFds[1]);
+	ASSERT_TRUE(rsslNotifierEventIsReadable(pEvents[1]));
+	ASSERT_FALSE(rsslNotifierEventIsReadable(pEvents[0]));
+	ASSERT_FALSE(rsslNotifierEventIsReadable(pEvents[2]));
+
+	/* Level-triggered: still ready until read. */
+	ASSERT_TRUE(rsslNotifierWait(pNotifier, 0) == 1);
+	ASSERT_TRUE(read(pipeFds[1][0], &byte, 1) == 1);
+	ASSERT_TRUE(rsslNotifierWait(pNotifier, 0) == 0);
+	ASSERT_FALSE(rsslNotifierEventIsReadable(pEvents[1]));
+
+	/* Unregistered events are not reported. */
+	ASSERT_TRUE(rsslNotifierUnregisterRead(pNotifier, pEvents[2]) == 0);
+	ASSERT_TRUE(write(pipeFds[2][1], &byte, 1) == 1);
+	ASSERT_TRUE(rsslNotifierWait(pNotifier, 0) == 0);
+	ASSERT_TRUE(rsslNotifierRegisterRead(pNotifier, pEvents[2]) == 0);
+	ASSERT_TRUE(rsslNotifierWait(pNotifier, 0) == 1);
+	ASSERT_TRUE(rsslNotifierEventIsReadable(pEvents[2]));
+
+	/* Removing a notified event, then waiting, should not report it. */
+	ASSERT_TRUE(rsslNotifierRemoveEvent(pNotifier, pEvents[2]) == 0);
+	ASSERT_TRUE(rsslNotifierWait(pNotifier, 0) == 0);
+
+	/* A descriptor that was closed is reported as bad once its registration changes. */
+	close(pipeFds[0][0]);
+	ASSERT_TRUE(rsslNotifierRegisterWrite(pNotifier, pEvents[0]) == 0);
+	ASSERT_TRUE(rsslNotifierWait(pNotifier, 0) == 1);
+	ASSERT_TRUE(rsslNotifierEventIsFdBad(pEvents[0]));
+
+	/* Updating the descriptor restores normal notification. */
+	ASSERT_TRUE(pipe(pipeFds[0]) == 0);
+	ASSERT_TRUE(rsslNotifierUpdateEventFd(pNotifier, pEvents[0], pipeFds[0][0]) == 0);
+	ASSERT_TRUE(rsslNotifierUnregisterWrite(pNotifier, pEvents[0]) == 0);
+	ASSERT_TRUE(rsslNotifierWait(pNotifier, 0) == 0);
+	ASSERT_TRUE(write(pipeFds[0][1], &byte, 1) == 1);
+	ASSERT_TRUE(rsslNotifierWait(pNotifier, 0) == 1);
+	ASSERT_TRUE(rsslNotifierEventIsReadable(pEvents[0]));
+	ASSERT_FALSE(rsslNotifierEventIsFdBad(pEvents[0]));
+
+	ASSERT_TRUE(rsslNotifierRemoveEvent(pNotifier, pEvents[0]) == 0);
+	ASSERT_TRUE(rsslNotifierRemoveEvent(pNotifier, pEvents[1]) == 0);
+	rsslDestroyNotifier(pNotifier);
+
+	for (i = 0; i < 3; ++i)
+	{
+		close(pipeFds[i][0]);
+		close(pipeFds[i][1]);
+		rsslDestroyNotifierEvent(pEvents[i]);
+	}
+}
+#endif
+
+static void reactorUnitTests_BusyPollDispatch()
+{
+	/* Test that channels come up when reactors are dispatched in a loop without waiting for notification,
+	 * and that a reactor falls back to notifying the application once it has been idle for 
+	 * busyPollIdleSpinLimit calls. */
+	RsslReactorDispatchOptions dispatchOpts;
+	fd_set readFds;
+	struct timeval selectTime;
+	RsslUInt32 i;
+
+	clearObjects();
+
+	ASSERT_TRUE(rsslReactorConnect(pConsMon->pReactor, &connectOpts, (RsslReactorChannelRole*)&ommConsumerRole, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+	ASSERT_TRUE(waitForConnection(pServer, 100));
+	ASSERT_TRUE(rsslReactorAccept(pProvMon->pReactor, pServer, &acceptOpts, (RsslReactorChannelRole*)&ommProviderRole, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+
+	/* Prov: Conn up */
+	ASSERT_TRUE(busyPollEvent(pProvMon, 1000) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pProvMon->mutMsg.mutMsgType == MUT_MSG_CONN && pProvMon->mutMsg.channelEvent.channelEventType == RSSL_RC_CET_CHANNEL_UP);
+	pProvCh[0] = pProvMon->mutMsg.pReactorChannel;
+
+	/* Prov: Conn ready */
+	ASSERT_TRUE(busyPollEvent(pProvMon, 1000) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pProvMon->mutMsg.mutMsgType == MUT_MSG_CONN && pProvMon->mutMsg.channelEvent.channelEventType == RSSL_RC_CET_CHANNEL_READY);
+
+	/* Cons: Conn up */
+	ASSERT_TRUE(busyPollEvent(pConsMon, 1000) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pConsMon->mutMsg.mutMsgType == MUT_MSG_CONN && pConsMon->mutMsg.channelEvent.channelEventType == RSSL_RC_CET_CHANNEL_UP);
+	pConsCh[0] = pConsMon->mutMsg.pReactorChannel;
+
+	/* Cons: Conn ready */
+	ASSERT_TRUE(busyPollEvent(pConsMon, 1000) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pConsMon->mutMsg.mutMsgType == MUT_MSG_CONN && pConsMon->mutMsg.channelEvent.channelEventType == RSSL_RC_CET_CHANNEL_READY);
+
+	/* Cons: Idle until the reactor falls back to its notifier. */
+	rsslClearReactorDispatchOptions(&dispatchOpts);
+	clearMutMsg(&pConsMon->mutMsg);
+	for (i = 0; i < mOpts.busyPollIdleSpinLimit; ++i)
+		ASSERT_TRUE(rsslReactorDispatch(pConsMon->pReactor, &dispatchOpts, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pConsMon->mutMsg.mutMsgType == MUT_MSG_NONE);
+
+	/* Nothing to process, so the eventFd should not be triggered. */
+	FD_ZERO(&readFds);
+	FD_SET(pConsMon->pReactor->eventFd, &readFds);
+	selectTime.tv_sec = 0; selectTime.tv_usec = 0;
+	ASSERT_TRUE(select(FD_SETSIZE, &readFds, NULL, NULL, &selectTime) == 0);
+
+	/* Cons: Connect to a port with no server. The channel-down event is delivered from the worker 
+	 * through the reactor's event queue, so it is only seen if the eventFd is signaled again. */
+	connectOpts.rsslConnectOptions.connectionInfo.unified.serviceName = const_cast<char*>("14010");
+	ASSERT_TRUE(rsslReactorConnect(pConsMon->pReactor, &connectOpts, (RsslReactorChannelRole*)&ommConsumerRole, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+
+	ASSERT_TRUE(dispatchEvent(pConsMon, 1000) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pConsMon->mutMsg.mutMsgType == MUT_MSG_CONN && pConsMon->mutMsg.channelEvent.channelEventType == RSSL_RC_CET_CHANNEL_DOWN);
+
+	/* Prov: Close channel */
+	removeConnection(pProvMon, pProvCh[0]);
+
+	/* Cons: Conn down; the reactor is busy-polling again. */
+	ASSERT_TRUE(busyPollEvent(pConsMon, 1000) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pConsMon->mutMsg.mutMsgType == MUT_MSG_CONN && pConsMon->mutMsg.channelEvent.channelEventType == RSSL_RC_CET_CHANNEL_DOWN);
+
+	/* Cons: (none) */
+	ASSERT_TRUE(busyPollEvent(pConsMon, 100) == RSSL_RET_READ_WOULD_BLOCK);
+}
+
+static void reactorUnitTests_FlushDelay()
+{
+	/* Test that a reactor with a flush delay flushes a channel once the delay passes, or sooner if enough 
+	 * messages are submitted, and that the flush statistics reflect this. */
+	RsslReactorSubmitMsgOptions submitMsgOpts;
+	RsslGenericMsg genericMsg;
+	RsslReactorChannelFlushStats flushStats;
+	RsslUInt32 i, msgCount;
+	TimeValue startTimeMs;
+
+	clearObjects();
+
+	ASSERT_TRUE(rsslReactorConnect(pConsMon->pReactor, &connectOpts, (RsslReactorChannelRole*)&ommConsumerRole, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+	ASSERT_TRUE(waitForConnection(pServer, 100));
+	ASSERT_TRUE(rsslReactorAccept(pProvMon->pReactor, pServer, &acceptOpts, (RsslReactorChannelRole*)&ommProviderRole, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+
+	/* Prov: Conn up */
+	ASSERT_TRUE(dispatchEvent(pProvMon, 1000) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pProvMon->mutMsg.mutMsgType == MUT_MSG_CONN && pProvMon->mutMsg.channelEvent.channelEventType == RSSL_RC_CET_CHANNEL_UP);
+	pProvCh[0] = pProvMon->mutMsg.pReactorChannel;
+
+	/* Prov: Conn ready */
+	ASSERT_TRUE(dispatchEvent(pProvMon, 1000) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pProvMon->mutMsg.mutMsgType == MUT_MSG_CONN && pProvMon->mutMsg.channelEvent.channelEventType == RSSL_RC_CET_CHANNEL_READY);
+
+	/* Cons: Conn up */
+	ASSERT_TRUE(dispatchEvent(pConsMon, 1000) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pConsMon->mutMsg.mutMsgType == MUT_MSG_CONN && pConsMon->mutMsg.channelEvent.channelEventType == RSSL_RC_CET_CHANNEL_UP);
+	pConsCh[0] = pConsMon->mutMsg.pReactorChannel;
+
+	/* Cons: Conn ready */
+	ASSERT_TRUE(dispatchEvent(pConsMon, 1000) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pConsMon->mutMsg.mutMsgType == MUT_MSG_CONN && pConsMon->mutMsg.channelEvent.channelEventType == RSSL_RC_CET_CHANNEL_READY);
+
+	ASSERT_TRUE(rsslReactorGetChannelFlushStats(pProvMon->pReactor, pProvCh[0], NULL, &rsslErrorInfo) == RSSL_RET_INVALID_ARGUMENT);
+	ASSERT_TRUE(rsslReactorGetChannelFlushStats(pProvMon->pReactor, pProvCh[0], &flushStats, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+	ASSERT_TRUE(flushStats.highWaterMarkFlushes == 0);
+	ASSERT_TRUE(flushStats.deadlineFlushes == 0);
+
+	rsslClearGenericMsg(&genericMsg);
+	genericMsg.msgBase.streamId = 5;
+	genericMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+	genericMsg.msgBase.containerType = RSSL_DT_NO_DATA;
+
+	rsslClearReactorSubmitMsgOptions(&submitMsgOpts);
+	submitMsgOpts.pRsslMsg = (RsslMsg*)&genericMsg;
+
+	/* Prov: Send one message. It is flushed once the delay passes. */
+	startTimeMs = getTimeMilli();
+	ASSERT_TRUE(rsslReactorSubmitMsg(pProvMon->pReactor, pProvCh[0], &submitMsgOpts, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+
+	/* Cons: Receive message */
+	ASSERT_TRUE(dispatchEvent(pConsMon, 2000) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pConsMon->mutMsg.mutMsgType == MUT_MSG_RSSL && pConsMon->mutMsg.pRsslMsg->msgBase.msgClass == RSSL_MC_GENERIC);
+	ASSERT_TRUE(getTimeMilli() - startTimeMs >= 450);
+
+	ASSERT_TRUE(rsslReactorGetChannelFlushStats(pProvMon->pReactor, pProvCh[0], &flushStats, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+	ASSERT_TRUE(flushStats.deadlineFlushes == 1);
+	ASSERT_TRUE(flushStats.highWaterMarkFlushes == 0);
+
+	/* Prov: Process the flush completion. */
+	ASSERT_TRUE(dispatchEvent(pProvMon, 100) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pProvMon->mutMsg.mutMsgType == MUT_MSG_NONE);
+
+	ASSERT_TRUE(rsslReactorGetChannelFlushStats(pProvMon->pReactor, pProvCh[0], &flushStats, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+	ASSERT_TRUE(flushStats.flushCalls >= 1);
+
+	/* Prov: Send enough messages to reach the high-water mark. They are flushed without waiting for the delay. */
+	startTimeMs = getTimeMilli();
+	for (i = 0; i < mOpts.flushHighWaterMarkMsgs; ++i)
+		ASSERT_TRUE(rsslReactorSubmitMsg(pProvMon->pReactor, pProvCh[0], &submitMsgOpts, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+
+	ASSERT_TRUE(rsslReactorGetChannelFlushStats(pProvMon->pReactor, pProvCh[0], &flushStats, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+	ASSERT_TRUE(flushStats.highWaterMarkFlushes == 1);
+	/* The first message requested the flush and the last reached the high-water mark; the ones between were added to the pending flush. */
+	ASSERT_TRUE(flushStats.coalescedMsgs == mOpts.flushHighWaterMarkMsgs - 2);
+
+	/* Cons: Receive messages(they may be read together, so dispatch without waiting for notification) */
+	msgCount = 0;
+	while (msgCount < mOpts.flushHighWaterMarkMsgs)
+	{
+		ASSERT_TRUE(busyPollEvent(pConsMon, 400) >= RSSL_RET_SUCCESS);
+		ASSERT_TRUE(pConsMon->mutMsg.mutMsgType == MUT_MSG_RSSL && pConsMon->mutMsg.pRsslMsg->msgBase.msgClass == RSSL_MC_GENERIC);
+		++msgCount;
+	}
+	ASSERT_TRUE(getTimeMilli() - startTimeMs < 450);
+
+	ASSERT_TRUE(rsslReactorGetChannelFlushStats(pProvMon->pReactor, pProvCh[0], &flushStats, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+	ASSERT_TRUE(flushStats.deadlineFlushes == 1);
+
+	/* Prov: Close channel */
+	removeConnection(pProvMon, pProvCh[0]);
+
+	/* Cons: Conn down */
+	ASSERT_TRUE(dispatchEvent(pConsMon, 1000) >= RSSL_RET_SUCCESS);
+	ASSERT_TRUE(pConsMon->mutMsg.mutMsgType == MUT_MSG_CONN && pConsMon->mutMsg.channelEvent.channelEventType == RSSL_RC_CET_CHANNEL_DOWN);
+
+	/* Cons: (none) */
+	ASSERT_TRUE(busyPollEvent(pConsMon, 100) == RSSL_RET_READ_WOULD_BLOCK);
+}
+
+static void reactorUnitTests_ShardedReactor()
+{
+	/* Test that a sharded reactor spreads its channels across shards, that each shard dispatches 
+	 * only its own channels, and that channels can be closed through the sharded reactor. */
+	MyReactor shardReactors[2];
+	RsslReactorChannel *pShardCh[2];
+	RsslCreateReactorOptions reactorOpts;
+	RsslReactor *pReactor;
+	RsslReactorChannel *pProvChannels[2];
+	RsslUInt32 i;
+
+	clearObjects();
+
+	rsslClearCreateReactorOptions(&reactorOpts);
+	reactorOpts.shardCount = 2;
+	ASSERT_TRUE((pReactor = rsslCreateReactor(&reactorOpts, &rsslErrorInfo)) != NULL);
+
+	ASSERT_TRUE(rsslReactorGetShard(pReactor, 0, &rsslErrorInfo) == pReactor);
+	ASSERT_TRUE(rsslReactorGetShard(pReactor, 2, &rsslErrorInfo) == NULL);
+
+	for (i = 0; i < 2; ++i)
+	{
+		clearMyReactor(&shardReactors[i]);
+		ASSERT_TRUE((shardReactors[i].pReactor = rsslReactorGetShard(pReactor, i, &rsslErrorInfo)) != NULL);
+		shardReactors[i].pReactor->userSpecPtr = &shardReactors[i];
+		shardReactors[i].closeConnections = RSSL_TRUE;
+		FD_ZERO(&shardReactors[i].readFds);
+		FD_ZERO(&shardReactors[i].exceptFds);
+		FD_SET(shardReactors[i].pReactor->eventFd, &shardReactors[i].readFds);
+		FD_SET(shardReactors[i].pReactor->eventFd, &shardReactors[i].exceptFds);
+	}
+	ASSERT_TRUE(shardReactors[0].pReactor != shardReactors[1].pReactor);
+
+	/* Shards may not be destroyed individually. */
+	ASSERT_TRUE(rsslDestroyReactor(shardReactors[1].pReactor, &rsslErrorInfo) == RSSL_RET_INVALID_ARGUMENT);
+
+	/* Connect two channels; each should be assigned to a different shard. */
+	for (i = 0; i < 2; ++i)
+	{
+		ASSERT_TRUE(rsslReactorConnect(pReactor, &connectOpts, (RsslReactorChannelRole*)&ommConsumerRole, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+		ASSERT_TRUE(waitForConnection(pServer, 100));
+		ASSERT_TRUE(rsslReactorAccept(pProvMon->pReactor, pServer, &acceptOpts, (RsslReactorChannelRole*)&ommProviderRole, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+
+		/* Prov: Conn up */
+		ASSERT_TRUE(dispatchEvent(pProvMon, 100) >= RSSL_RET_SUCCESS);
+		ASSERT_TRUE(pProvMon->mutMsg.mutMsgType == MUT_MSG_CONN && pProvMon->mutMsg.channelEvent.channelEventType == RSSL_RC_CET_CHANNEL_UP);
+		pProvChannels[i] = pProvMon->mutMsg.pReactorChannel;
+
+		/* Prov: Conn ready */
+		ASSERT_TRUE(dispatchEvent(pProvMon, 100) >= RSSL_RET_SUCCESS);
+		ASSERT_TRUE(pProvMon->mutMsg.mutMsgType == MUT_MSG_CONN && pProvMon->mutMsg.channelEvent.channelEventType == RSSL_RC_CET_CHANNEL_READY);
+	}
+
+	for (i = 0; i < 2; ++i)
+	{
+		/* Shard: Conn up */
+		ASSERT_TRUE(dispatchEvent(&shardReactors[i], 100) >= RSSL_RET_SUCCESS);
+		ASSERT_TRUE(shardReactors[i].mutMsg.mutMsgType == MUT_MSG_CONN && shardReactors[i].mutMsg.channelEvent.channelEventType == RSSL_RC_CET_CHANNEL_UP);
+		pShardCh[i] = shardReactors[i].mutMsg.pReactorChannel;
+
+		/* Shard: Conn ready */
+		ASSERT_TRUE(dispatchEvent(&shardReactors[i], 100) >= RSSL_RET_SUCCESS);
+		ASSERT_TRUE(shardReactors[i].mutMsg.mutMsgType == MUT_MSG_CONN && shardReactors[i].mutMsg.channelEvent.channelEventType == RSSL_RC_CET_CHANNEL_READY);
+		ASSERT_TRUE(shardReactors[i].mutMsg.pReactorChannel == pShardCh[i]);
+
+		/* Shard: (none) */
+		ASSERT_TRUE(dispatchEvent(&shardReactors[i], 100) == RSSL_RET_READ_WOULD_BLOCK);
+	}
+	ASSERT_TRUE(pShardCh[0] != pShardCh[1]);
+
+	/* Close the second shard's channel through the sharded reactor. */
+	FD_CLR(pShardCh[1]->socketId, &shardReactors[1].readFds);
+	FD_CLR(pShardCh[1]->socketId, &shardReactors[1].exceptFds);
+	ASSERT_TRUE(rsslReactorCloseChannel(pReactor, pShardCh[1], &rsslErrorInfo) == RSSL_RET_SUCCESS);
+
+	/* Prov: Conn down */
+	for (i = 0; i < 2; ++i)
+	{
+		ASSERT_TRUE(dispatchEvent(pProvMon, 1000) >= RSSL_RET_SUCCESS);
+		if (pProvMon->mutMsg.mutMsgType == MUT_MSG_CONN)
+			break;
+	}
+	ASSERT_TRUE(pProvMon->mutMsg.mutMsgType == MUT_MSG_CONN && pProvMon->mutMsg.channelEvent.channelEventType == RSSL_RC_CET_CHANNEL_DOWN);
+	ASSERT_TRUE(pProvMon->mutMsg.pReactorChannel == pProvChannels[1]);
+
+	/* Destroying the sharded reactor brings down the channel of the first shard. */
+	ASSERT_TRUE(rsslDestroyReactor(pReactor, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+
+	for (i = 0; i < 2; ++i)
+	{
+		ASSERT_TRUE(dispatchEvent(pProvMon, 1000) >= RSSL_RET_SUCCESS);
+		if (pProvMon->mutMsg.mutMsgType == MUT_MSG_CONN)
+			break;
+	}
+	ASSERT_TRUE(pProvMon->mutMsg.mutMsgType == MUT_MSG_CONN && pProvMon->mutMsg.channelEvent.channelEventType == RSSL_RC_CET_CHANNEL_DOWN);
+	ASSERT_TRUE(pProvMon->mutMsg.pReactorChannel == pProvChannels[0]);
+}
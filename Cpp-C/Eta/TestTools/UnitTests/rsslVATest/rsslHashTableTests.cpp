@@ -0,0 +1,343 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright Thomson Reuters 2018. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+/* Tests for the hash table used by the watchlist, tunnel streams and dictionaries. */
+
+#include "rtr/rsslHashTable.h"
+#include "gtest/gtest.h"
+#include "getTime.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <vector>
+
+typedef struct
+{
+	RsslHashLink	hashLink;
+	RsslUInt32		id;
+	RsslBuffer		name;
+	char			nameBlock[16];
+	bool			inTable;
+} HashTestElement;
+
+static void hashTableTest_U32Keys();
+static void hashTableTest_BufferKeys();
+static void hashTableTest_RemoveAllLinks();
+static void hashTableTest_Performance();
+
+TEST(HashTableTest, U32Keys)
+{
+	hashTableTest_U32Keys();
+}
+
+TEST(HashTableTest, BufferKeys)
+{
+	hashTableTest_BufferKeys();
+}
+
+TEST(HashTableTest, RemoveAllLinks)
+{
+	hashTableTest_RemoveAllLinks();
+}
+
+/* Inserts, finds and removes 1M keys.
+ * Run with --gtest_also_run_disabled_tests --gtest_filter=*HashTableTest*Performance*. */
+TEST(HashTableTest, DISABLED_Performance)
+{
+	hashTableTest_Performance();
+}
+
+/* Creates RIC-like names, e.g. "BA.O", "ZZC.PA". */
+static void hashTestSetName(HashTestElement *pElement, RsslUInt32 i)
+{
+	static const char *exchanges[] = { ".L", ".O", ".N", ".PA", ".DE", ".TO", ".HK", "=" };
+	char *pName = pElement->nameBlock;
+	int length = 0;
+
+	do
+	{
+		pName[length++] = (char)('A' + i % 26);
+		i /= 26;
+	} while (i > 0);
+
+	length += snprintf(pName + length, sizeof(pElement->nameBlock) - length, "%s", exchanges[length % 8]);
+
+	pElement->name.data = pName;
+	pElement->name.length = (RsslUInt32)length;
+}
+
+/* Checks that every element marked as in the table is found, and the others are not. */
+static void hashTestVerify(RsslHashTable *pTable, std::vector<HashTestElement> &elements, bool bufferKeys)
+{
+	RsslUInt32 i;
+	RsslUInt32 count = 0;
+
+	for (i = 0; i < elements.size(); ++i)
+	{
+		RsslHashLink *pLink = bufferKeys ? rsslHashTableFind(pTable, &elements[i].name, NULL)
+			: rsslHashTableFind(pTable, &elements[i].id, NULL);
+
+		if (elements[i].inTable)
+		{
+			ASSERT_TRUE(pLink == &elements[i].hashLink);
+			++count;
+		}
+		else
+			ASSERT_TRUE(pLink == NULL);
+	}
+
+	ASSERT_EQ(count, pTable->elementCount);
+}
+
+static void hashTableTest_U32Keys()
+{
+	RsslHashTable table;
+	RsslErrorInfo errorInfo;
+	std::vector<HashTestElement> elements(20000);
+	RsslUInt32 i;
+
+	for (i = 0; i < elements.size(); ++i)
+	{
+		rsslHashLinkInit(&elements[i].hashLink);
+		elements[i].id = i * 4; /* Keys with regular low bits should still spread across the slots. */
+		elements[i].inTable = false;
+	}
+
+	/* Start small, so the table grows several times. */
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslHashTableInit(&table, 1, rsslHashU32Sum, rsslHashU32Compare, &errorInfo));
+	ASSERT_EQ(RSSL_HASH_TABLE_MIN_SLOTS, table.slotCount);
+
+	for (i = 0; i < elements.size(); ++i)
+	{
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslHashTableInsertLink(&table, &elements[i].hashLink, &elements[i].id, NULL));
+		elements[i].inTable = true;
+
+		/* Remove some elements while the table may be moving its old slots. */
+		if (i % 3 == 2)
+		{
+			rsslHashTableRemoveLink(&table, &elements[i - 1].hashLink);
+			elements[i - 1].inTable = false;
+		}
+	}
+
+	hashTestVerify(&table, elements, false);
+	ASSERT_TRUE(table.elementCount <= table.thresholdCapacity);
+
+	/* Remove the rest in a different order than they were added. */
+	for (i = (RsslUInt32)elements.size(); i > 0; --i)
+	{
+		if (elements[i - 1].inTable && i % 2 == 0)
+		{
+			rsslHashTableRemoveLink(&table, &elements[i - 1].hashLink);
+			elements[i - 1].inTable = false;
+		}
+	}
+	hashTestVerify(&table, elements, false);
+
+	for (i = 0; i < elements.size(); ++i)
+	{
+		if (elements[i].inTable)
+		{
+			rsslHashTableRemoveLink(&table, &elements[i].hashLink);
+			elements[i].inTable = false;
+		}
+	}
+	hashTestVerify(&table, elements, false);
+	ASSERT_EQ(0, table.elementCount);
+
+	/* Removing a link that is not in the table has no effect. */
+	rsslHashTableRemoveLink(&table, &elements[0].hashLink);
+	ASSERT_EQ(0, table.elementCount);
+
+	rsslHashTableCleanup(&table);
+}
+
+static void hashTableTest_BufferKeys()
+{
+	RsslHashTable table;
+	RsslErrorInfo errorInfo;
+	std::vector<HashTestElement> elements(5000);
+	HashTestElement duplicate;
+	RsslUInt32 i, hashSum;
+
+	for (i = 0; i < elements.size(); ++i)
+	{
+		rsslHashLinkInit(&elements[i].hashLink);
+		hashTestSetName(&elements[i], i);
+		elements[i].inTable = false;
+	}
+
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslHashTableInit(&table, 10, rsslHashBufferSum, rsslHashBufferCompare, &errorInfo));
+
+	for (i = 0; i < elements.size(); ++i)
+	{
+		/* Use a precomputed sum for half of them. */
+		if (i % 2)
+		{
+			hashSum = rsslHashBufferSum(&elements[i].name);
+			ASSERT_EQ(RSSL_RET_SUCCESS, rsslHashTableInsertLink(&table, &elements[i].hashLink, &elements[i].name, &hashSum));
+		}
+		else
+			ASSERT_EQ(RSSL_RET_SUCCESS, rsslHashTableInsertLink(&table, &elements[i].hashLink, &elements[i].name, NULL));
+		elements[i].inTable = true;
+	}
+	hashTestVerify(&table, elements, true);
+
+	/* A link with the same key as one already in the table is found after it. */
+	rsslHashLinkInit(&duplicate.hashLink);
+	hashTestSetName(&duplicate, 7);
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslHashTableInsertLink(&table, &duplicate.hashLink, &duplicate.name, NULL));
+	ASSERT_TRUE(rsslHashTableFind(&table, &duplicate.name, NULL) == &elements[7].hashLink);
+	rsslHashTableRemoveLink(&table, &elements[7].hashLink);
+	ASSERT_TRUE(rsslHashTableFind(&table, &duplicate.name, NULL) == &duplicate.hashLink);
+	rsslHashTableRemoveLink(&table, &duplicate.hashLink);
+	elements[7].inTable = false;
+	hashTestVerify(&table, elements, true);
+
+	rsslHashTableCleanup(&table);
+}
+
+/* Counts the calls made by rsslHashTableRemoveAllLinks. */
+static RsslUInt32 hashTestRemovedCount;
+
+static void hashTestRemoved(RsslHashLink *pLink)
+{
+	HashTestElement *pElement = RSSL_HASH_LINK_TO_OBJECT(HashTestElement, hashLink, pLink);
+
+	ASSERT_TRUE(pElement->inTable);
+	pElement->inTable = false;
+	++hashTestRemovedCount;
+}
+
+static void hashTableTest_RemoveAllLinks()
+{
+	RsslHashTable table;
+	RsslErrorInfo errorInfo;
+	std::vector<HashTestElement> elements(1000);
+	RsslUInt32 i, expectedCount;
+
+	for (i = 0; i < elements.size(); ++i)
+	{
+		rsslHashLinkInit(&elements[i].hashLink);
+		elements[i].id = i;
+		elements[i].inTable = false;
+	}
+
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslHashTableInit(&table, 1, rsslHashU32Sum, rsslHashU32Compare, &errorInfo));
+
+	/* Stop inserting while the table is still moving its old slots, so that both sets of slots are emptied. */
+	for (i = 0; i < elements.size(); ++i)
+	{
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslHashTableInsertLink(&table, &elements[i].hashLink, &elements[i].id, NULL));
+		elements[i].inTable = true;
+
+		if (i > 100 && table.oldSlots != NULL && table.oldSlotIndex > 0)
+			break;
+	}
+	ASSERT_TRUE(table.oldSlots != NULL);
+
+	/* Remove a few, so some old slots are marked as removed. */
+	rsslHashTableRemoveLink(&table, &elements[0].hashLink);
+	elements[0].inTable = false;
+	rsslHashTableRemoveLink(&table, &elements[i / 2].hashLink);
+	elements[i / 2].inTable = false;
+	expectedCount = table.elementCount;
+
+	hashTestRemovedCount = 0;
+	rsslHashTableRemoveAllLinks(&table, hashTestRemoved);
+	ASSERT_EQ(expectedCount, hashTestRemovedCount);
+	ASSERT_EQ(0, table.elementCount);
+	ASSERT_TRUE(table.oldSlots == NULL);
+	hashTestVerify(&table, elements, false);
+
+	/* The table is usable afterwards. */
+	for (i = 0; i < elements.size(); ++i)
+	{
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslHashTableInsertLink(&table, &elements[i].hashLink, &elements[i].id, NULL));
+		elements[i].inTable = true;
+	}
+	hashTestVerify(&table, elements, false);
+
+	rsslHashTableCleanup(&table);
+}
+
+/* Previous RsslBuffer hash sum, for comparison. */
+static RsslUInt32 hashTestShiftXorSum(void *pKey)
+{
+	RsslUInt32 i;
+	RsslUInt32 hashSum = 0;
+	RsslBuffer *pBuffer = (RsslBuffer*)pKey;
+
+	for(i = 0; i < pBuffer->length; ++i)
+	{
+		hashSum = (hashSum << 4) + (RsslUInt32)pBuffer->data[i];
+		hashSum ^= (hashSum >> 12);
+	}
+
+	return hashSum;
+}
+
+static void hashTableTest_Performance()
+{
+	const RsslUInt32 keyCount = 1000000;
+	std::vector<HashTestElement> elements(keyCount);
+	RsslHashTable table;
+	RsslErrorInfo errorInfo;
+	std::vector<RsslUInt32> sums(keyCount);
+	RsslUInt32 i, pass, distinctSums;
+	TimeValue startTime;
+
+	for (i = 0; i < keyCount; ++i)
+	{
+		rsslHashLinkInit(&elements[i].hashLink);
+		elements[i].id = (RsslUInt32)rand() * 65536U + i;
+		hashTestSetName(&elements[i], i);
+	}
+
+	for (pass = 0; pass < 2; ++pass)
+	{
+		bool bufferKeys = (pass == 1);
+
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslHashTableInit(&table, 16,
+				bufferKeys ? rsslHashBufferSum : rsslHashU32Sum,
+				bufferKeys ? rsslHashBufferCompare : rsslHashU32Compare, &errorInfo));
+
+		startTime = getTimeNano();
+		for (i = 0; i < keyCount; ++i)
+			rsslHashTableInsertLink(&table, &elements[i].hashLink, bufferKeys ? (void*)&elements[i].name : (void*)&elements[i].id, NULL);
+		printf("%s keys: insert %.1f ns/key (%u slots)\n", bufferKeys ? "RsslBuffer" : "RsslUInt32",
+				(double)(getTimeNano() - startTime) / keyCount, table.slotCount);
+
+		startTime = getTimeNano();
+		for (i = 0; i < keyCount; ++i)
+			ASSERT_TRUE(rsslHashTableFind(&table, bufferKeys ? (void*)&elements[i].name : (void*)&elements[i].id, NULL) != NULL);
+		printf("%s keys: find %.1f ns/key\n", bufferKeys ? "RsslBuffer" : "RsslUInt32", (double)(getTimeNano() - startTime) / keyCount);
+
+		startTime = getTimeNano();
+		for (i = 0; i < keyCount; ++i)
+			rsslHashTableRemoveLink(&table, &elements[i].hashLink);
+		printf("%s keys: remove %.1f ns/key\n", bufferKeys ? "RsslBuffer" : "RsslUInt32", (double)(getTimeNano() - startTime) / keyCount);
+		ASSERT_EQ(0, table.elementCount);
+
+		rsslHashTableCleanup(&table);
+	}
+
+	/* Compare how well the buffer hash sums spread the names. */
+	for (pass = 0; pass < 2; ++pass)
+	{
+		startTime = getTimeNano();
+		for (i = 0; i < keyCount; ++i)
+			sums[i] = (pass == 0) ? hashTestShiftXorSum(&elements[i].name) : rsslHashBufferSum(&elements[i].name);
+		printf("%s: %.1f ns/key, ", (pass == 0) ? "shift-xor sum" : "rsslHashBufferSum", (double)(getTimeNano() - startTime) / keyCount);
+
+		std::sort(sums.begin(), sums.end());
+		distinctSums = (RsslUInt32)(std::unique(sums.begin(), sums.end()) - sums.begin());
+		printf("%u distinct sums for %u names\n", distinctSums, keyCount);
+	}
+}
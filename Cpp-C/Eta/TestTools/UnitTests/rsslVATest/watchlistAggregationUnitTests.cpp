@@ -37,9 +37,12 @@ void watchlistAggregationTest_TwoItems_SnapshotView();
 void watchlistAggregationTest_SnapshotBeforeStreaming_View(); 
 void watchlistAggregationTest_TwoItems_ViewOnOff();
 void watchlistAggregationTest_TwoItems_ViewMixture(); 
+void watchlistAggregationTest_TwoItems_FilteredViews();
+void watchlistAggregationTest_OneItem_ConflatedUpdates();
 void watchlistAggregationTest_TwoItemsInMsgBuffer_ViewMixture(); 
 void watchlistAggregationTest_ThreeItemsInMsgBuffer_Batch(); 
 void watchlistAggregationTest_ThreeItemsInMsgBuffer_BatchWithView(); 
+void watchlistAggregationTest_ThreeItems_OutboundBatch(); 
 void watchlistAggregationTest_ThreeItems_OnePrivate(); 
 
 #ifdef COMPILE_64BITS
@@ -189,6 +192,16 @@ TEST_F(WatchlistAggregationTest, TwoItems_ViewMixture)
 	watchlistAggregationTest_TwoItems_ViewMixture();
 }
 
+TEST_F(WatchlistAggregationTest, TwoItems_FilteredViews)
+{
+	watchlistAggregationTest_TwoItems_FilteredViews();
+}
+
+TEST_F(WatchlistAggregationTest, OneItem_ConflatedUpdates)
+{
+	watchlistAggregationTest_OneItem_ConflatedUpdates();
+}
+
 TEST_F(WatchlistAggregationTest, TwoItemsInMsgBuffer_ViewMixture)
 {
 	watchlistAggregationTest_TwoItemsInMsgBuffer_ViewMixture();
@@ -204,6 +217,11 @@ TEST_F(WatchlistAggregationTest, ThreeItemsInMsgBuffer_BatchWithView)
 	watchlistAggregationTest_ThreeItemsInMsgBuffer_BatchWithView();
 }
 
+TEST_F(WatchlistAggregationTest, ThreeItems_OutboundBatch)
+{
+	watchlistAggregationTest_ThreeItems_OutboundBatch();
+}
+
 TEST_F(WatchlistAggregationTest, ThreeItems_OnePrivate)
 {
 	watchlistAggregationTest_ThreeItems_OnePrivate();
@@ -3813,6 +3831,445 @@ void watchlistAggregationTest_TwoItems_ViewOnOff()
 	wtfFinishTest();
 }
 
+/* Encodes a field list containing the given field IDs, each set to the given value (or to its own
+ * ID, if no values are given). */
+static void encodeFieldIdList(RsslBuffer *pBuffer, RsslInt *fieldIdList, RsslUInt32 fieldIdCount,
+		RsslUInt *valueList)
+{
+	RsslEncodeIterator eIter;
+	RsslFieldList fieldList;
+	RsslFieldEntry fieldEntry;
+	RsslUInt value;
+	RsslUInt32 ui;
+
+	rsslClearEncodeIterator(&eIter);
+	rsslSetEncodeIteratorBuffer(&eIter, pBuffer);
+
+	rsslClearFieldList(&fieldList);
+	fieldList.flags = RSSL_FLF_HAS_STANDARD_DATA;
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeFieldListInit(&eIter, &fieldList, NULL, 0));
+
+	for (ui = 0; ui < fieldIdCount; ++ui)
+	{
+		rsslClearFieldEntry(&fieldEntry);
+		fieldEntry.fieldId = (RsslFieldId)fieldIdList[ui];
+		fieldEntry.dataType = RSSL_DT_UINT;
+		value = valueList ? valueList[ui] : (RsslUInt)fieldIdList[ui];
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeFieldEntry(&eIter, &fieldEntry, &value));
+	}
+
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeFieldListComplete(&eIter, RSSL_TRUE));
+	pBuffer->length = rsslGetEncodedBufferLength(&eIter);
+}
+
+/* Checks that a field list contains exactly the given field IDs, each set to the given value (or
+ * to its own ID, if no values are given). */
+static void checkFieldIdList(RsslMsg *pRsslMsg, RsslInt *fieldIdList, RsslUInt32 fieldIdCount,
+		RsslUInt *valueList)
+{
+	RsslDecodeIterator dIter;
+	RsslFieldList fieldList;
+	RsslFieldEntry fieldEntry;
+	RsslUInt value;
+	RsslUInt32 ui = 0;
+
+	ASSERT_EQ(RSSL_DT_FIELD_LIST, pRsslMsg->msgBase.containerType);
+
+	rsslClearDecodeIterator(&dIter);
+	rsslSetDecodeIteratorBuffer(&dIter, &pRsslMsg->msgBase.encDataBody);
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslDecodeFieldList(&dIter, &fieldList, NULL));
+
+	while (rsslDecodeFieldEntry(&dIter, &fieldEntry) == RSSL_RET_SUCCESS)
+	{
+		ASSERT_TRUE(ui < fieldIdCount);
+		ASSERT_EQ(fieldIdList[ui], fieldEntry.fieldId);
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslDecodeUInt(&dIter, &value));
+		ASSERT_EQ(valueList ? valueList[ui] : (RsslUInt)fieldIdList[ui], value);
+		++ui;
+	}
+
+	ASSERT_EQ(fieldIdCount, ui);
+}
+
+void watchlistAggregationTest_TwoItems_FilteredViews()
+{
+	RsslReactorSubmitMsgOptions opts;
+	WtfSetupConnectionOpts sOpts;
+	WtfEvent		*pEvent;
+	RsslRequestMsg	requestMsg, *pRequestMsg;
+	RsslInt32		providerItemStream;
+	RsslRefreshMsg	refreshMsg, *pRefreshMsg;
+	RsslUpdateMsg	updateMsg, *pUpdateMsg;
+	RsslInt			view1List[] = {25, 22};
+	RsslUInt32		view1Count = 2;
+	RsslInt			view2List[] = {22, 30, 6};
+	RsslUInt32		view2Count = 3;
+	RsslInt			providerView1List[] = {22, 25};
+	RsslUInt32		providerView1Count = 2;
+	RsslInt			providerViewList[] = {6, 22, 25, 30};
+	RsslUInt32		providerViewCount = 4;
+	RsslInt			stream1List[] = {22, 25};
+	RsslInt			stream2List[] = {6, 22, 30};
+	RsslInt			update1List[] = {25};
+	RsslInt			update2List[] = {22, 30};
+	RsslInt			update2Stream1List[] = {22};
+
+	char			viewBodyBuf[256];
+	RsslBuffer		viewDataBody = { 256, viewBodyBuf };
+	RsslUInt32		viewDataBodyLen = 256;
+	char			dataBodyBuf[256];
+	RsslBuffer		dataBody;
+
+	/* Test that, with fanout filtering enabled, two requests with different views
+	 * each receive only the fields of their own view, and that updates carrying
+	 * none of a request's fields are not delivered to it. */
+
+	ASSERT_TRUE(wtfStartTest());
+
+	wtfClearSetupConnectionOpts(&sOpts);
+	sOpts.filterFanoutByView = RSSL_TRUE;
+	wtfSetupConnection(&sOpts);
+
+	/* Request first item. */
+	rsslClearRequestMsg(&requestMsg);
+	requestMsg.msgBase.streamId = 2;
+	requestMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+	requestMsg.msgBase.containerType = RSSL_DT_ELEMENT_LIST;
+	requestMsg.flags = RSSL_RQMF_STREAMING | RSSL_RQMF_HAS_QOS | RSSL_RQMF_HAS_VIEW;
+	requestMsg.qos.timeliness = RSSL_QOS_TIME_REALTIME;
+	requestMsg.qos.rate = RSSL_QOS_RATE_TICK_BY_TICK;
+
+	rsslClearReactorSubmitMsgOptions(&opts);
+	opts.pRsslMsg = (RsslMsg*)&requestMsg;
+	opts.pServiceName = &service1Name;
+
+	viewDataBody.length = viewDataBodyLen;
+	wtfConsumerEncodeViewRequest(RDM_VIEW_TYPE_FIELD_ID_LIST, &viewDataBody, view1List, 0, view1Count);
+	requestMsg.msgBase.encDataBody = viewDataBody;
+
+	wtfSubmitMsg(&opts, WTF_TC_CONSUMER, NULL, RSSL_TRUE);
+
+	/* Provider receives request. */
+	wtfDispatch(WTF_TC_PROVIDER, 100);
+	ASSERT_TRUE(pEvent = wtfGetEvent());
+	ASSERT_TRUE(pRequestMsg = (RsslRequestMsg*)wtfGetRsslMsg(pEvent));
+	ASSERT_TRUE(pRequestMsg->msgBase.msgClass == RSSL_MC_REQUEST);
+	wtfProviderTestView(pRequestMsg, providerView1List, providerView1Count,
+			RDM_VIEW_TYPE_FIELD_ID_LIST);
+	providerItemStream = pRequestMsg->msgBase.streamId;
+
+	/* Provider sends refresh, satisfying first view. */
+	rsslClearRefreshMsg(&refreshMsg);
+	refreshMsg.msgBase.streamId = providerItemStream;
+	refreshMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+	refreshMsg.msgBase.containerType = RSSL_DT_FIELD_LIST;
+	refreshMsg.qos.timeliness = RSSL_QOS_TIME_REALTIME;
+	refreshMsg.qos.rate = RSSL_QOS_RATE_TICK_BY_TICK;
+	refreshMsg.flags = RSSL_RFMF_SOLICITED | RSSL_RFMF_REFRESH_COMPLETE | RSSL_RFMF_CLEAR_CACHE 
+		| RSSL_RFMF_HAS_QOS;
+	refreshMsg.state.streamState = RSSL_STREAM_OPEN;
+	refreshMsg.state.dataState = RSSL_DATA_OK;
+	dataBody.data = dataBodyBuf; dataBody.length = sizeof(dataBodyBuf);
+	encodeFieldIdList(&dataBody, stream1List, 2, NULL);
+	refreshMsg.msgBase.encDataBody = dataBody;
+
+	rsslClearReactorSubmitMsgOptions(&opts);
+	opts.pRsslMsg = (RsslMsg*)&refreshMsg;
+	wtfSubmitMsg(&opts, WTF_TC_PROVIDER, NULL, RSSL_TRUE);
+
+	/* Consumer receives refresh. */
+	wtfDispatch(WTF_TC_CONSUMER, 100);
+	ASSERT_TRUE(pEvent = wtfGetEvent());
+	ASSERT_TRUE(pRefreshMsg = (RsslRefreshMsg*)wtfGetRsslMsg(pEvent));
+	ASSERT_TRUE(pRefreshMsg->msgBase.msgClass == RSSL_MC_REFRESH);
+	ASSERT_TRUE(pRefreshMsg->msgBase.streamId == 2);
+	checkFieldIdList((RsslMsg*)pRefreshMsg, stream1List, 2, NULL);
+	ASSERT_NE(0, pRefreshMsg->msgBase.encMsgBuffer.length);
+
+	/* Request second item with a different view. */
+	requestMsg.msgBase.streamId = 3;
+	viewDataBody.length = viewDataBodyLen;
+	wtfConsumerEncodeViewRequest(RDM_VIEW_TYPE_FIELD_ID_LIST, &viewDataBody, view2List, 0, view2Count);
+	requestMsg.msgBase.encDataBody = viewDataBody;
+
+	rsslClearReactorSubmitMsgOptions(&opts);
+	opts.pRsslMsg = (RsslMsg*)&requestMsg;
+	opts.pServiceName = &service1Name;
+	wtfSubmitMsg(&opts, WTF_TC_CONSUMER, NULL, RSSL_TRUE);
+
+	/* Provider receives request with the union of both views. */
+	wtfDispatch(WTF_TC_PROVIDER, 100);
+	ASSERT_TRUE(pEvent = wtfGetEvent());
+	ASSERT_TRUE(pRequestMsg = (RsslRequestMsg*)wtfGetRsslMsg(pEvent));
+	ASSERT_TRUE(pRequestMsg->msgBase.msgClass == RSSL_MC_REQUEST);
+	ASSERT_TRUE(pRequestMsg->msgBase.streamId == providerItemStream);
+	wtfProviderTestView(pRequestMsg, providerViewList, providerViewCount,
+			RDM_VIEW_TYPE_FIELD_ID_LIST);
+
+	/* Provider sends refresh containing all fields. */
+	dataBody.data = dataBodyBuf; dataBody.length = sizeof(dataBodyBuf);
+	encodeFieldIdList(&dataBody, providerViewList, providerViewCount, NULL);
+	refreshMsg.msgBase.encDataBody = dataBody;
+
+	rsslClearReactorSubmitMsgOptions(&opts);
+	opts.pRsslMsg = (RsslMsg*)&refreshMsg;
+	wtfSubmitMsg(&opts, WTF_TC_PROVIDER, NULL, RSSL_TRUE);
+
+	/* Each request receives only its own fields. The encoded message, which still holds
+	 * every field, is not passed along with them. */
+	wtfDispatch(WTF_TC_CONSUMER, 100);
+	ASSERT_TRUE(pEvent = wtfGetEvent());
+	ASSERT_TRUE(pRefreshMsg = (RsslRefreshMsg*)wtfGetRsslMsg(pEvent));
+	ASSERT_TRUE(pRefreshMsg->msgBase.msgClass == RSSL_MC_REFRESH);
+	ASSERT_TRUE(pRefreshMsg->msgBase.streamId == 2);
+	checkFieldIdList((RsslMsg*)pRefreshMsg, stream1List, 2, NULL);
+	ASSERT_EQ(0, pRefreshMsg->msgBase.encMsgBuffer.length);
+
+	ASSERT_TRUE(pEvent = wtfGetEvent());
+	ASSERT_TRUE(pRefreshMsg = (RsslRefreshMsg*)wtfGetRsslMsg(pEvent));
+	ASSERT_TRUE(pRefreshMsg->msgBase.msgClass == RSSL_MC_REFRESH);
+	ASSERT_TRUE(pRefreshMsg->msgBase.streamId == 3);
+	checkFieldIdList((RsslMsg*)pRefreshMsg, stream2List, 3, NULL);
+	ASSERT_EQ(0, pRefreshMsg->msgBase.encMsgBuffer.length);
+
+	ASSERT_TRUE(!wtfGetEvent());
+
+	/* Provider sends an update only the first view is interested in. */
+	rsslClearUpdateMsg(&updateMsg);
+	updateMsg.msgBase.streamId = providerItemStream;
+	updateMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+	updateMsg.msgBase.containerType = RSSL_DT_FIELD_LIST;
+	dataBody.data = dataBodyBuf; dataBody.length = sizeof(dataBodyBuf);
+	encodeFieldIdList(&dataBody, update1List, 1, NULL);
+	updateMsg.msgBase.encDataBody = dataBody;
+
+	rsslClearReactorSubmitMsgOptions(&opts);
+	opts.pRsslMsg = (RsslMsg*)&updateMsg;
+	wtfSubmitMsg(&opts, WTF_TC_PROVIDER, NULL, RSSL_TRUE);
+
+	wtfDispatch(WTF_TC_CONSUMER, 100);
+	ASSERT_TRUE(pEvent = wtfGetEvent());
+	ASSERT_TRUE(pUpdateMsg = (RsslUpdateMsg*)wtfGetRsslMsg(pEvent));
+	ASSERT_TRUE(pUpdateMsg->msgBase.msgClass == RSSL_MC_UPDATE);
+	ASSERT_TRUE(pUpdateMsg->msgBase.streamId == 2);
+	checkFieldIdList((RsslMsg*)pUpdateMsg, update1List, 1, NULL);
+
+	ASSERT_TRUE(!wtfGetEvent());
+
+	/* Provider sends an update both views are interested in. */
+	dataBody.data = dataBodyBuf; dataBody.length = sizeof(dataBodyBuf);
+	encodeFieldIdList(&dataBody, update2List, 2, NULL);
+	updateMsg.msgBase.encDataBody = dataBody;
+
+	rsslClearReactorSubmitMsgOptions(&opts);
+	opts.pRsslMsg = (RsslMsg*)&updateMsg;
+	wtfSubmitMsg(&opts, WTF_TC_PROVIDER, NULL, RSSL_TRUE);
+
+	wtfDispatch(WTF_TC_CONSUMER, 100);
+	ASSERT_TRUE(pEvent = wtfGetEvent());
+	ASSERT_TRUE(pUpdateMsg = (RsslUpdateMsg*)wtfGetRsslMsg(pEvent));
+	ASSERT_TRUE(pUpdateMsg->msgBase.streamId == 2);
+	checkFieldIdList((RsslMsg*)pUpdateMsg, update2Stream1List, 1, NULL);
+
+	ASSERT_TRUE(pEvent = wtfGetEvent());
+	ASSERT_TRUE(pUpdateMsg = (RsslUpdateMsg*)wtfGetRsslMsg(pEvent));
+	ASSERT_TRUE(pUpdateMsg->msgBase.streamId == 3);
+	checkFieldIdList((RsslMsg*)pUpdateMsg, update2List, 2, NULL);
+
+	ASSERT_TRUE(!wtfGetEvent());
+
+	wtfFinishTest();
+}
+
+void watchlistAggregationTest_OneItem_ConflatedUpdates()
+{
+	RsslReactorSubmitMsgOptions opts;
+	WtfEvent		*pEvent;
+	RsslRequestMsg	requestMsg, *pRequestMsg;
+	RsslInt32		providerItemStream;
+	RsslRefreshMsg	refreshMsg, *pRefreshMsg;
+	RsslUpdateMsg	updateMsg, *pUpdateMsg;
+	RsslStatusMsg	statusMsg, *pStatusMsg;
+	RsslInt			update1List[] = {22, 25};
+	RsslUInt		update1Values[] = {1, 2};
+	RsslInt			update2List[] = {30, 22};
+	RsslUInt		update2Values[] = {3, 4};
+	RsslInt			update3List[] = {6};
+	RsslUInt		update3Values[] = {5};
+	RsslInt			conflatedList[] = {22, 25, 30, 6};
+	RsslUInt		conflatedValues[] = {4, 2, 3, 5};
+	RsslInt			update4List[] = {25};
+	RsslUInt		update4Values[] = {6};
+	RsslUInt32		conflationInterval = (RsslUInt32)(500 / wtfGlobalConfig.speed);
+	char			dataBodyBuf[256];
+	RsslBuffer		dataBody;
+
+	/* Test that updates to a request that conflates updates are merged field by field and
+	 * delivered once per interval, and that a pending update is delivered ahead of other
+	 * messages. */
+
+	ASSERT_TRUE(wtfStartTest());
+
+	wtfSetupConnection(NULL);
+
+	/* Request item, conflating its updates. */
+	rsslClearRequestMsg(&requestMsg);
+	requestMsg.msgBase.streamId = 2;
+	requestMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+	requestMsg.flags = RSSL_RQMF_STREAMING;
+
+	rsslClearReactorSubmitMsgOptions(&opts);
+	opts.pRsslMsg = (RsslMsg*)&requestMsg;
+	opts.pServiceName = &service1Name;
+	opts.requestMsgOptions.conflateUpdates = RSSL_TRUE;
+	opts.requestMsgOptions.conflationInterval = conflationInterval;
+	wtfSubmitMsg(&opts, WTF_TC_CONSUMER, NULL, RSSL_TRUE);
+
+	/* Provider receives request. */
+	wtfDispatch(WTF_TC_PROVIDER, 100);
+	ASSERT_TRUE(pEvent = wtfGetEvent());
+	ASSERT_TRUE(pRequestMsg = (RsslRequestMsg*)wtfGetRsslMsg(pEvent));
+	ASSERT_TRUE(pRequestMsg->msgBase.msgClass == RSSL_MC_REQUEST);
+	providerItemStream = pRequestMsg->msgBase.streamId;
+
+	/* Provider sends refresh. */
+	rsslClearRefreshMsg(&refreshMsg);
+	refreshMsg.msgBase.streamId = providerItemStream;
+	refreshMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+	refreshMsg.msgBase.containerType = RSSL_DT_NO_DATA;
+	refreshMsg.flags = RSSL_RFMF_SOLICITED | RSSL_RFMF_REFRESH_COMPLETE;
+	refreshMsg.state.streamState = RSSL_STREAM_OPEN;
+	refreshMsg.state.dataState = RSSL_DATA_OK;
+
+	rsslClearReactorSubmitMsgOptions(&opts);
+	opts.pRsslMsg = (RsslMsg*)&refreshMsg;
+	wtfSubmitMsg(&opts, WTF_TC_PROVIDER, NULL, RSSL_TRUE);
+
+	/* Consumer receives refresh. */
+	wtfDispatch(WTF_TC_CONSUMER, 100);
+	ASSERT_TRUE(pEvent = wtfGetEvent());
+	ASSERT_TRUE(pRefreshMsg = (RsslRefreshMsg*)wtfGetRsslMsg(pEvent));
+	ASSERT_TRUE(pRefreshMsg->msgBase.msgClass == RSSL_MC_REFRESH);
+	ASSERT_TRUE(pRefreshMsg->msgBase.streamId == 2);
+
+	/* Provider sends three updates. */
+	rsslClearUpdateMsg(&updateMsg);
+	updateMsg.msgBase.streamId = providerItemStream;
+	updateMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+	updateMsg.msgBase.containerType = RSSL_DT_FIELD_LIST;
+	updateMsg.updateType = RDM_UPD_EVENT_TYPE_QUOTE;
+
+	dataBody.data = dataBodyBuf; dataBody.length = sizeof(dataBodyBuf);
+	encodeFieldIdList(&dataBody, update1List, 2, update1Values);
+	updateMsg.msgBase.encDataBody = dataBody;
+	rsslClearReactorSubmitMsgOptions(&opts);
+	opts.pRsslMsg = (RsslMsg*)&updateMsg;
+	wtfSubmitMsg(&opts, WTF_TC_PROVIDER, NULL, RSSL_TRUE);
+
+	dataBody.data = dataBodyBuf; dataBody.length = sizeof(dataBodyBuf);
+	encodeFieldIdList(&dataBody, update2List, 2, update2Values);
+	updateMsg.msgBase.encDataBody = dataBody;
+	wtfSubmitMsg(&opts, WTF_TC_PROVIDER, NULL, RSSL_TRUE);
+
+	dataBody.data = dataBodyBuf; dataBody.length = sizeof(dataBodyBuf);
+	encodeFieldIdList(&dataBody, update3List, 1, update3Values);
+	updateMsg.msgBase.encDataBody = dataBody;
+	updateMsg.updateType = RDM_UPD_EVENT_TYPE_TRADE;
+	wtfSubmitMsg(&opts, WTF_TC_PROVIDER, NULL, RSSL_TRUE);
+
+	/* Nothing is delivered before the interval. */
+	wtfDispatch(WTF_TC_CONSUMER, 100);
+	ASSERT_TRUE(!wtfGetEvent());
+
+	/* Consumer receives one update, with later fields replacing earlier ones. */
+	wtfDispatch(WTF_TC_CONSUMER, 2 * conflationInterval);
+	ASSERT_TRUE(pEvent = wtfGetEvent());
+	ASSERT_TRUE(pUpdateMsg = (RsslUpdateMsg*)wtfGetRsslMsg(pEvent));
+	ASSERT_TRUE(pUpdateMsg->msgBase.msgClass == RSSL_MC_UPDATE);
+	ASSERT_TRUE(pUpdateMsg->msgBase.streamId == 2);
+	ASSERT_TRUE(pUpdateMsg->updateType == RDM_UPD_EVENT_TYPE_TRADE);
+	ASSERT_TRUE(pUpdateMsg->flags & RSSL_UPMF_HAS_CONF_INFO);
+	ASSERT_TRUE(pUpdateMsg->conflationCount == 3);
+	checkFieldIdList((RsslMsg*)pUpdateMsg, conflatedList, 4, conflatedValues);
+
+	ASSERT_TRUE(!wtfGetEvent());
+
+	/* Provider sends an update, then a status. */
+	dataBody.data = dataBodyBuf; dataBody.length = sizeof(dataBodyBuf);
+	encodeFieldIdList(&dataBody, update4List, 1, update4Values);
+	updateMsg.msgBase.encDataBody = dataBody;
+	wtfSubmitMsg(&opts, WTF_TC_PROVIDER, NULL, RSSL_TRUE);
+
+	rsslClearStatusMsg(&statusMsg);
+	statusMsg.msgBase.streamId = providerItemStream;
+	statusMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+	statusMsg.msgBase.containerType = RSSL_DT_NO_DATA;
+	statusMsg.flags = RSSL_STMF_HAS_STATE;
+	statusMsg.state.streamState = RSSL_STREAM_OPEN;
+	statusMsg.state.dataState = RSSL_DATA_SUSPECT;
+
+	rsslClearReactorSubmitMsgOptions(&opts);
+	opts.pRsslMsg = (RsslMsg*)&statusMsg;
+	wtfSubmitMsg(&opts, WTF_TC_PROVIDER, NULL, RSSL_TRUE);
+
+	/* Consumer receives the pending update ahead of the status. */
+	wtfDispatch(WTF_TC_CONSUMER, 100);
+	ASSERT_TRUE(pEvent = wtfGetEvent());
+	ASSERT_TRUE(pUpdateMsg = (RsslUpdateMsg*)wtfGetRsslMsg(pEvent));
+	ASSERT_TRUE(pUpdateMsg->msgBase.msgClass == RSSL_MC_UPDATE);
+	ASSERT_TRUE(pUpdateMsg->msgBase.streamId == 2);
+	ASSERT_TRUE(!(pUpdateMsg->flags & RSSL_UPMF_HAS_CONF_INFO));
+	checkFieldIdList((RsslMsg*)pUpdateMsg, update4List, 1, update4Values);
+
+	ASSERT_TRUE(pEvent = wtfGetEvent());
+	ASSERT_TRUE(pStatusMsg = (RsslStatusMsg*)wtfGetRsslMsg(pEvent));
+	ASSERT_TRUE(pStatusMsg->msgBase.msgClass == RSSL_MC_STATUS);
+	ASSERT_TRUE(pStatusMsg->msgBase.streamId == 2);
+	ASSERT_TRUE(pStatusMsg->state.dataState == RSSL_DATA_SUSPECT);
+
+	ASSERT_TRUE(!wtfGetEvent());
+
+	/* Provider sends an update. */
+	rsslClearReactorSubmitMsgOptions(&opts);
+	opts.pRsslMsg = (RsslMsg*)&updateMsg;
+	wtfSubmitMsg(&opts, WTF_TC_PROVIDER, NULL, RSSL_TRUE);
+
+	wtfDispatch(WTF_TC_CONSUMER, 100);
+	ASSERT_TRUE(!wtfGetEvent());
+
+	/* Consumer reissues with a longer interval while the update is pending. */
+	rsslClearRequestMsg(&requestMsg);
+	requestMsg.msgBase.streamId = 2;
+	requestMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+	requestMsg.flags = RSSL_RQMF_STREAMING | RSSL_RQMF_NO_REFRESH;
+
+	rsslClearReactorSubmitMsgOptions(&opts);
+	opts.pRsslMsg = (RsslMsg*)&requestMsg;
+	opts.pServiceName = &service1Name;
+	opts.requestMsgOptions.conflateUpdates = RSSL_TRUE;
+	opts.requestMsgOptions.conflationInterval = 4 * conflationInterval;
+	wtfSubmitMsg(&opts, WTF_TC_CONSUMER, NULL, RSSL_TRUE);
+
+	wtfDispatch(WTF_TC_PROVIDER, 100);
+	while (wtfGetEvent());
+
+	/* The pending update is not delivered on the old interval. */
+	wtfDispatch(WTF_TC_CONSUMER, 2 * conflationInterval);
+	ASSERT_TRUE(!wtfGetEvent());
+
+	/* It is delivered on the new one. */
+	wtfDispatch(WTF_TC_CONSUMER, 3 * conflationInterval);
+	ASSERT_TRUE(pEvent = wtfGetEvent());
+	ASSERT_TRUE(pUpdateMsg = (RsslUpdateMsg*)wtfGetRsslMsg(pEvent));
+	ASSERT_TRUE(pUpdateMsg->msgBase.msgClass == RSSL_MC_UPDATE);
+	ASSERT_TRUE(pUpdateMsg->msgBase.streamId == 2);
+	checkFieldIdList((RsslMsg*)pUpdateMsg, update4List, 1, update4Values);
+
+	ASSERT_TRUE(!wtfGetEvent());
+
+	wtfFinishTest();
+}
+
 void watchlistAggregationTest_TwoItems_FieldViewFromMsgBuffer()
 {
 	RsslReactorSubmitMsgOptions opts;
@@ -5238,6 +5695,139 @@ void watchlistAggregationTest_ThreeItemsInMsgBuffer_Batch()
 
 }
 
+void watchlistAggregationTest_ThreeItems_OutboundBatch()
+{
+	/* Test that item requests waiting to be sent are combined into batch requests,
+	 * up to the batch size. */
+
+	RsslReactorSubmitMsgOptions opts;
+	WtfEvent		*pEvent;
+	RsslRequestMsg	requestMsg, *pRequestMsg;
+	RsslRefreshMsg	refreshMsg, *pRefreshMsg;
+	RsslStatusMsg	statusMsg;
+	RsslCloseMsg	closeMsg, *pCloseMsg;
+	RsslInt32		providerBatchStream, providerDjiStream;
+	RsslBuffer		itemList[] = {{5, const_cast<char*>("TRI.N")}, {5, const_cast<char*>("IBM.N")}, {4, const_cast<char*>(".DJI")}};
+	RsslUInt32		ui;
+	WtfSetupConnectionOpts sOpts;
+
+	ASSERT_TRUE(wtfStartTest());
+
+	wtfClearSetupConnectionOpts(&sOpts);
+	sOpts.requestBatchSize = 2;
+	wtfSetupConnection(&sOpts);
+
+	/* Request items, without dispatching in between. */
+	for (ui = 0; ui < 3; ++ui)
+	{
+		rsslClearRequestMsg(&requestMsg);
+		requestMsg.msgBase.streamId = 2 + ui;
+		requestMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+		requestMsg.msgBase.containerType = RSSL_DT_NO_DATA;
+		requestMsg.flags = RSSL_RQMF_STREAMING;
+		requestMsg.msgBase.msgKey.flags = RSSL_MKF_HAS_NAME;
+		requestMsg.msgBase.msgKey.name = itemList[ui];
+
+		rsslClearReactorSubmitMsgOptions(&opts);
+		opts.pRsslMsg = (RsslMsg*)&requestMsg;
+		opts.pServiceName = &service1Name;
+		wtfSubmitMsg(&opts, WTF_TC_CONSUMER, NULL, RSSL_FALSE);
+	}
+
+	wtfDispatch(WTF_TC_CONSUMER, 100);
+	ASSERT_TRUE(!wtfGetEvent());
+
+	/* Provider receives a batch request for the first two items. */
+	wtfDispatch(WTF_TC_PROVIDER, 100);
+	ASSERT_TRUE(pEvent = wtfGetEvent());
+	ASSERT_TRUE(pRequestMsg = (RsslRequestMsg*)wtfGetRsslMsg(pEvent));
+	ASSERT_TRUE(pRequestMsg->msgBase.msgClass == RSSL_MC_REQUEST);
+	ASSERT_TRUE(pRequestMsg->msgBase.domainType == RSSL_DMT_MARKET_PRICE);
+	ASSERT_TRUE(pRequestMsg->flags & RSSL_RQMF_STREAMING);
+	ASSERT_TRUE(!(pRequestMsg->flags & RSSL_RQMF_NO_REFRESH));
+	ASSERT_TRUE(pRequestMsg->msgBase.msgKey.flags & RSSL_MKF_HAS_SERVICE_ID);
+	ASSERT_TRUE(pRequestMsg->msgBase.msgKey.serviceId == service1Id);
+	wtfProviderTestBatch(pRequestMsg, itemList, 2);
+	providerBatchStream = pRequestMsg->msgBase.streamId;
+
+	/* Provider receives a request for the third. */
+	ASSERT_TRUE(pEvent = wtfGetEvent());
+	ASSERT_TRUE(pRequestMsg = (RsslRequestMsg*)wtfGetRsslMsg(pEvent));
+	ASSERT_TRUE(pRequestMsg->msgBase.msgClass == RSSL_MC_REQUEST);
+	ASSERT_TRUE(!(pRequestMsg->flags & RSSL_RQMF_HAS_BATCH));
+	ASSERT_TRUE(pRequestMsg->msgBase.msgKey.flags & RSSL_MKF_HAS_NAME);
+	ASSERT_TRUE(rsslBufferIsEqual(&pRequestMsg->msgBase.msgKey.name, &itemList[2]));
+	providerDjiStream = pRequestMsg->msgBase.streamId;
+	ASSERT_TRUE(providerDjiStream != providerBatchStream + 1);
+	ASSERT_TRUE(providerDjiStream != providerBatchStream + 2);
+
+	ASSERT_TRUE(!wtfGetEvent());
+
+	/* Provider closes the batch stream and refreshes the items, on the streams following it. */
+	rsslClearStatusMsg(&statusMsg);
+	statusMsg.msgBase.streamId = providerBatchStream;
+	statusMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+	statusMsg.msgBase.containerType = RSSL_DT_NO_DATA;
+	statusMsg.flags = RSSL_STMF_HAS_STATE;
+	statusMsg.state.streamState = RSSL_STREAM_CLOSED;
+	statusMsg.state.dataState = RSSL_DATA_OK;
+
+	rsslClearReactorSubmitMsgOptions(&opts);
+	opts.pRsslMsg = (RsslMsg*)&statusMsg;
+	wtfSubmitMsg(&opts, WTF_TC_PROVIDER, NULL, RSSL_TRUE);
+
+	for (ui = 0; ui < 3; ++ui)
+	{
+		rsslClearRefreshMsg(&refreshMsg);
+		refreshMsg.msgBase.streamId = (ui < 2) ? providerBatchStream + 1 + ui : providerDjiStream;
+		refreshMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+		refreshMsg.msgBase.containerType = RSSL_DT_NO_DATA;
+		refreshMsg.flags = RSSL_RFMF_SOLICITED | RSSL_RFMF_REFRESH_COMPLETE | RSSL_RFMF_CLEAR_CACHE;
+		refreshMsg.state.streamState = RSSL_STREAM_OPEN;
+		refreshMsg.state.dataState = RSSL_DATA_OK;
+
+		rsslClearReactorSubmitMsgOptions(&opts);
+		opts.pRsslMsg = (RsslMsg*)&refreshMsg;
+		wtfSubmitMsg(&opts, WTF_TC_PROVIDER, NULL, RSSL_TRUE);
+	}
+
+	/* Consumer receives each refresh on its own stream. */
+	wtfDispatch(WTF_TC_CONSUMER, 100);
+	for (ui = 0; ui < 3; ++ui)
+	{
+		ASSERT_TRUE(pEvent = wtfGetEvent());
+		ASSERT_TRUE(pRefreshMsg = (RsslRefreshMsg*)wtfGetRsslMsg(pEvent));
+		ASSERT_TRUE(pRefreshMsg->msgBase.msgClass == RSSL_MC_REFRESH);
+		ASSERT_TRUE(pRefreshMsg->msgBase.streamId == 2 + (RsslInt32)ui);
+		ASSERT_TRUE(pRefreshMsg->state.streamState == RSSL_STREAM_OPEN);
+		ASSERT_TRUE(pRefreshMsg->state.dataState == RSSL_DATA_OK);
+	}
+	ASSERT_TRUE(!wtfGetEvent());
+
+	/* Provider does not receive a close for the batch stream. */
+	wtfDispatch(WTF_TC_PROVIDER, 100);
+	ASSERT_TRUE(!wtfGetEvent());
+
+	/* Close second item. */
+	rsslClearCloseMsg(&closeMsg);
+	closeMsg.msgBase.streamId = 3;
+	closeMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+
+	rsslClearReactorSubmitMsgOptions(&opts);
+	opts.pRsslMsg = (RsslMsg*)&closeMsg;
+	wtfSubmitMsg(&opts, WTF_TC_CONSUMER, NULL, RSSL_TRUE);
+
+	/* Provider receives close on the item's stream in the batch. */
+	wtfDispatch(WTF_TC_PROVIDER, 100);
+	ASSERT_TRUE(pEvent = wtfGetEvent());
+	ASSERT_TRUE(pCloseMsg = (RsslCloseMsg*)wtfGetRsslMsg(pEvent));
+	ASSERT_TRUE(pCloseMsg->msgBase.msgClass == RSSL_MC_CLOSE);
+	ASSERT_TRUE(pCloseMsg->msgBase.streamId == providerBatchStream + 2);
+	ASSERT_TRUE(!wtfGetEvent());
+
+	wtfFinishTest();
+}
+
 void watchlistAggregationTest_ThreeItemsInMsgBuffer_BatchWithView()
 {
 	RsslReactorSubmitMsgOptions opts;
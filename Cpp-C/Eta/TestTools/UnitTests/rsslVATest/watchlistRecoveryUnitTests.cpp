@@ -16,6 +16,8 @@ void watchlistRecoveryTest_OneItem_RequestTimeout_Multipart();
 void watchlistRecoveryTest_OneItem_ClearCache();
 void watchlistRecoveryTest_OneItem_QosChange();
 void watchlistRecoveryTest_TwoItems_OpenWindow();
+void watchlistRecoveryTest_ThreeItems_PacedRequests();
+void watchlistRecoveryTest_ThreeItems_PacedBatch();
 void watchlistRecoveryTest_OneItem_ServiceNameChange();
 void watchlistRecoveryTest_OneItem_ClosedRecover_PrivateStream();
 void watchlistRecoveryTest_OneItem_ClosedRecover_SingleOpenOff();
@@ -125,6 +127,16 @@ TEST_F(WatchlistRecoveryTest, TwoItems_OpenWindow)
 	watchlistRecoveryTest_TwoItems_OpenWindow();
 }
 
+TEST_F(WatchlistRecoveryTest, ThreeItems_PacedRequests)
+{
+	watchlistRecoveryTest_ThreeItems_PacedRequests();
+}
+
+TEST_F(WatchlistRecoveryTest, ThreeItems_PacedBatch)
+{
+	watchlistRecoveryTest_ThreeItems_PacedBatch();
+}
+
 TEST_F(WatchlistRecoveryTest, OneItem_ServiceNameChange)
 {
 	watchlistRecoveryTest_OneItem_ServiceNameChange();
@@ -7814,3 +7826,158 @@ void watchlistRecoveryTest_OneItem_Disconnect(RsslBool singleOpen)
 
 	wtfFinishTest();
 }
+
+void watchlistRecoveryTest_ThreeItems_PacedRequests()
+{
+	/* Test that item requests are sent no faster than the item request rate,
+	 * with critical items first. */
+
+	WtfEvent		*pEvent;
+	RsslRequestMsg	requestMsg, *pRequestMsg;
+	RsslReactorSubmitMsgOptions opts;
+	WtfSetupConnectionOpts sOpts;
+	RsslReactorChannelRequestPacingStats stats;
+	RsslUInt32		i;
+
+	ASSERT_TRUE(wtfStartTest());
+
+	wtfClearSetupConnectionOpts(&sOpts);
+	sOpts.itemRequestRate = 1;
+	wtfSetupConnection(&sOpts);
+
+	/* Request three items; the last is critical. */
+	for (i = 0; i < 3; ++i)
+	{
+		rsslClearRequestMsg(&requestMsg);
+		requestMsg.msgBase.streamId = 2 + i;
+		requestMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+		requestMsg.msgBase.containerType = RSSL_DT_NO_DATA;
+		requestMsg.flags = RSSL_RQMF_STREAMING;
+		requestMsg.msgBase.msgKey.flags |= RSSL_MKF_HAS_IDENTIFIER;
+		requestMsg.msgBase.msgKey.identifier = 5 + i;
+
+		rsslClearReactorSubmitMsgOptions(&opts);
+		opts.pRsslMsg = (RsslMsg*)&requestMsg;
+		opts.pServiceName = &service1Name;
+		opts.requestMsgOptions.critical = (i == 2);
+		wtfSubmitMsg(&opts, WTF_TC_CONSUMER, NULL, RSSL_TRUE);
+	}
+
+	/* Provider receives first request (there was credit for one). */
+	wtfDispatch(WTF_TC_PROVIDER, 100);
+	ASSERT_TRUE(pEvent = wtfGetEvent());
+	ASSERT_TRUE(pRequestMsg = (RsslRequestMsg*)wtfGetRsslMsg(pEvent));
+	ASSERT_TRUE(pRequestMsg->msgBase.msgClass == RSSL_MC_REQUEST);
+	ASSERT_TRUE(pRequestMsg->msgBase.msgKey.identifier == 5);
+	ASSERT_TRUE(!wtfGetEvent());
+
+	rsslClearReactorChannelRequestPacingStats(&stats);
+	ASSERT_TRUE(wtfGetRequestPacingStats(&stats) == RSSL_RET_SUCCESS);
+	ASSERT_TRUE(stats.itemRequestRate == 1);
+	ASSERT_TRUE(stats.pendingRequests == 2);
+	ASSERT_TRUE(stats.pendingCriticalRequests == 1);
+	ASSERT_TRUE(stats.pacedRequestsSent == 1);
+	ASSERT_TRUE(stats.estimatedTimeRemaining > 1000 && stats.estimatedTimeRemaining <= 2000);
+
+	/* After a second, the critical item is requested ahead of the second item. */
+	wtfDispatch(WTF_TC_CONSUMER, 1200);
+	ASSERT_TRUE(!wtfGetEvent());
+
+	wtfDispatch(WTF_TC_PROVIDER, 100);
+	ASSERT_TRUE(pEvent = wtfGetEvent());
+	ASSERT_TRUE(pRequestMsg = (RsslRequestMsg*)wtfGetRsslMsg(pEvent));
+	ASSERT_TRUE(pRequestMsg->msgBase.msgClass == RSSL_MC_REQUEST);
+	ASSERT_TRUE(pRequestMsg->msgBase.msgKey.identifier == 7);
+	ASSERT_TRUE(!wtfGetEvent());
+
+	/* Then the second item. */
+	wtfDispatch(WTF_TC_CONSUMER, 1200);
+	ASSERT_TRUE(!wtfGetEvent());
+
+	wtfDispatch(WTF_TC_PROVIDER, 100);
+	ASSERT_TRUE(pEvent = wtfGetEvent());
+	ASSERT_TRUE(pRequestMsg = (RsslRequestMsg*)wtfGetRsslMsg(pEvent));
+	ASSERT_TRUE(pRequestMsg->msgBase.msgClass == RSSL_MC_REQUEST);
+	ASSERT_TRUE(pRequestMsg->msgBase.msgKey.identifier == 6);
+	ASSERT_TRUE(!wtfGetEvent());
+
+	ASSERT_TRUE(wtfGetRequestPacingStats(&stats) == RSSL_RET_SUCCESS);
+	ASSERT_TRUE(stats.pendingRequests == 0);
+	ASSERT_TRUE(stats.pendingCriticalRequests == 0);
+	ASSERT_TRUE(stats.pacedRequestsSent == 3);
+	ASSERT_TRUE(stats.estimatedTimeRemaining == 0);
+
+	wtfFinishTest();
+}
+
+void watchlistRecoveryTest_ThreeItems_PacedBatch()
+{
+	/* Test that item requests waiting for the item request rate are combined into
+	 * batch requests, each item taking one request's credit. */
+
+	WtfEvent		*pEvent;
+	RsslRequestMsg	requestMsg, *pRequestMsg;
+	RsslReactorSubmitMsgOptions opts;
+	WtfSetupConnectionOpts sOpts;
+	RsslReactorChannelRequestPacingStats stats;
+	RsslBuffer		itemList[] = {{5, const_cast<char*>("TRI.N")}, {5, const_cast<char*>("IBM.N")}, {4, const_cast<char*>(".DJI")}};
+	RsslUInt32		ui;
+
+	ASSERT_TRUE(wtfStartTest());
+
+	wtfClearSetupConnectionOpts(&sOpts);
+	sOpts.itemRequestRate = 2;
+	sOpts.requestBatchSize = 5;
+	wtfSetupConnection(&sOpts);
+
+	/* Request items, without dispatching in between. */
+	for (ui = 0; ui < 3; ++ui)
+	{
+		rsslClearRequestMsg(&requestMsg);
+		requestMsg.msgBase.streamId = 2 + ui;
+		requestMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+		requestMsg.msgBase.containerType = RSSL_DT_NO_DATA;
+		requestMsg.flags = RSSL_RQMF_STREAMING;
+		requestMsg.msgBase.msgKey.flags = RSSL_MKF_HAS_NAME;
+		requestMsg.msgBase.msgKey.name = itemList[ui];
+
+		rsslClearReactorSubmitMsgOptions(&opts);
+		opts.pRsslMsg = (RsslMsg*)&requestMsg;
+		opts.pServiceName = &service1Name;
+		wtfSubmitMsg(&opts, WTF_TC_CONSUMER, NULL, RSSL_FALSE);
+	}
+
+	wtfDispatch(WTF_TC_CONSUMER, 100);
+	ASSERT_TRUE(!wtfGetEvent());
+
+	/* Provider receives a batch request for the first two items (there was credit for two). */
+	wtfDispatch(WTF_TC_PROVIDER, 100);
+	ASSERT_TRUE(pEvent = wtfGetEvent());
+	ASSERT_TRUE(pRequestMsg = (RsslRequestMsg*)wtfGetRsslMsg(pEvent));
+	ASSERT_TRUE(pRequestMsg->msgBase.msgClass == RSSL_MC_REQUEST);
+	wtfProviderTestBatch(pRequestMsg, itemList, 2);
+	ASSERT_TRUE(!wtfGetEvent());
+
+	rsslClearReactorChannelRequestPacingStats(&stats);
+	ASSERT_TRUE(wtfGetRequestPacingStats(&stats) == RSSL_RET_SUCCESS);
+	ASSERT_TRUE(stats.pendingRequests == 1);
+	ASSERT_TRUE(stats.pacedRequestsSent == 2);
+
+	/* The third item is requested when there is credit again. */
+	wtfDispatch(WTF_TC_CONSUMER, 700);
+	ASSERT_TRUE(!wtfGetEvent());
+
+	wtfDispatch(WTF_TC_PROVIDER, 100);
+	ASSERT_TRUE(pEvent = wtfGetEvent());
+	ASSERT_TRUE(pRequestMsg = (RsslRequestMsg*)wtfGetRsslMsg(pEvent));
+	ASSERT_TRUE(pRequestMsg->msgBase.msgClass == RSSL_MC_REQUEST);
+	ASSERT_TRUE(!(pRequestMsg->flags & RSSL_RQMF_HAS_BATCH));
+	ASSERT_TRUE(rsslBufferIsEqual(&pRequestMsg->msgBase.msgKey.name, &itemList[2]));
+	ASSERT_TRUE(!wtfGetEvent());
+
+	ASSERT_TRUE(wtfGetRequestPacingStats(&stats) == RSSL_RET_SUCCESS);
+	ASSERT_TRUE(stats.pendingRequests == 0);
+	ASSERT_TRUE(stats.pacedRequestsSent == 3);
+
+	wtfFinishTest();
+}
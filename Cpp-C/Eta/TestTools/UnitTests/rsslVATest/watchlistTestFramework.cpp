@@ -1024,6 +1024,8 @@ void wtfInitDefaultLoginRefresh(RsslRDMLoginRefresh *pLoginRefresh)
 	pLoginRefresh->supportOptimizedPauseResume = 1;
 	pLoginRefresh->flags |= RDM_LG_RFF_HAS_SUPPORT_VIEW;
 	pLoginRefresh->supportViewRequests = 1;
+	pLoginRefresh->flags |= RDM_LG_RFF_HAS_SUPPORT_BATCH;
+	pLoginRefresh->supportBatchRequests = RDM_LOGIN_BATCH_SUPPORT_REQUESTS;
 }
 
 void wtfInitDefaultDirectoryRefresh(RsslRDMDirectoryRefresh *pDirectoryRefresh,
@@ -1085,13 +1087,18 @@ void wtfSetupConnection(WtfSetupConnectionOpts *pOpts)
 	wtf.ommConsumerRole.watchlistOptions.channelOpenCallback = channelEventCallback;
 	wtf.ommConsumerRole.watchlistOptions.requestTimeout = pOpts->requestTimeout;
 	wtf.ommConsumerRole.watchlistOptions.postAckTimeout = pOpts->postAckTimeout;
+	wtf.ommConsumerRole.watchlistOptions.filterFanoutByView = pOpts->filterFanoutByView;
+	wtf.ommConsumerRole.watchlistOptions.itemRequestRate = pOpts->itemRequestRate;
+	wtf.ommConsumerRole.watchlistOptions.requestBatchSize = pOpts->requestBatchSize;
 
 	/* wtfDispatch() multiplies times less than 1 second. So set
-	 * requestTimeout/postAckTimeout accordingly. */
+	 * requestTimeout/postAckTimeout/itemRequestRate accordingly. */
 	wtf.ommConsumerRole.watchlistOptions.requestTimeout = 
 		(RsslUInt32)((float)wtf.ommConsumerRole.watchlistOptions.requestTimeout / wtfGlobalConfig.speed);
 	wtf.ommConsumerRole.watchlistOptions.postAckTimeout = 
 		(RsslUInt32)((float)wtf.ommConsumerRole.watchlistOptions.postAckTimeout / wtfGlobalConfig.speed);
+	wtf.ommConsumerRole.watchlistOptions.itemRequestRate = 
+		(RsslUInt32)((float)wtf.ommConsumerRole.watchlistOptions.itemRequestRate * wtfGlobalConfig.speed);
 
 
 	wtfConnect(pOpts);
@@ -1385,6 +1392,57 @@ void wtfProviderTestView(RsslRequestMsg *pRequestMsg, void *elemList,
 	ASSERT_TRUE(foundView);
 }
 
+void wtfProviderTestBatch(RsslRequestMsg *pRequestMsg, RsslBuffer *itemList, RsslUInt32 itemCount)
+{
+	RsslDecodeIterator dIter;
+	RsslElementList elementList;
+	RsslElementEntry elementEntry;
+	RsslArray rsslArray;
+	RsslBuffer arrayEntry;
+	RsslUInt32 itemPos = 0;
+	RsslRet ret;
+	RsslBool foundBatch = RSSL_FALSE;
+
+	ASSERT_TRUE(pRequestMsg->flags & RSSL_RQMF_HAS_BATCH);
+	ASSERT_TRUE(!(pRequestMsg->msgBase.msgKey.flags & RSSL_MKF_HAS_NAME));
+	ASSERT_TRUE(pRequestMsg->msgBase.containerType == RSSL_DT_ELEMENT_LIST);
+
+	rsslClearDecodeIterator(&dIter);
+	rsslSetDecodeIteratorRWFVersion(&dIter, wtf.pProvReactorChannel->majorVersion,
+			wtf.pProvReactorChannel->minorVersion);
+
+	rsslSetDecodeIteratorBuffer(&dIter, &pRequestMsg->msgBase.encDataBody);
+
+	ASSERT_TRUE((ret = rsslDecodeElementList(&dIter, &elementList, NULL)) == RSSL_RET_SUCCESS);
+
+	while((ret = rsslDecodeElementEntry(&dIter, &elementEntry)) !=
+			RSSL_RET_END_OF_CONTAINER)
+	{
+		ASSERT_TRUE(ret == RSSL_RET_SUCCESS);
+
+		if (!rsslBufferIsEqual(&elementEntry.name, &RSSL_ENAME_BATCH_ITEM_LIST))
+			continue;
+
+		ASSERT_TRUE(!foundBatch);
+		ASSERT_TRUE(elementEntry.dataType == RSSL_DT_ARRAY);
+		ASSERT_TRUE((ret = rsslDecodeArray(&dIter, &rsslArray)) == RSSL_RET_SUCCESS);
+		ASSERT_TRUE(rsslArray.primitiveType == RSSL_DT_ASCII_STRING);
+
+		while ((ret = rsslDecodeArrayEntry(&dIter, &arrayEntry)) != RSSL_RET_END_OF_CONTAINER)
+		{
+			ASSERT_TRUE(ret == RSSL_RET_SUCCESS);
+			ASSERT_TRUE(itemPos < itemCount);
+			ASSERT_TRUE(rsslBufferIsEqual(&arrayEntry, &itemList[itemPos]));
+			++itemPos;
+		}
+
+		foundBatch = RSSL_TRUE;
+	}
+
+	ASSERT_TRUE(foundBatch);
+	ASSERT_TRUE(itemPos == itemCount);
+}
+
 
 
 void wtfProviderEncodeSymbolListDataBody(RsslBuffer *pBuffer, WtfSymbolAction *symbolList, 
@@ -1578,6 +1636,14 @@ RsslRet wtfGetChannelInfo(WtfComponent component, RsslReactorChannelInfo *pChann
 	return rsslReactorGetChannelInfo(pReactorChannel, pChannelInfo, &rsslErrorInfo);
 }
 
+RsslRet wtfGetRequestPacingStats(RsslReactorChannelRequestPacingStats *pStats)
+{
+	RsslErrorInfo rsslErrorInfo;
+
+	return rsslReactorGetChannelRequestPacingStats(wtf.pConsReactor, wtf.pConsReactorChannel, 
+			pStats, &rsslErrorInfo);
+}
+
 static void wtfConsumerEncodeSLBehaviorsElement(RsslEncodeIterator *pIter, RsslUInt slDataStreamFlags)
 {
 	RsslElementList behaviorsEList;
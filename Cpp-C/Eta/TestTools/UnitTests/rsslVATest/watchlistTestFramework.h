@@ -301,6 +301,9 @@ typedef struct
 	RsslUInt32	requestTimeout;					/* Sets watchlist request timeout. */
 	RsslBool	multicastGapRecovery;			/* Provider's login response indicates
 												 * whether watchlist should recover from gaps. */
+	RsslBool	filterFanoutByView;				/* Enables filtering of fanout to field ID views. */
+	RsslUInt32	itemRequestRate;				/* Sets watchlist item request rate. */
+	RsslUInt32	requestBatchSize;				/* Sets watchlist outbound request batch size. */
 } WtfSetupConnectionOpts;
 
 /* Initializes commonly used settings of WtfSetupConnectionOpts. */
@@ -322,6 +325,9 @@ static void wtfClearSetupConnectionOpts(WtfSetupConnectionOpts *pOpts)
 	pOpts->postAckTimeout = 15000;
 	pOpts->requestTimeout = 15000;
 	pOpts->multicastGapRecovery = RSSL_TRUE;
+	pOpts->filterFanoutByView = RSSL_FALSE;
+	pOpts->itemRequestRate = 0;
+	pOpts->requestBatchSize = 0;
 }
 
 /*** Connections ***/
@@ -340,6 +346,10 @@ void wtfAcceptWithTime(time_t timeoutMsec);
 /* Gets channel information (wraps around rsslReactorGetChannelInfo). */
 RsslRet wtfGetChannelInfo(WtfComponent component, RsslReactorChannelInfo *pChannelInfo);
 
+/* Gets the consumer's item request pacing statistics (wraps around 
+ * rsslReactorGetChannelRequestPacingStats). */
+RsslRet wtfGetRequestPacingStats(RsslReactorChannelRequestPacingStats *pStats);
+
 /* Returns the currently-used connection type for the test. */
 RsslConnectionTypes wtfGetConnectionType();
 
@@ -399,6 +409,11 @@ extern RsslUInt16	service1Id;
 void wtfProviderTestView(RsslRequestMsg *pRequestMsg, void *elemList, 
 		RsslUInt32 elemCount, RsslUInt viewType);
 
+/*** Batches ***/
+
+/* Decodes a batch request payload and tests it against the expected list of item names. */
+void wtfProviderTestBatch(RsslRequestMsg *pRequestMsg, RsslBuffer *itemList, RsslUInt32 itemCount);
+
 /* Returns a dictionary object populated by RDMFieldDictionary and enumtype.def. */
 RsslDataDictionary *wtfGetDictionary();
 
@@ -0,0 +1,262 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright Thomson Reuters 2018. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+/* Tests for the timing wheel used by the watchlist's timers. */
+
+#include "rtr/wlTimerWheel.h"
+#include "gtest/gtest.h"
+#include "getTime.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+typedef struct
+{
+	WlTimer		timer;
+	bool		cancelled;
+	bool		expired;
+} TimerTestElement;
+
+static void timerWheelTest_ExpireInOrder();
+static void timerWheelTest_RearmAndCancel();
+static void timerWheelTest_Performance();
+
+TEST(TimerWheelTest, ExpireInOrder)
+{
+	timerWheelTest_ExpireInOrder();
+}
+
+TEST(TimerWheelTest, RearmAndCancel)
+{
+	timerWheelTest_RearmAndCancel();
+}
+
+/* Arms, cancels and expires 1M timers.
+ * Run with --gtest_also_run_disabled_tests --gtest_filter=*TimerWheelTest*Performance*. */
+TEST(TimerWheelTest, DISABLED_Performance)
+{
+	timerWheelTest_Performance();
+}
+
+/* Returns a (nonzero) timeout that exercises each level of the wheel. */
+static RsslInt64 timerTestGetTimeout(RsslUInt32 i)
+{
+	switch(i % 4)
+	{
+		case 0: return 1 + rand() % 255;
+		case 1: return rand() % 65536;
+		case 2: return rand() % 16777216;
+		default: return ((RsslInt64)rand() * 4096 + rand() % 4096) % 8000000000LL;
+	}
+}
+
+static void timerWheelTest_ExpireInOrder()
+{
+	const RsslUInt32 timerCount = 5000;
+	std::vector<TimerTestElement> elements(timerCount);
+	WlTimerWheel *pWheel = (WlTimerWheel*)malloc(sizeof(WlTimerWheel));
+	RsslInt64 currentTime = 1000000, lastTime, nextExpireTime, lastExpireTime;
+	RsslUInt32 i, armedCount = 0, expiredCount = 0;
+	WlTimer *pTimer;
+
+	ASSERT_TRUE(pWheel != NULL);
+	wlTimerWheelInit(pWheel, currentTime);
+	ASSERT_EQ(WL_TIME_UNSET, wlTimerWheelGetNextExpireTime(pWheel));
+
+	srand(0);
+	for (i = 0; i < timerCount; ++i)
+	{
+		wlTimerInit(&elements[i].timer, 0);
+		elements[i].cancelled = false;
+		elements[i].expired = false;
+		wlTimerWheelArm(pWheel, &elements[i].timer, currentTime, timerTestGetTimeout(i));
+		ASSERT_TRUE(wlTimerIsArmed(&elements[i].timer));
+		++armedCount;
+
+		/* Move time along while arming. */
+		if (i % 100 == 99)
+		{
+			currentTime += rand() % 50;
+			while ((pTimer = wlTimerWheelPopExpired(pWheel, currentTime)))
+			{
+				TimerTestElement *pElement = (TimerTestElement*)pTimer;
+				ASSERT_FALSE(pElement->expired);
+				ASSERT_LE(pTimer->expireTime, currentTime);
+				pElement->expired = true;
+				++expiredCount;
+			}
+		}
+	}
+
+	/* Cancel every third timer. */
+	for (i = 0; i < timerCount; i += 3)
+	{
+		if (elements[i].expired)
+			continue;
+
+		wlTimerWheelCancel(pWheel, &elements[i].timer);
+		ASSERT_FALSE(wlTimerIsArmed(&elements[i].timer));
+		elements[i].cancelled = true;
+		--armedCount;
+	}
+
+	ASSERT_EQ(armedCount - expiredCount, wlTimerWheelGetCount(pWheel));
+
+	/* Expire the rest, jumping to the next time the wheel needs service. Each timer should
+	 * expire no earlier than its expiration time, in order, and no later than the first
+	 * service time at or after its expiration. */
+	lastTime = currentTime;
+	lastExpireTime = 0;
+	while (wlTimerWheelGetCount(pWheel))
+	{
+		RsslInt64 minExpireTime = WL_TIME_UNSET;
+
+		for (i = 0; i < timerCount; ++i)
+		{
+			if (wlTimerIsArmed(&elements[i].timer) && elements[i].timer.expireTime < minExpireTime)
+				minExpireTime = elements[i].timer.expireTime;
+		}
+
+		nextExpireTime = wlTimerWheelGetNextExpireTime(pWheel);
+		ASSERT_LE(nextExpireTime, minExpireTime);
+
+		currentTime = (nextExpireTime > lastTime) ? nextExpireTime : lastTime + 1;
+		while ((pTimer = wlTimerWheelPopExpired(pWheel, currentTime)))
+		{
+			TimerTestElement *pElement = (TimerTestElement*)pTimer;
+			ASSERT_FALSE(pElement->cancelled);
+			ASSERT_FALSE(pElement->expired);
+			ASSERT_LE(pTimer->expireTime, currentTime);
+			ASSERT_GT(pTimer->expireTime, lastTime);
+			ASSERT_GE(pTimer->expireTime, lastExpireTime);
+			lastExpireTime = pTimer->expireTime;
+			pElement->expired = true;
+			++expiredCount;
+		}
+
+		lastTime = currentTime;
+	}
+
+	ASSERT_EQ(armedCount, expiredCount);
+	ASSERT_EQ(WL_TIME_UNSET, wlTimerWheelGetNextExpireTime(pWheel));
+
+	for (i = 0; i < timerCount; ++i)
+		ASSERT_TRUE(elements[i].cancelled != elements[i].expired);
+
+	free(pWheel);
+}
+
+static void timerWheelTest_RearmAndCancel()
+{
+	WlTimerWheel *pWheel = (WlTimerWheel*)malloc(sizeof(WlTimerWheel));
+	TimerTestElement element1, element2;
+
+	ASSERT_TRUE(pWheel != NULL);
+	wlTimerWheelInit(pWheel, 0);
+	wlTimerInit(&element1.timer, 1);
+	wlTimerInit(&element2.timer, 2);
+
+	/* An empty wheel is brought to the time of the first timer. */
+	wlTimerWheelArm(pWheel, &element1.timer, 5000000, 1000);
+	ASSERT_EQ(5001000, element1.timer.expireTime);
+	ASSERT_EQ(1, wlTimerWheelGetCount(pWheel));
+	ASSERT_LE(wlTimerWheelGetNextExpireTime(pWheel), 5001000);
+	ASSERT_GT(wlTimerWheelGetNextExpireTime(pWheel), 5000000);
+
+	/* Re-arming moves the timer. */
+	wlTimerWheelArm(pWheel, &element1.timer, 5000100, 10);
+	ASSERT_EQ(1, wlTimerWheelGetCount(pWheel));
+	ASSERT_EQ(5000110, wlTimerWheelGetNextExpireTime(pWheel));
+
+	wlTimerWheelArm(pWheel, &element2.timer, 5000100, 5);
+	ASSERT_EQ(2, wlTimerWheelGetCount(pWheel));
+	ASSERT_EQ(5000105, wlTimerWheelGetNextExpireTime(pWheel));
+
+	ASSERT_EQ(NULL, wlTimerWheelPopExpired(pWheel, 5000104));
+	ASSERT_EQ(&element2.timer, wlTimerWheelPopExpired(pWheel, 5000110));
+	ASSERT_FALSE(wlTimerIsArmed(&element2.timer));
+
+	/* A timer can be cancelled after it has expired but before it is retrieved. */
+	wlTimerWheelCancel(pWheel, &element1.timer);
+	ASSERT_FALSE(wlTimerIsArmed(&element1.timer));
+	ASSERT_EQ(0, wlTimerWheelGetCount(pWheel));
+	ASSERT_EQ(NULL, wlTimerWheelPopExpired(pWheel, 5000110));
+
+	/* Cancelling a timer that is not armed does nothing. */
+	wlTimerWheelCancel(pWheel, &element1.timer);
+	ASSERT_EQ(0, wlTimerWheelGetCount(pWheel));
+
+	/* A timer armed in the past expires on the next turn of the wheel. */
+	wlTimerWheelArm(pWheel, &element1.timer, 5000110, 0);
+	wlTimerWheelArm(pWheel, &element2.timer, 4000000, 0);
+	ASSERT_EQ(5000110, wlTimerWheelGetNextExpireTime(pWheel));
+	ASSERT_EQ(&element1.timer, wlTimerWheelPopExpired(pWheel, 5000110));
+	ASSERT_EQ(&element2.timer, wlTimerWheelPopExpired(pWheel, 5000110));
+	ASSERT_EQ(NULL, wlTimerWheelPopExpired(pWheel, 5000110));
+
+	free(pWheel);
+}
+
+static void timerWheelTest_Performance()
+{
+	const RsslUInt32 timerCount = 1000000;
+	const RsslInt64 requestTimeout = 15000;
+	std::vector<TimerTestElement> elements(timerCount);
+	WlTimerWheel *pWheel = (WlTimerWheel*)malloc(sizeof(WlTimerWheel));
+	RsslInt64 currentTime = 1000000;
+	RsslUInt32 i, expiredCount = 0;
+	WlTimer *pTimer;
+	TimeValue startTime;
+
+	ASSERT_TRUE(pWheel != NULL);
+	wlTimerWheelInit(pWheel, currentTime);
+
+	for (i = 0; i < timerCount; ++i)
+		wlTimerInit(&elements[i].timer, 0);
+
+	/* Arm request timeouts as a large recovery would, about 1000 per millisecond. */
+	startTime = getTimeNano();
+	for (i = 0; i < timerCount; ++i)
+		wlTimerWheelArm(pWheel, &elements[i].timer, currentTime + i / 1000, requestTimeout);
+	printf("arm: %.1f ns/timer\n", (double)(getTimeNano() - startTime) / timerCount);
+
+	/* Most requests are answered before they time out. */
+	startTime = getTimeNano();
+	for (i = 0; i < timerCount; ++i)
+	{
+		if (i % 10)
+			wlTimerWheelCancel(pWheel, &elements[i].timer);
+	}
+	printf("cancel: %.1f ns/timer\n", (double)(getTimeNano() - startTime) / (timerCount - timerCount / 10));
+
+	/* Re-arm the cancelled timers with different timeouts. */
+	startTime = getTimeNano();
+	for (i = 0; i < timerCount; ++i)
+	{
+		if (i % 10)
+			wlTimerWheelArm(pWheel, &elements[i].timer, currentTime + 1000, i % 60000);
+	}
+	printf("re-arm: %.1f ns/timer\n", (double)(getTimeNano() - startTime) / (timerCount - timerCount / 10));
+
+	/* Expire everything, servicing the wheel whenever it asks. */
+	startTime = getTimeNano();
+	while (wlTimerWheelGetCount(pWheel))
+	{
+		RsslInt64 nextExpireTime = wlTimerWheelGetNextExpireTime(pWheel);
+		if (nextExpireTime > currentTime)
+			currentTime = nextExpireTime;
+
+		while ((pTimer = wlTimerWheelPopExpired(pWheel, currentTime)))
+			++expiredCount;
+	}
+	printf("expire: %.1f ns/timer\n", (double)(getTimeNano() - startTime) / timerCount);
+	ASSERT_EQ(timerCount, expiredCount);
+
+	free(pWheel);
+}